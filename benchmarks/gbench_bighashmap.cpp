@@ -1,5 +1,6 @@
 #include "benchmark/benchmark.h"
 #include <nctl/HashMap.h>
+#include <nctl/SwissHashMap.h>
 #define TEST_WITH_NCTL
 #include "test_movable.h"
 
@@ -10,6 +11,7 @@ using SaxHashMap = nctl::HashMap<unsigned int, Movable, nctl::SaxHashFunc<unsign
 using JenkinsHashMap = nctl::HashMap<unsigned int, Movable, nctl::JenkinsHashFunc<unsigned int>>;
 using FNV1aHashMap = nctl::HashMap<unsigned int, Movable, nctl::FNV1aHashFunc<unsigned int>>;
 using HashMapTestType = FNV1aHashMap;
+using SwissHashMapTestType = nctl::SwissHashMap<unsigned int, Movable, nctl::FNV1aHashFunc<unsigned int>>;
 
 static void BM_BigHashMapCopy(benchmark::State &state)
 {
@@ -148,4 +150,61 @@ static void BM_BigHashMapEmplace(benchmark::State &state)
 }
 BENCHMARK(BM_BigHashMapEmplace)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
 
+static void BM_BigSwissHashMapInsert(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType map(Capacity);
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < state.range(0); i++)
+		{
+			Movable movable(Movable::Construction::INITIALIZED);
+			map.insert(i, movable);
+		}
+
+		state.PauseTiming();
+		map.clear();
+		state.ResumeTiming();
+	}
+}
+BENCHMARK(BM_BigSwissHashMapInsert)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_BigSwissHashMapMoveInsert(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType map(Capacity);
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < state.range(0); i++)
+		{
+			Movable movable(Movable::Construction::INITIALIZED);
+			map.insert(i, nctl::move(movable));
+		}
+
+		state.PauseTiming();
+		map.clear();
+		state.ResumeTiming();
+	}
+}
+BENCHMARK(BM_BigSwissHashMapMoveInsert)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_BigSwissHashMapEmplace(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType map(Capacity);
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < state.range(0); i++)
+			map.emplace(i, Movable::Construction::INITIALIZED);
+
+		state.PauseTiming();
+		map.clear();
+		state.ResumeTiming();
+	}
+}
+BENCHMARK(BM_BigSwissHashMapEmplace)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
 BENCHMARK_MAIN();
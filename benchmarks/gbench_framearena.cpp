@@ -0,0 +1,41 @@
+#include "benchmark/benchmark.h"
+#include <cstdlib>
+#include <ncine/FrameArena.h>
+
+namespace nc = ncine;
+const unsigned int NumAllocations = 1024;
+const unsigned int MaxBlockSize = 256;
+
+static void BM_MallocFree(benchmark::State &state)
+{
+	void *blocks[NumAllocations];
+	const unsigned int numAllocations = static_cast<unsigned int>(state.range(0));
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < numAllocations; i++)
+		{
+			blocks[i] = malloc(1 + (i * 13) % MaxBlockSize);
+			benchmark::DoNotOptimize(blocks[i]);
+		}
+		for (unsigned int i = 0; i < numAllocations; i++)
+			free(blocks[i]);
+	}
+}
+BENCHMARK(BM_MallocFree)->Arg(NumAllocations);
+
+static void BM_FrameArenaAllocate(benchmark::State &state)
+{
+	nc::FrameArena arena(NumAllocations * (MaxBlockSize + nctl::IAllocator::DefaultAlignment));
+	const unsigned int numAllocations = static_cast<unsigned int>(state.range(0));
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < numAllocations; i++)
+			benchmark::DoNotOptimize(arena.allocate(1 + (i * 13) % MaxBlockSize));
+		arena.swap();
+	}
+}
+BENCHMARK(BM_FrameArenaAllocate)->Arg(NumAllocations);
+
+BENCHMARK_MAIN();
@@ -1,5 +1,7 @@
 #include "benchmark/benchmark.h"
 #include <nctl/HashMap.h>
+#include <nctl/SwissHashMap.h>
+#include <nctl/String.h>
 
 const unsigned int Capacity = 1024;
 const int KeyValueDifference = 10;
@@ -8,6 +10,19 @@ using SaxHashMap = nctl::HashMap<unsigned int, unsigned int, nctl::SaxHashFunc<u
 using JenkinsHashMap = nctl::HashMap<unsigned int, unsigned int, nctl::JenkinsHashFunc<unsigned int>>;
 using FNV1aHashMap = nctl::HashMap<unsigned int, unsigned int, nctl::FNV1aHashFunc<unsigned int>>;
 using HashMapTestType = FNV1aHashMap;
+using SwissHashMapTestType = nctl::SwissHashMap<unsigned int, unsigned int, nctl::FNV1aHashFunc<unsigned int>>;
+using FNV1aStringHashMap = nctl::HashMap<nctl::String, unsigned int, nctl::FNV1aFuncHashContainer<nctl::String>>;
+using WordStringHashMap = nctl::HashMap<nctl::String, unsigned int, nctl::WordHashFuncContainer<nctl::String>>;
+using CachedStringHashMap = nctl::StringHashMap<unsigned int>;
+
+static void initPaths(nctl::String *paths, unsigned int numPaths)
+{
+	for (unsigned int i = 0; i < numPaths; i++)
+	{
+		paths[i] = nctl::String(64);
+		paths[i].format("data/textures/level_%02u/sprites/sprite_%04u.png", i % 16, i);
+	}
+}
 
 static void BM_HashMapCreation(benchmark::State &state)
 {
@@ -73,6 +88,22 @@ static void BM_HashMapRetrieve(benchmark::State &state)
 }
 BENCHMARK(BM_HashMapRetrieve)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
 
+static void BM_HashMapFindMissing(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	HashMapTestType map(Capacity);
+	for (unsigned int i = 0; i < state.range(0); i++)
+		map[i] = i * 2;
+
+	unsigned int key = 0;
+	for (auto _ : state)
+	{
+		key = (key + 19) % state.range(0);
+		benchmark::DoNotOptimize(map.find(key + Capacity));
+	}
+}
+BENCHMARK(BM_HashMapFindMissing)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
 static void BM_HashMapClear(benchmark::State &state)
 {
 	state.counters["Capacity"] = Capacity;
@@ -147,4 +178,108 @@ static void BM_HashMapRehashDoubleCapacity(benchmark::State &state)
 }
 BENCHMARK(BM_HashMapRehashDoubleCapacity)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
 
+static void BM_SwissHashMapInsert(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType map(Capacity);
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < state.range(0); i++)
+			benchmark::DoNotOptimize(map[i] = i + KeyValueDifference);
+
+		state.PauseTiming();
+		map.clear();
+		state.ResumeTiming();
+	}
+}
+BENCHMARK(BM_SwissHashMapInsert)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_SwissHashMapRetrieve(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType map(Capacity);
+	for (unsigned int i = 0; i < state.range(0); i++)
+		map[i] = i * 2;
+
+	unsigned int key = 0;
+	for (auto _ : state)
+	{
+		key = (key + 19) % state.range(0);
+		benchmark::DoNotOptimize(map[key]);
+	}
+}
+BENCHMARK(BM_SwissHashMapRetrieve)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_SwissHashMapFindMissing(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType map(Capacity);
+	for (unsigned int i = 0; i < state.range(0); i++)
+		map[i] = i * 2;
+
+	unsigned int key = 0;
+	for (auto _ : state)
+	{
+		key = (key + 19) % state.range(0);
+		benchmark::DoNotOptimize(map.find(key + Capacity));
+	}
+}
+BENCHMARK(BM_SwissHashMapFindMissing)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_SwissHashMapRemove(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	SwissHashMapTestType initMap(Capacity);
+	for (unsigned int i = 0; i < state.range(0); i++)
+		initMap[i] = i * 2;
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		SwissHashMapTestType map(initMap);
+		state.ResumeTiming();
+
+		for (unsigned int i = 0; i < state.range(0); i++)
+			map.remove(i);
+	}
+}
+BENCHMARK(BM_SwissHashMapRemove)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+template <class StringHashMapType>
+static void stringHashMapRetrieve(benchmark::State &state)
+{
+	state.counters["Capacity"] = Capacity;
+	nctl::String paths[Capacity];
+	initPaths(paths, state.range(0));
+	StringHashMapType map(Capacity);
+	for (unsigned int i = 0; i < state.range(0); i++)
+		map[paths[i]] = i;
+
+	unsigned int key = 0;
+	for (auto _ : state)
+	{
+		key = (key + 19) % state.range(0);
+		benchmark::DoNotOptimize(map.find(paths[key]));
+	}
+}
+
+static void BM_StringHashMapRetrieveFNV1a(benchmark::State &state)
+{
+	stringHashMapRetrieve<FNV1aStringHashMap>(state);
+}
+BENCHMARK(BM_StringHashMapRetrieveFNV1a)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_StringHashMapRetrieveWord(benchmark::State &state)
+{
+	stringHashMapRetrieve<WordStringHashMap>(state);
+}
+BENCHMARK(BM_StringHashMapRetrieveWord)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
+static void BM_StringHashMapRetrieveCached(benchmark::State &state)
+{
+	stringHashMapRetrieve<CachedStringHashMap>(state);
+}
+BENCHMARK(BM_StringHashMapRetrieveCached)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity / 4 * 3);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+#include "benchmark/benchmark.h"
+#include <cstring>
+#include <ncine/LuaStateManager.h>
+#include <ncine/LuaUtils.h>
+#include <ncine/LuaVector2Utils.h>
+
+namespace nc = ncine;
+
+namespace {
+
+const unsigned int NumCalls = 1024;
+const char *Script =
+    "function table_loop(n) for i = 1, n do set_position_table(get_position_table()) end end\n"
+    "function userdata_loop(n) for i = 1, n do set_position(get_position()) end end\n"
+    "function field_loop(n) local v = get_position() for i = 1, n do v.x = v.x + v.y end end\n";
+
+nc::Vector2f position(1.0f, 2.0f);
+
+int getPositionTable(lua_State *L)
+{
+	nc::LuaUtils::createTable(L, 0, 2);
+	nc::LuaUtils::pushField(L, nc::LuaNames::Vector2::x, position.x);
+	nc::LuaUtils::pushField(L, nc::LuaNames::Vector2::y, position.y);
+	return 1;
+}
+
+int setPositionTable(lua_State *L)
+{
+	position.x = nc::LuaUtils::retrieveField<float>(L, 1, nc::LuaNames::Vector2::x);
+	position.y = nc::LuaUtils::retrieveField<float>(L, 1, nc::LuaNames::Vector2::y);
+	return 0;
+}
+
+int getPosition(lua_State *L)
+{
+	nc::LuaVector2fUtils::push(L, position);
+	return 1;
+}
+
+int setPosition(lua_State *L)
+{
+	int vectorIndex = 0;
+	position = nc::LuaVector2fUtils::retrieve(L, 1, vectorIndex);
+	return 0;
+}
+
+void setupState(nc::LuaStateManager &luaState)
+{
+	lua_State *L = luaState.state();
+	nc::LuaUtils::setGlobal(L, "get_position_table", getPositionTable);
+	nc::LuaUtils::setGlobal(L, "set_position_table", setPositionTable);
+	nc::LuaUtils::setGlobal(L, "get_position", getPosition);
+	nc::LuaUtils::setGlobal(L, "set_position", setPosition);
+	luaState.runFromMemory("gbench_luabindings", Script, strlen(Script));
+}
+
+void runLoop(benchmark::State &state, const char *functionName)
+{
+	nc::LuaStateManager luaState(nc::LuaStateManager::ApiType::NONE,
+	                             nc::LuaStateManager::StatisticsTracking::DISABLED,
+	                             nc::LuaStateManager::StandardLibraries::LOADED);
+	setupState(luaState);
+	lua_State *L = luaState.state();
+
+	for (auto _ : state)
+	{
+		nc::LuaUtils::getGlobal(L, functionName);
+		nc::LuaUtils::push(L, static_cast<int64_t>(state.range(0)));
+		nc::LuaUtils::call(L, 1, 0);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+static void BM_TableRoundTrip(benchmark::State &state)
+{
+	runLoop(state, "table_loop");
+}
+BENCHMARK(BM_TableRoundTrip)->Arg(NumCalls);
+
+static void BM_UserDataRoundTrip(benchmark::State &state)
+{
+	runLoop(state, "userdata_loop");
+}
+BENCHMARK(BM_UserDataRoundTrip)->Arg(NumCalls);
+
+static void BM_UserDataFieldAccess(benchmark::State &state)
+{
+	runLoop(state, "field_loop");
+}
+BENCHMARK(BM_UserDataFieldAccess)->Arg(NumCalls);
+
+static void BM_ManagerLookup(benchmark::State &state)
+{
+	nc::LuaStateManager luaState(nc::LuaStateManager::ApiType::NONE,
+	                             nc::LuaStateManager::StatisticsTracking::DISABLED,
+	                             nc::LuaStateManager::StandardLibraries::NOT_LOADED);
+	lua_State *L = luaState.state();
+
+	for (auto _ : state)
+		benchmark::DoNotOptimize(nc::LuaStateManager::manager(L));
+}
+BENCHMARK(BM_ManagerLookup);
+
+BENCHMARK_MAIN();
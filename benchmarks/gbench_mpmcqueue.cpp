@@ -0,0 +1,62 @@
+#include "benchmark/benchmark.h"
+#include <nctl/MpmcQueue.h>
+#include <thread>
+
+const unsigned int Capacity = 1024;
+const unsigned int NumElements = 64 * 1024;
+const unsigned int MaxThreads = 8;
+
+static void BM_MpmcQueuePushPop(benchmark::State &state)
+{
+	nctl::MpmcQueue<unsigned int> queue(Capacity);
+	unsigned int value = 0;
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < state.range(0); i++)
+			queue.push(i);
+		for (unsigned int i = 0; i < state.range(0); i++)
+			queue.pop(value);
+		benchmark::DoNotOptimize(value);
+	}
+}
+BENCHMARK(BM_MpmcQueuePushPop)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity);
+
+/// Runs the same number of producer and consumer threads
+static void BM_MpmcQueueThroughput(benchmark::State &state)
+{
+	nctl::MpmcQueue<unsigned int> queue(Capacity);
+	const unsigned int numThreads = static_cast<unsigned int>(state.range(0));
+	const unsigned int elementsPerThread = NumElements / numThreads;
+
+	for (auto _ : state)
+	{
+		std::thread threads[MaxThreads * 2];
+		for (unsigned int i = 0; i < numThreads; i++)
+		{
+			threads[i] = std::thread([&queue, elementsPerThread]() {
+				unsigned int value = 0;
+				for (unsigned int j = 0; j < elementsPerThread; j++)
+				{
+					while (queue.pop(value) == false)
+						std::this_thread::yield();
+					benchmark::DoNotOptimize(value);
+				}
+			});
+			threads[numThreads + i] = std::thread([&queue, elementsPerThread]() {
+				for (unsigned int j = 0; j < elementsPerThread; j++)
+				{
+					while (queue.push(j) == false)
+						std::this_thread::yield();
+				}
+			});
+		}
+
+		for (unsigned int i = 0; i < numThreads * 2; i++)
+			threads[i].join();
+	}
+	state.SetItemsProcessed(state.iterations() * elementsPerThread * numThreads);
+}
+BENCHMARK(BM_MpmcQueueThroughput)->Arg(1)->Arg(2)->Arg(4)->Arg(MaxThreads)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,184 @@
+#include "benchmark/benchmark.h"
+#include <ncine/ParallelAlgorithms.h>
+#include <nctl/Array.h>
+#include <nctl/List.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace nc = ncine;
+
+const unsigned int Size = 1024 * 1024;
+const unsigned int MaxThreads = 8;
+// Coprime with the size, to generate a permutation of its indices
+const unsigned int Multiplier = 7919;
+
+/// A minimal thread pool, the engine one is private and only created by the application
+class BenchmarkThreadPool : public nc::IThreadPool
+{
+  public:
+	explicit BenchmarkThreadPool(unsigned int numThreads)
+	    : numThreads_(numThreads), shouldQuit_(false)
+	{
+		for (unsigned int i = 0; i < numThreads_; i++)
+			threads_[i] = std::thread(&BenchmarkThreadPool::workerFunction, this);
+	}
+
+	~BenchmarkThreadPool() override
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			shouldQuit_ = true;
+		}
+		cv_.notify_all();
+		for (unsigned int i = 0; i < numThreads_; i++)
+			threads_[i].join();
+	}
+
+	void enqueueCommand(nctl::UniquePtr<nc::IThreadCommand> threadCommand) override
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			queue_.pushBack(nctl::move(threadCommand));
+		}
+		cv_.notify_one();
+	}
+
+	unsigned int numThreads() const override { return numThreads_; }
+
+  private:
+	unsigned int numThreads_;
+	bool shouldQuit_;
+	std::thread threads_[MaxThreads];
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	nctl::List<nctl::UniquePtr<nc::IThreadCommand>> queue_;
+
+	void workerFunction()
+	{
+		while (true)
+		{
+			nctl::UniquePtr<nc::IThreadCommand> threadCommand;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				cv_.wait(lock, [this]() { return shouldQuit_ || queue_.isEmpty() == false; });
+				if (shouldQuit_)
+					return;
+				threadCommand = nctl::move(queue_.front());
+				queue_.popFront();
+			}
+			threadCommand->execute();
+		}
+	}
+};
+
+static void initArray(nctl::Array<unsigned int> &array)
+{
+	array.clear();
+	for (unsigned int i = 0; i < Size; i++)
+		array.pushBack((i * Multiplier) % Size);
+}
+
+static void heavyWork(unsigned int &value)
+{
+	for (unsigned int i = 0; i < 16; i++)
+		value = value * 1664525u + 1013904223u;
+}
+
+static void BM_ForEach(benchmark::State &state)
+{
+	nctl::Array<unsigned int> array(Size);
+	initArray(array);
+
+	for (auto _ : state)
+	{
+		nctl::forEach(array.begin(), array.end(), heavyWork);
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * Size);
+}
+BENCHMARK(BM_ForEach)->UseRealTime();
+
+static void BM_ParallelForEach(benchmark::State &state)
+{
+	BenchmarkThreadPool threadPool(state.range(0));
+	nctl::Array<unsigned int> array(Size);
+	initArray(array);
+
+	for (auto _ : state)
+	{
+		nc::parallelForEach(threadPool, array.begin(), array.end(), heavyWork);
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * Size);
+}
+BENCHMARK(BM_ParallelForEach)->Arg(1)->Arg(3)->Arg(MaxThreads - 1)->UseRealTime();
+
+static void BM_Reduce(benchmark::State &state)
+{
+	nctl::Array<unsigned int> array(Size);
+	initArray(array);
+
+	for (auto _ : state)
+	{
+		unsigned long int sum = 0;
+		for (unsigned int value : array)
+			sum += value;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * Size);
+}
+BENCHMARK(BM_Reduce)->UseRealTime();
+
+static void BM_ParallelReduce(benchmark::State &state)
+{
+	BenchmarkThreadPool threadPool(state.range(0));
+	nctl::Array<unsigned int> array(Size);
+	initArray(array);
+
+	for (auto _ : state)
+	{
+		const unsigned long int sum = nc::parallelReduce(threadPool, array.begin(), array.end(), 0UL,
+		                                                 [](unsigned long int a, unsigned long int b) { return a + b; });
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * Size);
+}
+BENCHMARK(BM_ParallelReduce)->Arg(1)->Arg(3)->Arg(MaxThreads - 1)->UseRealTime();
+
+static void BM_Quicksort(benchmark::State &state)
+{
+	nctl::Array<unsigned int> array(Size);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		initArray(array);
+		state.ResumeTiming();
+
+		nctl::quicksort(array.begin(), array.end());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * Size);
+}
+BENCHMARK(BM_Quicksort)->UseRealTime();
+
+static void BM_ParallelSort(benchmark::State &state)
+{
+	BenchmarkThreadPool threadPool(state.range(0));
+	nctl::Array<unsigned int> array(Size);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		initArray(array);
+		state.ResumeTiming();
+
+		nc::parallelSort(threadPool, array.begin(), array.end());
+		benchmark::DoNotOptimize(array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * Size);
+}
+BENCHMARK(BM_ParallelSort)->Arg(1)->Arg(3)->Arg(MaxThreads - 1)->UseRealTime();
+
+BENCHMARK_MAIN();
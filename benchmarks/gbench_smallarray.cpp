@@ -0,0 +1,93 @@
+#include "benchmark/benchmark.h"
+#include <nctl/Array.h>
+#include <nctl/SmallArray.h>
+
+const unsigned int InlineCapacity = 8;
+const unsigned int NumArrays = 1024;
+
+static void BM_ArrayCreationAndPushBack(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		nctl::Array<unsigned int> array(InlineCapacity);
+		for (unsigned int i = 0; i < state.range(0); i++)
+			array.pushBack(i);
+		benchmark::DoNotOptimize(array);
+	}
+}
+BENCHMARK(BM_ArrayCreationAndPushBack)->Arg(InlineCapacity / 2)->Arg(InlineCapacity)->Arg(InlineCapacity * 2);
+
+static void BM_SmallArrayCreationAndPushBack(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		nctl::SmallArray<unsigned int, InlineCapacity> array;
+		for (unsigned int i = 0; i < state.range(0); i++)
+			array.pushBack(i);
+		benchmark::DoNotOptimize(array);
+	}
+}
+BENCHMARK(BM_SmallArrayCreationAndPushBack)->Arg(InlineCapacity / 2)->Arg(InlineCapacity)->Arg(InlineCapacity * 2);
+
+static void BM_SmallArrayCopy(benchmark::State &state)
+{
+	nctl::SmallArray<unsigned int, InlineCapacity> initArray;
+	for (unsigned int i = 0; i < state.range(0); i++)
+		initArray.pushBack(i);
+	nctl::SmallArray<unsigned int, InlineCapacity> array;
+
+	for (auto _ : state)
+	{
+		array = initArray;
+		benchmark::DoNotOptimize(array);
+	}
+}
+BENCHMARK(BM_SmallArrayCopy)->Arg(InlineCapacity / 2)->Arg(InlineCapacity)->Arg(InlineCapacity * 2);
+
+static void BM_ArrayIterateMany(benchmark::State &state)
+{
+	nctl::Array<nctl::Array<unsigned int>> arrays(NumArrays);
+	for (unsigned int i = 0; i < NumArrays; i++)
+	{
+		arrays.emplaceBack(InlineCapacity);
+		for (unsigned int j = 0; j < state.range(0); j++)
+			arrays.back().pushBack(j);
+	}
+
+	for (auto _ : state)
+	{
+		unsigned int sum = 0;
+		for (const nctl::Array<unsigned int> &array : arrays)
+		{
+			for (unsigned int value : array)
+				sum += value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+}
+BENCHMARK(BM_ArrayIterateMany)->Arg(InlineCapacity / 2)->Arg(InlineCapacity);
+
+static void BM_SmallArrayIterateMany(benchmark::State &state)
+{
+	nctl::Array<nctl::SmallArray<unsigned int, InlineCapacity>> arrays(NumArrays);
+	for (unsigned int i = 0; i < NumArrays; i++)
+	{
+		arrays.emplaceBack();
+		for (unsigned int j = 0; j < state.range(0); j++)
+			arrays.back().pushBack(j);
+	}
+
+	for (auto _ : state)
+	{
+		unsigned int sum = 0;
+		for (const nctl::SmallArray<unsigned int, InlineCapacity> &array : arrays)
+		{
+			for (unsigned int value : array)
+				sum += value;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+}
+BENCHMARK(BM_SmallArrayIterateMany)->Arg(InlineCapacity / 2)->Arg(InlineCapacity);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,51 @@
+#include "benchmark/benchmark.h"
+#include <nctl/SpscQueue.h>
+#include <thread>
+
+const unsigned int Capacity = 1024;
+const unsigned int NumElements = 64 * 1024;
+
+static void BM_SpscQueuePushPop(benchmark::State &state)
+{
+	nctl::SpscQueue<unsigned int> queue(Capacity);
+	unsigned int value = 0;
+
+	for (auto _ : state)
+	{
+		for (unsigned int i = 0; i < state.range(0); i++)
+			queue.push(i);
+		for (unsigned int i = 0; i < state.range(0); i++)
+			queue.pop(value);
+		benchmark::DoNotOptimize(value);
+	}
+}
+BENCHMARK(BM_SpscQueuePushPop)->Arg(Capacity / 4)->Arg(Capacity / 2)->Arg(Capacity);
+
+static void BM_SpscQueueThroughput(benchmark::State &state)
+{
+	nctl::SpscQueue<unsigned int> queue(state.range(0));
+
+	for (auto _ : state)
+	{
+		std::thread consumer([&queue]() {
+			unsigned int value = 0;
+			for (unsigned int i = 0; i < NumElements; i++)
+			{
+				while (queue.pop(value) == false)
+					std::this_thread::yield();
+				benchmark::DoNotOptimize(value);
+			}
+		});
+
+		for (unsigned int i = 0; i < NumElements; i++)
+		{
+			while (queue.push(i) == false)
+				std::this_thread::yield();
+		}
+		consumer.join();
+	}
+	state.SetItemsProcessed(state.iterations() * NumElements);
+}
+BENCHMARK(BM_SpscQueueThroughput)->Arg(64)->Arg(Capacity)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -3,6 +3,14 @@
 
 const unsigned int Length = 256;
 
+static void initString(nctl::String &string, unsigned int length)
+{
+	for (unsigned int i = 0; i < length; i++)
+		string.data()[i] = static_cast<char>('a' + i % 26);
+	string.data()[length] = '\0';
+	string.setLength(length);
+}
+
 static void BM_StringCreation(benchmark::State &state)
 {
 	for (auto _ : state)
@@ -85,4 +93,47 @@ static void BM_StringClear(benchmark::State &state)
 }
 BENCHMARK(BM_StringClear)->Arg(Length / 4)->Arg(Length / 2)->Arg(Length);
 
+static void BM_StringHashFNV1a(benchmark::State &state)
+{
+	nctl::String string(state.range(0) + 1);
+	initString(string, state.range(0));
+
+	for (auto _ : state)
+	{
+		const nctl::hash_t hash = nctl::fnv1aHash(string.data(), string.length());
+		benchmark::DoNotOptimize(hash);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringHashFNV1a)->Arg(Length / 16)->Arg(Length / 4)->Arg(Length);
+
+static void BM_StringHashWord(benchmark::State &state)
+{
+	nctl::String string(state.range(0) + 1);
+	initString(string, state.range(0));
+
+	for (auto _ : state)
+	{
+		const nctl::hash_t hash = nctl::wordHash(string.data(), string.length());
+		benchmark::DoNotOptimize(hash);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringHashWord)->Arg(Length / 16)->Arg(Length / 4)->Arg(Length);
+
+static void BM_StringHashCached(benchmark::State &state)
+{
+	nctl::String string(state.range(0) + 1);
+	initString(string, state.range(0));
+	const nctl::String &constString = string;
+
+	for (auto _ : state)
+	{
+		const nctl::hash_t hash = constString.hash();
+		benchmark::DoNotOptimize(hash);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringHashCached)->Arg(Length / 16)->Arg(Length / 4)->Arg(Length);
+
 BENCHMARK_MAIN();
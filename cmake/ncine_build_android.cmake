@@ -28,6 +28,7 @@ if(NCINE_BUILD_ANDROID)
 		-DCMAKE_MODULE_PATH=${CMAKE_MODULE_PATH} -DNCINE_DYNAMIC_LIBRARY=${NCINE_DYNAMIC_LIBRARY}
 		-DNCINE_STARTUP_TEST=${NCINE_STARTUP_TEST} -DEXTERNAL_ANDROID_DIR=${EXTERNAL_ANDROID_DIR}
 		-DGENERATED_INCLUDE_DIR=${GENERATED_INCLUDE_DIR} -DNCINE_STRIP_BINARIES=${NCINE_STRIP_BINARIES}
+		-DNCINE_FNV1A_STRING_HASH=${NCINE_FNV1A_STRING_HASH}
 		-DNCINE_WITH_PNG=${NCINE_WITH_PNG} -DNCINE_WITH_WEBP=${NCINE_WITH_WEBP}
 		-DNCINE_WITH_AUDIO=${NCINE_WITH_AUDIO} -DNCINE_WITH_VORBIS=${NCINE_WITH_VORBIS}
 		-DNCINE_WITH_THREADS=${NCINE_WITH_THREADS} -DNCINE_WITH_LUA=${NCINE_WITH_LUA}
@@ -0,0 +1,7 @@
+if(NCINE_BUILD_TOOLS)
+	if(EMSCRIPTEN OR NCINE_BUILD_ANDROID)
+		message(STATUS "Command line tools are only built for desktop platforms")
+	else()
+		add_subdirectory(src/tools)
+	endif()
+endif()
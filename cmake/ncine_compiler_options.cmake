@@ -2,6 +2,10 @@ target_compile_features(ncine PUBLIC cxx_std_11)
 set_target_properties(ncine PROPERTIES CXX_EXTENSIONS OFF)
 
 target_compile_definitions(ncine PRIVATE "$<$<CONFIG:Debug>:NCINE_DEBUG>")
+if(NCINE_FNV1A_STRING_HASH)
+	# The string hash is computed in public headers too
+	target_compile_definitions(ncine PUBLIC "NCTL_FNV1A_STRING_HASH")
+endif()
 
 if(EMSCRIPTEN)
 	target_compile_options(ncine PUBLIC
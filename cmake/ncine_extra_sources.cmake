@@ -50,6 +50,21 @@ if(SDL2_FOUND AND NOT GLFW_FOUND)
 	)
 endif()
 
+if(NCINE_WITH_HEADLESS AND OpenGL_EGL_FOUND)
+	message(STATUS "EGL has been found, the headless device is available")
+	target_compile_definitions(ncine PRIVATE "WITH_HEADLESS")
+	target_link_libraries(ncine PRIVATE OpenGL::EGL)
+
+	list(APPEND PRIVATE_HEADERS
+		${NCINE_ROOT}/src/include/HeadlessInputManager.h
+		${NCINE_ROOT}/src/include/HeadlessGfxDevice.h
+	)
+	list(APPEND SOURCES
+		${NCINE_ROOT}/src/input/HeadlessInputManager.cpp
+		${NCINE_ROOT}/src/graphics/HeadlessGfxDevice.cpp
+	)
+endif()
+
 if(OPENAL_FOUND)
 	target_compile_definitions(ncine PRIVATE "WITH_AUDIO")
 	target_link_libraries(ncine PRIVATE OpenAL::AL)
@@ -136,6 +151,7 @@ if(LUA_FOUND)
 	list(APPEND HEADERS
 		${NCINE_ROOT}/include/ncine/LuaTypes.h
 		${NCINE_ROOT}/include/ncine/LuaStateManager.h
+		${NCINE_ROOT}/include/ncine/LuaProfiler.h
 		${NCINE_ROOT}/include/ncine/LuaClassWrapper.h
 		${NCINE_ROOT}/include/ncine/LuaUtils.h
 		${NCINE_ROOT}/include/ncine/LuaDebug.h
@@ -156,6 +172,7 @@ if(LUA_FOUND)
 		${NCINE_ROOT}/src/include/LuaVector2.h
 		${NCINE_ROOT}/src/include/LuaVector3.h
 		${NCINE_ROOT}/src/include/LuaColor.h
+		${NCINE_ROOT}/src/include/LuaValueType.h
 		${NCINE_ROOT}/src/include/LuaIInputManager.h
 		${NCINE_ROOT}/src/include/LuaMouseEvents.h
 		${NCINE_ROOT}/src/include/LuaKeys.h
@@ -182,6 +199,7 @@ if(LUA_FOUND)
 		${NCINE_ROOT}/src/scripting/LuaUtils.cpp
 		${NCINE_ROOT}/src/scripting/LuaDebug.cpp
 		${NCINE_ROOT}/src/scripting/LuaStatistics.cpp
+		${NCINE_ROOT}/src/scripting/LuaProfiler.cpp
 		${NCINE_ROOT}/src/scripting/LuaIAppEventHandler.cpp
 		${NCINE_ROOT}/src/scripting/LuaILogger.cpp
 		${NCINE_ROOT}/src/scripting/LuaColor.cpp
@@ -276,6 +294,10 @@ if(NCINE_WITH_IMGUI)
 		list(APPEND PRIVATE_HEADERS ${NCINE_ROOT}/src/include/ImGuiAndroidInput.h)
 		list(APPEND SOURCES ${NCINE_ROOT}/src/android/ImGuiAndroidInput.cpp)
 	endif()
+	if(NCINE_WITH_HEADLESS AND OpenGL_EGL_FOUND)
+		list(APPEND PRIVATE_HEADERS ${NCINE_ROOT}/src/include/ImGuiHeadlessInput.h)
+		list(APPEND SOURCES ${NCINE_ROOT}/src/input/ImGuiHeadlessInput.cpp)
+	endif()
 
 	list(APPEND PRIVATE_HEADERS ${NCINE_ROOT}/src/include/ImGuiDebugOverlay.h)
 	list(APPEND SOURCES ${NCINE_ROOT}/src/graphics/ImGuiDebugOverlay.cpp)
@@ -190,6 +190,9 @@ if(EXISTS ${CMAKE_SOURCE_DIR}/config.h.in)
 	set(NCINE_WITH_GLEW ${GLEW_FOUND})
 	set(NCINE_WITH_GLFW ${GLFW_FOUND})
 	set(NCINE_WITH_SDL ${SDL2_FOUND})
+	if(NCINE_WITH_HEADLESS)
+		set(NCINE_WITH_HEADLESS ${OpenGL_EGL_FOUND})
+	endif()
 	set(NCINE_WITH_PNG ${PNG_FOUND})
 	set(NCINE_WITH_WEBP ${WEBP_FOUND})
 	set(NCINE_WITH_AUDIO ${OPENAL_FOUND})
@@ -22,7 +22,9 @@ set(HEADERS
 	${NCINE_ROOT}/include/ncine/ILogger.h
 	${NCINE_ROOT}/include/ncine/IAudioDevice.h
 	${NCINE_ROOT}/include/ncine/IThreadPool.h
+	${NCINE_ROOT}/include/ncine/IAsyncFileReader.h
 	${NCINE_ROOT}/include/ncine/IThreadCommand.h
+	${NCINE_ROOT}/include/ncine/ParallelAlgorithms.h
 	${NCINE_ROOT}/include/ncine/IGfxCapabilities.h
 	${NCINE_ROOT}/include/ncine/ServiceLocator.h
 	${NCINE_ROOT}/include/ncine/DisplayMode.h
@@ -33,12 +35,16 @@ set(HEADERS
 	${NCINE_ROOT}/include/ncine/IGfxDevice.h
 	${NCINE_ROOT}/include/ncine/Texture.h
 	${NCINE_ROOT}/include/ncine/SceneNode.h
+	${NCINE_ROOT}/include/ncine/NodeComponents.h
 	${NCINE_ROOT}/include/ncine/BaseSprite.h
 	${NCINE_ROOT}/include/ncine/Sprite.h
 	${NCINE_ROOT}/include/ncine/MeshSprite.h
 	${NCINE_ROOT}/include/ncine/Application.h
 	${NCINE_ROOT}/include/ncine/PCApplication.h
 	${NCINE_ROOT}/include/ncine/AppConfiguration.h
+	${NCINE_ROOT}/include/ncine/FrameArena.h
+	${NCINE_ROOT}/include/ncine/FramePacer.h
+	${NCINE_ROOT}/include/ncine/FrameTimeStatistics.h
 	${NCINE_ROOT}/include/ncine/IDebugOverlay.h
 	${NCINE_ROOT}/include/ncine/ParticleAffectors.h
 	${NCINE_ROOT}/include/ncine/ParticleSystem.h
@@ -53,13 +59,22 @@ set(NCTL_HEADERS
 	${NCINE_ROOT}/include/nctl/iterator.h
 	${NCINE_ROOT}/include/nctl/type_traits.h
 	${NCINE_ROOT}/include/nctl/utility.h
+	${NCINE_ROOT}/include/nctl/IAllocator.h
+	${NCINE_ROOT}/include/nctl/MallocAllocator.h
+	${NCINE_ROOT}/include/nctl/LinearAllocator.h
+	${NCINE_ROOT}/include/nctl/StackAllocator.h
+	${NCINE_ROOT}/include/nctl/PoolAllocator.h
+	${NCINE_ROOT}/include/nctl/FreeListAllocator.h
 	${NCINE_ROOT}/include/nctl/Array.h
 	${NCINE_ROOT}/include/nctl/ArrayIterator.h
 	${NCINE_ROOT}/include/nctl/StaticArray.h
+	${NCINE_ROOT}/include/nctl/SmallArray.h
 	${NCINE_ROOT}/include/nctl/List.h
 	${NCINE_ROOT}/include/nctl/ListIterator.h
 	${NCINE_ROOT}/include/nctl/String.h
 	${NCINE_ROOT}/include/nctl/StringIterator.h
+	${NCINE_ROOT}/include/nctl/StringView.h
+	${NCINE_ROOT}/include/nctl/StringId.h
 	${NCINE_ROOT}/include/nctl/HashFunctions.h
 	${NCINE_ROOT}/include/nctl/HashMap.h
 	${NCINE_ROOT}/include/nctl/HashMapIterator.h
@@ -73,10 +88,19 @@ set(NCTL_HEADERS
 	${NCINE_ROOT}/include/nctl/StaticHashSetIterator.h
 	${NCINE_ROOT}/include/nctl/HashSetList.h
 	${NCINE_ROOT}/include/nctl/HashSetListIterator.h
+	${NCINE_ROOT}/include/nctl/SwissGroup.h
+	${NCINE_ROOT}/include/nctl/SwissHashMap.h
+	${NCINE_ROOT}/include/nctl/SwissHashMapIterator.h
+	${NCINE_ROOT}/include/nctl/SwissHashSet.h
+	${NCINE_ROOT}/include/nctl/SwissHashSetIterator.h
 	${NCINE_ROOT}/include/nctl/SparseSet.h
 	${NCINE_ROOT}/include/nctl/SparseSetIterator.h
+	${NCINE_ROOT}/include/nctl/EntityRegistry.h
+	${NCINE_ROOT}/include/nctl/ComponentPool.h
 	${NCINE_ROOT}/include/nctl/ReverseIterator.h
 	${NCINE_ROOT}/include/nctl/Atomic.h
+	${NCINE_ROOT}/include/nctl/SpscQueue.h
+	${NCINE_ROOT}/include/nctl/MpmcQueue.h
 	${NCINE_ROOT}/include/nctl/UniquePtr.h
 	${NCINE_ROOT}/include/nctl/SharedPtr.h
 )
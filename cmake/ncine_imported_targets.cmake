@@ -113,7 +113,11 @@ elseif(NOT ANDROID) # GCC and LLVM
 			find_package(GLEW)
 		endif()
 	endif()
-	find_package(OpenGL REQUIRED)
+	if(NCINE_WITH_HEADLESS)
+		find_package(OpenGL REQUIRED OPTIONAL_COMPONENTS EGL)
+	else()
+		find_package(OpenGL REQUIRED)
+	endif()
 	if(NCINE_PREFERRED_BACKEND STREQUAL "GLFW")
 		find_package(GLFW)
 	elseif(NCINE_PREFERRED_BACKEND STREQUAL "SDL2")
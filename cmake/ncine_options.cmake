@@ -1,6 +1,7 @@
 option(NCINE_BUILD_TESTS "Build the engine test programs" ON)
 option(NCINE_BUILD_UNIT_TESTS "Build the engine unit tests" OFF)
 option(NCINE_BUILD_BENCHMARKS "Build the engine micro benchmarks" OFF)
+option(NCINE_BUILD_TOOLS "Build the engine command line tools" OFF)
 option(NCINE_INSTALL_DEV_SUPPORT "Install files to support development" ON)
 option(NCINE_LINKTIME_OPTIMIZATION "Compile the engine with link time optimization when in release" ON)
 option(NCINE_AUTOVECTORIZATION_REPORT "Enable report generation from compiler auto-vectorization" OFF)
@@ -9,6 +10,7 @@ option(NCINE_BUILD_DOCUMENTATION "Create and install the HTML based API document
 option(NCINE_EMBED_SHADERS "Export shader files to C strings to be included in engine sources" ON)
 option(NCINE_BUILD_ANDROID "Build the Android version of the engine" OFF)
 option(NCINE_STRIP_BINARIES "Enable symbols stripping from libraries and executables when in release" OFF)
+option(NCINE_FNV1A_STRING_HASH "Hash strings with FNV-1a instead of the faster word at a time hash" OFF)
 
 set(NCINE_PREFERRED_BACKEND "GLFW" CACHE STRING "Specify the preferred backend on desktop")
 set_property(CACHE NCINE_PREFERRED_BACKEND PROPERTY STRINGS "GLFW;SDL2")
@@ -21,6 +23,9 @@ endif()
 if(NOT WIN32)
 	option(NCINE_WITH_GLEW "Enable GLEW support" ON)
 endif()
+if(NOT WIN32 AND NOT APPLE AND NOT EMSCRIPTEN)
+	option(NCINE_WITH_HEADLESS "Enable the headless graphics device based on an offscreen EGL context" ON)
+endif()
 option(NCINE_WITH_PNG "Enable PNG image file loading" ON)
 option(NCINE_WITH_WEBP "Enable WebP image file loading" ON)
 option(NCINE_WITH_AUDIO "Enable OpenAL support and thus sound" ON)
@@ -2,8 +2,11 @@ set(PRIVATE_HEADERS
 	${NCINE_ROOT}/src/include/common_headers.h
 	${NCINE_ROOT}/src/include/Clock.h
 	${NCINE_ROOT}/src/include/ArrayIndexer.h
+	${NCINE_ROOT}/src/include/AsyncFileReader.h
 	${NCINE_ROOT}/src/include/FrameTimer.h
 	${NCINE_ROOT}/src/include/StandardFile.h
+	${NCINE_ROOT}/src/include/PackArchive.h
+	${NCINE_ROOT}/src/include/MemoryFile.h
 	${NCINE_ROOT}/src/include/FileLogger.h
 	${NCINE_ROOT}/src/include/JoyMapping.h
 	${NCINE_ROOT}/src/input/JoyMappingDb.h
@@ -14,6 +17,7 @@ set(PRIVATE_HEADERS
 	${NCINE_ROOT}/src/include/RenderCommand.h
 	${NCINE_ROOT}/src/include/RenderQueue.h
 	${NCINE_ROOT}/src/include/Material.h
+	${NCINE_ROOT}/src/include/UniformNames.h
 	${NCINE_ROOT}/src/include/Geometry.h
 	${NCINE_ROOT}/src/include/Particle.h
 	${NCINE_ROOT}/src/include/TextureFormat.h
@@ -42,6 +46,7 @@ set(PRIVATE_HEADERS
 	${NCINE_ROOT}/src/include/GLDepthTest.h
 	${NCINE_ROOT}/src/include/GLBlending.h
 	${NCINE_ROOT}/src/include/GLCullFace.h
+	${NCINE_ROOT}/src/include/GLCallCounters.h
 	${NCINE_ROOT}/src/include/RenderBuffersManager.h
 	${NCINE_ROOT}/src/include/RenderBatcher.h
 	${NCINE_ROOT}/src/include/GLDebug.h
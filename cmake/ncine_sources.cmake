@@ -2,18 +2,31 @@ set(SOURCES
 	${NCINE_ROOT}/src/base/Random.cpp
 	${NCINE_ROOT}/src/base/Object.cpp
 	${NCINE_ROOT}/src/base/String.cpp
+	${NCINE_ROOT}/src/base/StringId.cpp
+	${NCINE_ROOT}/src/base/MallocAllocator.cpp
+	${NCINE_ROOT}/src/base/LinearAllocator.cpp
+	${NCINE_ROOT}/src/base/StackAllocator.cpp
+	${NCINE_ROOT}/src/base/PoolAllocator.cpp
+	${NCINE_ROOT}/src/base/FreeListAllocator.cpp
 	${NCINE_ROOT}/src/base/Clock.cpp
 	${NCINE_ROOT}/src/ServiceLocator.cpp
+	${NCINE_ROOT}/src/ParallelAlgorithms.cpp
 	${NCINE_ROOT}/src/FileLogger.cpp
 	${NCINE_ROOT}/src/ArrayIndexer.cpp
+	${NCINE_ROOT}/src/AsyncFileReader.cpp
 	${NCINE_ROOT}/src/TimeStamp.cpp
 	${NCINE_ROOT}/src/Timer.cpp
 	${NCINE_ROOT}/src/FrameTimer.cpp
+	${NCINE_ROOT}/src/FrameArena.cpp
+	${NCINE_ROOT}/src/FramePacer.cpp
+	${NCINE_ROOT}/src/FrameTimeStatistics.cpp
 	${NCINE_ROOT}/src/Font.cpp
 	${NCINE_ROOT}/src/FntParser.cpp
 	${NCINE_ROOT}/src/FontGlyph.cpp
 	${NCINE_ROOT}/src/IFile.cpp
 	${NCINE_ROOT}/src/StandardFile.cpp
+	${NCINE_ROOT}/src/PackArchive.cpp
+	${NCINE_ROOT}/src/MemoryFile.cpp
 	${NCINE_ROOT}/src/input/IInputManager.cpp
 	${NCINE_ROOT}/src/input/JoyMapping.cpp
 	${NCINE_ROOT}/src/graphics/Color.cpp
@@ -24,6 +37,7 @@ set(SOURCES
 	${NCINE_ROOT}/src/graphics/RenderCommand.cpp
 	${NCINE_ROOT}/src/graphics/RenderQueue.cpp
 	${NCINE_ROOT}/src/graphics/Material.cpp
+	${NCINE_ROOT}/src/graphics/UniformNames.cpp
 	${NCINE_ROOT}/src/graphics/Geometry.cpp
 	${NCINE_ROOT}/src/graphics/TextureFormat.cpp
 	${NCINE_ROOT}/src/graphics/ITextureLoader.cpp
@@ -33,6 +47,7 @@ set(SOURCES
 	${NCINE_ROOT}/src/graphics/Texture.cpp
 	${NCINE_ROOT}/src/graphics/DrawableNode.cpp
 	${NCINE_ROOT}/src/graphics/SceneNode.cpp
+	${NCINE_ROOT}/src/graphics/NodeComponents.cpp
 	${NCINE_ROOT}/src/graphics/BaseSprite.cpp
 	${NCINE_ROOT}/src/graphics/Sprite.cpp
 	${NCINE_ROOT}/src/graphics/MeshSprite.cpp
@@ -64,6 +79,7 @@ set(SOURCES
 	${NCINE_ROOT}/src/graphics/opengl/GLDepthTest.cpp
 	${NCINE_ROOT}/src/graphics/opengl/GLBlending.cpp
 	${NCINE_ROOT}/src/graphics/opengl/GLCullFace.cpp
+	${NCINE_ROOT}/src/graphics/opengl/GLCallCounters.cpp
 	${NCINE_ROOT}/src/graphics/RenderBuffersManager.cpp
 	${NCINE_ROOT}/src/graphics/RenderBatcher.cpp
 	${NCINE_ROOT}/src/graphics/opengl/GLDebug.cpp
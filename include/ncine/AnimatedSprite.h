@@ -38,9 +38,9 @@ class DLL_PUBLIC AnimatedSprite : public Sprite
 	/// Returns the number of animations
 	inline unsigned int numAnimations() { return anims_.size(); }
 	/// Returns the array of all animations
-	inline nctl::Array<nctl::UniquePtr<RectAnimation>> &animations() { return anims_; }
+	inline nctl::SmallArray<nctl::UniquePtr<RectAnimation>, 4> &animations() { return anims_; }
 	/// Returns the constant array of all animations
-	inline const nctl::Array<nctl::UniquePtr<RectAnimation>> &animations() const { return anims_; }
+	inline const nctl::SmallArray<nctl::UniquePtr<RectAnimation>, 4> &animations() const { return anims_; }
 
 	/// Returns the index of the current animation
 	unsigned int animationIndex() const { return currentAnimIndex_; }
@@ -55,7 +55,7 @@ class DLL_PUBLIC AnimatedSprite : public Sprite
 	inline static ObjectType sType() { return ObjectType::ANIMATED_SPRITE; }
 
   private:
-	nctl::Array<nctl::UniquePtr<RectAnimation>> anims_;
+	nctl::SmallArray<nctl::UniquePtr<RectAnimation>, 4> anims_;
 	unsigned int currentAnimIndex_;
 
 	/// Deleted copy constructor
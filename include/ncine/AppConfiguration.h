@@ -32,6 +32,9 @@ class DLL_PUBLIC AppConfiguration
 	bool inFullscreen;
 	/// The flag is `true` if the window is going to be resizable
 	bool isResizable;
+	/// The flag is `true` if the application runs without a window, rendering to an offscreen surface
+	/*! \note It is only supported on desktop Linux, where an EGL library is available */
+	bool isHeadless;
 	/// The maximum number of frames to render per second or 0 for no limit
 	unsigned int frameLimit;
 
@@ -51,6 +54,8 @@ class DLL_PUBLIC AppConfiguration
 	unsigned long iboSize;
 	/// The maximum size for the pool of VAOs
 	unsigned int vaoPoolSize;
+	/// The size in bytes of each of the two buffers of the frame arena
+	unsigned long frameArenaSize;
 
 	/// The flag is `true` if the debug overlay is enabled
 	bool withDebugOverlay;
@@ -64,6 +69,8 @@ class DLL_PUBLIC AppConfiguration
 	bool withVSync;
 	/// The flag is `true` if the OpenGL debug context is enabled
 	bool withGlDebugContext;
+	/// The flag is `true` if objects are indexed by name, allowing lookups with `Object::fromName()`
+	bool withObjectNameIndex;
 
 	/// \returns The path for the application to load data from
 	const nctl::String &dataPath() const;
@@ -10,6 +10,9 @@
 namespace ncine {
 
 class FrameTimer;
+class FrameArena;
+class FramePacer;
+class FrameTimeStatistics;
 class SceneNode;
 class RenderQueue;
 class IInputManager;
@@ -23,9 +26,20 @@ class DLL_PUBLIC Application
 	/// Rendering settings that can be changed at run-time
 	struct RenderingSettings
 	{
+		/// The render command properties used to sort the commands that are on the same layer
+		enum class SortKeyField
+		{
+			SHADER,
+			TEXTURE,
+			VERTEX_FORMAT
+		};
+		/// The number of configurable fields in the sort key
+		static const unsigned int NumSortKeyFields = 3;
+
 		RenderingSettings()
 		    : batchingEnabled(true), batchingWithIndices(false),
-		      cullingEnabled(true), minBatchSize(4), maxBatchSize(500) {}
+		      cullingEnabled(true), minBatchSize(4), maxBatchSize(500),
+		      sortKeyFields{ SortKeyField::SHADER, SortKeyField::TEXTURE, SortKeyField::VERTEX_FORMAT } {}
 
 		/// True if batching is enabled
 		bool batchingEnabled;
@@ -37,6 +51,9 @@ class DLL_PUBLIC Application
 		unsigned int minBatchSize;
 		/// Maximum size for a batch before a forced split
 		unsigned int maxBatchSize;
+		/// The sort key fields from the most important one, commands are grouped by the first field before the others
+		/*! \note Every field should appear once, repetitions are ignored, and the layer and the translucency always come before them */
+		SortKeyField sortKeyFields[NumSortKeyFields];
 	};
 
 	struct Timings
@@ -52,6 +69,7 @@ class DLL_PUBLIC Application
 			VISIT,
 			DRAW,
 			IMGUI,
+			AUDIO,
 			FRAME_END,
 
 			COUNT
@@ -71,6 +89,13 @@ class DLL_PUBLIC Application
 	/// Returns all timings
 	inline const float *timings() const { return timings_; }
 
+	/// Returns the arena for allocations that only need to last until the end of the next frame
+	inline FrameArena &frameArena() { return *frameArena_; }
+	/// Returns the frame pacer, to change the target frame time at run-time
+	inline FramePacer &framePacer() { return *framePacer_; }
+	/// Returns the statistics about the duration of the last frames and of their phases
+	FrameTimeStatistics &frameTimeStatistics();
+
 	/// Returns the graphics device instance
 	inline IGfxDevice &gfxDevice() { return *gfxDevice_; }
 	/// Returns the root of the transformation graph
@@ -128,6 +153,8 @@ class DLL_PUBLIC Application
 
 	TimeStamp profileStartTime_;
 	nctl::UniquePtr<FrameTimer> frameTimer_;
+	nctl::UniquePtr<FrameArena> frameArena_;
+	nctl::UniquePtr<FramePacer> framePacer_;
 	nctl::UniquePtr<IGfxDevice> gfxDevice_;
 	nctl::UniquePtr<RenderQueue> renderQueue_;
 	nctl::UniquePtr<SceneNode> rootNode_;
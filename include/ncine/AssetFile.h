@@ -29,6 +29,9 @@ class AssetFile : public IFile
 
 	bool isOpened() const override;
 
+	/// Maps the asset to memory with `AAsset_getBuffer()` when it is opened as an asset
+	const unsigned char *mapToMemory() override;
+
 	/// Sets the global pointer to the AAssetManager
 	static void initAssetManager(struct android_app *state) { assetManager_ = state->activity->assetManager; }
 
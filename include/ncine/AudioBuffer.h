@@ -2,6 +2,7 @@
 #define CLASS_NCINE_AUDIOBUFFER
 
 #include "Object.h"
+#include <nctl/UniquePtr.h>
 
 namespace ncine {
 
@@ -16,8 +17,18 @@ class DLL_PUBLIC AudioBuffer : public Object
 	AudioBuffer();
 	/// A constructor creating a buffer from a file
 	explicit AudioBuffer(const char *filename);
+	/// A constructor creating a buffer from a memory buffer, like the one filled by the asynchronous file reader
+	/*! \param bufferName The name of the buffer, its extension is used to detect the audio format */
+	AudioBuffer(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize);
 	~AudioBuffer() override;
 
+	/// The function called on the main thread when a buffer requested with `loadAsync()` has been created
+	/*! The buffer is empty if the file could not be read. */
+	using AsyncLoadCallback = void (*)(nctl::UniquePtr<AudioBuffer> audioBuffer, void *userData);
+	/// Reads an audio file with the asynchronous file reader, the buffer is then created and decoded on the main thread
+	/*! \return The request identifier that can be passed to `IAsyncFileReader::cancel()`, or zero on failure */
+	static unsigned int loadAsync(const char *filename, AsyncLoadCallback callback, void *userData);
+
 	/// Returns the OpenAL buffer id
 	inline unsigned int bufferId() const { return bufferId_; }
 	/// Returns the number of audio channels
@@ -45,7 +56,7 @@ class DLL_PUBLIC AudioBuffer : public Object
 	AudioBuffer &operator=(const AudioBuffer &) = delete;
 
 	/// Loads audio samples based on information from the audio loader
-	void load(const IAudioLoader *audioLoader);
+	void load(IAudioLoader *audioLoader);
 };
 
 }
@@ -0,0 +1,71 @@
+#ifndef CLASS_NCINE_FRAMEARENA
+#define CLASS_NCINE_FRAMEARENA
+
+#include "common_defines.h"
+#include <nctl/LinearAllocator.h>
+
+namespace ncine {
+
+/// A double-buffered linear allocator for transient allocations
+/*!
+ * Memory allocated during a frame stays valid until the end of the following one,
+ * then it is reclaimed all at once without calling any destructor.
+ * \note The arena is not thread-safe, it should only be used by the main thread.
+ */
+class DLL_PUBLIC FrameArena
+{
+  public:
+	/// Constructs an arena with two buffers of the specified size in bytes
+	explicit FrameArena(size_t size);
+
+	/// Allocates a block from the current frame buffer
+	/*! \return A pointer to the block or `nullptr` if the buffer has overflowed */
+	inline void *allocate(size_t bytes, uint8_t alignment) { return currentAllocator_->allocate(bytes, alignment); }
+	/// Allocates a block with the default alignment from the current frame buffer
+	inline void *allocate(size_t bytes) { return currentAllocator_->allocate(bytes); }
+	/// Constructs an object in the current frame buffer, its destructor will never be called
+	template <class T, typename... Args> T *newObject(Args &&... args) { return currentAllocator_->newObject<T>(nctl::forward<Args>(args)...); }
+
+	/// Returns the allocator of the current frame, to be used by containers that do not outlive the next frame
+	inline nctl::IAllocator &allocator() { return *currentAllocator_; }
+
+	/// Reclaims the memory of the previous frame and makes its buffer the current one
+	/*! It is called by the application at the end of every frame. */
+	void swap();
+
+	/// Returns the size in bytes of each of the two buffers
+	inline size_t size() const { return firstAllocator_.size(); }
+	/// Returns the number of bytes allocated during the current frame
+	inline size_t usedMemory() const { return currentAllocator_->usedMemory(); }
+	/// Returns the number of bytes allocated during the previous frame
+	inline size_t lastFrameUsedMemory() const { return lastFrameUsedMemory_; }
+	/// Returns the highest number of bytes allocated during a single frame
+	size_t peakUsedMemory() const;
+	/// Returns the number of allocations made during the current frame
+	inline unsigned int numAllocations() const { return currentAllocator_->numAllocations(); }
+	/// Returns the number of allocations that failed during the previous frame
+	inline unsigned int lastFrameOverflows() const { return lastFrameOverflows_; }
+	/// Returns the number of frames in which at least an allocation has failed
+	inline unsigned int numOverflowFrames() const { return numOverflowFrames_; }
+
+  private:
+	nctl::LinearAllocator firstAllocator_;
+	nctl::LinearAllocator secondAllocator_;
+	nctl::LinearAllocator *currentAllocator_;
+
+	size_t lastFrameUsedMemory_;
+	unsigned int lastFrameOverflows_;
+	unsigned int numOverflowFrames_;
+	/// Number of failed allocations of each allocator when it became the current one
+	unsigned int firstFailedAllocations_;
+	unsigned int secondFailedAllocations_;
+
+	/// Deleted copy constructor
+	FrameArena(const FrameArena &) = delete;
+	/// Deleted assignment operator
+	FrameArena &operator=(const FrameArena &) = delete;
+};
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef CLASS_NCINE_FRAMEPACER
+#define CLASS_NCINE_FRAMEPACER
+
+#include "common_defines.h"
+
+namespace ncine {
+
+/// A class that limits the frame rate by waiting for a target frame time at the end of every frame
+/*!
+ * The thread sleeps for most of the remaining time and then spins for a short tail before the deadline.
+ * The length of the tail follows the wake-up error of the operating system measured on previous frames,
+ * so that the sleep is as long as possible without overshooting the deadline.
+ * \note The target frame time is independent from vertical synchronization, which can further limit the frame rate.
+ */
+class DLL_PUBLIC FramePacer
+{
+  public:
+	/// Pacing statistics gathered over an interval
+	struct Statistics
+	{
+		Statistics()
+		    : averageWakeUpError(0.0f), maxWakeUpError(0.0f), averageSpinTime(0.0f),
+		      averageFrameTime(0.0f), frameTimeJitter(0.0f), missedDeadlines(0) {}
+
+		/// Average time in seconds by which a sleep lasted longer than requested
+		float averageWakeUpError;
+		/// Maximum time in seconds by which a sleep lasted longer than requested
+		float maxWakeUpError;
+		/// Average time in seconds spent spinning before a deadline
+		float averageSpinTime;
+		/// Average time in seconds between the end of two consecutive frames
+		float averageFrameTime;
+		/// Standard deviation in seconds of the time between the end of two consecutive frames
+		float frameTimeJitter;
+		/// Number of frames that ended after their deadline
+		unsigned int missedDeadlines;
+	};
+
+	/// Constructs a pacer that updates its statistics every `statisticsInterval` seconds
+	explicit FramePacer(float statisticsInterval);
+
+	/// Returns the target frame time in seconds, zero if the frame rate is not limited
+	inline float targetFrameTime() const { return targetFrameTime_; }
+	/// Sets the target frame time in seconds, zero to disable the limit
+	void setTargetFrameTime(float seconds);
+
+	/// Forgets the previous deadline, for example after the application has been suspended
+	void reset();
+
+	/// Waits until the deadline of the current frame
+	/*! It is called by the application at the end of every frame. */
+	void wait();
+	/// Returns the number of seconds left before the deadline of the current frame, zero if the frame rate is not limited
+	float timeLeft() const;
+
+	/// Returns the statistics of the last complete interval
+	inline const Statistics &statistics() const { return statistics_; }
+	/// Returns the length in seconds of the spinning tail that precedes a deadline
+	inline float spinTime() const { return static_cast<float>(spinTime_); }
+
+  private:
+	float targetFrameTime_;
+	float statisticsInterval_;
+
+	/// The deadline of the current frame as seconds since the clock base, zero if not yet known
+	double deadline_;
+	/// The end time of the previous frame as seconds since the clock base
+	double lastFrameEnd_;
+	/// Time before the deadline at which sleeping stops and spinning starts
+	double spinTime_;
+
+	/// Accumulators for the statistics of the current interval
+	struct Accumulators
+	{
+		Accumulators()
+		    : numSleeps(0), wakeUpError(0.0), maxWakeUpError(0.0), numFrames(0),
+		      spinTime(0.0), frameTime(0.0), frameTimeSquared(0.0), missedDeadlines(0), elapsedTime(0.0) {}
+
+		unsigned int numSleeps;
+		double wakeUpError;
+		double maxWakeUpError;
+		unsigned int numFrames;
+		double spinTime;
+		double frameTime;
+		double frameTimeSquared;
+		unsigned int missedDeadlines;
+		double elapsedTime;
+	};
+
+	Accumulators accumulators_;
+	Statistics statistics_;
+
+	void calibrate(double wakeUpError);
+	void updateStatistics(double frameEnd);
+};
+
+}
+
+#endif
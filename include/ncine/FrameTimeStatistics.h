@@ -0,0 +1,125 @@
+#ifndef CLASS_NCINE_FRAMETIMESTATISTICS
+#define CLASS_NCINE_FRAMETIMESTATISTICS
+
+#include "common_defines.h"
+
+namespace ncine {
+
+/// A class that keeps the duration of the last frames and of their phases to compute percentiles, a histogram and to detect hitches
+/*!
+ * Averages hide isolated long frames, the ones that are perceived as stuttering.
+ * Percentiles are calculated from a ring buffer of the last `NumFrames` frames, while the histogram and
+ * the hitch counter accumulate all the frames since the last reset.
+ */
+class DLL_PUBLIC FrameTimeStatistics
+{
+  public:
+	/// The tracked frame phases, the first one is the whole frame
+	struct Phase
+	{
+		enum Enum
+		{
+			FRAME,
+			FRAME_START,
+			UPDATE,
+			VISIT,
+			DRAW,
+			IMGUI,
+			AUDIO,
+			FRAME_END,
+
+			COUNT
+		};
+	};
+
+	/// Percentiles of the durations in the ring buffer, in seconds
+	struct Percentiles
+	{
+		Percentiles()
+		    : p50(0.0f), p95(0.0f), p99(0.0f), max(0.0f) {}
+
+		float p50;
+		float p95;
+		float p99;
+		float max;
+	};
+
+	/// The thresholds that decide if a frame is a hitch
+	struct HitchSettings
+	{
+		HitchSettings()
+		    : minFrameTime(1.0f / 30.0f), medianFactor(2.0f), logHitches(true) {}
+
+		/// A frame that lasts less than this number of seconds is never a hitch
+		float minFrameTime;
+		/// A frame is a hitch when it lasts longer than the median frame time multiplied by this factor
+		float medianFactor;
+		/// True if every hitch is written to the log together with the duration of its phases
+		bool logHitches;
+	};
+
+	/// Number of frames in the ring buffer
+	static const unsigned int NumFrames = 256;
+	/// Number of histogram bins, the last one also counts all the frames that are longer
+	static const unsigned int NumHistogramBins = 32;
+
+	/// Constructs an object that updates the percentiles every `updateInterval` seconds of frame time
+	explicit FrameTimeStatistics(float updateInterval);
+
+	/// Adds the duration in seconds of a frame and of its phases, indexed by `Phase`
+	void addFrame(const float durations[Phase::COUNT]);
+	/// Clears the ring buffer, the percentiles, the histogram and the hitch counter
+	void reset();
+
+	/// Returns the number of frames currently in the ring buffer
+	inline unsigned int numFrames() const { return numFrames_; }
+	/// Returns the duration in seconds of a phase of one of the frames in the ring buffer, zero being the last one
+	float duration(Phase::Enum phase, unsigned int age) const;
+	/// Returns the percentiles of the durations of a phase
+	inline const Percentiles &percentiles(Phase::Enum phase) const { return percentiles_[phase]; }
+
+	/// Returns the number of frames in every histogram bin
+	inline const unsigned int *histogram() const { return histogram_; }
+	/// Returns the width in seconds of a histogram bin
+	inline float histogramBinWidth() const { return histogramBinWidth_; }
+	/// Sets the width in seconds of a histogram bin, clearing the histogram
+	void setHistogramBinWidth(float seconds);
+
+	/// Returns the thresholds used to detect hitches
+	inline HitchSettings &hitchSettings() { return hitchSettings_; }
+	/// Returns the number of hitches detected since the last reset
+	inline unsigned int numHitches() const { return numHitches_; }
+	/// Returns the duration in seconds of the phases of the last hitch, indexed by `Phase`
+	inline const float *lastHitch() const { return lastHitch_; }
+
+	/// Writes the percentiles of all phases and the hitch counter to the log
+	void logReport() const;
+
+	/// Returns the name of a phase
+	static const char *phaseName(Phase::Enum phase);
+
+  private:
+	float updateInterval_;
+	/// Frame time accumulated since the last percentiles update
+	float elapsedTime_;
+
+	float durations_[Phase::COUNT][NumFrames];
+	/// The index in the ring buffer of the next frame
+	unsigned int nextIndex_;
+	unsigned int numFrames_;
+	Percentiles percentiles_[Phase::COUNT];
+
+	float histogramBinWidth_;
+	unsigned int histogram_[NumHistogramBins];
+
+	HitchSettings hitchSettings_;
+	unsigned int numHitches_;
+	float lastHitch_[Phase::COUNT];
+
+	void updatePercentiles();
+	void checkHitch(const float durations[Phase::COUNT]);
+};
+
+}
+
+#endif
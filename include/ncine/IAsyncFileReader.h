@@ -0,0 +1,126 @@
+#ifndef CLASS_NCINE_IASYNCFILEREADER
+#define CLASS_NCINE_IASYNCFILEREADER
+
+#include "common_defines.h"
+#include <nctl/UniquePtr.h>
+
+namespace ncine {
+
+/// Asynchronous file reader interface class
+/*!
+ * Read requests are served in submission order by a worker thread, while completion callbacks
+ * are invoked by `update()` on the thread that calls it, once per frame by the application.
+ */
+class DLL_PUBLIC IAsyncFileReader
+{
+  public:
+	/// The information about a completed request that is passed to its callback
+	struct Result
+	{
+		Result()
+		    : requestId(0), filename(nullptr), data(nullptr), bytesRead(0),
+		      succeeded(false), readTime(0.0f), latency(0.0f), userData(nullptr) {}
+
+		/// The identifier returned on submission
+		unsigned int requestId;
+		/// File name with path
+		const char *filename;
+		/// Pointer to the data read, either the user buffer or the one allocated by the reader
+		unsigned char *data;
+		/// Number of bytes read
+		unsigned long int bytesRead;
+		/// True if all the requested bytes have been read
+		bool succeeded;
+		/// Time in seconds spent opening and reading the file
+		float readTime;
+		/// Time in seconds from the submission of the request to the end of the read
+		float latency;
+		/// The user data pointer specified on submission
+		void *userData;
+		/// The buffer allocated by the reader for whole file requests
+		/*! The callback can move it away to take ownership of the data, otherwise it is released after the call. */
+		nctl::UniquePtr<unsigned char[]> buffer;
+	};
+
+	/// The function called on the main thread when a request has been completed
+	using CompletionCallback = void (*)(Result &result);
+	/// The function called instead of the completion one when a request is canceled or discarded
+	/*! It lets the submitter release the user data, it is not invoked if the submission fails. */
+	using ReleaseCallback = void (*)(void *userData);
+
+	/// Statistics about the completed requests
+	struct Statistics
+	{
+		Statistics()
+		    : numSubmitted(0), numCompleted(0), numFailed(0), numCanceled(0), bytesRead(0),
+		      lastLatency(0.0f), averageLatency(0.0f), maxLatency(0.0f), lastReadTime(0.0f), averageReadTime(0.0f) {}
+
+		unsigned int numSubmitted;
+		/// Number of requests delivered to their callback, failed ones included
+		unsigned int numCompleted;
+		unsigned int numFailed;
+		unsigned int numCanceled;
+		unsigned long long int bytesRead;
+		float lastLatency;
+		float averageLatency;
+		float maxLatency;
+		float lastReadTime;
+		float averageReadTime;
+	};
+
+	virtual ~IAsyncFileReader() = 0;
+
+	/// Submits a request to read a range of a file into a user buffer
+	/*!
+	 * The buffer should stay valid until the callback has been invoked or the request has been canceled.
+	 * \return The request identifier, or zero if the request cannot be submitted
+	 */
+	virtual unsigned int submitRead(const char *filename, unsigned char *buffer, unsigned long int offset,
+	                                unsigned long int bytes, CompletionCallback callback, void *userData) = 0;
+	/// Submits a request to read a whole file into a buffer allocated by the reader
+	/*! \return The request identifier, or zero if the request cannot be submitted */
+	virtual unsigned int submitFileRead(const char *filename, CompletionCallback callback, void *userData) = 0;
+	/// Submits a request to read a whole file, with a callback to release the user data if the request is never completed
+	/*! \return The request identifier, or zero if the request cannot be submitted */
+	virtual unsigned int submitFileRead(const char *filename, CompletionCallback callback, ReleaseCallback releaseCallback, void *userData) = 0;
+	/// Cancels a request so that its callback is never invoked
+	/*!
+	 * If the request is being read the call waits for the read to end, the user buffer can be released afterwards.
+	 * It can be called from a completion callback, to cancel requests that are going to be delivered in the same update.
+	 * \return True if the request was still pending
+	 */
+	virtual bool cancel(unsigned int requestId) = 0;
+
+	/// Invokes the callbacks of the completed requests
+	virtual void update() = 0;
+
+	/// Returns the number of requests whose callback has not been invoked yet
+	virtual unsigned int numPendingRequests() const = 0;
+	/// Returns the statistics about the completed requests
+	virtual const Statistics &statistics() const = 0;
+};
+
+inline IAsyncFileReader::~IAsyncFileReader() {}
+
+/// A fake asynchronous file reader which doesn't read anything
+class DLL_PUBLIC NullAsyncFileReader : public IAsyncFileReader
+{
+  public:
+	unsigned int submitRead(const char *filename, unsigned char *buffer, unsigned long int offset,
+	                        unsigned long int bytes, CompletionCallback callback, void *userData) override { return 0; }
+	unsigned int submitFileRead(const char *filename, CompletionCallback callback, void *userData) override { return 0; }
+	unsigned int submitFileRead(const char *filename, CompletionCallback callback, ReleaseCallback releaseCallback, void *userData) override { return 0; }
+	bool cancel(unsigned int requestId) override { return false; }
+
+	void update() override {}
+
+	unsigned int numPendingRequests() const override { return 0; }
+	const Statistics &statistics() const override { return statistics_; }
+
+  private:
+	Statistics statistics_;
+};
+
+}
+
+#endif
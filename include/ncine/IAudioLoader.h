@@ -21,6 +21,9 @@ class DLL_PUBLIC IAudioLoader
 	virtual unsigned long int read(char *buffer, unsigned long int bufferSize) const = 0;
 	/// Resets the audio file seek value
 	virtual void rewind() const = 0;
+	/// Maps the decoded audio data to memory, if the file format allows it
+	/*! \return A pointer to the samples that can be used without a copy, or `nullptr` */
+	virtual const char *mapSamples() { return nullptr; }
 
 	/// Returns the duration in seconds
 	inline float duration() const { return duration_; }
@@ -38,6 +41,8 @@ class DLL_PUBLIC IAudioLoader
 
 	/// Returns the proper audio loader according to the file extension
 	static nctl::UniquePtr<IAudioLoader> createFromFile(const char *filename);
+	/// Returns the proper audio loader for a memory buffer according to the extension of its name
+	static nctl::UniquePtr<IAudioLoader> createFromMemory(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize);
 
   protected:
 	/// Audio file handle
@@ -57,6 +62,10 @@ class DLL_PUBLIC IAudioLoader
 
 	explicit IAudioLoader(const char *filename);
 	explicit IAudioLoader(nctl::UniquePtr<IFile> fileHandle);
+
+  private:
+	/// Returns the proper audio loader for a file handle according to its extension
+	static nctl::UniquePtr<IAudioLoader> createLoader(nctl::UniquePtr<IFile> fileHandle);
 };
 
 }
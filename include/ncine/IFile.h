@@ -5,9 +5,12 @@
 #include <cstdint> // for endianness conversions
 #include <nctl/String.h>
 #include <nctl/UniquePtr.h>
+#include <nctl/Array.h>
 
 namespace ncine {
 
+class PackArchive;
+
 /// The interface class dealing with file operations
 class DLL_PUBLIC IFile
 {
@@ -17,7 +20,8 @@ class DLL_PUBLIC IFile
 	{
 		BASE = 0,
 		STANDARD,
-		ASSET
+		ASSET,
+		MEMORY
 	};
 
 	/// Open mode bitmask
@@ -77,6 +81,17 @@ class DLL_PUBLIC IFile
 	/// Returns true if the file is already opened
 	virtual bool isOpened() const;
 
+	/// Maps the whole content of an opened file to a read-only memory region
+	/*! The base implementation reads the file into a memory buffer owned by the object.
+	 *  \return A pointer to the file content or `nullptr` if the file cannot be mapped */
+	virtual const unsigned char *mapToMemory();
+	/// Releases the memory region returned by `mapToMemory()`
+	virtual void unmapFromMemory();
+	/// Returns true if the file content is currently mapped to memory
+	inline bool isMappedToMemory() const { return mappedMemory_ != nullptr; }
+	/// Returns the pointer to the file content mapped to memory, if any
+	inline const unsigned char *mappedMemory() const { return mappedMemory_; }
+
 	/// Returns file name with path
 	const char *filename() const { return filename_.data(); }
 	/// Returns file extension
@@ -116,10 +131,30 @@ class DLL_PUBLIC IFile
 	}
 
 	/// Returns the proper file handle according to prepended tags
+	/*! Files found in a mounted pack archive take precedence over the ones in the file system. */
 	static nctl::UniquePtr<IFile> createFileHandle(const char *filename);
+	/// Returns a read-only file handle for a memory buffer
+	/*!
+	 * The buffer is not copied and it should stay valid while the handle is in use.
+	 * \param bufferName The name of the buffer, its extension is used by loaders to detect the format
+	 */
+	static nctl::UniquePtr<IFile> createFromMemory(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize);
 	/// Checks if a file can be accessed with the specified mode
 	static bool access(const char *filename, unsigned char mode);
 
+	/// Mounts a pack archive so that its entries are served before the file system ones
+	/*!
+	 * Entries are looked up by their path relative to the data path, archives mounted later take precedence.
+	 * Entry handles can only be opened for reading, a file to be written should not share its path with an entry.
+	 * \return True if the archive is valid and has been mounted
+	 */
+	static bool mountPack(const char *filename);
+	/// Unmounts all pack archives
+	/*! \warning Files created from an archive should not be accessed anymore after it has been unmounted. */
+	static void unmountPacks();
+	/// Returns the number of mounted pack archives
+	static unsigned int numMountedPacks() { return mountedPacks_.size(); }
+
 	/// Returns the base directory for data loading
 	static const nctl::String &dataPath() { return dataPath_; }
 	/// Returns the writable directory for saving data
@@ -153,11 +188,21 @@ class DLL_PUBLIC IFile
 	/// File size in bytes
 	long int fileSize_;
 
+	/// Pointer to the read-only memory region holding the file content
+	const unsigned char *mappedMemory_;
+	/// The buffer holding the file content when it is not mapped by the operating system
+	nctl::UniquePtr<unsigned char[]> mappedBuffer_;
+
   private:
 	/// The path for the application to load files from
 	static nctl::String dataPath_;
 	/// The path for the application to write files into
 	static nctl::String savePath_;
+	/// The pack archives searched by `createFileHandle()` before the file system
+	static nctl::Array<nctl::UniquePtr<PackArchive>> mountedPacks_;
+
+	/// Returns a file handle for an entry of a mounted pack archive, or `nullptr` if no archive contains it
+	static nctl::UniquePtr<IFile> createPackFileHandle(const char *filename);
 
 	/// Determines the correct save path based on the platform
 	static void initSavePath();
@@ -2,6 +2,13 @@
 #define CLASS_NCINE_IINDEXER
 
 #include "common_defines.h"
+#include <nctl/HashFunctions.h>
+
+namespace nctl {
+
+class StringView;
+
+}
 
 namespace ncine {
 
@@ -21,6 +28,13 @@ class DLL_PUBLIC IIndexer
 	/// Returns the object with the specified object id, if any
 	virtual Object *object(unsigned int id) const = 0;
 
+	/// Updates the name index after the name of an object has changed
+	virtual void updateObjectName(unsigned int id) = 0;
+	/// Returns the first object with the specified name and name hash, if any
+	virtual Object *firstWithName(const nctl::StringView &name, nctl::hash_t hash) const = 0;
+	/// Returns the next object with the same name of the specified one, if any
+	virtual Object *nextWithName(const Object *object) const = 0;
+
 	/// Returns true if the index is empty
 	virtual bool isEmpty() const = 0;
 
@@ -42,6 +56,10 @@ class DLL_PUBLIC NullIndexer : public IIndexer
 
 	Object *object(unsigned int id) const override { return nullptr; }
 
+	void updateObjectName(unsigned int id) override {}
+	Object *firstWithName(const nctl::StringView &name, nctl::hash_t hash) const override { return nullptr; }
+	Object *nextWithName(const Object *object) const override { return nullptr; }
+
 	bool isEmpty() const override { return true; }
 
 	unsigned int size() const override { return 0U; }
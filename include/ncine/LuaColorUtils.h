@@ -9,10 +9,27 @@ namespace ncine {
 
 class Colorf;
 
+namespace LuaNames {
+namespace Color {
+	static const char *r = "r";
+	static const char *g = "g";
+	static const char *b = "b";
+	static const char *a = "a";
+
+	static const char *Colorf = "ncine.color";
+}}
+
 /// Lua utilities for the `Color` class
 class DLL_PUBLIC LuaColorUtils
 {
   public:
+	/// The number of fields of the userdata pushed by `push()`
+	static const unsigned int NumFields = 4;
+
+	/// Returns the name of the metatable of the userdata pushed by `push()`
+	static inline const char *typeName() { return LuaNames::Color::Colorf; }
+
+	/// Pushes the color as a value type userdata, whose `type()` in scripts is `"userdata"`
 	static void push(lua_State *L, const Colorf &color);
 	static void pushField(lua_State *L, const char *name, const Colorf &color);
 	static Colorf retrieve(lua_State *L, int index, int &newIndex);
@@ -0,0 +1,100 @@
+#ifndef CLASS_NCINE_LUAPROFILER
+#define CLASS_NCINE_LUAPROFILER
+
+#include "common_defines.h"
+#include <nctl/HashMap.h>
+#include <nctl/String.h>
+#include <nctl/StringView.h>
+#include "TimeStamp.h"
+
+struct lua_State;
+
+namespace ncine {
+
+class LuaStateManager;
+
+/// A sampling profiler that captures the Lua call stack from the count hook of a state
+/*!
+ * Every sample is weighted by the time elapsed since the previous one, so that the aggregated
+ * stacks approximate the time spent in every function and not just the number of executed instructions.
+ */
+class DLL_PUBLIC LuaProfiler
+{
+  public:
+	/// The time spent in a function, in seconds
+	struct FunctionTimes
+	{
+		FunctionTimes()
+		    : selfTime(0.0f), totalTime(0.0f), numSamples(0) {}
+
+		/// Time spent with the function at the top of the stack
+		float selfTime;
+		/// Time spent with the function anywhere in the stack
+		float totalTime;
+		unsigned int numSamples;
+	};
+
+	explicit LuaProfiler(LuaStateManager &stateManager);
+
+	inline bool isEnabled() const { return enabled_; }
+	/// Starts or stops sampling from the count hook, previously collected samples are kept
+	void setEnabled(bool enabled);
+	/// Returns true if every sample is also sent to Tracy as a message with its stack
+	inline bool forwardsToTracy() const { return forwardToTracy_; }
+	inline void setForwardToTracy(bool forwardToTracy) { forwardToTracy_ = forwardToTracy; }
+	/// Discards all the collected samples
+	void reset();
+
+	inline unsigned int numSamples() const { return numSamples_; }
+	/// Returns a line per sampled stack in the collapsed format read by flame graph tools, weighted in microseconds
+	nctl::String collapsedStacks() const;
+	/// Returns a line per sampled function with its self and total time in milliseconds, sorted by self time
+	nctl::String functionTimes() const;
+
+	static void expose(lua_State *L);
+
+  private:
+	/// Number of stack levels captured by a sample, deeper levels are ignored
+	static const unsigned int MaxStackDepth = 32;
+	/// Maximum length of a single level in a collapsed stack, including the termination character
+	static const unsigned int MaxFrameLength = 128;
+	/// Capacity of a collapsed stack, enough for the maximum number of levels and their separators
+	static const unsigned int MaxStackLength = MaxStackDepth * MaxFrameLength;
+
+	LuaStateManager &stateManager_;
+	bool enabled_;
+	bool forwardToTracy_;
+	/// Time of the previous sample, or of the moment sampling was enabled
+	TimeStamp lastSampleTime_;
+	unsigned int numSamples_;
+
+	nctl::StringHashMap<float> stacks_;
+	nctl::StringHashMap<FunctionTimes> functions_;
+
+	/// Collapsed stack being sampled, reused to avoid allocations
+	nctl::String stackKey_;
+	/// Offsets in the collapsed stack where the name of every function starts, from the outermost level
+	unsigned int frameOffsets_[MaxStackDepth + 1];
+
+	/// Captures the call stack of the running thread
+	void sample(lua_State *L);
+	void addStack(float weight);
+	void addFunctions(unsigned int depth, float weight);
+	/// Returns the name of a function in the collapsed stack, from the outermost level
+	nctl::StringView frameName(unsigned int index) const;
+
+	static int luaIsEnabled(lua_State *L);
+	static int luaSetEnabled(lua_State *L);
+	static int luaReset(lua_State *L);
+	static int luaNumSamples(lua_State *L);
+	static int luaCollapsedStacks(lua_State *L);
+	static int luaFunctionTimes(lua_State *L);
+	static int luaForwardsToTracy(lua_State *L);
+	static int luaSetForwardToTracy(lua_State *L);
+
+	friend class LuaStateManager;
+};
+
+}
+
+#endif
@@ -12,6 +12,9 @@ namespace Rect {
 	static const char *y = "y";
 	static const char *w = "w";
 	static const char *h = "h";
+
+	static const char *Rectf = "ncine.rect";
+	static const char *Recti = "ncine.recti";
 }}
 
 /// Lua utilities for the `Rect` template class
@@ -19,6 +22,13 @@ template <class T>
 class LuaRectUtils
 {
   public:
+	/// The number of fields of the userdata pushed by `push()`
+	static const unsigned int NumFields = 4;
+
+	/// Returns the name of the metatable of the userdata pushed by `push()`
+	static const char *typeName();
+
+	/// Pushes the rectangle as a value type userdata, scripts can no longer iterate its fields with `pairs()`
 	static void push(lua_State *L, const Rect<T> &rect);
 	static void pushField(lua_State *L, const char *name, const Rect<T> &rect);
 	static Rect<T> retrieve(lua_State *L, int index, int &newIndex);
@@ -32,14 +42,19 @@ class LuaRectUtils
 using LuaRectfUtils = LuaRectUtils<float>;
 using LuaRectiUtils = LuaRectUtils<int>;
 
+template <>
+inline const char *LuaRectUtils<float>::typeName() { return LuaNames::Rect::Rectf; }
+template <>
+inline const char *LuaRectUtils<int>::typeName() { return LuaNames::Rect::Recti; }
+
 template <class T>
 void LuaRectUtils<T>::push(lua_State *L, const Rect<T> &rect)
 {
-	LuaUtils::createTable(L, 4, 0);
-	LuaUtils::pushField(L, LuaNames::Rect::x, rect.x);
-	LuaUtils::pushField(L, LuaNames::Rect::y, rect.y);
-	LuaUtils::pushField(L, LuaNames::Rect::w, rect.w);
-	LuaUtils::pushField(L, LuaNames::Rect::h, rect.h);
+	T *fields = static_cast<T *>(LuaUtils::newValueType(L, NumFields * sizeof(T), typeName()));
+	fields[0] = rect.x;
+	fields[1] = rect.y;
+	fields[2] = rect.w;
+	fields[3] = rect.h;
 }
 
 template <class T>
@@ -52,7 +67,13 @@ void LuaRectUtils<T>::pushField(lua_State *L, const char *name, const Rect<T> &r
 template <class T>
 Rect<T> LuaRectUtils<T>::retrieve(lua_State *L, int index, int &newIndex)
 {
-	if (LuaUtils::isTable(L, index))
+	const T *fields = static_cast<const T *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+	{
+		newIndex = index;
+		return Rect<T>(fields[0], fields[1], fields[2], fields[3]);
+	}
+	else if (LuaUtils::isTableOrUserData(L, index))
 	{
 		newIndex = index;
 		return retrieveTable(L, index);
@@ -67,6 +88,10 @@ Rect<T> LuaRectUtils<T>::retrieve(lua_State *L, int index, int &newIndex)
 template <class T>
 Rect<T> LuaRectUtils<T>::retrieveTable(lua_State *L, int index)
 {
+	const T *fields = static_cast<const T *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+		return Rect<T>(fields[0], fields[1], fields[2], fields[3]);
+
 	const T x = LuaUtils::retrieveField<T>(L, index, LuaNames::Rect::x);
 	const T y = LuaUtils::retrieveField<T>(L, index, LuaNames::Rect::y);
 	const T w = LuaUtils::retrieveField<T>(L, index, LuaNames::Rect::w);
@@ -109,14 +134,11 @@ Rect<T> LuaRectUtils<T>::retrieveParams(lua_State *L, int index)
 template <class T>
 Rect<T> LuaRectUtils<T>::retrieveTableField(lua_State *L, int index, const char *name)
 {
-	LuaUtils::retrieveFieldTable(L, index, name);
-	const T x = LuaUtils::retrieveField<T>(L, -1, LuaNames::Rect::x);
-	const T y = LuaUtils::retrieveField<T>(L, -1, LuaNames::Rect::y);
-	const T w = LuaUtils::retrieveField<T>(L, -1, LuaNames::Rect::w);
-	const T h = LuaUtils::retrieveField<T>(L, -1, LuaNames::Rect::h);
+	LuaUtils::getField(L, index, name);
+	const Rect<T> rect = retrieveTable(L, -1);
 	LuaUtils::pop(L);
 
-	return Rect<T>(x, y, w, h);
+	return rect;
 }
 
 template <class T>
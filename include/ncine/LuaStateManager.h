@@ -4,6 +4,7 @@
 #include "common_defines.h"
 #include <nctl/Array.h>
 #include "LuaTypes.h"
+#include "LuaProfiler.h"
 
 struct lua_State;
 struct lua_Debug;
@@ -34,15 +35,12 @@ class DLL_PUBLIC LuaStateManager
 		NOT_LOADED
 	};
 
-	struct StateToManager
+	enum class GarbageCollection
 	{
-		StateToManager()
-		    : luaState(nullptr), stateManager(nullptr) {}
-		StateToManager(lua_State *L, LuaStateManager *manager)
-		    : luaState(L), stateManager(manager) {}
-
-		lua_State *luaState;
-		LuaStateManager *stateManager;
+		/// The collector is paced by Lua and can run a step at every allocation
+		AUTOMATIC,
+		/// The collector only runs at the end of a frame, for no longer than the budget
+		FRAME_BUDGETED
 	};
 
 	struct UserDataWrapper
@@ -63,6 +61,7 @@ class DLL_PUBLIC LuaStateManager
 	void exposeModuleApi();
 	void exposeScriptApi();
 	bool run(const char *filename);
+	bool runFromMemory(const char *bufferName, const char *bufferPtr, unsigned long int bufferSize);
 
 	inline lua_State *state() { return L_; }
 	inline ApiType apiType() const { return apiType_; }
@@ -71,10 +70,28 @@ class DLL_PUBLIC LuaStateManager
 	inline nctl::Array<UserDataWrapper> &trackedUserDatas() { return trackedUserDatas_; }
 	inline nctl::Array<UserDataWrapper> &untrackedUserDatas() { return untrackedUserDatas_; }
 
+	inline GarbageCollection garbageCollection() const { return gcMode_; }
+	/// Stops the automatic collector and lets the application step it at the end of every frame, or restarts it
+	void setGarbageCollection(GarbageCollection gcMode);
+	/// Returns the maximum number of seconds spent by a frame budgeted collector in a frame
+	inline float gcBudget() const { return gcBudget_; }
+	void setGcBudget(float seconds);
+	/// Runs incremental collection steps until the number of seconds is exhausted or a cycle is completed
+	void stepGarbageCollector(float budget);
+
+	/// Steps the collectors of all the frame budgeted states, sharing the seconds left before the end of the frame
+	/*! If the frame rate is not limited, or no time is left, every collector runs for its own budget. */
+	static void stepGarbageCollectors(float timeLeft);
+
+	/// Returns the sampling profiler of the state
+	inline LuaProfiler &profiler() { return profiler_; }
+
+	/// Returns the manager of a Lua state or of one of its threads in constant time
 	static LuaStateManager *manager(lua_State *L);
 
   private:
-	static nctl::Array<StateToManager> managers_;
+	/// The states whose collector is stepped at the end of every frame
+	static nctl::Array<LuaStateManager *> budgetedManagers_;
 
 	lua_State *L_;
 	ApiType apiType_;
@@ -85,15 +102,38 @@ class DLL_PUBLIC LuaStateManager
 	/// True if the Lua state should be closed upon destruction
 	bool closeOnDestruction_;
 
+	GarbageCollection gcMode_;
+	float gcBudget_;
+	/// Memory in use in Kbytes at the end of the last collection cycle
+	int gcMemoryAfterCycle_;
+	/// True if a collection cycle has been started by a frame budgeted step and is not completed yet
+	bool gcCycleInProgress_;
+
+	LuaProfiler profiler_;
+
+	/// Returns true if the state has been created by the engine and its extra space can be used
+	static bool isEngineState(lua_State *L);
 	static void *luaAllocator(void *ud, void *ptr, size_t osize, size_t nsize);
 	static void *luaAllocatorWithStatistics(void *ud, void *ptr, size_t osize, size_t nsize);
 	static void luaCountHook(lua_State *L, lua_Debug *ar);
 
+	static int luaGcMode(lua_State *L);
+	static int luaSetGcMode(lua_State *L);
+	static int luaGcBudget(lua_State *L);
+	static int luaSetGcBudget(lua_State *L);
+	/// Installs the count hook if it is needed by the statistics or by the profiler, removes it otherwise
+	void updateCountHook();
+
 	void exposeApi();
 	void exposeConstants();
+	/// Exposes the functions to change the garbage collection mode and budget of the state
+	void exposeGarbageCollector();
+	/// Creates the metatables of the math types pushed as userdata, they are needed even without the script API
+	void exposeValueTypes();
 
 	friend class LuaEventHandler;
 	friend class LuaStatistics;
+	friend class LuaProfiler;
 };
 
 }
@@ -21,6 +21,7 @@ namespace LuaUtils {
 	DLL_PUBLIC bool isNil(lua_State *L, int index);
 	DLL_PUBLIC bool isTable(int type);
 	DLL_PUBLIC bool isTable(lua_State *L, int index);
+	DLL_PUBLIC bool isTableOrUserData(lua_State *L, int index);
 
 	DLL_PUBLIC size_t rawLen(lua_State *L, int index);
 	DLL_PUBLIC int rawGeti(lua_State *L, int index, int64_t n);
@@ -39,6 +40,8 @@ namespace LuaUtils {
 	template <> DLL_PUBLIC const char *retrieve<const char *>(lua_State *L, int index);
 	template <> DLL_PUBLIC bool retrieve<bool>(lua_State *L, int index);
 	void *retrieveUserData(lua_State *L, int index); // not DLL_PUBLIC
+	DLL_PUBLIC void *newValueType(lua_State *L, size_t size, const char *typeName);
+	DLL_PUBLIC void *retrieveValueType(lua_State *L, int index, const char *typeName);
 	template <class T> T *retrieveUserData(lua_State *L, int index) { return static_cast<T *>(retrieveUserData(L, index)); }
 	void assertArrayLength(lua_State *L, int index, unsigned int length); // utility function, not DLL_PUBLIC
 
@@ -10,6 +10,9 @@ namespace LuaNames {
 namespace Vector2 {
 	static const char *x = "x";
 	static const char *y = "y";
+
+	static const char *Vector2f = "ncine.vec2";
+	static const char *Vector2i = "ncine.vec2i";
 }}
 
 /// Lua utilities for the `Vector2` template class
@@ -17,6 +20,13 @@ template <class T>
 class LuaVector2Utils
 {
   public:
+	/// The number of fields of the userdata pushed by `push()`
+	static const unsigned int NumFields = 2;
+
+	/// Returns the name of the metatable of the userdata pushed by `push()`
+	static const char *typeName();
+
+	/// Pushes the vector as a value type userdata, not as a table, see `LuaValueType`
 	static void push(lua_State *L, const Vector2<T> &v);
 	static void pushField(lua_State *L, const char *name, const Vector2<T> &v);
 	static Vector2<T> retrieve(lua_State *L, int index, int &newIndex);
@@ -30,12 +40,17 @@ class LuaVector2Utils
 using LuaVector2fUtils = LuaVector2Utils<float>;
 using LuaVector2iUtils = LuaVector2Utils<int>;
 
+template <>
+inline const char *LuaVector2Utils<float>::typeName() { return LuaNames::Vector2::Vector2f; }
+template <>
+inline const char *LuaVector2Utils<int>::typeName() { return LuaNames::Vector2::Vector2i; }
+
 template <class T>
 void LuaVector2Utils<T>::push(lua_State *L, const Vector2<T> &v)
 {
-	LuaUtils::createTable(L, 2, 0);
-	LuaUtils::pushField(L, LuaNames::Vector2::x, v.x);
-	LuaUtils::pushField(L, LuaNames::Vector2::y, v.y);
+	T *fields = static_cast<T *>(LuaUtils::newValueType(L, NumFields * sizeof(T), typeName()));
+	fields[0] = v.x;
+	fields[1] = v.y;
 }
 
 template <class T>
@@ -48,7 +63,13 @@ void LuaVector2Utils<T>::pushField(lua_State *L, const char *name, const Vector2
 template <class T>
 Vector2<T> LuaVector2Utils<T>::retrieve(lua_State *L, int index, int &newIndex)
 {
-	if (LuaUtils::isTable(L, index))
+	const T *fields = static_cast<const T *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+	{
+		newIndex = index;
+		return Vector2<T>(fields[0], fields[1]);
+	}
+	else if (LuaUtils::isTableOrUserData(L, index))
 	{
 		newIndex = index;
 		return retrieveTable(L, index);
@@ -63,6 +84,10 @@ Vector2<T> LuaVector2Utils<T>::retrieve(lua_State *L, int index, int &newIndex)
 template <class T>
 Vector2<T> LuaVector2Utils<T>::retrieveTable(lua_State *L, int index)
 {
+	const T *fields = static_cast<const T *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+		return Vector2<T>(fields[0], fields[1]);
+
 	const T x = LuaUtils::retrieveField<T>(L, index, LuaNames::Vector2::x);
 	const T y = LuaUtils::retrieveField<T>(L, index, LuaNames::Vector2::y);
 	return Vector2<T>(x, y);
@@ -93,12 +118,11 @@ Vector2<T> LuaVector2Utils<T>::retrieveParams(lua_State *L, int index)
 template <class T>
 Vector2<T> LuaVector2Utils<T>::retrieveTableField(lua_State *L, int index, const char *name)
 {
-	LuaUtils::retrieveFieldTable(L, index, name);
-	const T x = LuaUtils::retrieveField<T>(L, -1, LuaNames::Vector2::x);
-	const T y = LuaUtils::retrieveField<T>(L, -1, LuaNames::Vector2::y);
+	LuaUtils::getField(L, index, name);
+	const Vector2<T> v = retrieveTable(L, -1);
 	LuaUtils::pop(L);
 
-	return Vector2<T>(x, y);
+	return v;
 }
 
 template <class T>
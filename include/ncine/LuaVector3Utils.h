@@ -11,6 +11,9 @@ namespace Vector3 {
 	static const char *x = "x";
 	static const char *y = "y";
 	static const char *z = "z";
+
+	static const char *Vector3f = "ncine.vec3";
+	static const char *Vector3i = "ncine.vec3i";
 }}
 
 /// Lua utilities for the `Vector3` template class
@@ -18,6 +21,13 @@ template <class T>
 class LuaVector3Utils
 {
   public:
+	/// The number of fields of the userdata pushed by `push()`
+	static const unsigned int NumFields = 3;
+
+	/// Returns the name of the metatable of the userdata pushed by `push()`
+	static const char *typeName();
+
+	/// Pushes the vector as a value type userdata with `x`, `y` and `z` fields
 	static void push(lua_State *L, const Vector3<T> &v);
 	static void pushField(lua_State *L, const char *name, const Vector3<T> &v);
 	static Vector3<T> retrieve(lua_State *L, int index, int &newIndex);
@@ -31,13 +41,18 @@ class LuaVector3Utils
 using LuaVector3fUtils = LuaVector3Utils<float>;
 using LuaVector3iUtils = LuaVector3Utils<int>;
 
+template <>
+inline const char *LuaVector3Utils<float>::typeName() { return LuaNames::Vector3::Vector3f; }
+template <>
+inline const char *LuaVector3Utils<int>::typeName() { return LuaNames::Vector3::Vector3i; }
+
 template <class T>
 void LuaVector3Utils<T>::push(lua_State *L, const Vector3<T> &v)
 {
-	LuaUtils::createTable(L, 3, 0);
-	LuaUtils::pushField(L, LuaNames::Vector3::x, v.x);
-	LuaUtils::pushField(L, LuaNames::Vector3::y, v.y);
-	LuaUtils::pushField(L, LuaNames::Vector3::z, v.z);
+	T *fields = static_cast<T *>(LuaUtils::newValueType(L, NumFields * sizeof(T), typeName()));
+	fields[0] = v.x;
+	fields[1] = v.y;
+	fields[2] = v.z;
 }
 
 template <class T>
@@ -50,7 +65,13 @@ void LuaVector3Utils<T>::pushField(lua_State *L, const char *name, const Vector3
 template <class T>
 Vector3<T> LuaVector3Utils<T>::retrieve(lua_State *L, int index, int &newIndex)
 {
-	if (LuaUtils::isTable(L, index))
+	const T *fields = static_cast<const T *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+	{
+		newIndex = index;
+		return Vector3<T>(fields[0], fields[1], fields[2]);
+	}
+	else if (LuaUtils::isTableOrUserData(L, index))
 	{
 		newIndex = index;
 		return retrieveTable(L, index);
@@ -65,6 +86,10 @@ Vector3<T> LuaVector3Utils<T>::retrieve(lua_State *L, int index, int &newIndex)
 template <class T>
 Vector3<T> LuaVector3Utils<T>::retrieveTable(lua_State *L, int index)
 {
+	const T *fields = static_cast<const T *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+		return Vector3<T>(fields[0], fields[1], fields[2]);
+
 	const T x = LuaUtils::retrieveField<T>(L, index, LuaNames::Vector3::x);
 	const T y = LuaUtils::retrieveField<T>(L, index, LuaNames::Vector3::y);
 	const T z = LuaUtils::retrieveField<T>(L, index, LuaNames::Vector3::z);
@@ -101,13 +126,11 @@ Vector3<T> LuaVector3Utils<T>::retrieveParams(lua_State *L, int index)
 template <class T>
 Vector3<T> LuaVector3Utils<T>::retrieveTableField(lua_State *L, int index, const char *name)
 {
-	LuaUtils::retrieveFieldTable(L, index, name);
-	const T x = LuaUtils::retrieveField<T>(L, -1, LuaNames::Vector3::x);
-	const T y = LuaUtils::retrieveField<T>(L, -1, LuaNames::Vector3::y);
-	const T z = LuaUtils::retrieveField<T>(L, -1, LuaNames::Vector3::z);
+	LuaUtils::getField(L, index, name);
+	const Vector3<T> v = retrieveTable(L, -1);
 	LuaUtils::pop(L);
 
-	return Vector3<T>(x, y, z);
+	return v;
 }
 
 template <class T>
@@ -0,0 +1,64 @@
+#ifndef CLASS_NCINE_NODECOMPONENTS
+#define CLASS_NCINE_NODECOMPONENTS
+
+#include "Vector2.h"
+#include "Color.h"
+#include <nctl/ComponentPool.h>
+
+namespace ncine {
+
+class SceneNode;
+class DrawableNode;
+
+/// A component with the local transformation of a scene node
+struct DLL_PUBLIC TransformComponent
+{
+	TransformComponent()
+	    : position(0.0f, 0.0f), rotation(0.0f), scale(1.0f) {}
+	TransformComponent(const Vector2f &pos, float rot, float scaleFactor)
+	    : position(pos), rotation(rot), scale(scaleFactor) {}
+
+	Vector2f position;
+	float rotation;
+	float scale;
+};
+
+/// A component with the state used by a drawable node to update its render command
+struct DLL_PUBLIC DrawComponent
+{
+	DrawComponent()
+	    : color(Color::White), layer(0), drawEnabled(true) {}
+
+	Color color;
+	unsigned int layer;
+	bool drawEnabled;
+};
+
+/// Bridges component pools and the scene graph
+/*!
+ * Entities are bound to nodes by storing node pointers in a pool, then component data is applied
+ * in bulk with a single pass over the smallest of the pools.
+ * \note Nodes are not owned by the pools, a node should be removed from its pool before being deleted.
+ */
+class DLL_PUBLIC NodeComponents
+{
+  public:
+	using SceneNodePool = nctl::ComponentPool<SceneNode *>;
+	using DrawableNodePool = nctl::ComponentPool<DrawableNode *>;
+	using TransformPool = nctl::ComponentPool<TransformComponent>;
+	using DrawPool = nctl::ComponentPool<DrawComponent>;
+
+	/// Sets the local transformation of every node whose entity has a transform component
+	/*! \return The number of updated nodes */
+	static unsigned int applyTransforms(TransformPool &transforms, SceneNodePool &nodes);
+	/// Stores the local transformation of every node in the transform component of its entity
+	/*! \return The number of updated components */
+	static unsigned int storeTransforms(SceneNodePool &nodes, TransformPool &transforms);
+	/// Sets color, layer and drawing state of every drawable node whose entity has a draw component
+	/*! \return The number of updated nodes */
+	static unsigned int applyDrawState(DrawPool &drawStates, DrawableNodePool &nodes);
+};
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define CLASS_NCINE_OBJECT
 
 #include <nctl/String.h>
+#include <nctl/StringId.h>
 
 namespace ncine {
 
@@ -46,12 +47,28 @@ class DLL_PUBLIC Object
 
 	/// Returns the object name
 	inline const nctl::String &name() const { return name_; }
-	/// Sets the object name
-	inline void setName(const nctl::String &name) { name_ = name; }
+	/// Sets the object name and updates the name index
+	void setName(const nctl::String &name);
 
 	/// Returns a casted pointer to the object with the specified id, if any exists
 	template <class T>
-	static T *fromId(unsigned int id);
+	static T *fromId(unsigned int id) { return static_cast<T *>(objectFromId(id, T::sType())); }
+
+	/// Returns a casted pointer to an object with the specified name and type, if any exists
+	/*! \note If more objects share the same name, the one named last is returned first. Use `Object` as type to match any object.
+	 *  \note It requires the name index to be enabled with `AppConfiguration::withObjectNameIndex`. */
+	template <class T>
+	static T *fromName(const char *name) { return fromName<T>(nctl::StringView(name)); }
+	/// Returns a casted pointer to an object with the specified name and type, if any exists
+	template <class T>
+	static T *fromName(const nctl::StringView &name) { return static_cast<T *>(objectFromName(name, name.hash(), T::sType())); }
+	/// Returns a casted pointer to an object with the specified interned name and type, if any exists
+	template <class T>
+	static T *fromName(const nctl::StringId &name) { return static_cast<T *>(objectFromName(name.view(), name.hash(), T::sType())); }
+
+	/// Returns a casted pointer to the next object after the specified one that has the same name and type, if any exists
+	template <class T>
+	static T *nextWithName(const Object *object) { return static_cast<T *>(nextObjectWithName(object, T::sType())); }
 
   protected:
 	/// Object type
@@ -61,11 +78,13 @@ class DLL_PUBLIC Object
 	/// Object identification in the indexer
 	unsigned int id_;
 
-	/// Object name
-	/*! \note This field is currently only useful in debug,
-	 *  as there is still no string hashing based search. */
+	/// Object name, indexed by hash to allow searching
 	nctl::String name_;
 
+	static Object *objectFromId(unsigned int id, ObjectType type);
+	static Object *objectFromName(const nctl::StringView &name, nctl::hash_t hash, ObjectType type);
+	static Object *nextObjectWithName(const Object *object, ObjectType type);
+
 	/// Deleted copy constructor
 	Object(const Object &) = delete;
 	/// Deleted assignment operator
@@ -0,0 +1,225 @@
+#ifndef CLASS_NCINE_PARALLELALGORITHMS
+#define CLASS_NCINE_PARALLELALGORITHMS
+
+#include "IThreadPool.h"
+#include <nctl/algorithms.h>
+#include <nctl/UniquePtr.h>
+
+namespace ncine {
+
+/// Splits a range of indices in chunks and processes them with the worker threads of a pool
+/*!
+ * The calling thread processes chunks too and the function only returns when all of them are done.
+ * If the pool has no worker threads, like the `NullThreadPool`, every chunk is processed serially by the calling thread.
+ */
+class DLL_PUBLIC ParallelRange
+{
+  public:
+	/// A function that processes the indices from `begin` to `end`, excluded
+	using RangeFunction = void (*)(void *userData, unsigned int begin, unsigned int end);
+
+	/// The default number of elements processed by a chunk, ranges not larger than this are processed serially
+	static const unsigned int DefaultGrainSize = 4096;
+
+	/// Calls the function on consecutive chunks of `grainSize` indices, from zero to `size`
+	/*! \note The function is called concurrently by different threads */
+	static void run(IThreadPool &threadPool, unsigned int size, unsigned int grainSize, RangeFunction function, void *userData);
+
+	/// Calls a function object on consecutive chunks of `grainSize` indices, from zero to `size`
+	template <class Function>
+	static void run(IThreadPool &threadPool, unsigned int size, unsigned int grainSize, Function &function)
+	{
+		run(threadPool, size, grainSize, invokeFunction<Function>, &function);
+	}
+
+  private:
+	template <class Function>
+	static void invokeFunction(void *userData, unsigned int begin, unsigned int end)
+	{
+		(*static_cast<Function *>(userData))(begin, end);
+	}
+};
+
+namespace {
+
+	/// Merges two sorted runs by moving their elements, the first run wins the ties
+	template <class IteratorIn, class IteratorOut, class Compare>
+	void mergeRuns(IteratorIn first1, const IteratorIn last1, IteratorIn first2, const IteratorIn last2, IteratorOut result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first2, *first1))
+			{
+				*result = nctl::move(*first2);
+				++first2;
+			}
+			else
+			{
+				*result = nctl::move(*first1);
+				++first1;
+			}
+			++result;
+		}
+
+		for (; first1 != last1; ++first1, ++result)
+			*result = nctl::move(*first1);
+		for (; first2 != last2; ++first2, ++result)
+			*result = nctl::move(*first2);
+	}
+
+	/// Merges every pair of adjacent runs of the specified width from the source to the destination range
+	template <class IteratorIn, class IteratorOut, class Compare>
+	void mergePass(IThreadPool &threadPool, IteratorIn source, IteratorOut destination, unsigned int size, unsigned int width, Compare comp)
+	{
+		auto mergeFunction = [source, destination, width, comp](unsigned int begin, unsigned int end) {
+			const unsigned int middle = nctl::min(begin + width, end);
+			mergeRuns(source + static_cast<int>(begin), source + static_cast<int>(middle),
+			          source + static_cast<int>(middle), source + static_cast<int>(end),
+			          destination + static_cast<int>(begin), comp);
+		};
+		// Every chunk is made of the two runs to merge
+		ParallelRange::run(threadPool, size, width * 2, mergeFunction);
+	}
+
+}
+
+/// Applies a function to every element in the range, in parallel
+/*! \note The function is called concurrently by different threads and should not depend on the order of the elements */
+template <class Iterator, class Function>
+void parallelForEach(IThreadPool &threadPool, Iterator first, const Iterator last, Function fn, unsigned int grainSize = ParallelRange::DefaultGrainSize)
+{
+	const int size = nctl::distance(first, last);
+	if (size <= static_cast<int>(grainSize))
+	{
+		nctl::forEach(first, last, fn);
+		return;
+	}
+
+	auto chunkFunction = [first, &fn](unsigned int begin, unsigned int end) {
+		Iterator it = first + static_cast<int>(begin);
+		for (unsigned int i = begin; i < end; i++, ++it)
+			fn(*it);
+	};
+	ParallelRange::run(threadPool, static_cast<unsigned int>(size), grainSize, chunkFunction);
+}
+
+/// Applies an operation to every element in the range and stores the results in another range, in parallel
+template <class IteratorIn, class IteratorOut, class UnaryOperation>
+IteratorOut parallelTransform(IThreadPool &threadPool, IteratorIn first, const IteratorIn last, IteratorOut result, UnaryOperation op,
+                              unsigned int grainSize = ParallelRange::DefaultGrainSize)
+{
+	const int size = nctl::distance(first, last);
+	if (size <= static_cast<int>(grainSize))
+		return nctl::transform(first, last, result, op);
+
+	auto chunkFunction = [first, result, &op](unsigned int begin, unsigned int end) {
+		IteratorIn it = first + static_cast<int>(begin);
+		IteratorOut resultIt = result + static_cast<int>(begin);
+		for (unsigned int i = begin; i < end; i++, ++it, ++resultIt)
+			*resultIt = op(*it);
+	};
+	ParallelRange::run(threadPool, static_cast<unsigned int>(size), grainSize, chunkFunction);
+
+	return result + size;
+}
+
+/// Combines all the elements in the range with a binary operation, in parallel
+/*!
+ * Every chunk is reduced independently, then the partial results are combined in order with the initial value.
+ * \note The operation should be associative, the result does not depend on the number of threads.
+ */
+template <class Iterator, class T, class BinaryOperation>
+T parallelReduce(IThreadPool &threadPool, Iterator first, const Iterator last, T init, BinaryOperation op,
+                 unsigned int grainSize = ParallelRange::DefaultGrainSize)
+{
+	const int size = nctl::distance(first, last);
+	if (size <= static_cast<int>(grainSize))
+	{
+		for (; first != last; ++first)
+			init = op(init, *first);
+		return init;
+	}
+
+	const unsigned int numChunks = (static_cast<unsigned int>(size) + grainSize - 1) / grainSize;
+	nctl::UniquePtr<T[]> partials = nctl::makeUnique<T[]>(numChunks);
+
+	auto chunkFunction = [first, &partials, &op, grainSize](unsigned int begin, unsigned int end) {
+		Iterator it = first + static_cast<int>(begin);
+		T partial = *it;
+		++it;
+		for (unsigned int i = begin + 1; i < end; i++, ++it)
+			partial = op(partial, *it);
+		partials[begin / grainSize] = partial;
+	};
+	ParallelRange::run(threadPool, static_cast<unsigned int>(size), grainSize, chunkFunction);
+
+	for (unsigned int i = 0; i < numChunks; i++)
+		init = op(init, partials[i]);
+	return init;
+}
+
+/// Sorts the elements in the range with a custom compare function, in parallel
+/*!
+ * The range is split in one run per thread, each run is sorted with `quicksort()` and then
+ * pairs of adjacent runs are merged in parallel through a temporary buffer until only one is left.
+ * \note The iterators should be random access ones.
+ */
+template <class Iterator, class Compare>
+void parallelSort(IThreadPool &threadPool, Iterator first, Iterator last, Compare comp, unsigned int grainSize = ParallelRange::DefaultGrainSize)
+{
+	using T = typename nctl::IteratorTraits<Iterator>::ValueType;
+
+	const int size = nctl::distance(first, last);
+	const unsigned int numThreads = threadPool.numThreads();
+	if (size <= static_cast<int>(grainSize) || numThreads == 0)
+	{
+		nctl::quicksort(first, last, comp);
+		return;
+	}
+
+	const unsigned int unsignedSize = static_cast<unsigned int>(size);
+	// One run for every worker and one for the calling thread, but none smaller than the grain size
+	unsigned int runSize = (unsignedSize + numThreads) / (numThreads + 1);
+	runSize = nctl::max(runSize, grainSize);
+
+	auto sortFunction = [first, comp](unsigned int begin, unsigned int end) {
+		nctl::quicksort(first + static_cast<int>(begin), first + static_cast<int>(end), comp);
+	};
+	ParallelRange::run(threadPool, unsignedSize, runSize, sortFunction);
+
+	if (runSize >= unsignedSize)
+		return;
+
+	nctl::UniquePtr<T[]> buffer = nctl::makeUnique<T[]>(unsignedSize);
+	bool sortedInBuffer = false;
+	for (unsigned int width = runSize; width < unsignedSize; width *= 2)
+	{
+		if (sortedInBuffer)
+			mergePass(threadPool, buffer.get(), first, unsignedSize, width, comp);
+		else
+			mergePass(threadPool, first, buffer.get(), unsignedSize, width, comp);
+		sortedInBuffer = !sortedInBuffer;
+	}
+
+	if (sortedInBuffer)
+	{
+		T *sorted = buffer.get();
+		auto moveFunction = [first, sorted](unsigned int begin, unsigned int end) {
+			Iterator it = first + static_cast<int>(begin);
+			for (unsigned int i = begin; i < end; i++, ++it)
+				*it = nctl::move(sorted[i]);
+		};
+		ParallelRange::run(threadPool, unsignedSize, grainSize, moveFunction);
+	}
+}
+
+/// Sorts the elements in the range in ascending order, in parallel
+template <class Iterator>
+void parallelSort(IThreadPool &threadPool, Iterator first, Iterator last)
+{
+	parallelSort(threadPool, first, last, nctl::IsLess<typename nctl::IteratorTraits<Iterator>::ValueType>);
+}
+
+}
+
+#endif
@@ -3,7 +3,7 @@
 
 #include "Vector2.h"
 #include "Colorf.h"
-#include <nctl/Array.h>
+#include <nctl/SmallArray.h>
 
 namespace ncine {
 
@@ -38,18 +38,17 @@ class DLL_PUBLIC ColorAffector : public ParticleAffector
 		    : age(newAge), color(newColor) {}
 	};
 
-	ColorAffector()
-	    : colorSteps_(StepsInitialSize) {}
+	ColorAffector() {}
 
 	/// Affects the color of the specified particle
 	void affect(Particle *particle, float normalizedAge) override;
 	void addColorStep(float age, const Colorf &color);
 
-	inline nctl::Array<ColorStep> &steps() { return colorSteps_; }
-	inline const nctl::Array<ColorStep> &steps() const { return colorSteps_; }
+	inline nctl::SmallArray<ColorStep, StepsInitialSize> &steps() { return colorSteps_; }
+	inline const nctl::SmallArray<ColorStep, StepsInitialSize> &steps() const { return colorSteps_; }
 
   private:
-	nctl::Array<ColorStep> colorSteps_;
+	nctl::SmallArray<ColorStep, StepsInitialSize> colorSteps_;
 };
 
 /// Particle size affector
@@ -69,20 +68,20 @@ class DLL_PUBLIC SizeAffector : public ParticleAffector
 
 	/// Constructs a size affector with a base scale factor as a reference
 	explicit SizeAffector(float baseScale)
-	    : sizeSteps_(StepsInitialSize), baseScale_(baseScale) {}
+	    : baseScale_(baseScale) {}
 
 	/// Affects the size of the specified particle
 	void affect(Particle *particle, float normalizedAge) override;
 	void addSizeStep(float age, float scale);
 
-	inline nctl::Array<SizeStep> &steps() { return sizeSteps_; }
-	inline const nctl::Array<SizeStep> &steps() const { return sizeSteps_; }
+	inline nctl::SmallArray<SizeStep, StepsInitialSize> &steps() { return sizeSteps_; }
+	inline const nctl::SmallArray<SizeStep, StepsInitialSize> &steps() const { return sizeSteps_; }
 
 	inline float baseScale() const { return baseScale_; }
 	inline void setBaseScale(float baseScale) { baseScale_ = baseScale; }
 
   private:
-	nctl::Array<SizeStep> sizeSteps_;
+	nctl::SmallArray<SizeStep, StepsInitialSize> sizeSteps_;
 	float baseScale_;
 };
 
@@ -101,18 +100,17 @@ class DLL_PUBLIC RotationAffector : public ParticleAffector
 		    : age(newAge), angle(newAngle) {}
 	};
 
-	RotationAffector()
-	    : rotationSteps_(StepsInitialSize) {}
+	RotationAffector() {}
 
 	/// Affects the rotation of the specified particle
 	void affect(Particle *particle, float normalizedAge) override;
 	void addRotationStep(float age, float angle);
 
-	inline nctl::Array<RotationStep> &steps() { return rotationSteps_; }
-	inline const nctl::Array<RotationStep> &steps() const { return rotationSteps_; }
+	inline nctl::SmallArray<RotationStep, StepsInitialSize> &steps() { return rotationSteps_; }
+	inline const nctl::SmallArray<RotationStep, StepsInitialSize> &steps() const { return rotationSteps_; }
 
   private:
-	nctl::Array<RotationStep> rotationSteps_;
+	nctl::SmallArray<RotationStep, StepsInitialSize> rotationSteps_;
 };
 
 /// Particle position affector
@@ -130,19 +128,18 @@ class DLL_PUBLIC PositionAffector : public ParticleAffector
 		    : age(newAge), position(newPositionX, newPositionY) {}
 	};
 
-	PositionAffector()
-	    : positionSteps_(StepsInitialSize) {}
+	PositionAffector() {}
 
 	/// Affects the position of the specified particle
 	void affect(Particle *particle, float normalizedAge) override;
 	void addPositionStep(float age, float posX, float posY);
 	inline void addPositionStep(float age, const Vector2f &position) { addPositionStep(age, position.x, position.y); }
 
-	inline nctl::Array<PositionStep> &steps() { return positionSteps_; }
-	inline const nctl::Array<PositionStep> &steps() const { return positionSteps_; }
+	inline nctl::SmallArray<PositionStep, StepsInitialSize> &steps() { return positionSteps_; }
+	inline const nctl::SmallArray<PositionStep, StepsInitialSize> &steps() const { return positionSteps_; }
 
   private:
-	nctl::Array<PositionStep> positionSteps_;
+	nctl::SmallArray<PositionStep, StepsInitialSize> positionSteps_;
 };
 
 /// Particle velocity affector
@@ -160,19 +157,18 @@ class DLL_PUBLIC VelocityAffector : public ParticleAffector
 		    : age(newAge), velocity(newVelocityX, newVelocityY) {}
 	};
 
-	VelocityAffector()
-	    : velocitySteps_(StepsInitialSize) {}
+	VelocityAffector() {}
 
 	/// Affects the velocity of the specified particle
 	void affect(Particle *particle, float normalizedAge) override;
 	void addVelocityStep(float age, float velX, float velY);
 	inline void addVelocityStep(float age, const Vector2f &velocity) { addVelocityStep(age, velocity.x, velocity.y); }
 
-	inline nctl::Array<VelocityStep> &steps() { return velocitySteps_; }
-	inline const nctl::Array<VelocityStep> &steps() const { return velocitySteps_; }
+	inline nctl::SmallArray<VelocityStep, StepsInitialSize> &steps() { return velocitySteps_; }
+	inline const nctl::SmallArray<VelocityStep, StepsInitialSize> &steps() const { return velocitySteps_; }
 
   private:
-	nctl::Array<VelocityStep> velocitySteps_;
+	nctl::SmallArray<VelocityStep, StepsInitialSize> velocitySteps_;
 };
 
 }
@@ -1,7 +1,7 @@
 #ifndef CLASS_NCINE_RECTANIMATION
 #define CLASS_NCINE_RECTANIMATION
 
-#include <nctl/Array.h>
+#include <nctl/SmallArray.h>
 #include "Rect.h"
 
 namespace ncine {
@@ -57,9 +57,9 @@ class DLL_PUBLIC RectAnimation
 	/// Returns the number of rectangles
 	inline unsigned int numRectangles() { return rects_.size(); }
 	/// Returns the array of all rectangles
-	inline nctl::Array<Recti> &rectangles() { return rects_; }
+	inline nctl::SmallArray<Recti, 4> &rectangles() { return rects_; }
 	/// Returns the constant array of all rectangles
-	inline const nctl::Array<Recti> &rectangles() const { return rects_; }
+	inline const nctl::SmallArray<Recti, 4> &rectangles() const { return rects_; }
 
   private:
 	/// The time until the next frame change
@@ -70,7 +70,7 @@ class DLL_PUBLIC RectAnimation
 	RewindMode rewindMode_;
 
 	/// The rectangles array
-	nctl::Array<Recti> rects_;
+	nctl::SmallArray<Recti, 4> rects_;
 	/// Current frame
 	unsigned int currentFrame_;
 	/// Elapsed time since the last frame change
@@ -12,6 +12,7 @@
 #include "ILogger.h"
 #include "IAudioDevice.h"
 #include "IThreadPool.h"
+#include "IAsyncFileReader.h"
 #include "IGfxCapabilities.h"
 
 namespace ncine {
@@ -49,6 +50,13 @@ class DLL_PUBLIC ServiceLocator
 	/// Unregisters the thread pool provider and reinstates the null one
 	void unregisterThreadPool();
 
+	/// Returns a reference to the current asynchronous file reader instance
+	IAsyncFileReader &asyncFileReader() { return *asyncFileReader_; }
+	/// Registers an asynchronous file reader provider
+	void registerAsyncFileReader(nctl::UniquePtr<IAsyncFileReader> service);
+	/// Unregisters the asynchronous file reader provider and reinstates the null one
+	void unregisterAsyncFileReader();
+
 	/// Returns a reference to the current graphics capabilities instance
 	const IGfxCapabilities &gfxCapabilities() { return *gfxCapabilities_; }
 	/// Registers a graphics capabilities provider
@@ -76,6 +84,10 @@ class DLL_PUBLIC ServiceLocator
 	nctl::UniquePtr<IThreadPool> registeredThreadPool_;
 	NullThreadPool nullThreadPool_;
 
+	IAsyncFileReader *asyncFileReader_;
+	nctl::UniquePtr<IAsyncFileReader> registeredAsyncFileReader_;
+	NullAsyncFileReader nullAsyncFileReader_;
+
 	IGfxCapabilities *gfxCapabilities_;
 	nctl::UniquePtr<IGfxCapabilities> registeredGfxCapabilities_;
 	NullGfxCapabilities nullGfxCapabilities_;
@@ -3,6 +3,7 @@
 
 #include "Object.h"
 #include "Rect.h"
+#include <nctl/UniquePtr.h>
 
 namespace ncine {
 
@@ -35,8 +36,19 @@ class DLL_PUBLIC Texture : public Object
 	explicit Texture(const char *filename);
 	Texture(const char *filename, int width, int height);
 	Texture(const char *filename, Vector2i size);
+	/// A constructor creating a texture from a memory buffer, like the one filled by the asynchronous file reader
+	/*! \param bufferName The name of the buffer, its extension is used to detect the texture format */
+	Texture(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize);
+	Texture(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize, int width, int height);
 	~Texture() override;
 
+	/// The function called on the main thread when a texture requested with `loadAsync()` has been created
+	/*! The texture is empty if the file could not be read. */
+	using AsyncLoadCallback = void (*)(nctl::UniquePtr<Texture> texture, void *userData);
+	/// Reads a texture file with the asynchronous file reader, the texture is then created on the main thread
+	/*! \return The request identifier that can be passed to `IAsyncFileReader::cancel()`, or zero on failure */
+	static unsigned int loadAsync(const char *filename, AsyncLoadCallback callback, void *userData);
+
 	/// Returns texture width
 	inline int width() const { return width_; }
 	/// Returns texture height
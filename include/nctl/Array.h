@@ -2,6 +2,7 @@
 #define CLASS_NCTL_ARRAY
 
 #include <ncine/common_macros.h>
+#include "IAllocator.h"
 #include "ArrayIterator.h"
 #include "ReverseIterator.h"
 #include "utility.h"
@@ -34,13 +35,13 @@ class Array
 
 	/// Constructs an array without allocating memory
 	Array()
-	    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false)
+	    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false), allocator_(nullptr)
 	{
 	}
 
 	/// Constructs an array with explicit capacity
 	explicit Array(unsigned int capacity)
-	    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false)
+	    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false), allocator_(nullptr)
 	{
 		if (capacity > 0)
 			setCapacity(capacity);
@@ -49,20 +50,49 @@ class Array
 	/// Constructs an array with explicit capacity and the option for it to be fixed
 	Array(unsigned int capacity, ArrayMode mode)
 	    : array_(nullptr), size_(0), capacity_(0),
-	      fixedCapacity_(mode == ArrayMode::FIXED_CAPACITY)
+	      fixedCapacity_(mode == ArrayMode::FIXED_CAPACITY), allocator_(nullptr)
 	{
 		if (capacity > 0)
 			setCapacity(capacity);
 	}
 
-	~Array() { delete[] array_; }
+	/// Constructs an array that takes its memory from the specified allocator
+	explicit Array(IAllocator &alloc)
+	    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false), allocator_(&alloc)
+	{
+	}
+
+	/// Constructs an array with explicit capacity that takes its memory from the specified allocator
+	Array(unsigned int capacity, IAllocator &alloc)
+	    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false), allocator_(&alloc)
+	{
+		if (capacity > 0)
+			setCapacity(capacity);
+	}
 
-	/// Copy constructor
-	Array(const Array &other);
+	/// Constructs an array with explicit capacity, fixed or not, that takes its memory from the specified allocator
+	Array(unsigned int capacity, ArrayMode mode, IAllocator &alloc)
+	    : array_(nullptr), size_(0), capacity_(0),
+	      fixedCapacity_(mode == ArrayMode::FIXED_CAPACITY), allocator_(&alloc)
+	{
+		if (capacity > 0)
+			setCapacity(capacity);
+	}
+
+	~Array() { nctl::deleteArray(allocator_, array_); }
+
+	/// Copy constructor, the copy uses `new` and `delete` whatever the allocator of the other array
+	Array(const Array &other)
+	    : Array(other, static_cast<IAllocator *>(nullptr)) {}
+	/// Copy constructor with an allocator for the copy
+	Array(const Array &other, IAllocator &alloc)
+	    : Array(other, &alloc) {}
 	/// Move constructor
 	Array(Array &&other);
-	/// Copy-and-swap assignment operator
-	Array &operator=(Array other);
+	/// Copy assignment operator, the array keeps its own allocator
+	Array &operator=(const Array &other);
+	/// Move assignment operator
+	Array &operator=(Array &&other);
 
 	/// Swaps two arrays without copying their data
 	void swap(Array &first, Array &second)
@@ -71,6 +101,7 @@ class Array
 		nctl::swap(first.size_, second.size_);
 		nctl::swap(first.capacity_, second.capacity_);
 		nctl::swap(first.fixedCapacity_, second.fixedCapacity_);
+		nctl::swap(first.allocator_, second.allocator_);
 	}
 
 	/// Returns an iterator to the first element
@@ -174,18 +205,26 @@ class Array
 	/*! When adding new elements through a pointer the size field is not updated, like with `std::vector`. */
 	inline T *data() { return array_; }
 
+	/// Returns the allocator used by the array, or `nullptr` if it uses `new` and `delete`
+	inline IAllocator *allocator() const { return allocator_; }
+
   private:
 	T *array_;
 	unsigned int size_;
 	unsigned int capacity_;
 	bool fixedCapacity_;
+	/// The allocator for the elements memory, `nullptr` to use `new` and `delete`
+	IAllocator *allocator_;
+
+	Array(const Array &other, IAllocator *alloc);
 };
 
 template <class T>
-Array<T>::Array(const Array<T> &other)
-    : array_(nullptr), size_(other.size_), capacity_(other.capacity_), fixedCapacity_(other.fixedCapacity_)
+Array<T>::Array(const Array<T> &other, IAllocator *alloc)
+    : array_(nullptr), size_(other.size_), capacity_(other.capacity_),
+      fixedCapacity_(other.fixedCapacity_), allocator_(alloc)
 {
-	array_ = new T[capacity_];
+	array_ = nctl::newArray<T>(allocator_, capacity_);
 	// copying all elements invoking their copy constructor
 	for (unsigned int i = 0; i < size_; i++)
 		array_[i] = other.array_[i];
@@ -193,14 +232,25 @@ Array<T>::Array(const Array<T> &other)
 
 template <class T>
 Array<T>::Array(Array<T> &&other)
-    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false)
+    : array_(nullptr), size_(0), capacity_(0), fixedCapacity_(false), allocator_(nullptr)
 {
 	swap(*this, other);
 }
 
-/*! \note The parameter should be passed by value for the idiom to work. */
+/*! \note The allocator of the other array is not propagated, like when copy constructing. */
+template <class T>
+Array<T> &Array<T>::operator=(const Array<T> &other)
+{
+	if (this != &other)
+	{
+		Array<T> copy(other, allocator_);
+		swap(*this, copy);
+	}
+	return *this;
+}
+
 template <class T>
-Array<T> &Array<T>::operator=(Array<T> other)
+Array<T> &Array<T>::operator=(Array<T> &&other)
 {
 	swap(*this, other);
 	return *this;
@@ -232,7 +282,7 @@ void Array<T>::setCapacity(unsigned int newCapacity)
 
 	T *newArray = nullptr;
 	if (newCapacity > 0)
-		newArray = new T[newCapacity];
+		newArray = nctl::newArray<T>(allocator_, newCapacity);
 
 	if (size_ > 0)
 	{
@@ -243,7 +293,7 @@ void Array<T>::setCapacity(unsigned int newCapacity)
 			newArray[i] = nctl::move(array_[i]);
 	}
 
-	delete[] array_;
+	nctl::deleteArray(allocator_, array_);
 	array_ = newArray;
 	capacity_ = newCapacity;
 }
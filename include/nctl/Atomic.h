@@ -126,6 +126,90 @@ class DLL_PUBLIC Atomic64
 	Atomic64 &operator=(const Atomic64 &) = delete;
 };
 
+/// An atomic pointer class
+class DLL_PUBLIC AtomicPtr
+{
+  public:
+	enum class MemoryModel
+	{
+		RELAXED,
+		ACQUIRE,
+		RELEASE,
+		SEQ_CST
+	};
+
+	AtomicPtr()
+	    : value_(nullptr) {}
+	explicit AtomicPtr(void *value)
+	    : value_(value) {}
+	~AtomicPtr() = default;
+
+	void *load(MemoryModel memModel);
+	inline void *load() { return load(MemoryModel::SEQ_CST); }
+	void store(void *value, MemoryModel memModel);
+	inline void store(void *value) { store(value, MemoryModel::SEQ_CST); }
+
+	/// Replaces the pointer and returns the previous one
+	void *exchange(void *value, MemoryModel memModel);
+	inline void *exchange(void *value) { return exchange(value, MemoryModel::SEQ_CST); }
+	bool cmpExchange(void *newValue, void *cmpValue, MemoryModel memModel);
+	inline bool cmpExchange(void *newValue, void *cmpValue) { return cmpExchange(newValue, cmpValue, MemoryModel::SEQ_CST); }
+
+	/// Loads the pointer and casts it to the specified type
+	template <class T> inline T *loadAs(MemoryModel memModel) { return static_cast<T *>(load(memModel)); }
+
+  private:
+#ifdef __APPLE__
+	std::atomic<void *> value_;
+#else
+	void *value_;
+#endif
+
+	/// Deleted copy constructor
+	AtomicPtr(const AtomicPtr &) = delete;
+	/// Deleted move constructor
+	AtomicPtr(AtomicPtr &&) = delete;
+	/// Deleted assignment operator
+	AtomicPtr &operator=(const AtomicPtr &) = delete;
+};
+
+/// An atomic boolean flag, useful to signal between threads or to implement a spin lock
+class AtomicFlag
+{
+  public:
+	using MemoryModel = Atomic32::MemoryModel;
+
+	AtomicFlag()
+	    : value_(0) {}
+
+	/// Sets the flag and returns true if it was already set
+	bool testAndSet(MemoryModel memModel)
+	{
+		// Retrying in case the compare and exchange fails spuriously
+		while (value_.cmpExchange(1, 0, memModel) == false)
+		{
+			if (value_.load(MemoryModel::RELAXED) != 0)
+				return true;
+		}
+		return false;
+	}
+	inline bool testAndSet() { return testAndSet(MemoryModel::SEQ_CST); }
+	/// Returns true if the flag is set
+	inline bool test(MemoryModel memModel) { return (value_.load(memModel) != 0); }
+	inline bool test() { return test(MemoryModel::SEQ_CST); }
+	/// Clears the flag
+	inline void clear(MemoryModel memModel) { value_.store(0, memModel); }
+	inline void clear() { clear(MemoryModel::SEQ_CST); }
+
+  private:
+	Atomic32 value_;
+
+	/// Deleted copy constructor
+	AtomicFlag(const AtomicFlag &) = delete;
+	/// Deleted assignment operator
+	AtomicFlag &operator=(const AtomicFlag &) = delete;
+};
+
 }
 
 #endif
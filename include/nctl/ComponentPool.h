@@ -0,0 +1,220 @@
+#ifndef CLASS_NCTL_COMPONENTPOOL
+#define CLASS_NCTL_COMPONENTPOOL
+
+#include <ncine/common_macros.h>
+#include "SparseSet.h"
+#include "Array.h"
+#include "utility.h"
+
+namespace nctl {
+
+/// A pool of components associated to entities, stored contiguously for cache friendly iteration
+/*!
+ * The pool pairs a sparse set of entities with a dense array of components at the same indices.
+ * Removing a component moves the last one in its place, so the two arrays are always packed.
+ * \note Pointers and references to components are invalidated when components are added or removed.
+ */
+template <class T>
+class ComponentPool
+{
+  public:
+	/// Creates a pool for entities in the range from zero to the maximum number of entities minus one
+	ComponentPool(unsigned int capacity, unsigned int maxEntities)
+	    : entities_(capacity, maxEntityValue(maxEntities)), components_(capacity) {}
+
+	/// Returns the number of components in the pool
+	inline unsigned int size() const { return entities_.size(); }
+	/// Returns true if the pool has no components
+	inline bool isEmpty() const { return entities_.isEmpty(); }
+	/// Returns the number of components the pool can hold before growing
+	inline unsigned int capacity() const { return entities_.capacity(); }
+	/// Returns the maximum number of entities
+	inline unsigned int maxEntities() const { return entities_.maxValue() + 1; }
+
+	/// Returns the set of entities having a component in the pool
+	inline const SparseSet<unsigned int> &entities() const { return entities_; }
+	/// Returns the entity at the specified dense index
+	inline unsigned int entityAt(unsigned int index) const { return entities_.data()[index]; }
+	/// Returns the component at the specified dense index
+	inline T &componentAt(unsigned int index) { return components_[index]; }
+	/// Returns the constant component at the specified dense index
+	inline const T &componentAt(unsigned int index) const { return components_[index]; }
+	/// Returns a pointer to the densely packed components
+	inline T *data() { return components_.data(); }
+	/// Returns a constant pointer to the densely packed components
+	inline const T *data() const { return components_.data(); }
+
+	/// Returns true if the entity has a component in the pool
+	inline bool contains(unsigned int entity) const { return entities_.contains(entity); }
+	/// Returns a pointer to the component of an entity or `nullptr` if it has none
+	T *find(unsigned int entity);
+	/// Returns a constant pointer to the component of an entity or `nullptr` if it has none
+	const T *find(unsigned int entity) const;
+
+	/// Adds a component to an entity, replacing the existing one
+	T &add(unsigned int entity, const T &component);
+	/// Move adds a component to an entity, replacing the existing one
+	T &add(unsigned int entity, T &&component);
+	/// Constructs a component for an entity, replacing the existing one
+	template <typename... Args> T &emplace(unsigned int entity, Args &&... args);
+	/// Removes the component of an entity
+	bool remove(unsigned int entity);
+	/// Removes every component
+	void clear();
+
+  private:
+	SparseSet<unsigned int> entities_;
+	Array<T> components_;
+
+	/// Returns the dense index of a new or existing component of an entity
+	unsigned int insertEntity(unsigned int entity);
+
+	/// Returns the maximum value of the sparse set, checking that the number of entities does not wrap around
+	static unsigned int maxEntityValue(unsigned int maxEntities)
+	{
+		FATAL_ASSERT_MSG(maxEntities > 0, "Zero is not a valid number of entities");
+		return maxEntities - 1;
+	}
+};
+
+template <class T>
+T *ComponentPool<T>::find(unsigned int entity)
+{
+	const unsigned int index = entities_.find(entity);
+	return (index != SparseSet<unsigned int>::NotFound) ? &components_[index] : nullptr;
+}
+
+template <class T>
+const T *ComponentPool<T>::find(unsigned int entity) const
+{
+	const unsigned int index = entities_.find(entity);
+	return (index != SparseSet<unsigned int>::NotFound) ? &components_[index] : nullptr;
+}
+
+template <class T>
+T &ComponentPool<T>::add(unsigned int entity, const T &component)
+{
+	const unsigned int index = insertEntity(entity);
+	if (index < components_.size())
+		components_[index] = component;
+	else
+		components_.pushBack(component);
+	return components_[index];
+}
+
+template <class T>
+T &ComponentPool<T>::add(unsigned int entity, T &&component)
+{
+	const unsigned int index = insertEntity(entity);
+	if (index < components_.size())
+		components_[index] = nctl::move(component);
+	else
+		components_.pushBack(nctl::move(component));
+	return components_[index];
+}
+
+template <class T>
+template <typename... Args>
+T &ComponentPool<T>::emplace(unsigned int entity, Args &&... args)
+{
+	const unsigned int index = insertEntity(entity);
+	if (index < components_.size())
+		components_[index] = T(nctl::forward<Args>(args)...);
+	else
+		components_.emplaceBack(nctl::forward<Args>(args)...);
+	return components_[index];
+}
+
+/*! \return True if the entity had a component in the pool */
+template <class T>
+bool ComponentPool<T>::remove(unsigned int entity)
+{
+	const unsigned int index = entities_.find(entity);
+	if (index == SparseSet<unsigned int>::NotFound)
+		return false;
+
+	// Mirroring the sparse set removal, which moves the last element in place of the removed one
+	entities_.remove(entity);
+	const unsigned int lastIndex = components_.size() - 1;
+	if (index != lastIndex)
+		components_[index] = nctl::move(components_[lastIndex]);
+	components_.popBack();
+
+	return true;
+}
+
+template <class T>
+void ComponentPool<T>::clear()
+{
+	entities_.clear();
+	components_.clear();
+}
+
+template <class T>
+unsigned int ComponentPool<T>::insertEntity(unsigned int entity)
+{
+	FATAL_ASSERT_MSG_X(entity < maxEntities(), "Entity %u is out of range (max entities: %u)", entity, maxEntities());
+
+	const unsigned int index = entities_.find(entity);
+	if (index != SparseSet<unsigned int>::NotFound)
+		return index;
+
+	if (entities_.size() == entities_.capacity())
+	{
+		const unsigned int newCapacity = entities_.capacity() * 2;
+		entities_.rehash(newCapacity < maxEntities() ? newCapacity : maxEntities());
+	}
+
+	entities_.insert(entity);
+	return entities_.size() - 1;
+}
+
+namespace {
+
+	inline bool allContain(unsigned int)
+	{
+		return true;
+	}
+
+	template <class T, class... Ts>
+	inline bool allContain(unsigned int entity, const ComponentPool<T> &pool, const ComponentPool<Ts> &... pools)
+	{
+		return pool.contains(entity) && allContain(entity, pools...);
+	}
+
+	inline const SparseSet<unsigned int> &smallestEntitySet(const SparseSet<unsigned int> &smallest)
+	{
+		return smallest;
+	}
+
+	template <class T, class... Ts>
+	inline const SparseSet<unsigned int> &smallestEntitySet(const SparseSet<unsigned int> &smallest, const ComponentPool<T> &pool, const ComponentPool<Ts> &... pools)
+	{
+		return smallestEntitySet(pool.size() < smallest.size() ? pool.entities() : smallest, pools...);
+	}
+
+}
+
+/// Calls a function for every entity having a component in all the specified pools
+/*!
+ * Only the entities of the smallest pool are visited, each one is then looked up in constant time in the other pools.
+ * The function is called with the entity followed by a reference to each of its components, in the same order as the pools.
+ * \note Components should not be added or removed from the pools while iterating.
+ */
+template <class Func, class T, class... Ts>
+void forEachEntity(Func func, ComponentPool<T> &pool, ComponentPool<Ts> &... pools)
+{
+	const SparseSet<unsigned int> &smallest = smallestEntitySet(pool.entities(), pools...);
+	const unsigned int *entities = smallest.data();
+
+	for (unsigned int i = 0; i < smallest.size(); i++)
+	{
+		const unsigned int entity = entities[i];
+		if (allContain(entity, pool, pools...))
+			func(entity, *pool.find(entity), *pools.find(entity)...);
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef CLASS_NCTL_ENTITYREGISTRY
+#define CLASS_NCTL_ENTITYREGISTRY
+
+#include <ncine/common_macros.h>
+#include "SparseSet.h"
+#include "Array.h"
+
+namespace nctl {
+
+/// Allocates stable entity identifiers to be used as keys of component pools
+/*!
+ * Identifiers are in the range from zero to the maximum number of entities minus one,
+ * they never change while an entity is alive and the ones of destroyed entities are reused.
+ * \note Destroying an entity does not remove its components, they should be removed from every pool.
+ */
+class EntityRegistry
+{
+  public:
+	/// The value returned when no more entities can be created
+	static const unsigned int InvalidEntity = ~0U;
+
+	explicit EntityRegistry(unsigned int maxEntities)
+	    : alive_(maxEntities, maxEntities - 1), freeEntities_(maxEntities), nextEntity_(0) {}
+
+	/// Returns the maximum number of entities that can be alive at the same time
+	inline unsigned int maxEntities() const { return alive_.capacity(); }
+	/// Returns the number of alive entities
+	inline unsigned int size() const { return alive_.size(); }
+	/// Returns true if there are no alive entities
+	inline bool isEmpty() const { return alive_.isEmpty(); }
+
+	/// Returns the set of alive entities, densely packed for iteration
+	inline const SparseSet<unsigned int> &entities() const { return alive_; }
+	/// Returns true if the entity has been created and not yet destroyed
+	inline bool isAlive(unsigned int entity) const { return alive_.contains(entity); }
+
+	/// Creates a new entity, reusing the identifier of a destroyed one if possible
+	/*! \return The entity identifier or `InvalidEntity` if the maximum number of entities is reached */
+	unsigned int create()
+	{
+		unsigned int entity = InvalidEntity;
+		if (freeEntities_.isEmpty() == false)
+		{
+			entity = freeEntities_.back();
+			freeEntities_.popBack();
+		}
+		else if (nextEntity_ < maxEntities())
+			entity = nextEntity_++;
+
+		if (entity != InvalidEntity)
+			alive_.insert(entity);
+		return entity;
+	}
+
+	/// Destroys an entity and makes its identifier available again
+	/*! \return True if the entity was alive */
+	bool destroy(unsigned int entity)
+	{
+		if (alive_.remove(entity) == false)
+			return false;
+
+		freeEntities_.pushBack(entity);
+		return true;
+	}
+
+	/// Destroys every entity
+	void clear()
+	{
+		alive_.clear();
+		freeEntities_.clear();
+		nextEntity_ = 0;
+	}
+
+  private:
+	SparseSet<unsigned int> alive_;
+	/// Identifiers of destroyed entities, reused in LIFO order
+	Array<unsigned int> freeEntities_;
+	/// The first identifier that has never been used
+	unsigned int nextEntity_;
+};
+
+}
+
+#endif
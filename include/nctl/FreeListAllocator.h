@@ -0,0 +1,50 @@
+#ifndef CLASS_NCTL_FREELISTALLOCATOR
+#define CLASS_NCTL_FREELISTALLOCATOR
+
+#include "IAllocator.h"
+
+namespace nctl {
+
+/// A general purpose allocator that keeps the unused memory in an address ordered list
+/*! Blocks of any size can be released in any order, adjacent free blocks are merged together. */
+class DLL_PUBLIC FreeListAllocator : public IAllocator
+{
+  public:
+	/// Constructs a free list allocator that owns a memory region of the specified size
+	FreeListAllocator(const char *name, size_t size);
+	/// Constructs a free list allocator that manages a memory region owned by the caller
+	FreeListAllocator(const char *name, void *base, size_t size);
+	~FreeListAllocator() override;
+
+	/// Returns the number of non contiguous free blocks, a measure of fragmentation
+	unsigned int numFreeBlocks() const;
+
+  private:
+	/// The header stored before every allocated block
+	struct Header
+	{
+		/// Size of the whole block, adjustment included
+		size_t size;
+		/// Distance between the beginning of the block and the aligned address
+		size_t adjustment;
+	};
+
+	/// An unused block, pointing to the next one in address order
+	struct FreeBlock
+	{
+		size_t size;
+		FreeBlock *next;
+	};
+
+	uint8_t *base_;
+	FreeBlock *freeList_;
+	bool ownsMemory_;
+
+	void init();
+	void *allocateImpl(size_t bytes, uint8_t alignment) override;
+	void deallocateImpl(void *ptr) override;
+};
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define CLASS_NCTL_HASHFUNCTIONS
 
 #include <cstdint>
+#include <cstring> // for memcpy()
 
 namespace nctl {
 
@@ -180,6 +181,167 @@ class FNV1aFuncHashContainer
 	}
 };
 
+/// Computes the FNV-1a hash of a sequence of characters
+/*! \note The result is the same as the one of `FNV1aFuncHashContainer<String>` on a string with the same characters. */
+inline hash_t fnv1aHash(const char *chars, unsigned int length)
+{
+	hash_t hash = static_cast<hash_t>(0x811C9DC5);
+	for (unsigned int i = 0; i < length; i++)
+		hash = (static_cast<unsigned char>(chars[i]) ^ hash) * static_cast<hash_t>(0x01000193);
+
+	return hash;
+}
+
+/// Computes the FNV-1a hash of a sequence of characters at compile time
+/*! \note It is recursive because of the C++11 restrictions on `constexpr` functions, prefer `fnv1aHash()` at run time. */
+constexpr hash_t fnv1aHashConstexpr(const char *chars, unsigned int length, hash_t hash = 0x811C9DC5)
+{
+	return (length == 0) ? hash : fnv1aHashConstexpr(chars + 1, length - 1, (static_cast<unsigned char>(chars[0]) ^ hash) * static_cast<hash_t>(0x01000193));
+}
+
+/// Computes the FNV-1a hash of a string literal at compile time
+template <unsigned int N>
+constexpr hash_t fnv1aHashLiteral(const char (&literal)[N])
+{
+	return fnv1aHashConstexpr(literal, N - 1);
+}
+
+namespace {
+
+	/// Prime numbers of the 64 bits xxHash function
+	constexpr uint64_t WordHashPrime1 = 0x9E3779B185EBCA87ULL;
+	constexpr uint64_t WordHashPrime2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr uint64_t WordHashPrime3 = 0x165667B19E3779F9ULL;
+	constexpr uint64_t WordHashPrime4 = 0x85EBCA77C2B2AE63ULL;
+	constexpr uint64_t WordHashPrime5 = 0x27D4EB2F165667C5ULL;
+
+	constexpr uint64_t wordHashRotate(uint64_t value, unsigned int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	constexpr uint64_t wordHashXorShift(uint64_t value, unsigned int bits)
+	{
+		return value ^ (value >> bits);
+	}
+
+	/// Mixes a full word of eight characters into the hash
+	constexpr uint64_t wordHashRound(uint64_t hash, uint64_t word)
+	{
+		return wordHashRotate(hash ^ (wordHashRotate(word * WordHashPrime2, 31) * WordHashPrime1), 27) * WordHashPrime1 + WordHashPrime4;
+	}
+
+	/// Mixes the last word, made of less than eight characters, into the hash
+	constexpr uint64_t wordHashTail(uint64_t hash, uint64_t word)
+	{
+		return wordHashRotate(hash ^ (word * WordHashPrime5), 23) * WordHashPrime2 + WordHashPrime3;
+	}
+
+	/// Spreads every input bit to all the output ones
+	constexpr hash_t wordHashAvalanche(uint64_t hash)
+	{
+		return static_cast<hash_t>(wordHashXorShift(wordHashXorShift(wordHashXorShift(hash, 33) * WordHashPrime2, 29) * WordHashPrime3, 32));
+	}
+
+	/// Reads up to eight characters as a little endian word
+	inline uint64_t wordHashRead(const char *chars, unsigned int length)
+	{
+		uint64_t word = 0;
+		memcpy(&word, chars, length);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		word = __builtin_bswap64(word);
+#endif
+		return word;
+	}
+
+	constexpr uint64_t wordHashReadConstexpr(const char *chars, unsigned int length)
+	{
+		return (length == 0) ? 0 : static_cast<uint64_t>(static_cast<unsigned char>(chars[0])) | (wordHashReadConstexpr(chars + 1, length - 1) << 8);
+	}
+
+	constexpr uint64_t wordHashWordsConstexpr(const char *chars, unsigned int length, uint64_t hash)
+	{
+		return (length >= 8) ? wordHashWordsConstexpr(chars + 8, length - 8, wordHashRound(hash, wordHashReadConstexpr(chars, 8)))
+		                     : ((length > 0) ? wordHashTail(hash, wordHashReadConstexpr(chars, length)) : hash);
+	}
+
+}
+
+/// Computes a hash of a sequence of characters reading them eight at a time
+/*!
+ * The mixing steps are derived from the 64 bits xxHash function, the length is part of the seed so that
+ * sequences only differing by trailing zeros have different hashes.
+ * It is several times faster than FNV-1a on long sequences.
+ */
+inline hash_t wordHash(const char *chars, unsigned int length)
+{
+	uint64_t hash = WordHashPrime5 + length;
+	for (; length >= 8; chars += 8, length -= 8)
+		hash = wordHashRound(hash, wordHashRead(chars, 8));
+	if (length > 0)
+		hash = wordHashTail(hash, wordHashRead(chars, length));
+
+	return wordHashAvalanche(hash);
+}
+
+/// Computes the word hash of a sequence of characters at compile time
+/*! \note It is recursive because of the C++11 restrictions on `constexpr` functions, prefer `wordHash()` at run time. */
+constexpr hash_t wordHashConstexpr(const char *chars, unsigned int length)
+{
+	return wordHashAvalanche(wordHashWordsConstexpr(chars, length, WordHashPrime5 + length));
+}
+
+/// Word at a time hash function
+/*! \note The key type should be a container of characters exposing `data()` and `length()` methods. */
+template <class K>
+class WordHashFuncContainer
+{
+  public:
+	hash_t operator()(const K &key) const { return wordHash(key.data(), key.length()); }
+};
+
+/// Hash function returning the hash computed by the key itself
+/*! \note The key type should expose a `hash()` method, like `String`, `StringView` and `StringId`. */
+template <class K>
+class MemberHashFunc
+{
+  public:
+	hash_t operator()(const K &key) const { return key.hash(); }
+};
+
+#ifdef NCTL_FNV1A_STRING_HASH
+/// Computes the hash used for strings, FNV-1a when `NCTL_FNV1A_STRING_HASH` is defined
+inline hash_t stringHash(const char *chars, unsigned int length)
+{
+	return fnv1aHash(chars, length);
+}
+
+/// Computes the hash used for strings at compile time
+constexpr hash_t stringHashConstexpr(const char *chars, unsigned int length)
+{
+	return fnv1aHashConstexpr(chars, length);
+}
+#else
+/// Computes the hash used for strings, the word hash unless `NCTL_FNV1A_STRING_HASH` is defined
+inline hash_t stringHash(const char *chars, unsigned int length)
+{
+	return wordHash(chars, length);
+}
+
+/// Computes the hash used for strings at compile time
+constexpr hash_t stringHashConstexpr(const char *chars, unsigned int length)
+{
+	return wordHashConstexpr(chars, length);
+}
+#endif
+
+/// Computes the hash used for strings of a string literal at compile time
+template <unsigned int N>
+constexpr hash_t stringHashLiteral(const char (&literal)[N])
+{
+	return stringHashConstexpr(literal, N - 1);
+}
+
 }
 
 #endif
@@ -103,6 +103,10 @@ class HashMap
 	T *find(const K &key);
 	/// Checks whether an element is in the hashmap or not (read-only)
 	const T *find(const K &key) const;
+	/// Checks whether an element is in the hashmap or not, using a compatible key type and its precomputed hash
+	template <class LK> T *find(const LK &key, hash_t hash);
+	/// Checks whether an element is in the hashmap or not, using a compatible key type and its precomputed hash (read-only)
+	template <class LK> const T *find(const LK &key, hash_t hash) const;
 	/// Removes a key from the hashmap, if it exists
 	bool remove(const K &key);
 
@@ -128,14 +132,15 @@ class HashMap
 	UniquePtr<Node[]> nodes_;
 	HashFunc hashFunc_;
 
-	bool findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const;
+	template <class LK> bool findBucketIndex(const LK &key, hash_t hash, unsigned int &foundIndex, unsigned int &prevFoundIndex) const;
+	inline bool findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const;
 	inline bool findBucketIndex(const K &key, unsigned int &foundIndex) const;
 	unsigned int addDelta1(unsigned int bucketIndex) const;
 	unsigned int addDelta2(unsigned int bucketIndex) const;
 	unsigned int calcNewDelta(unsigned int bucketIndex, unsigned int newIndex) const;
 	unsigned int linearSearch(unsigned int index, hash_t hash, const K &key) const;
-	bool bucketFoundOrEmpty(unsigned int index, hash_t hash, const K &key) const;
-	bool bucketFound(unsigned int index, hash_t hash, const K &key) const;
+	template <class LK> bool bucketFoundOrEmpty(unsigned int index, hash_t hash, const LK &key) const;
+	template <class LK> bool bucketFound(unsigned int index, hash_t hash, const LK &key) const;
 	T &addNode(unsigned int index, hash_t hash, const K &key);
 	void insertNode(unsigned int index, hash_t hash, const K &key, const T &value);
 	void insertNode(unsigned int index, hash_t hash, const K &key, T &&value);
@@ -538,6 +543,38 @@ const T *HashMap<K, T, HashFunc>::find(const K &key) const
 	return returnedPtr;
 }
 
+/*! \note The key type should be comparable with `K` and the hash should be the same that the hash function would return for the equivalent `K` key. */
+template <class K, class T, class HashFunc>
+template <class LK>
+T *HashMap<K, T, HashFunc>::find(const LK &key, hash_t hash)
+{
+	int unsigned bucketIndex = 0;
+	int unsigned prevBucketIndex = 0;
+	const bool found = findBucketIndex(key, hash, bucketIndex, prevBucketIndex);
+
+	T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[bucketIndex].value;
+
+	return returnedPtr;
+}
+
+/*! \note The key type should be comparable with `K` and the hash should be the same that the hash function would return for the equivalent `K` key. */
+template <class K, class T, class HashFunc>
+template <class LK>
+const T *HashMap<K, T, HashFunc>::find(const LK &key, hash_t hash) const
+{
+	int unsigned bucketIndex = 0;
+	int unsigned prevBucketIndex = 0;
+	const bool found = findBucketIndex(key, hash, bucketIndex, prevBucketIndex);
+
+	const T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[bucketIndex].value;
+
+	return returnedPtr;
+}
+
 /*! \return True if the element has been found and removed */
 template <class K, class T, class HashFunc>
 bool HashMap<K, T, HashFunc>::remove(const K &key)
@@ -619,13 +656,13 @@ void HashMap<K, T, HashFunc>::rehash(unsigned int count)
 }
 
 template <class K, class T, class HashFunc>
-bool HashMap<K, T, HashFunc>::findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const
+template <class LK>
+bool HashMap<K, T, HashFunc>::findBucketIndex(const LK &key, hash_t hash, unsigned int &foundIndex, unsigned int &prevFoundIndex) const
 {
 	if (size_ == 0)
 		return false;
 
 	bool found = false;
-	const hash_t hash = hashFunc_(key);
 	foundIndex = hash % capacity_;
 	prevFoundIndex = foundIndex;
 
@@ -668,6 +705,12 @@ bool HashMap<K, T, HashFunc>::findBucketIndex(const K &key, unsigned int &foundI
 	return found;
 }
 
+template <class K, class T, class HashFunc>
+bool HashMap<K, T, HashFunc>::findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const
+{
+	return findBucketIndex(key, hashFunc_(key), foundIndex, prevFoundIndex);
+}
+
 template <class K, class T, class HashFunc>
 bool HashMap<K, T, HashFunc>::findBucketIndex(const K &key, unsigned int &foundIndex) const
 {
@@ -725,13 +768,15 @@ unsigned int HashMap<K, T, HashFunc>::linearSearch(unsigned int index, hash_t ha
 }
 
 template <class K, class T, class HashFunc>
-bool HashMap<K, T, HashFunc>::bucketFoundOrEmpty(unsigned int index, hash_t hash, const K &key) const
+template <class LK>
+bool HashMap<K, T, HashFunc>::bucketFoundOrEmpty(unsigned int index, hash_t hash, const LK &key) const
 {
 	return (hashes_[index] == NullHash || (hashes_[index] == hash && nodes_[index].key == key));
 }
 
 template <class K, class T, class HashFunc>
-bool HashMap<K, T, HashFunc>::bucketFound(unsigned int index, hash_t hash, const K &key) const
+template <class LK>
+bool HashMap<K, T, HashFunc>::bucketFound(unsigned int index, hash_t hash, const LK &key) const
 {
 	return (hashes_[index] == hash && nodes_[index].key == key);
 }
@@ -786,7 +831,7 @@ void HashMap<K, T, HashFunc>::emplaceNode(unsigned int index, hash_t hash, const
 }
 
 template <class T>
-using StringHashMap = HashMap<String, T, FNV1aFuncHashContainer<String>>;
+using StringHashMap = HashMap<String, T, MemberHashFunc<String>>;
 
 }
 
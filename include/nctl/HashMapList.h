@@ -598,7 +598,7 @@ const typename HashMapList<K, T, HashFunc>::HashBucket &HashMapList<K, T, HashFu
 }
 
 template <class T>
-using StringHashMapList = HashMapList<String, T, FNV1aFuncHashContainer<String>>;
+using StringHashMapList = HashMapList<String, T, MemberHashFunc<String>>;
 
 }
 
@@ -629,7 +629,7 @@ void HashSet<K, HashFunc>::insertKey(unsigned int index, hash_t hash, K &&key)
 	keys_[index] = nctl::move(key);
 }
 
-using StringHashSet = HashSet<String, FNV1aFuncHashContainer<String>>;
+using StringHashSet = HashSet<String, MemberHashFunc<String>>;
 
 }
 
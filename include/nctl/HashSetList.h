@@ -537,7 +537,7 @@ const typename HashSetList<K, HashFunc>::HashBucket &HashSetList<K, HashFunc>::r
 	return buckets_[index];
 }
 
-using StringHashSetList = HashSetList<String, FNV1aFuncHashContainer<String>>;
+using StringHashSetList = HashSetList<String, MemberHashFunc<String>>;
 
 }
 
@@ -0,0 +1,193 @@
+#ifndef CLASS_NCTL_IALLOCATOR
+#define CLASS_NCTL_IALLOCATOR
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uintptr_t
+#include <new> // for placement new
+#include <ncine/common_macros.h>
+#include "utility.h"
+
+namespace nctl {
+
+/// The interface class for memory allocators
+/*!
+ * Containers constructed with an allocator use it for all their memory, otherwise they use `new` and `delete`.
+ * \note Allocators are not thread-safe, they should only be used by one thread at a time.
+ */
+class DLL_PUBLIC IAllocator
+{
+  public:
+	/// The alignment used when none is specified
+	static const uint8_t DefaultAlignment = 2 * sizeof(void *);
+
+	/// Constructs an allocator with a name and the size of the memory it manages, zero if unbounded
+	IAllocator(const char *name, size_t size)
+	    : name_(name), size_(size), usedMemory_(0), peakUsedMemory_(0),
+	      numAllocations_(0), totalAllocations_(0), numFailedAllocations_(0) {}
+	virtual ~IAllocator() {}
+
+	/// Allocates a memory block with the specified alignment, that must be a power of two
+	/*! \return A pointer to the block or `nullptr` if the allocator has run out of memory */
+	void *allocate(size_t bytes, uint8_t alignment);
+	/// Allocates a memory block with the default alignment
+	inline void *allocate(size_t bytes) { return allocate(bytes, DefaultAlignment); }
+	/// Releases a memory block allocated by this allocator
+	void deallocate(void *ptr);
+
+	/// Constructs an object in memory provided by the allocator
+	template <class T, typename... Args> T *newObject(Args &&... args);
+	/// Destructs an object and releases its memory
+	template <class T> void deleteObject(T *ptr);
+	/// Allocates an array of default constructed objects
+	template <class T> T *newArray(size_t numElements);
+	/// Destructs the objects of an array and releases its memory
+	template <class T> void deleteArray(T *ptr);
+
+	/// Returns the allocator name
+	inline const char *name() const { return name_; }
+	/// Returns the size in bytes of the managed memory, zero if unbounded
+	inline size_t size() const { return size_; }
+	/// Returns the number of bytes currently in use, padding and headers included
+	inline size_t usedMemory() const { return usedMemory_; }
+	/// Returns the highest number of bytes that have been in use at the same time
+	inline size_t peakUsedMemory() const { return peakUsedMemory_; }
+	/// Returns the number of blocks currently allocated
+	inline unsigned int numAllocations() const { return numAllocations_; }
+	/// Returns the number of blocks allocated since the allocator creation
+	inline unsigned long int totalAllocations() const { return totalAllocations_; }
+	/// Returns the number of requests that could not be satisfied
+	inline unsigned int numFailedAllocations() const { return numFailedAllocations_; }
+
+	/// Returns the first address after `address` that is a multiple of `alignment`
+	inline static uintptr_t alignAddress(uintptr_t address, uint8_t alignment)
+	{
+		const uintptr_t mask = static_cast<uintptr_t>(alignment) - 1;
+		ASSERT((alignment & mask) == 0);
+		return (address + mask) & ~mask;
+	}
+
+  protected:
+	const char *name_;
+	size_t size_;
+	/// Updated by implementations on every allocation and deallocation
+	size_t usedMemory_;
+	size_t peakUsedMemory_;
+	unsigned int numAllocations_;
+	unsigned long int totalAllocations_;
+	unsigned int numFailedAllocations_;
+
+	/// Returns a block of at least `bytes` bytes aligned to `alignment`, or `nullptr`
+	virtual void *allocateImpl(size_t bytes, uint8_t alignment) = 0;
+	/// Releases a block returned by `allocateImpl()`
+	virtual void deallocateImpl(void *ptr) = 0;
+
+  private:
+	/// Returns the bytes needed before an array to store its number of elements while keeping it aligned
+	template <class T> inline static size_t arrayHeaderSize()
+	{
+		return (alignof(T) > sizeof(size_t)) ? alignof(T) : sizeof(size_t);
+	}
+
+	/// Deleted copy constructor
+	IAllocator(const IAllocator &) = delete;
+	/// Deleted assignment operator
+	IAllocator &operator=(const IAllocator &) = delete;
+};
+
+inline void *IAllocator::allocate(size_t bytes, uint8_t alignment)
+{
+	void *ptr = allocateImpl(bytes, alignment);
+	if (ptr != nullptr)
+	{
+		numAllocations_++;
+		totalAllocations_++;
+		if (usedMemory_ > peakUsedMemory_)
+			peakUsedMemory_ = usedMemory_;
+	}
+	else
+		numFailedAllocations_++;
+
+	return ptr;
+}
+
+inline void IAllocator::deallocate(void *ptr)
+{
+	if (ptr == nullptr)
+		return;
+
+	ASSERT(numAllocations_ > 0);
+	deallocateImpl(ptr);
+	numAllocations_--;
+}
+
+template <class T, typename... Args>
+T *IAllocator::newObject(Args &&... args)
+{
+	void *ptr = allocate(sizeof(T), alignof(T));
+	FATAL_ASSERT_MSG_X(ptr, "Allocator \"%s\" cannot allocate %lu bytes", name_, static_cast<unsigned long>(sizeof(T)));
+	return new (ptr) T(nctl::forward<Args>(args)...);
+}
+
+template <class T>
+void IAllocator::deleteObject(T *ptr)
+{
+	if (ptr == nullptr)
+		return;
+
+	ptr->~T();
+	deallocate(ptr);
+}
+
+template <class T>
+T *IAllocator::newArray(size_t numElements)
+{
+	const size_t headerSize = arrayHeaderSize<T>();
+	const size_t bytes = headerSize + numElements * sizeof(T);
+	const uint8_t alignment = static_cast<uint8_t>(headerSize);
+
+	uint8_t *ptr = static_cast<uint8_t *>(allocate(bytes, alignment));
+	FATAL_ASSERT_MSG_X(ptr, "Allocator \"%s\" cannot allocate %lu bytes", name_, static_cast<unsigned long>(bytes));
+
+	*reinterpret_cast<size_t *>(ptr + headerSize - sizeof(size_t)) = numElements;
+	T *array = reinterpret_cast<T *>(ptr + headerSize);
+	for (size_t i = 0; i < numElements; i++)
+		new (array + i) T();
+
+	return array;
+}
+
+template <class T>
+void IAllocator::deleteArray(T *ptr)
+{
+	if (ptr == nullptr)
+		return;
+
+	const size_t headerSize = arrayHeaderSize<T>();
+	uint8_t *blockPtr = reinterpret_cast<uint8_t *>(ptr) - headerSize;
+	const size_t numElements = *reinterpret_cast<size_t *>(blockPtr + headerSize - sizeof(size_t));
+	for (size_t i = numElements; i > 0; i--)
+		ptr[i - 1].~T();
+
+	deallocate(blockPtr);
+}
+
+/// Allocates an array with the specified allocator, or with `new` if it is `nullptr`
+template <class T>
+inline T *newArray(IAllocator *allocator, size_t numElements)
+{
+	return allocator ? allocator->newArray<T>(numElements) : new T[numElements];
+}
+
+/// Releases an array with the specified allocator, or with `delete` if it is `nullptr`
+template <class T>
+inline void deleteArray(IAllocator *allocator, T *ptr)
+{
+	if (allocator)
+		allocator->deleteArray(ptr);
+	else
+		delete[] ptr;
+}
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef CLASS_NCTL_LINEARALLOCATOR
+#define CLASS_NCTL_LINEARALLOCATOR
+
+#include "IAllocator.h"
+
+namespace nctl {
+
+/// An allocator that moves a pointer forward inside a memory region
+/*!
+ * Single blocks cannot be released, all the memory is reclaimed at once with `clear()`.
+ * It is suited for data whose lifetime is bound to a frame or a level.
+ */
+class DLL_PUBLIC LinearAllocator : public IAllocator
+{
+  public:
+	/// Constructs a linear allocator that owns a memory region of the specified size
+	LinearAllocator(const char *name, size_t size);
+	/// Constructs a linear allocator that manages a memory region owned by the caller
+	LinearAllocator(const char *name, void *base, size_t size);
+	~LinearAllocator() override;
+
+	/// Reclaims all the allocated memory
+	/*! Objects living in the region are not destructed. */
+	void clear();
+
+	/// Returns the number of bytes still available, not accounting for alignment
+	inline size_t freeMemory() const { return size_ - offset_; }
+
+  private:
+	uint8_t *base_;
+	size_t offset_;
+	bool ownsMemory_;
+
+	void *allocateImpl(size_t bytes, uint8_t alignment) override;
+	/// Blocks are not released singularly, the memory is reclaimed by `clear()`
+	void deallocateImpl(void *ptr) override {}
+};
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef CLASS_NCTL_LIST
 #define CLASS_NCTL_LIST
 
+#include "IAllocator.h"
 #include "ListIterator.h"
 #include "ReverseIterator.h"
 #include "utility.h"
@@ -64,15 +65,24 @@ class List
 	using ConstReverseIterator = nctl::ReverseIterator<ConstIterator>;
 
 	List()
-	    : size_(0) {}
+	    : size_(0), allocator_(nullptr) {}
+	/// Constructs a list whose nodes are allocated by the specified allocator
+	explicit List(IAllocator &alloc)
+	    : size_(0), allocator_(&alloc) {}
 	~List() { clear(); }
 
-	/// Copy constructor
-	List(const List &other);
+	/// Copy constructor, the copy uses `new` and `delete` whatever the allocator of the other list
+	List(const List &other)
+	    : List(other, static_cast<IAllocator *>(nullptr)) {}
+	/// Copy constructor with an allocator for the nodes of the copy
+	List(const List &other, IAllocator &alloc)
+	    : List(other, &alloc) {}
 	/// Move constructor
 	List(List &&other);
-	/// Copy-and-swap assignment operator
-	List &operator=(List other);
+	/// Copy assignment operator, the list keeps its own allocator
+	List &operator=(const List &other);
+	/// Move assignment operator
+	List &operator=(List &&other);
 
 	/// Swaps two lists without copying their data
 	void swap(List &first, List &second)
@@ -80,6 +90,7 @@ class List
 		nctl::swap(first.size_, second.size_);
 		nctl::swap(first.sentinel_.previous_, second.sentinel_.previous_);
 		nctl::swap(first.sentinel_.next_, second.sentinel_.next_);
+		nctl::swap(first.allocator_, second.allocator_);
 	}
 
 	/// Returns an iterator to the first element
@@ -169,11 +180,21 @@ class List
 	/// Transfers a range of elements from the source list, `last` not included, in front of `position`
 	void splice(Iterator position, List &source, Iterator first, Iterator last);
 
+	/// Returns the allocator used for the nodes, or `nullptr` if they are allocated with `new` and `delete`
+	inline IAllocator *allocator() const { return allocator_; }
+
   private:
 	/// Number of elements in the list
 	unsigned int size_;
 	/// The sentinel node
 	BaseListNode sentinel_;
+	/// The allocator for the nodes, `nullptr` to use `new` and `delete`
+	IAllocator *allocator_;
+
+	/// Creates a new node with the list allocator
+	template <typename... Args> ListNode<T> *createNode(Args &&... args);
+	/// Destroys a node created with `createNode()`
+	void destroyNode(ListNode<T> *node);
 
 	/// Inserts a new element after a specified node
 	ListNode<T> *insertAfterNode(ListNode<T> *node, const T &element);
@@ -191,11 +212,13 @@ class List
 	ListNode<T> *removeNode(BaseListNode *node);
 	/// Removes a range of nodes in constant time, last not included
 	ListNode<T> *removeRange(ListNode<T> *firstNode, ListNode<T> *lastNode);
+
+	List(const List &other, IAllocator *alloc);
 };
 
 template <class T>
-List<T>::List(const List<T> &other)
-    : size_(0)
+List<T>::List(const List<T> &other, IAllocator *alloc)
+    : size_(0), allocator_(alloc)
 {
 	for (List<T>::ConstIterator i = other.begin(); i != other.end(); ++i)
 		pushBack(*i);
@@ -203,7 +226,7 @@ List<T>::List(const List<T> &other)
 
 template <class T>
 List<T>::List(List<T> &&other)
-    : size_(other.size_)
+    : size_(other.size_), allocator_(other.allocator_)
 {
 	if (other.size_ > 0)
 	{
@@ -218,10 +241,25 @@ List<T>::List(List<T> &&other)
 	}
 }
 
-/*! \note The parameter should be passed by value for the idiom to work. */
+/*! \note The allocator of the other list is not propagated, like when copy constructing. */
+template <class T>
+List<T> &List<T>::operator=(const List<T> &other)
+{
+	if (this != &other)
+	{
+		List<T> copy(other, allocator_);
+		*this = nctl::move(copy);
+	}
+	return *this;
+}
+
+/*! \note The other list receives the previous nodes of this one. */
 template <class T>
-List<T> &List<T>::operator=(List<T> other)
+List<T> &List<T>::operator=(List<T> &&other)
 {
+	if (this == &other)
+		return *this;
+
 	if (size_ == 0)
 	{
 		sentinel_.previous_ = &other.sentinel_;
@@ -252,7 +290,7 @@ void List<T>::clear()
 	{
 		nextNode = nextNode->next_;
 		// Cast is needed to prevent memory leaking
-		delete static_cast<ListNode<T> *>(sentinel_.next_);
+		destroyNode(static_cast<ListNode<T> *>(sentinel_.next_));
 		sentinel_.next_ = nextNode;
 	}
 
@@ -403,6 +441,8 @@ void List<T>::splice(Iterator position, List &source, Iterator it)
 template <class T>
 void List<T>::splice(Iterator position, List &source, Iterator first, Iterator last)
 {
+	// Nodes would be released by the wrong allocator
+	FATAL_ASSERT_MSG(allocator_ == source.allocator_, "Cannot splice nodes between lists with different allocators");
 	// Early-out if the source list is empty
 	if (source.isEmpty())
 		return;
@@ -443,7 +483,7 @@ void List<T>::splice(Iterator position, List &source, Iterator first, Iterator l
 template <class T>
 ListNode<T> *List<T>::insertAfterNode(ListNode<T> *node, const T &element)
 {
-	ListNode<T> *newNode = new ListNode<T>(node, node->next_, element);
+	ListNode<T> *newNode = createNode(node, node->next_, element);
 
 	// it also works if `node->next_` is the sentinel
 	node->next_->previous_ = newNode;
@@ -456,7 +496,7 @@ ListNode<T> *List<T>::insertAfterNode(ListNode<T> *node, const T &element)
 template <class T>
 ListNode<T> *List<T>::insertAfterNode(ListNode<T> *node, T &&element)
 {
-	ListNode<T> *newNode = new ListNode<T>(node, node->next_, nctl::move(element));
+	ListNode<T> *newNode = createNode(node, node->next_, nctl::move(element));
 
 	// it also works if `node->next_` is the sentinel
 	node->next_->previous_ = newNode;
@@ -470,7 +510,7 @@ template <class T>
 template <typename... Args>
 ListNode<T> *List<T>::emplaceAfterNode(ListNode<T> *node, Args &&... args)
 {
-	ListNode<T> *newNode = new ListNode<T>(node, node->next_, nctl::forward<Args>(args)...);
+	ListNode<T> *newNode = createNode(node, node->next_, nctl::forward<Args>(args)...);
 
 	// it also works if `node->next_` is the sentinel
 	node->next_->previous_ = newNode;
@@ -483,7 +523,7 @@ ListNode<T> *List<T>::emplaceAfterNode(ListNode<T> *node, Args &&... args)
 template <class T>
 ListNode<T> *List<T>::insertBeforeNode(ListNode<T> *node, const T &element)
 {
-	ListNode<T> *newNode = new ListNode<T>(node->previous_, node, element);
+	ListNode<T> *newNode = createNode(node->previous_, node, element);
 
 	// it also works if `node->previous_` is the sentinel
 	node->previous_->next_ = newNode;
@@ -496,7 +536,7 @@ ListNode<T> *List<T>::insertBeforeNode(ListNode<T> *node, const T &element)
 template <class T>
 ListNode<T> *List<T>::insertBeforeNode(ListNode<T> *node, T &&element)
 {
-	ListNode<T> *newNode = new ListNode<T>(node->previous_, node, nctl::move(element));
+	ListNode<T> *newNode = createNode(node->previous_, node, nctl::move(element));
 
 	// it also works if `node->previous_` is the sentinel
 	node->previous_->next_ = newNode;
@@ -510,7 +550,7 @@ template <class T>
 template <typename... Args>
 ListNode<T> *List<T>::emplaceBeforeNode(ListNode<T> *node, Args &&... args)
 {
-	ListNode<T> *newNode = new ListNode<T>(node->previous_, node, nctl::forward<Args>(args)...);
+	ListNode<T> *newNode = createNode(node->previous_, node, nctl::forward<Args>(args)...);
 
 	// it also works if `node->previous_` is the sentinel
 	node->previous_->next_ = newNode;
@@ -538,7 +578,7 @@ ListNode<T> *List<T>::removeRange(ListNode<T> *firstNode, ListNode<T> *lastNode)
 	{
 		next = current->next_;
 		// Cast is needed to prevent memory leaking
-		delete static_cast<ListNode<T> *>(current);
+		destroyNode(static_cast<ListNode<T> *>(current));
 		size_--;
 		current = next;
 	}
@@ -551,6 +591,30 @@ ListNode<T> *List<T>::removeRange(ListNode<T> *firstNode, ListNode<T> *lastNode)
 	return lastNode;
 }
 
+template <class T>
+template <typename... Args>
+ListNode<T> *List<T>::createNode(Args &&... args)
+{
+	if (allocator_ == nullptr)
+		return new ListNode<T>(nctl::forward<Args>(args)...);
+
+	void *ptr = allocator_->allocate(sizeof(ListNode<T>), alignof(ListNode<T>));
+	FATAL_ASSERT_MSG_X(ptr, "Allocator \"%s\" cannot allocate a list node", allocator_->name());
+	return new (ptr) ListNode<T>(nctl::forward<Args>(args)...);
+}
+
+template <class T>
+void List<T>::destroyNode(ListNode<T> *node)
+{
+	if (allocator_ == nullptr)
+		delete node;
+	else
+	{
+		node->~ListNode<T>();
+		allocator_->deallocate(node);
+	}
+}
+
 }
 
 #endif
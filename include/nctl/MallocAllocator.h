@@ -0,0 +1,31 @@
+#ifndef CLASS_NCTL_MALLOCALLOCATOR
+#define CLASS_NCTL_MALLOCALLOCATOR
+
+#include "IAllocator.h"
+
+namespace nctl {
+
+/// An allocator that forwards requests to `malloc()` and `free()`, keeping statistics
+/*! It is useful to measure the heap usage of a specific set of containers. */
+class DLL_PUBLIC MallocAllocator : public IAllocator
+{
+  public:
+	explicit MallocAllocator(const char *name);
+	~MallocAllocator() override;
+
+  private:
+	/// The header stored before every block
+	struct Header
+	{
+		size_t size;
+		/// Distance between the block returned by `malloc()` and the aligned one
+		size_t adjustment;
+	};
+
+	void *allocateImpl(size_t bytes, uint8_t alignment) override;
+	void deallocateImpl(void *ptr) override;
+};
+
+}
+
+#endif
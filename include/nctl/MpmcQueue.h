@@ -0,0 +1,180 @@
+#ifndef CLASS_NCTL_MPMCQUEUE
+#define CLASS_NCTL_MPMCQUEUE
+
+#include <ncine/common_macros.h>
+#include "Atomic.h"
+#include "UniquePtr.h"
+#include "utility.h"
+
+namespace nctl {
+
+/// A bounded lock-free ring queue for multiple producer and multiple consumer threads
+/*!
+ * Every slot has a sequence number that tells producers and consumers if it is ready to be written or read,
+ * threads only compete on the enqueue or on the dequeue index with a compare and exchange.
+ * \note The capacity is rounded up to a power of two and every element is constructed upfront.
+ */
+template <class T>
+class MpmcQueue
+{
+  public:
+	/// The maximum capacity, sequence numbers are compared as signed differences that must not reach half the index range
+	static const unsigned int MaxCapacity = 1u << 30;
+
+	/// Creates a queue that can hold at least the specified number of elements
+	explicit MpmcQueue(unsigned int capacity);
+
+	/// Returns the number of elements the queue can hold
+	inline unsigned int capacity() const { return capacity_; }
+	/// Returns the number of elements in the queue
+	/*! \note The value is only an estimate if other threads are operating on the queue. */
+	unsigned int size();
+	/// Returns true if the queue is empty
+	inline bool isEmpty() { return size() == 0; }
+
+	/// Copies an element at the back of the queue
+	/*! \return False if the queue is full */
+	bool push(const T &element);
+	/// Moves an element at the back of the queue
+	/*! \return False if the queue is full */
+	bool push(T &&element);
+	/// Moves the element at the front of the queue out of it
+	/*! \return False if the queue is empty */
+	bool pop(T &element);
+
+  private:
+	/// Padding to keep the enqueue and dequeue indices on different cache lines
+	static const unsigned int CacheLineSize = 64;
+
+	struct Cell
+	{
+		/// Equal to the enqueue index when the cell can be written and to the index plus one when it can be read
+		Atomic32 sequence;
+		T data;
+	};
+
+	unsigned int capacity_;
+	unsigned int mask_;
+	UniquePtr<Cell[]> cells_;
+
+	char padding0_[CacheLineSize];
+	Atomic32 enqueueIndex_;
+	char padding1_[CacheLineSize];
+	Atomic32 dequeueIndex_;
+	char padding2_[CacheLineSize];
+
+	/// Claims a cell to be written, returns `nullptr` if the queue is full
+	Cell *reserveCell(uint32_t &index);
+
+	/// Deleted copy constructor
+	MpmcQueue(const MpmcQueue &) = delete;
+	/// Deleted assignment operator
+	MpmcQueue &operator=(const MpmcQueue &) = delete;
+};
+
+template <class T>
+MpmcQueue<T>::MpmcQueue(unsigned int capacity)
+    : capacity_(1), mask_(0), enqueueIndex_(0), dequeueIndex_(0)
+{
+	FATAL_ASSERT_MSG(capacity > 0, "Zero is not a valid capacity");
+	FATAL_ASSERT_MSG_X(capacity <= MaxCapacity, "Capacity %u is larger than the maximum of %u", capacity, MaxCapacity);
+	while (capacity_ < capacity)
+		capacity_ <<= 1;
+	mask_ = capacity_ - 1;
+
+	cells_ = makeUnique<Cell[]>(capacity_);
+	for (unsigned int i = 0; i < capacity_; i++)
+		cells_[i].sequence.store(static_cast<int32_t>(i), Atomic32::MemoryModel::RELAXED);
+}
+
+template <class T>
+unsigned int MpmcQueue<T>::size()
+{
+	const uint32_t dequeueIndex = static_cast<uint32_t>(dequeueIndex_.load(Atomic32::MemoryModel::ACQUIRE));
+	const uint32_t enqueueIndex = static_cast<uint32_t>(enqueueIndex_.load(Atomic32::MemoryModel::ACQUIRE));
+	const uint32_t size = enqueueIndex - dequeueIndex;
+	// The two indices are not read at the same time
+	return (size <= capacity_) ? size : 0;
+}
+
+template <class T>
+bool MpmcQueue<T>::push(const T &element)
+{
+	uint32_t index = 0;
+	Cell *cell = reserveCell(index);
+	if (cell == nullptr)
+		return false;
+
+	cell->data = element;
+	cell->sequence.store(static_cast<int32_t>(index + 1), Atomic32::MemoryModel::RELEASE);
+	return true;
+}
+
+template <class T>
+bool MpmcQueue<T>::push(T &&element)
+{
+	uint32_t index = 0;
+	Cell *cell = reserveCell(index);
+	if (cell == nullptr)
+		return false;
+
+	cell->data = nctl::move(element);
+	cell->sequence.store(static_cast<int32_t>(index + 1), Atomic32::MemoryModel::RELEASE);
+	return true;
+}
+
+template <class T>
+bool MpmcQueue<T>::pop(T &element)
+{
+	Cell *cell = nullptr;
+	uint32_t index = static_cast<uint32_t>(dequeueIndex_.load(Atomic32::MemoryModel::RELAXED));
+	while (true)
+	{
+		cell = &cells_[index & mask_];
+		const uint32_t sequence = static_cast<uint32_t>(cell->sequence.load(Atomic32::MemoryModel::ACQUIRE));
+		const int32_t difference = static_cast<int32_t>(sequence - (index + 1));
+
+		if (difference == 0)
+		{
+			if (dequeueIndex_.cmpExchange(static_cast<int32_t>(index + 1), static_cast<int32_t>(index), Atomic32::MemoryModel::RELAXED))
+				break;
+			index = static_cast<uint32_t>(dequeueIndex_.load(Atomic32::MemoryModel::RELAXED));
+		}
+		else if (difference < 0)
+			return false; // the cell has not been written yet, the queue is empty
+		else
+			index = static_cast<uint32_t>(dequeueIndex_.load(Atomic32::MemoryModel::RELAXED));
+	}
+
+	element = nctl::move(cell->data);
+	// The cell can be written again when the enqueue index wraps around to it
+	cell->sequence.store(static_cast<int32_t>(index + capacity_), Atomic32::MemoryModel::RELEASE);
+	return true;
+}
+
+template <class T>
+typename MpmcQueue<T>::Cell *MpmcQueue<T>::reserveCell(uint32_t &index)
+{
+	index = static_cast<uint32_t>(enqueueIndex_.load(Atomic32::MemoryModel::RELAXED));
+	while (true)
+	{
+		Cell *cell = &cells_[index & mask_];
+		const uint32_t sequence = static_cast<uint32_t>(cell->sequence.load(Atomic32::MemoryModel::ACQUIRE));
+		const int32_t difference = static_cast<int32_t>(sequence - index);
+
+		if (difference == 0)
+		{
+			if (enqueueIndex_.cmpExchange(static_cast<int32_t>(index + 1), static_cast<int32_t>(index), Atomic32::MemoryModel::RELAXED))
+				return cell;
+			index = static_cast<uint32_t>(enqueueIndex_.load(Atomic32::MemoryModel::RELAXED));
+		}
+		else if (difference < 0)
+			return nullptr; // the cell has not been read yet, the queue is full
+		else
+			index = static_cast<uint32_t>(enqueueIndex_.load(Atomic32::MemoryModel::RELAXED));
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef CLASS_NCTL_POOLALLOCATOR
+#define CLASS_NCTL_POOLALLOCATOR
+
+#include "IAllocator.h"
+
+namespace nctl {
+
+/// An allocator of fixed size blocks, kept in a free list threaded through the unused ones
+/*! It is suited for node based containers, like a `List` whose nodes are all of the same size. */
+class DLL_PUBLIC PoolAllocator : public IAllocator
+{
+  public:
+	/// Constructs a pool allocator that owns the memory for `numBlocks` blocks of `blockSize` bytes
+	PoolAllocator(const char *name, size_t blockSize, unsigned int numBlocks);
+	/// Constructs a pool allocator with blocks aligned to the specified power of two
+	PoolAllocator(const char *name, size_t blockSize, unsigned int numBlocks, uint8_t alignment);
+	~PoolAllocator() override;
+
+	/// Returns the size in bytes of a block, padding included
+	inline size_t blockSize() const { return blockSize_; }
+	/// Returns the total number of blocks
+	inline unsigned int numBlocks() const { return numBlocks_; }
+	/// Returns the number of blocks that can still be allocated
+	inline unsigned int numFreeBlocks() const { return numBlocks_ - numAllocations_; }
+
+  private:
+	/// An unused block, pointing to the next one
+	struct FreeBlock
+	{
+		FreeBlock *next;
+	};
+
+	uint8_t *memory_;
+	uint8_t *base_;
+	size_t blockSize_;
+	unsigned int numBlocks_;
+	uint8_t alignment_;
+	FreeBlock *freeList_;
+
+	void *allocateImpl(size_t bytes, uint8_t alignment) override;
+	void deallocateImpl(void *ptr) override;
+};
+
+}
+
+#endif
@@ -111,8 +111,8 @@ SharedPtr<T>::~SharedPtr()
 {
 	if (ctrlBlock_)
 	{
-		ctrlBlock_->counter_--;
-		if (ctrlBlock_->counter_ <= 0)
+		// Decrementing and checking the counter is a single atomic operation, another owner could be releasing at the same time
+		if (--ctrlBlock_->counter_ <= 0)
 			delete ctrlBlock_;
 	}
 }
@@ -152,8 +152,7 @@ void SharedPtr<T>::reset(T *newPtr)
 	// check for self reset
 	if (ptr_ != newPtr)
 	{
-		ctrlBlock_->counter_--;
-		if (ctrlBlock_->counter_ <= 0)
+		if (--ctrlBlock_->counter_ <= 0)
 			ctrlBlock_->dispose();
 
 		ptr_ = newPtr;
@@ -165,8 +164,7 @@ void SharedPtr<T>::reset(T *newPtr)
 template <class T>
 void SharedPtr<T>::reset(nullptr_t)
 {
-	ctrlBlock_->counter_--;
-	if (ctrlBlock_->counter_ <= 0)
+	if (--ctrlBlock_->counter_ <= 0)
 		ctrlBlock_->dispose();
 
 	ptr_ = nullptr;
@@ -86,6 +86,8 @@ class SparseSet
 	inline unsigned int size() const { return size_; }
 	/// Returns the ratio between used and total buckets
 	inline float loadFactor() const { return size_ / static_cast<float>(capacity_); }
+	/// Returns a constant pointer to the densely packed elements
+	inline const T *data() const { return dense_.get(); }
 
 	/// Clears the sparseset
 	inline void clear() { size_ = 0; }
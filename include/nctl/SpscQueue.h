@@ -0,0 +1,152 @@
+#ifndef CLASS_NCTL_SPSCQUEUE
+#define CLASS_NCTL_SPSCQUEUE
+
+#include <ncine/common_macros.h>
+#include "Atomic.h"
+#include "UniquePtr.h"
+#include "utility.h"
+
+namespace nctl {
+
+/// A bounded lock-free ring queue for a single producer and a single consumer thread
+/*!
+ * Only one thread should push and only one thread should pop, the two can run concurrently without locks.
+ * Every thread keeps a local copy of the other thread index, reading the shared one only when the queue looks full or empty.
+ * \note The capacity is rounded up to a power of two and every element is constructed upfront.
+ */
+template <class T>
+class SpscQueue
+{
+  public:
+	/// The maximum capacity, a larger power of two does not fit in an `unsigned int`
+	static const unsigned int MaxCapacity = 1u << 31;
+
+	/// Creates a queue that can hold at least the specified number of elements
+	explicit SpscQueue(unsigned int capacity);
+
+	/// Returns the number of elements the queue can hold
+	inline unsigned int capacity() const { return capacity_; }
+	/// Returns the number of elements in the queue
+	/*! \note The value is only an estimate if the other thread is operating on the queue. */
+	unsigned int size();
+	/// Returns true if the queue is empty
+	inline bool isEmpty() { return size() == 0; }
+
+	/// Copies an element at the back of the queue, to be called only by the producer thread
+	/*! \return False if the queue is full */
+	bool push(const T &element);
+	/// Moves an element at the back of the queue, to be called only by the producer thread
+	/*! \return False if the queue is full */
+	bool push(T &&element);
+	/// Moves the element at the front of the queue out of it, to be called only by the consumer thread
+	/*! \return False if the queue is empty */
+	bool pop(T &element);
+
+  private:
+	/// Padding to keep the producer and consumer indices on different cache lines
+	static const unsigned int CacheLineSize = 64;
+
+	unsigned int capacity_;
+	unsigned int mask_;
+	UniquePtr<T[]> buffer_;
+
+	char padding0_[CacheLineSize];
+	/// Index of the next element to pop, written by the consumer
+	Atomic32 head_;
+	/// The last tail index read by the consumer
+	uint32_t cachedTail_;
+
+	char padding1_[CacheLineSize];
+	/// Index of the next element to push, written by the producer
+	Atomic32 tail_;
+	/// The last head index read by the producer
+	uint32_t cachedHead_;
+
+	char padding2_[CacheLineSize];
+
+	/// Retrieves the index of the slot to push in, returns false if the queue is full
+	bool reserveSlot(uint32_t &tail);
+
+	/// Deleted copy constructor
+	SpscQueue(const SpscQueue &) = delete;
+	/// Deleted assignment operator
+	SpscQueue &operator=(const SpscQueue &) = delete;
+};
+
+template <class T>
+SpscQueue<T>::SpscQueue(unsigned int capacity)
+    : capacity_(1), mask_(0), head_(0), cachedTail_(0), tail_(0), cachedHead_(0)
+{
+	FATAL_ASSERT_MSG(capacity > 0, "Zero is not a valid capacity");
+	FATAL_ASSERT_MSG_X(capacity <= MaxCapacity, "Capacity %u is larger than the maximum of %u", capacity, MaxCapacity);
+	while (capacity_ < capacity)
+		capacity_ <<= 1;
+	mask_ = capacity_ - 1;
+	buffer_ = makeUnique<T[]>(capacity_);
+}
+
+template <class T>
+unsigned int SpscQueue<T>::size()
+{
+	const uint32_t head = static_cast<uint32_t>(head_.load(Atomic32::MemoryModel::ACQUIRE));
+	const uint32_t tail = static_cast<uint32_t>(tail_.load(Atomic32::MemoryModel::ACQUIRE));
+	return tail - head;
+}
+
+template <class T>
+bool SpscQueue<T>::push(const T &element)
+{
+	uint32_t tail = 0;
+	if (reserveSlot(tail) == false)
+		return false;
+
+	buffer_[tail & mask_] = element;
+	tail_.store(static_cast<int32_t>(tail + 1), Atomic32::MemoryModel::RELEASE);
+	return true;
+}
+
+template <class T>
+bool SpscQueue<T>::push(T &&element)
+{
+	uint32_t tail = 0;
+	if (reserveSlot(tail) == false)
+		return false;
+
+	buffer_[tail & mask_] = nctl::move(element);
+	tail_.store(static_cast<int32_t>(tail + 1), Atomic32::MemoryModel::RELEASE);
+	return true;
+}
+
+template <class T>
+bool SpscQueue<T>::pop(T &element)
+{
+	const uint32_t head = static_cast<uint32_t>(head_.load(Atomic32::MemoryModel::RELAXED));
+	if (head == cachedTail_)
+	{
+		cachedTail_ = static_cast<uint32_t>(tail_.load(Atomic32::MemoryModel::ACQUIRE));
+		if (head == cachedTail_)
+			return false;
+	}
+
+	element = nctl::move(buffer_[head & mask_]);
+	head_.store(static_cast<int32_t>(head + 1), Atomic32::MemoryModel::RELEASE);
+	return true;
+}
+
+template <class T>
+bool SpscQueue<T>::reserveSlot(uint32_t &tail)
+{
+	tail = static_cast<uint32_t>(tail_.load(Atomic32::MemoryModel::RELAXED));
+	if (tail - cachedHead_ == capacity_)
+	{
+		cachedHead_ = static_cast<uint32_t>(head_.load(Atomic32::MemoryModel::ACQUIRE));
+		if (tail - cachedHead_ == capacity_)
+			return false;
+	}
+
+	return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef CLASS_NCTL_STACKALLOCATOR
+#define CLASS_NCTL_STACKALLOCATOR
+
+#include "IAllocator.h"
+
+namespace nctl {
+
+/// An allocator that releases blocks in the reverse order of their allocation
+/*! A small header before every block allows the top of the stack to be moved back on deallocation. */
+class DLL_PUBLIC StackAllocator : public IAllocator
+{
+  public:
+	/// Constructs a stack allocator that owns a memory region of the specified size
+	StackAllocator(const char *name, size_t size);
+	/// Constructs a stack allocator that manages a memory region owned by the caller
+	StackAllocator(const char *name, void *base, size_t size);
+	~StackAllocator() override;
+
+	/// Reclaims all the allocated memory
+	/*! Objects living in the region are not destructed. */
+	void clear();
+
+	/// Returns the number of bytes still available, not accounting for alignment and headers
+	inline size_t freeMemory() const { return size_ - offset_; }
+
+  private:
+	/// The header stored before every block
+	struct Header
+	{
+		/// Offset of the top of the stack before the allocation
+		size_t previousOffset;
+		/// The block that was at the top of the stack before the allocation
+		uint8_t *previousBlock;
+	};
+
+	uint8_t *base_;
+	size_t offset_;
+	/// The block at the top of the stack, the only one that can be released
+	uint8_t *lastBlock_;
+	bool ownsMemory_;
+
+	void *allocateImpl(size_t bytes, uint8_t alignment) override;
+	void deallocateImpl(void *ptr) override;
+};
+
+}
+
+#endif
@@ -93,6 +93,10 @@ class StaticHashMap
 	T *find(const K &key);
 	/// Checks whether an element is in the hashmap or not (read-only)
 	const T *find(const K &key) const;
+	/// Checks whether an element is in the hashmap or not, using a compatible key type and its precomputed hash
+	template <class LK> T *find(const LK &key, hash_t hash);
+	/// Checks whether an element is in the hashmap or not, using a compatible key type and its precomputed hash (read-only)
+	template <class LK> const T *find(const LK &key, hash_t hash) const;
 	/// Removes a key from the hashmap, if it exists
 	bool remove(const K &key);
 
@@ -112,14 +116,15 @@ class StaticHashMap
 	Node nodes_[Capacity];
 	HashFunc hashFunc_;
 
-	bool findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const;
+	template <class LK> bool findBucketIndex(const LK &key, hash_t hash, unsigned int &foundIndex, unsigned int &prevFoundIndex) const;
+	inline bool findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const;
 	inline bool findBucketIndex(const K &key, unsigned int &foundIndex) const;
 	unsigned int addDelta1(unsigned int bucketIndex) const;
 	unsigned int addDelta2(unsigned int bucketIndex) const;
 	unsigned int calcNewDelta(unsigned int bucketIndex, unsigned int newIndex) const;
 	unsigned int linearSearch(unsigned int index, hash_t hash, const K &key) const;
-	bool bucketFoundOrEmpty(unsigned int index, hash_t hash, const K &key) const;
-	bool bucketFound(unsigned int index, hash_t hash, const K &key) const;
+	template <class LK> bool bucketFoundOrEmpty(unsigned int index, hash_t hash, const LK &key) const;
+	template <class LK> bool bucketFound(unsigned int index, hash_t hash, const LK &key) const;
 	T &addNode(unsigned int index, hash_t hash, const K &key);
 	void insertNode(unsigned int index, hash_t hash, const K &key, const T &value);
 	void insertNode(unsigned int index, hash_t hash, const K &key, T &&value);
@@ -514,6 +519,38 @@ const T *StaticHashMap<K, T, Capacity, HashFunc>::find(const K &key) const
 	return returnedPtr;
 }
 
+/*! \note The key type should be comparable with `K` and the hash should be the same that the hash function would return for the equivalent `K` key. */
+template <class K, class T, unsigned int Capacity, class HashFunc>
+template <class LK>
+T *StaticHashMap<K, T, Capacity, HashFunc>::find(const LK &key, hash_t hash)
+{
+	int unsigned bucketIndex = 0;
+	int unsigned prevBucketIndex = 0;
+	const bool found = findBucketIndex(key, hash, bucketIndex, prevBucketIndex);
+
+	T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[bucketIndex].value;
+
+	return returnedPtr;
+}
+
+/*! \note The key type should be comparable with `K` and the hash should be the same that the hash function would return for the equivalent `K` key. */
+template <class K, class T, unsigned int Capacity, class HashFunc>
+template <class LK>
+const T *StaticHashMap<K, T, Capacity, HashFunc>::find(const LK &key, hash_t hash) const
+{
+	int unsigned bucketIndex = 0;
+	int unsigned prevBucketIndex = 0;
+	const bool found = findBucketIndex(key, hash, bucketIndex, prevBucketIndex);
+
+	const T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[bucketIndex].value;
+
+	return returnedPtr;
+}
+
 /*! \return True if the element has been found and removed */
 template <class K, class T, unsigned int Capacity, class HashFunc>
 bool StaticHashMap<K, T, Capacity, HashFunc>::remove(const K &key)
@@ -570,13 +607,13 @@ bool StaticHashMap<K, T, Capacity, HashFunc>::remove(const K &key)
 }
 
 template <class K, class T, unsigned int Capacity, class HashFunc>
-bool StaticHashMap<K, T, Capacity, HashFunc>::findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const
+template <class LK>
+bool StaticHashMap<K, T, Capacity, HashFunc>::findBucketIndex(const LK &key, hash_t hash, unsigned int &foundIndex, unsigned int &prevFoundIndex) const
 {
 	if (size_ == 0)
 		return false;
 
 	bool found = false;
-	const hash_t hash = hashFunc_(key);
 	foundIndex = hash % Capacity;
 	prevFoundIndex = foundIndex;
 
@@ -619,6 +656,12 @@ bool StaticHashMap<K, T, Capacity, HashFunc>::findBucketIndex(const K &key, unsi
 	return found;
 }
 
+template <class K, class T, unsigned int Capacity, class HashFunc>
+bool StaticHashMap<K, T, Capacity, HashFunc>::findBucketIndex(const K &key, unsigned int &foundIndex, unsigned int &prevFoundIndex) const
+{
+	return findBucketIndex(key, hashFunc_(key), foundIndex, prevFoundIndex);
+}
+
 template <class K, class T, unsigned int Capacity, class HashFunc>
 bool StaticHashMap<K, T, Capacity, HashFunc>::findBucketIndex(const K &key, unsigned int &foundIndex) const
 {
@@ -676,13 +719,15 @@ unsigned int StaticHashMap<K, T, Capacity, HashFunc>::linearSearch(unsigned int
 }
 
 template <class K, class T, unsigned int Capacity, class HashFunc>
-bool StaticHashMap<K, T, Capacity, HashFunc>::bucketFoundOrEmpty(unsigned int index, hash_t hash, const K &key) const
+template <class LK>
+bool StaticHashMap<K, T, Capacity, HashFunc>::bucketFoundOrEmpty(unsigned int index, hash_t hash, const LK &key) const
 {
 	return (hashes_[index] == NullHash || (hashes_[index] == hash && nodes_[index].key == key));
 }
 
 template <class K, class T, unsigned int Capacity, class HashFunc>
-bool StaticHashMap<K, T, Capacity, HashFunc>::bucketFound(unsigned int index, hash_t hash, const K &key) const
+template <class LK>
+bool StaticHashMap<K, T, Capacity, HashFunc>::bucketFound(unsigned int index, hash_t hash, const LK &key) const
 {
 	return (hashes_[index] == hash && nodes_[index].key == key);
 }
@@ -737,7 +782,7 @@ void StaticHashMap<K, T, Capacity, HashFunc>::emplaceNode(unsigned int index, ha
 }
 
 template <class T, unsigned int Capacity>
-using StaticStringHashMap = StaticHashMap<String, T, Capacity, FNV1aFuncHashContainer<String>>;
+using StaticStringHashMap = StaticHashMap<String, T, Capacity, MemberHashFunc<String>>;
 
 }
 
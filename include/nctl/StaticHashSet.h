@@ -581,7 +581,7 @@ void StaticHashSet<K, Capacity, HashFunc>::insertKey(unsigned int index, hash_t
 }
 
 template <unsigned int Capacity>
-using StaticStringHashSet = StaticHashSet<String, Capacity, FNV1aFuncHashContainer<String>>;
+using StaticStringHashSet = StaticHashSet<String, Capacity, MemberHashFunc<String>>;
 
 }
 
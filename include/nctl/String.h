@@ -2,6 +2,9 @@
 #define CLASS_NCTL_STRING
 
 #include <ncine/common_macros.h>
+#include "IAllocator.h"
+#include "Atomic.h"
+#include "StringView.h"
 #include "StringIterator.h"
 #include "ReverseIterator.h"
 #include "utility.h"
@@ -28,20 +31,32 @@ class DLL_PUBLIC String
 	String();
 	/// Constructs an empty string with explicit size
 	explicit String(unsigned int capacity);
+	/// Constructs an empty string with explicit size that takes its memory from the specified allocator
+	String(unsigned int capacity, IAllocator &alloc);
 	/// Constructs a string object from a C string
 	String(const char *cString);
+	/// Constructs a string object from a C string that takes its memory from the specified allocator
+	String(const char *cString, IAllocator &alloc);
+	/// Constructs a string object from the characters of a string view
+	explicit String(const StringView &view);
+	/// Constructs a string object from the characters of a string view that takes its memory from the specified allocator
+	String(const StringView &view, IAllocator &alloc);
 	~String();
 
-	/// Copy constructor
+	/// Copy constructor, the copy uses `new` and `delete` whatever the allocator of the other string
 	String(const String &other);
+	/// Copy constructor with an allocator for the copy
+	String(const String &other, IAllocator &alloc);
 	/// Move constructor
 	String(String &&other);
-	/// Assignment operator that preserves the original string capacity
+	/// Assignment operator that preserves the original string capacity and allocator
 	String &operator=(const String &other);
 	/// Move assignment operator
 	String &operator=(String &&other);
 	/// Assigns a constant C string to the string object
 	String &operator=(const char *cString);
+	/// Assigns the characters of a string view to the string object
+	String &operator=(const StringView &view);
 
 	/// Swaps two strings without copying their data
 	void swap(String &first, String &second)
@@ -49,6 +64,10 @@ class DLL_PUBLIC String
 		nctl::swap(first.array_, second.array_);
 		nctl::swap(first.length_, second.length_);
 		nctl::swap(first.capacity_, second.capacity_);
+		nctl::swap(first.allocator_, second.allocator_);
+		const int32_t firstHash = first.hash_.load(Atomic32::MemoryModel::RELAXED);
+		first.hash_.store(second.hash_.load(Atomic32::MemoryModel::RELAXED), Atomic32::MemoryModel::RELAXED);
+		second.hash_.store(firstHash, Atomic32::MemoryModel::RELAXED);
 	}
 
 	/// Returns an iterator to the first character
@@ -91,10 +110,37 @@ class DLL_PUBLIC String
 	void clear();
 
 	/// Returns a pointer to the internal array
-	inline char *data() { return (capacity_ > SmallBufferSize) ? array_.begin_ : array_.local_; }
+	/*! \note It invalidates the cached hash, as the characters could be modified through the pointer. */
+	inline char *data()
+	{
+		invalidateHash();
+		return (capacity_ > SmallBufferSize) ? array_.begin_ : array_.local_;
+	}
 	/// Returns a constant pointer to the internal array
 	inline const char *data() const { return (capacity_ > SmallBufferSize) ? array_.begin_ : array_.local_; }
 
+	/// Returns a view over the characters of the string
+	inline operator StringView() const { return StringView(data(), length_); }
+
+	/// Returns the string hash of the characters, computing it only if they have been modified since the last call
+	/*!
+	 * \note The hash is invalidated by every non-constant method, characters written later through a pointer or an iterator
+	 * retrieved before the last call are not tracked. It is the same as the one returned by `StringView::hash()`.
+	 * \note The cache is accessed atomically, so different threads can call this method on the same constant string.
+	 * Like for any other method, a string that is being modified cannot be read at the same time by another thread.
+	 */
+	inline hash_t hash() const
+	{
+		hash_t hash = static_cast<hash_t>(hash_.load(Atomic32::MemoryModel::RELAXED));
+		if (hash == NullHash)
+		{
+			// Threads racing here compute and store the same value
+			hash = stringHash(data(), length_);
+			hash_.store(static_cast<int32_t>(hash), Atomic32::MemoryModel::RELAXED);
+		}
+		return hash;
+	}
+
 	/// Copies characters from somewhere in the other string to somewhere in this one
 	unsigned int assign(const String &source, unsigned int srcChar, unsigned int numChar, unsigned int destChar);
 	/// Copies characters from somewhere in the other string to the beginning of this one
@@ -140,6 +186,8 @@ class DLL_PUBLIC String
 	String &operator+=(const String &other);
 	/// Appends a constant C string to the string object
 	String &operator+=(const char *cString);
+	/// Appends the characters of a string view to the string object
+	String &operator+=(const StringView &view);
 	/// Concatenate two strings together to create a third one
 	String operator+(const String &other) const;
 	/// Concatenates a string with a constant C string to create a third one
@@ -162,6 +210,9 @@ class DLL_PUBLIC String
 	inline bool operator>=(const char *cString) const { return compare(cString) >= 0; }
 	inline bool operator<=(const char *cString) const { return compare(cString) <= 0; }
 
+	inline bool operator==(const StringView &view) const { return StringView(*this) == view; }
+	inline bool operator!=(const StringView &view) const { return StringView(*this) != view; }
+
 	/// Read-only access to the specified element (with bounds checking)
 	const char &at(unsigned int index) const;
 	/// Access to the specified element (with bounds checking)
@@ -171,6 +222,9 @@ class DLL_PUBLIC String
 	/// Subscript operator
 	char &operator[](unsigned int index);
 
+	/// Returns the allocator used for buffers bigger than the local one, or `nullptr` if they use `new` and `delete`
+	inline IAllocator *allocator() const { return allocator_; }
+
   private:
 	/// Size of the local buffer
 	static const unsigned int SmallBufferSize = 16;
@@ -185,6 +239,17 @@ class DLL_PUBLIC String
 	Buffer array_;
 	unsigned int length_;
 	unsigned int capacity_;
+	/// The allocator for buffers bigger than the local one, `nullptr` to use `new` and `delete`
+	IAllocator *allocator_;
+	/// The cached hash of the characters, `NullHash` if it has to be computed again
+	mutable Atomic32 hash_;
+
+	String(unsigned int capacity, IAllocator *alloc);
+	String(const char *cString, IAllocator *alloc);
+	String(const StringView &view, IAllocator *alloc);
+	String(const String &other, IAllocator *alloc);
+
+	inline void invalidateHash() { hash_.store(static_cast<int32_t>(NullHash), Atomic32::MemoryModel::RELAXED); }
 };
 
 DLL_PUBLIC String operator+(const char *cString, const String &string);
@@ -0,0 +1,70 @@
+#ifndef CLASS_NCTL_STRINGID
+#define CLASS_NCTL_STRINGID
+
+#include <ncine/common_macros.h>
+#include "StringView.h"
+
+namespace nctl {
+
+/// An identifier for a string interned in a global table
+/*!
+ * Equal strings are stored only once, so identifiers compare by pointer and carry a precomputed hash.
+ * Interned characters are null terminated and live until the end of the program.
+ * \note The global table is not thread-safe, identifiers should be created on the main thread.
+ */
+class DLL_PUBLIC StringId
+{
+  public:
+	/// Creates the identifier of the empty string
+	StringId();
+	/// Interns a C string
+	explicit StringId(const char *cString);
+	/// Interns the characters of a string view
+	explicit StringId(const StringView &view);
+	/// Interns the characters of a string view whose hash has already been computed
+	/*! \note The hash can be computed at compile time for literals with `stringHashLiteral()`. */
+	StringId(const StringView &view, hash_t hash);
+
+	/// Returns a constant pointer to the null terminated interned characters
+	inline const char *data() const { return entry_->chars; }
+	/// Returns the number of interned characters
+	inline unsigned int length() const { return entry_->length; }
+	/// Returns true if the identifier refers to the empty string
+	inline bool isEmpty() const { return entry_->length == 0; }
+	/// Returns the string hash of the interned characters
+	/*! \note It is the same as the one returned by `StringView::hash()` and `String::hash()`. */
+	inline hash_t hash() const { return entry_->hash; }
+	/// Returns a view over the interned characters
+	inline StringView view() const { return StringView(entry_->chars, entry_->length); }
+
+	inline bool operator==(const StringId &other) const { return entry_ == other.entry_; }
+	inline bool operator!=(const StringId &other) const { return entry_ != other.entry_; }
+
+	/// Retrieves the identifier of already interned characters without interning them
+	/*! \return True if the characters were found in the table */
+	static bool find(const StringView &view, StringId &stringId);
+	/// Returns the number of strings in the global table
+	static unsigned int numInterned();
+	/// Returns the number of bytes allocated to store interned strings
+	static unsigned long int internedBytes();
+
+  private:
+	/// The data stored only once for every interned string
+	struct Entry
+	{
+		hash_t hash;
+		unsigned int length;
+		const char *chars;
+	};
+
+	const Entry *entry_;
+
+	explicit StringId(const Entry *entry)
+	    : entry_(entry) {}
+
+	friend class InternTable;
+};
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef CLASS_NCTL_STRINGVIEW
+#define CLASS_NCTL_STRINGVIEW
+
+#include <cstring>
+#include <ncine/common_macros.h>
+#include "HashFunctions.h"
+#include "algorithms.h"
+
+namespace nctl {
+
+/// A non-owning, read-only view over a sequence of chars
+/*! \note The viewed characters are not required to be null terminated and they should outlive the view. */
+class StringView
+{
+  public:
+	/// Default constructor, creates an empty view
+	constexpr StringView()
+	    : data_(""), length_(0) {}
+	/// Creates a view over the specified number of characters
+	constexpr StringView(const char *chars, unsigned int length)
+	    : data_(chars), length_(length) {}
+	/// Creates a view over a null terminated C string
+	StringView(const char *cString)
+	    : data_(cString), length_(static_cast<unsigned int>(strlen(cString))) {}
+
+	/// Returns a constant pointer to the first viewed character
+	constexpr const char *data() const { return data_; }
+	/// Returns the number of viewed characters
+	constexpr unsigned int length() const { return length_; }
+	/// Returns true if the view is empty
+	constexpr bool isEmpty() const { return length_ == 0; }
+
+	/// Returns a constant pointer to the first character
+	inline const char *begin() const { return data_; }
+	/// Returns a constant pointer past the last character
+	inline const char *end() const { return data_ + length_; }
+
+	/// Read-only subscript operator
+	inline const char &operator[](unsigned int index) const { return data_[index]; }
+	/// Read-only access to the specified element (with bounds checking)
+	inline const char &at(unsigned int index) const
+	{
+		FATAL_ASSERT_MSG_X(index < length_, "Index %u is out of bounds (length: %u)", index, length_);
+		return data_[index];
+	}
+
+	/// Returns a view over a part of this one, clamped to its length
+	inline StringView subView(unsigned int start, unsigned int numChar) const
+	{
+		const unsigned int clampedStart = nctl::min(start, length_);
+		return StringView(data_ + clampedStart, nctl::min(numChar, length_ - clampedStart));
+	}
+	/// Returns a view from the specified character up to the end of this one
+	inline StringView subView(unsigned int start) const { return subView(start, length_); }
+
+	/// Returns the string hash of the viewed characters
+	/*! \note It matches the hash of a `String` with the same characters, as returned by `String::hash()`. */
+	inline hash_t hash() const { return stringHash(data_, length_); }
+
+	/// Compares the view with another one in lexicographical order
+	int compare(const StringView &other) const
+	{
+		const unsigned int minLength = nctl::min(length_, other.length_);
+		const int result = (minLength > 0) ? memcmp(data_, other.data_, minLength) : 0;
+		if (result != 0)
+			return result;
+		return (length_ < other.length_) ? -1 : ((length_ > other.length_) ? 1 : 0);
+	}
+
+	/// Returns true if the view starts with the specified characters
+	inline bool startsWith(const StringView &other) const
+	{
+		return (other.length_ <= length_ && memcmp(data_, other.data_, other.length_) == 0);
+	}
+
+	/// Finds the first occurrence of a character
+	int findFirstChar(char c) const
+	{
+		const void *foundPtr = (length_ > 0) ? memchr(data_, c, length_) : nullptr;
+		return foundPtr ? static_cast<int>(static_cast<const char *>(foundPtr) - data_) : -1;
+	}
+	/// Finds the last occurrence of a character
+	int findLastChar(char c) const
+	{
+		for (unsigned int i = length_; i > 0; i--)
+		{
+			if (data_[i - 1] == c)
+				return static_cast<int>(i - 1);
+		}
+		return -1;
+	}
+	/// Finds the first occurrence of the given characters
+	int find(const StringView &other) const
+	{
+		if (other.length_ > length_)
+			return -1;
+
+		for (unsigned int i = 0; i <= length_ - other.length_; i++)
+		{
+			if (memcmp(data_ + i, other.data_, other.length_) == 0)
+				return static_cast<int>(i);
+		}
+		return -1;
+	}
+
+	inline bool operator==(const StringView &other) const { return length_ == other.length_ && (length_ == 0 || memcmp(data_, other.data_, length_) == 0); }
+	inline bool operator!=(const StringView &other) const { return !(*this == other); }
+	inline bool operator<(const StringView &other) const { return compare(other) < 0; }
+	inline bool operator>(const StringView &other) const { return compare(other) > 0; }
+
+  private:
+	const char *data_;
+	unsigned int length_;
+};
+
+}
+
+#endif
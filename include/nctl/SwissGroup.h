@@ -0,0 +1,144 @@
+#ifndef CLASS_NCTL_SWISSGROUP
+#define CLASS_NCTL_SWISSGROUP
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NCTL_SWISSGROUP_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define NCTL_SWISSGROUP_NEON
+	#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+	#include <intrin.h> // for _BitScanForward()
+#endif
+
+namespace nctl {
+
+/// Control byte values for the slots of the Swiss table based containers
+/*! A full slot stores the seven lower bits of the key hash, a value between 0 and 127. */
+namespace SwissCtrl {
+	/// The slot has never been used since the last clear
+	const int8_t Empty = -128;
+	/// The slot has been used and then emptied, lookups should continue past it
+	const int8_t Deleted = -2;
+}
+
+/// A mask with a set bit for each slot of a group that matches a condition
+class SwissGroupMask
+{
+  public:
+#ifdef NCTL_SWISSGROUP_NEON
+	/// Number of bits to shift to convert a bit position to a slot index
+	static const unsigned int Shift = 2;
+#else
+	/// Number of bits to shift to convert a bit position to a slot index
+	static const unsigned int Shift = 0;
+#endif
+
+	explicit SwissGroupMask(uint64_t bits)
+	    : bits_(bits) {}
+
+	/// Returns true if at least one slot matches
+	inline bool any() const { return bits_ != 0; }
+	/// Returns the index of the first matching slot
+	inline unsigned int lowest() const { return countTrailingZeros(bits_) >> Shift; }
+	/// Removes the first matching slot from the mask
+	inline void clearLowest() { bits_ &= bits_ - 1; }
+
+  private:
+	uint64_t bits_;
+
+	inline static unsigned int countTrailingZeros(uint64_t bits)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index = 0;
+		if (static_cast<uint32_t>(bits) != 0)
+			_BitScanForward(&index, static_cast<uint32_t>(bits));
+		else
+		{
+			_BitScanForward(&index, static_cast<uint32_t>(bits >> 32));
+			index += 32;
+		}
+		return static_cast<unsigned int>(index);
+#else
+		return static_cast<unsigned int>(__builtin_ctzll(bits));
+#endif
+	}
+};
+
+/// A group of consecutive control bytes that are scanned in parallel
+/*! SSE2 or NEON instructions are used when available, with a scalar fallback otherwise. */
+class SwissGroup
+{
+  public:
+	/// Number of slots in a group
+	static const unsigned int Size = 16;
+
+	explicit SwissGroup(const int8_t *ctrl)
+	{
+#if defined(NCTL_SWISSGROUP_SSE2)
+		ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#elif defined(NCTL_SWISSGROUP_NEON)
+		ctrl_ = vld1q_s8(ctrl);
+#else
+		ctrl_ = ctrl;
+#endif
+	}
+
+	/// Returns the slots whose control byte is equal to the specified hash bits
+	inline SwissGroupMask match(int8_t hashBits) const
+	{
+#if defined(NCTL_SWISSGROUP_SSE2)
+		return SwissGroupMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(hashBits)))));
+#elif defined(NCTL_SWISSGROUP_NEON)
+		return SwissGroupMask(toMask(vceqq_s8(ctrl_, vdupq_n_s8(hashBits))));
+#else
+		uint64_t bits = 0;
+		for (unsigned int i = 0; i < Size; i++)
+			bits |= static_cast<uint64_t>(ctrl_[i] == hashBits) << i;
+		return SwissGroupMask(bits);
+#endif
+	}
+
+	/// Returns the empty slots
+	inline SwissGroupMask matchEmpty() const { return match(SwissCtrl::Empty); }
+
+	/// Returns the empty or deleted slots
+	inline SwissGroupMask matchEmptyOrDeleted() const
+	{
+		// Only the two special control values have the sign bit set
+#if defined(NCTL_SWISSGROUP_SSE2)
+		return SwissGroupMask(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+#elif defined(NCTL_SWISSGROUP_NEON)
+		return SwissGroupMask(toMask(vcltq_s8(ctrl_, vdupq_n_s8(0))));
+#else
+		uint64_t bits = 0;
+		for (unsigned int i = 0; i < Size; i++)
+			bits |= static_cast<uint64_t>(ctrl_[i] < 0) << i;
+		return SwissGroupMask(bits);
+#endif
+	}
+
+  private:
+#if defined(NCTL_SWISSGROUP_SSE2)
+	__m128i ctrl_;
+#elif defined(NCTL_SWISSGROUP_NEON)
+	int8x16_t ctrl_;
+
+	/// Narrows a byte comparison result to four bits per slot, keeping only one of them
+	inline static uint64_t toMask(uint8x16_t comparison)
+	{
+		const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(comparison), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ULL;
+	}
+#else
+	const int8_t *ctrl_;
+#endif
+};
+
+}
+
+#endif
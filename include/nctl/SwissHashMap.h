@@ -0,0 +1,584 @@
+#ifndef CLASS_NCTL_SWISSHASHMAP
+#define CLASS_NCTL_SWISSHASHMAP
+
+#include <ncine/common_macros.h>
+#include "UniquePtr.h"
+#include "HashFunctions.h"
+#include "SwissGroup.h"
+#include "ReverseIterator.h"
+#include <cstring> // for memcpy() and memset()
+
+namespace nctl {
+
+template <class K, class T, class HashFunc, bool IsConst> class SwissHashMapIterator;
+template <class K, class T, class HashFunc, bool IsConst> struct SwissHashMapHelperTraits;
+class String;
+
+/// A template based hashmap implementation with open addressing and group probing of control bytes
+/*!
+ * Each slot has a control byte storing seven bits of the key hash. Lookups compare a whole
+ * group of control bytes at a time and only compare the keys of the matching slots.
+ * \note Removed elements leave a tombstone if their group is full, call `rehash()` to purge them.
+ */
+template <class K, class T, class HashFunc = FNV1aHashFunc<K>>
+class SwissHashMap
+{
+  public:
+	/// Iterator type
+	using Iterator = SwissHashMapIterator<K, T, HashFunc, false>;
+	/// Constant iterator type
+	using ConstIterator = SwissHashMapIterator<K, T, HashFunc, true>;
+	/// Reverse iterator type
+	using ReverseIterator = nctl::ReverseIterator<Iterator>;
+	/// Reverse constant iterator type
+	using ConstReverseIterator = nctl::ReverseIterator<ConstIterator>;
+
+	explicit SwissHashMap(unsigned int capacity);
+
+	/// Copy constructor
+	SwissHashMap(const SwissHashMap &other);
+	/// Move constructor
+	SwissHashMap(SwissHashMap &&other);
+	/// Copy-and-swap assignment operator
+	SwissHashMap &operator=(SwissHashMap other);
+
+	/// Swaps two hashmaps without copying their data
+	inline void swap(SwissHashMap &first, SwissHashMap &second)
+	{
+		nctl::swap(first.size_, second.size_);
+		nctl::swap(first.capacity_, second.capacity_);
+		nctl::swap(first.numGroups_, second.numGroups_);
+		nctl::swap(first.ctrl_, second.ctrl_);
+		nctl::swap(first.nodes_, second.nodes_);
+	}
+
+	/// Returns an iterator to the first element
+	Iterator begin();
+	/// Returns a reverse iterator to the last element
+	ReverseIterator rBegin();
+	/// Returns an iterator to past the last element
+	Iterator end();
+	/// Returns a reverse iterator to prior the first element
+	ReverseIterator rEnd();
+
+	/// Returns a constant iterator to the first element
+	ConstIterator begin() const;
+	/// Returns a constant reverse iterator to the last element
+	ConstReverseIterator rBegin() const;
+	/// Returns a constant iterator to past the last lement
+	ConstIterator end() const;
+	/// Returns a constant reverse iterator to prior the first element
+	ConstReverseIterator rEnd() const;
+
+	/// Returns a constant iterator to the first element
+	inline ConstIterator cBegin() const { return begin(); }
+	/// Returns a constant reverse iterator to the last element
+	inline ConstReverseIterator crBegin() const { return rBegin(); }
+	/// Returns a constant iterator to past the last lement
+	inline ConstIterator cEnd() const { return end(); }
+	/// Returns a constant reverse iterator to prior the first element
+	inline ConstReverseIterator crEnd() const { return rEnd(); }
+
+	/// Subscript operator
+	T &operator[](const K &key);
+	/// Inserts an element if no other has the same key
+	bool insert(const K &key, const T &value);
+	/// Moves an element if no other has the same key
+	bool insert(const K &key, T &&value);
+	/// Constructs an element if no other has the same key
+	template <typename... Args> bool emplace(const K &key, Args &&... args);
+
+	/// Returns the capacity of the hashmap
+	inline unsigned int capacity() const { return capacity_; }
+	/// Returns the number of slots, always greater than the capacity to keep some of them empty
+	inline unsigned int numSlots() const { return numGroups_ * SwissGroup::Size; }
+	/// Returns true if the hashmap is empty
+	inline bool isEmpty() const { return size_ == 0; }
+	/// Returns the number of elements in the hashmap
+	inline unsigned int size() const { return size_; }
+	/// Returns the ratio between used and total buckets
+	inline float loadFactor() const { return size_ / static_cast<float>(capacity_); }
+	/// Returns the hash of a given key
+	inline hash_t hash(const K &key) const { return hashFunc_(key); }
+
+	/// Clears the hashmap
+	void clear();
+	/// Checks whether an element is in the hashmap or not
+	bool contains(const K &key, T &returnedValue) const;
+	/// Checks whether an element is in the hashmap or not
+	T *find(const K &key);
+	/// Checks whether an element is in the hashmap or not (read-only)
+	const T *find(const K &key) const;
+	/// Checks whether an element is in the hashmap or not, using a compatible key type and its precomputed hash
+	template <class LK> T *find(const LK &key, hash_t hash);
+	/// Checks whether an element is in the hashmap or not, using a compatible key type and its precomputed hash (read-only)
+	template <class LK> const T *find(const LK &key, hash_t hash) const;
+	/// Removes a key from the hashmap, if it exists
+	bool remove(const K &key);
+
+	/// Sets the number of buckets to the new specified size and rehashes the container
+	void rehash(unsigned int count);
+
+  private:
+	/// The template class for the node stored inside the hashmap
+	class Node
+	{
+	  public:
+		K key;
+		T value;
+	};
+
+	unsigned int size_;
+	unsigned int capacity_;
+	/// Number of groups of slots, always a power of two
+	unsigned int numGroups_;
+	UniquePtr<int8_t[]> ctrl_;
+	UniquePtr<Node[]> nodes_;
+	HashFunc hashFunc_;
+
+	static unsigned int calcNumGroups(unsigned int capacity);
+	/// Returns the hash bits stored in the control byte of a full slot
+	inline static int8_t hashBits(hash_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+	/// Returns the group where the probing sequence for a hash starts
+	inline unsigned int firstGroup(hash_t hash) const { return (hash >> 7) & (numGroups_ - 1); }
+
+	template <class LK> bool findSlotIndex(const LK &key, hash_t hash, unsigned int &foundIndex) const;
+	inline bool findSlotIndex(const K &key, unsigned int &foundIndex) const { return findSlotIndex(key, hashFunc_(key), foundIndex); }
+	/// Returns true if the key is found, otherwise `index` is the slot where it should be inserted
+	bool findOrPrepareInsert(const K &key, hash_t hash, unsigned int &index) const;
+	T &addNode(unsigned int index, hash_t hash, const K &key);
+	void insertNode(unsigned int index, hash_t hash, const K &key, const T &value);
+	void insertNode(unsigned int index, hash_t hash, const K &key, T &&value);
+	template <typename... Args> void emplaceNode(unsigned int index, hash_t hash, const K &key, Args &&... args);
+
+	friend class SwissHashMapIterator<K, T, HashFunc, false>;
+	friend class SwissHashMapIterator<K, T, HashFunc, true>;
+	friend struct SwissHashMapHelperTraits<K, T, HashFunc, false>;
+	friend struct SwissHashMapHelperTraits<K, T, HashFunc, true>;
+};
+
+template <class K, class T, class HashFunc>
+inline typename SwissHashMap<K, T, HashFunc>::Iterator SwissHashMap<K, T, HashFunc>::begin()
+{
+	Iterator iterator(this, Iterator::SentinelTagInit::BEGINNING);
+	return ++iterator;
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::ReverseIterator SwissHashMap<K, T, HashFunc>::rBegin()
+{
+	Iterator iterator(this, Iterator::SentinelTagInit::END);
+	return ReverseIterator(--iterator);
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::Iterator SwissHashMap<K, T, HashFunc>::end()
+{
+	return Iterator(this, Iterator::SentinelTagInit::END);
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::ReverseIterator SwissHashMap<K, T, HashFunc>::rEnd()
+{
+	Iterator iterator(this, Iterator::SentinelTagInit::BEGINNING);
+	return ReverseIterator(iterator);
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::ConstIterator SwissHashMap<K, T, HashFunc>::begin() const
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::BEGINNING);
+	return ++iterator;
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::ConstReverseIterator SwissHashMap<K, T, HashFunc>::rBegin() const
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::END);
+	return ConstReverseIterator(--iterator);
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::ConstIterator SwissHashMap<K, T, HashFunc>::end() const
+{
+	return ConstIterator(this, ConstIterator::SentinelTagInit::END);
+}
+
+template <class K, class T, class HashFunc>
+typename SwissHashMap<K, T, HashFunc>::ConstReverseIterator SwissHashMap<K, T, HashFunc>::rEnd() const
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::BEGINNING);
+	return ConstReverseIterator(iterator);
+}
+
+template <class K, class T, class HashFunc>
+SwissHashMap<K, T, HashFunc>::SwissHashMap(unsigned int capacity)
+    : size_(0), capacity_(capacity), numGroups_(calcNumGroups(capacity))
+{
+	FATAL_ASSERT_MSG(capacity > 0, "Zero is not a valid capacity");
+
+	ctrl_ = makeUnique<int8_t[]>(numSlots());
+	nodes_ = makeUnique<Node[]>(numSlots());
+
+	clear();
+}
+
+template <class K, class T, class HashFunc>
+SwissHashMap<K, T, HashFunc>::SwissHashMap(const SwissHashMap<K, T, HashFunc> &other)
+    : size_(other.size_), capacity_(other.capacity_), numGroups_(other.numGroups_)
+{
+	const unsigned int slots = numSlots();
+	ctrl_ = makeUnique<int8_t[]>(slots);
+	memcpy(ctrl_.get(), other.ctrl_.get(), slots);
+
+	nodes_ = makeUnique<Node[]>(slots);
+	for (unsigned int i = 0; i < slots; i++)
+	{
+		if (ctrl_[i] >= 0)
+			nodes_[i] = other.nodes_[i];
+	}
+}
+
+template <class K, class T, class HashFunc>
+SwissHashMap<K, T, HashFunc>::SwissHashMap(SwissHashMap<K, T, HashFunc> &&other)
+    : size_(other.size_), capacity_(other.capacity_), numGroups_(other.numGroups_),
+      ctrl_(nctl::move(other.ctrl_)), nodes_(nctl::move(other.nodes_))
+{
+	other.size_ = 0;
+	other.capacity_ = 0;
+	other.numGroups_ = 0;
+}
+
+/*! \note The parameter should be passed by value for the idiom to work. */
+template <class K, class T, class HashFunc>
+SwissHashMap<K, T, HashFunc> &SwissHashMap<K, T, HashFunc>::operator=(SwissHashMap<K, T, HashFunc> other)
+{
+	swap(*this, other);
+	return *this;
+}
+
+template <class K, class T, class HashFunc>
+T &SwissHashMap<K, T, HashFunc>::operator[](const K &key)
+{
+	const hash_t hash = hashFunc_(key);
+	unsigned int slotIndex = 0;
+
+	if (findOrPrepareInsert(key, hash, slotIndex))
+		return nodes_[slotIndex].value;
+	else
+		return addNode(slotIndex, hash, key);
+}
+
+/*! \return True if the element has been inserted */
+template <class K, class T, class HashFunc>
+bool SwissHashMap<K, T, HashFunc>::insert(const K &key, const T &value)
+{
+	const hash_t hash = hashFunc_(key);
+	unsigned int slotIndex = 0;
+
+	if (findOrPrepareInsert(key, hash, slotIndex))
+		return false;
+
+	insertNode(slotIndex, hash, key, value);
+	return true;
+}
+
+/*! \return True if the element has been inserted */
+template <class K, class T, class HashFunc>
+bool SwissHashMap<K, T, HashFunc>::insert(const K &key, T &&value)
+{
+	const hash_t hash = hashFunc_(key);
+	unsigned int slotIndex = 0;
+
+	if (findOrPrepareInsert(key, hash, slotIndex))
+		return false;
+
+	insertNode(slotIndex, hash, key, nctl::move(value));
+	return true;
+}
+
+/*! \return True if the element has been emplaced */
+template <class K, class T, class HashFunc>
+template <typename... Args>
+bool SwissHashMap<K, T, HashFunc>::emplace(const K &key, Args &&... args)
+{
+	const hash_t hash = hashFunc_(key);
+	unsigned int slotIndex = 0;
+
+	if (findOrPrepareInsert(key, hash, slotIndex))
+		return false;
+
+	emplaceNode(slotIndex, hash, key, nctl::forward<Args>(args)...);
+	return true;
+}
+
+template <class K, class T, class HashFunc>
+void SwissHashMap<K, T, HashFunc>::clear()
+{
+	memset(ctrl_.get(), static_cast<unsigned char>(SwissCtrl::Empty), numSlots());
+	size_ = 0;
+}
+
+template <class K, class T, class HashFunc>
+bool SwissHashMap<K, T, HashFunc>::contains(const K &key, T &returnedValue) const
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	if (found)
+		returnedValue = nodes_[slotIndex].value;
+
+	return found;
+}
+
+/*! \note Prefer this method if copying `T` is expensive, but always check the validity of returned pointer. */
+template <class K, class T, class HashFunc>
+T *SwissHashMap<K, T, HashFunc>::find(const K &key)
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[slotIndex].value;
+
+	return returnedPtr;
+}
+
+/*! \note Prefer this method if copying `T` is expensive, but always check the validity of returned pointer. */
+template <class K, class T, class HashFunc>
+const T *SwissHashMap<K, T, HashFunc>::find(const K &key) const
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	const T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[slotIndex].value;
+
+	return returnedPtr;
+}
+
+/*! \note The key type should be comparable with `K` and the hash should be the same that the hash function would return for the equivalent `K` key. */
+template <class K, class T, class HashFunc>
+template <class LK>
+T *SwissHashMap<K, T, HashFunc>::find(const LK &key, hash_t hash)
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, hash, slotIndex);
+
+	T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[slotIndex].value;
+
+	return returnedPtr;
+}
+
+/*! \note The key type should be comparable with `K` and the hash should be the same that the hash function would return for the equivalent `K` key. */
+template <class K, class T, class HashFunc>
+template <class LK>
+const T *SwissHashMap<K, T, HashFunc>::find(const LK &key, hash_t hash) const
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, hash, slotIndex);
+
+	const T *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &nodes_[slotIndex].value;
+
+	return returnedPtr;
+}
+
+/*! \return True if the element has been found and removed */
+template <class K, class T, class HashFunc>
+bool SwissHashMap<K, T, HashFunc>::remove(const K &key)
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	if (found)
+	{
+		// If the group has an empty slot no probing sequence has ever continued past it
+		const unsigned int groupStart = slotIndex - (slotIndex % SwissGroup::Size);
+		const SwissGroup group(ctrl_.get() + groupStart);
+		ctrl_[slotIndex] = group.matchEmpty().any() ? SwissCtrl::Empty : SwissCtrl::Deleted;
+		size_--;
+	}
+
+	return found;
+}
+
+template <class K, class T, class HashFunc>
+void SwissHashMap<K, T, HashFunc>::rehash(unsigned int count)
+{
+	if (size_ == 0 || count < size_)
+		return;
+
+	SwissHashMap<K, T, HashFunc> hashMap(count);
+
+	unsigned int rehashedNodes = 0;
+	for (unsigned int i = 0; i < numSlots(); i++)
+	{
+		if (ctrl_[i] >= 0)
+		{
+			Node &node = nodes_[i];
+			hashMap.insert(node.key, nctl::move(node.value));
+
+			rehashedNodes++;
+			if (rehashedNodes == size_)
+				break;
+		}
+	}
+
+	*this = nctl::move(hashMap);
+}
+
+template <class K, class T, class HashFunc>
+unsigned int SwissHashMap<K, T, HashFunc>::calcNumGroups(unsigned int capacity)
+{
+	// The maximum load factor is 7/8, so that lookups for missing keys can always stop at an empty slot
+	const unsigned int minSlots = capacity + capacity / 7 + 1;
+	const unsigned int minGroups = (minSlots + SwissGroup::Size - 1) / SwissGroup::Size;
+
+	unsigned int numGroups = 1;
+	while (numGroups < minGroups)
+		numGroups <<= 1;
+	return numGroups;
+}
+
+template <class K, class T, class HashFunc>
+template <class LK>
+bool SwissHashMap<K, T, HashFunc>::findSlotIndex(const LK &key, hash_t hash, unsigned int &foundIndex) const
+{
+	if (size_ == 0)
+		return false;
+
+	const int8_t bits = hashBits(hash);
+	unsigned int groupIndex = firstGroup(hash);
+
+	for (unsigned int probe = 0; probe < numGroups_; probe++)
+	{
+		const unsigned int groupStart = groupIndex * SwissGroup::Size;
+		const SwissGroup group(ctrl_.get() + groupStart);
+
+		SwissGroupMask mask = group.match(bits);
+		while (mask.any())
+		{
+			const unsigned int slotIndex = groupStart + mask.lowest();
+			if (nodes_[slotIndex].key == key)
+			{
+				foundIndex = slotIndex;
+				return true;
+			}
+			mask.clearLowest();
+		}
+
+		if (group.matchEmpty().any())
+			break;
+
+		// Triangular probing visits every group once when their number is a power of two
+		groupIndex = (groupIndex + probe + 1) & (numGroups_ - 1);
+	}
+
+	return false;
+}
+
+template <class K, class T, class HashFunc>
+bool SwissHashMap<K, T, HashFunc>::findOrPrepareInsert(const K &key, hash_t hash, unsigned int &index) const
+{
+	const int8_t bits = hashBits(hash);
+	unsigned int groupIndex = firstGroup(hash);
+	bool insertIndexFound = false;
+
+	for (unsigned int probe = 0; probe < numGroups_; probe++)
+	{
+		const unsigned int groupStart = groupIndex * SwissGroup::Size;
+		const SwissGroup group(ctrl_.get() + groupStart);
+
+		SwissGroupMask mask = group.match(bits);
+		while (mask.any())
+		{
+			const unsigned int slotIndex = groupStart + mask.lowest();
+			if (nodes_[slotIndex].key == key)
+			{
+				index = slotIndex;
+				return true;
+			}
+			mask.clearLowest();
+		}
+
+		// The first free slot along the sequence is reused, but the search goes on until an empty one
+		if (insertIndexFound == false)
+		{
+			const SwissGroupMask freeMask = group.matchEmptyOrDeleted();
+			if (freeMask.any())
+			{
+				index = groupStart + freeMask.lowest();
+				insertIndexFound = true;
+			}
+		}
+
+		if (group.matchEmpty().any())
+			break;
+
+		groupIndex = (groupIndex + probe + 1) & (numGroups_ - 1);
+	}
+
+	return false;
+}
+
+template <class K, class T, class HashFunc>
+T &SwissHashMap<K, T, HashFunc>::addNode(unsigned int index, hash_t hash, const K &key)
+{
+	FATAL_ASSERT(size_ < capacity_);
+	FATAL_ASSERT(ctrl_[index] < 0);
+
+	size_++;
+	ctrl_[index] = hashBits(hash);
+	nodes_[index].key = key;
+	return nodes_[index].value;
+}
+
+template <class K, class T, class HashFunc>
+void SwissHashMap<K, T, HashFunc>::insertNode(unsigned int index, hash_t hash, const K &key, const T &value)
+{
+	FATAL_ASSERT(size_ < capacity_);
+	FATAL_ASSERT(ctrl_[index] < 0);
+
+	size_++;
+	ctrl_[index] = hashBits(hash);
+	nodes_[index].key = key;
+	nodes_[index].value = value;
+}
+
+template <class K, class T, class HashFunc>
+void SwissHashMap<K, T, HashFunc>::insertNode(unsigned int index, hash_t hash, const K &key, T &&value)
+{
+	FATAL_ASSERT(size_ < capacity_);
+	FATAL_ASSERT(ctrl_[index] < 0);
+
+	size_++;
+	ctrl_[index] = hashBits(hash);
+	nodes_[index].key = key;
+	nodes_[index].value = nctl::move(value);
+}
+
+template <class K, class T, class HashFunc>
+template <typename... Args>
+void SwissHashMap<K, T, HashFunc>::emplaceNode(unsigned int index, hash_t hash, const K &key, Args &&... args)
+{
+	FATAL_ASSERT(size_ < capacity_);
+	FATAL_ASSERT(ctrl_[index] < 0);
+
+	size_++;
+	ctrl_[index] = hashBits(hash);
+	nodes_[index].key = key;
+	new (&nodes_[index].value) T(nctl::forward<Args>(args)...);
+}
+
+template <class T>
+using StringSwissHashMap = SwissHashMap<String, T, MemberHashFunc<String>>;
+
+}
+
+#endif
@@ -0,0 +1,282 @@
+#ifndef CLASS_NCTL_SWISSHASHMAPITERATOR
+#define CLASS_NCTL_SWISSHASHMAPITERATOR
+
+#include "SwissHashMap.h"
+#include "iterator.h"
+
+namespace nctl {
+
+/// Base helper structure for type traits used in the Swiss hashmap iterator
+template <class K, class T, class HashFunc, bool IsConst>
+struct SwissHashMapHelperTraits
+{};
+
+/// Helper structure providing type traits used in the non constant Swiss hashmap iterator
+template <class K, class T, class HashFunc>
+struct SwissHashMapHelperTraits<K, T, HashFunc, false>
+{
+	using SwissHashMapPtr = SwissHashMap<K, T, HashFunc> *;
+	using NodeReference = typename SwissHashMap<K, T, HashFunc>::Node &;
+};
+
+/// Helper structure providing type traits used in the constant Swiss hashmap iterator
+template <class K, class T, class HashFunc>
+struct SwissHashMapHelperTraits<K, T, HashFunc, true>
+{
+	using SwissHashMapPtr = const SwissHashMap<K, T, HashFunc> *;
+	using NodeReference = const typename SwissHashMap<K, T, HashFunc>::Node &;
+};
+
+/// A Swiss hashmap iterator
+template <class K, class T, class HashFunc, bool IsConst>
+class SwissHashMapIterator
+{
+  public:
+	/// Reference type which respects iterator constness
+	using Reference = typename IteratorTraits<SwissHashMapIterator>::Reference;
+
+	/// Sentinel tags to initialize the iterator at the beginning and end
+	enum class SentinelTagInit
+	{
+		/// Iterator at the beginning, next element is the first one
+		BEGINNING,
+		/// Iterator at the end, previous element is the last one
+		END
+	};
+
+	SwissHashMapIterator(typename SwissHashMapHelperTraits<K, T, HashFunc, IsConst>::SwissHashMapPtr hashMap, unsigned int slotIndex)
+	    : hashMap_(hashMap), slotIndex_(slotIndex), tag_(SentinelTag::REGULAR) {}
+
+	SwissHashMapIterator(typename SwissHashMapHelperTraits<K, T, HashFunc, IsConst>::SwissHashMapPtr hashMap, SentinelTagInit tag);
+
+	/// Copy constructor to implicitly convert a non constant iterator to a constant one
+	SwissHashMapIterator(const SwissHashMapIterator<K, T, HashFunc, false> &it)
+	    : hashMap_(it.hashMap_), slotIndex_(it.slotIndex_), tag_(SentinelTag(it.tag_)) {}
+
+	/// Deferencing operator
+	Reference operator*() const;
+
+	/// Iterates to the next element (prefix)
+	SwissHashMapIterator &operator++();
+	/// Iterates to the next element (postfix)
+	SwissHashMapIterator operator++(int);
+
+	/// Iterates to the previous element (prefix)
+	SwissHashMapIterator &operator--();
+	/// Iterates to the previous element (postfix)
+	SwissHashMapIterator operator--(int);
+
+	/// Equality operator
+	friend inline bool operator==(const SwissHashMapIterator &lhs, const SwissHashMapIterator &rhs)
+	{
+		if (lhs.tag_ == SentinelTag::REGULAR && rhs.tag_ == SentinelTag::REGULAR)
+			return (lhs.hashMap_ == rhs.hashMap_ && lhs.slotIndex_ == rhs.slotIndex_);
+		else
+			return (lhs.tag_ == rhs.tag_);
+	}
+
+	/// Inequality operator
+	friend inline bool operator!=(const SwissHashMapIterator &lhs, const SwissHashMapIterator &rhs)
+	{
+		if (lhs.tag_ == SentinelTag::REGULAR && rhs.tag_ == SentinelTag::REGULAR)
+			return (lhs.hashMap_ != rhs.hashMap_ || lhs.slotIndex_ != rhs.slotIndex_);
+		else
+			return (lhs.tag_ != rhs.tag_);
+	}
+
+	/// Returns the hashmap node currently pointed by the iterator
+	typename SwissHashMapHelperTraits<K, T, HashFunc, IsConst>::NodeReference node() const;
+	/// Returns the value associated to the currently pointed node
+	const T &value() const;
+	/// Returns the key associated to the currently pointed node
+	const K &key() const;
+	/// Returns the hash associated to the currently pointed node
+	hash_t hash() const;
+
+  private:
+	/// Sentinel tags to detect begin and end conditions
+	enum SentinelTag
+	{
+		/// Iterator poiting to a real element
+		REGULAR,
+		/// Iterator at the beginning, next element is the first one
+		BEGINNING,
+		/// Iterator at the end, previous element is the last one
+		END
+	};
+
+	typename SwissHashMapHelperTraits<K, T, HashFunc, IsConst>::SwissHashMapPtr hashMap_;
+	unsigned int slotIndex_;
+	SentinelTag tag_;
+
+	/// Makes the iterator point to the next element in the hashmap
+	void next();
+	/// Makes the iterator point to the previous element in the hashmap
+	void previous();
+
+	/// For non constant to constant iterator implicit conversion
+	friend class SwissHashMapIterator<K, T, HashFunc, true>;
+};
+
+/// Iterator traits structure specialization for `SwissHashMapIterator` class
+template <class K, class T, class HashFunc>
+struct IteratorTraits<SwissHashMapIterator<K, T, HashFunc, false>>
+{
+	/// Type of the values deferenced by the iterator
+	using ValueType = T;
+	/// Pointer to the type of the values deferenced by the iterator
+	using Pointer = T *;
+	/// Reference to the type of the values deferenced by the iterator
+	using Reference = T &;
+	/// Type trait for iterator category
+	static inline BidirectionalIteratorTag IteratorCategory() { return BidirectionalIteratorTag(); }
+};
+
+/// Iterator traits structure specialization for constant `SwissHashMapIterator` class
+template <class K, class T, class HashFunc>
+struct IteratorTraits<SwissHashMapIterator<K, T, HashFunc, true>>
+{
+	/// Type of the values deferenced by the iterator (never const)
+	using ValueType = T;
+	/// Pointer to the type of the values deferenced by the iterator
+	using Pointer = const T *;
+	/// Reference to the type of the values deferenced by the iterator
+	using Reference = const T &;
+	/// Type trait for iterator category
+	static inline BidirectionalIteratorTag IteratorCategory() { return BidirectionalIteratorTag(); }
+};
+
+template <class K, class T, class HashFunc, bool IsConst>
+SwissHashMapIterator<K, T, HashFunc, IsConst>::SwissHashMapIterator(typename SwissHashMapHelperTraits<K, T, HashFunc, IsConst>::SwissHashMapPtr hashMap, SentinelTagInit tag)
+    : hashMap_(hashMap), slotIndex_(0)
+{
+	switch (tag)
+	{
+		case SentinelTagInit::BEGINNING: tag_ = SentinelTag::BEGINNING; break;
+		case SentinelTagInit::END: tag_ = SentinelTag::END; break;
+	}
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+typename SwissHashMapIterator<K, T, HashFunc, IsConst>::Reference SwissHashMapIterator<K, T, HashFunc, IsConst>::operator*() const
+{
+	return node().value;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+SwissHashMapIterator<K, T, HashFunc, IsConst> &SwissHashMapIterator<K, T, HashFunc, IsConst>::operator++()
+{
+	next();
+	return *this;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+SwissHashMapIterator<K, T, HashFunc, IsConst> SwissHashMapIterator<K, T, HashFunc, IsConst>::operator++(int)
+{
+	// Create an unmodified copy to return
+	SwissHashMapIterator<K, T, HashFunc, IsConst> iterator = *this;
+	next();
+	return iterator;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+SwissHashMapIterator<K, T, HashFunc, IsConst> &SwissHashMapIterator<K, T, HashFunc, IsConst>::operator--()
+{
+	previous();
+	return *this;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+SwissHashMapIterator<K, T, HashFunc, IsConst> SwissHashMapIterator<K, T, HashFunc, IsConst>::operator--(int)
+{
+	// Create an unmodified copy to return
+	SwissHashMapIterator<K, T, HashFunc, IsConst> iterator = *this;
+	previous();
+	return iterator;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+typename SwissHashMapHelperTraits<K, T, HashFunc, IsConst>::NodeReference SwissHashMapIterator<K, T, HashFunc, IsConst>::node() const
+{
+	return hashMap_->nodes_[slotIndex_];
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+const T &SwissHashMapIterator<K, T, HashFunc, IsConst>::value() const
+{
+	return node().value;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+const K &SwissHashMapIterator<K, T, HashFunc, IsConst>::key() const
+{
+	return node().key;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+hash_t SwissHashMapIterator<K, T, HashFunc, IsConst>::hash() const
+{
+	return hashMap_->hashFunc_(node().key);
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+void SwissHashMapIterator<K, T, HashFunc, IsConst>::next()
+{
+	if (tag_ == SentinelTag::REGULAR)
+	{
+		if (slotIndex_ >= hashMap_->numSlots() - 1)
+		{
+			tag_ = SentinelTag::END;
+			return;
+		}
+		else
+			slotIndex_++;
+	}
+	else if (tag_ == SentinelTag::BEGINNING)
+	{
+		tag_ = SentinelTag::REGULAR;
+		slotIndex_ = 0;
+	}
+	else if (tag_ == SentinelTag::END)
+		return;
+
+	// Search the first non empty index starting from the current one
+	while (slotIndex_ < hashMap_->numSlots() - 1 && hashMap_->ctrl_[slotIndex_] < 0)
+		slotIndex_++;
+
+	if (hashMap_->ctrl_[slotIndex_] < 0)
+		tag_ = SentinelTag::END;
+}
+
+template <class K, class T, class HashFunc, bool IsConst>
+void SwissHashMapIterator<K, T, HashFunc, IsConst>::previous()
+{
+	if (tag_ == SentinelTag::REGULAR)
+	{
+		if (slotIndex_ == 0)
+		{
+			tag_ = SentinelTag::BEGINNING;
+			return;
+		}
+		else
+			slotIndex_--;
+	}
+	else if (tag_ == SentinelTag::END)
+	{
+		tag_ = SentinelTag::REGULAR;
+		slotIndex_ = hashMap_->numSlots() - 1;
+	}
+	else if (tag_ == SentinelTag::BEGINNING)
+		return;
+
+	// Search the first non empty index starting from the current one
+	while (slotIndex_ > 0 && hashMap_->ctrl_[slotIndex_] < 0)
+		slotIndex_--;
+
+	if (hashMap_->ctrl_[slotIndex_] < 0)
+		tag_ = SentinelTag::BEGINNING;
+}
+
+}
+
+#endif
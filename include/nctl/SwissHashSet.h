@@ -0,0 +1,473 @@
+#ifndef CLASS_NCTL_SWISSHASHSET
+#define CLASS_NCTL_SWISSHASHSET
+
+#include <ncine/common_macros.h>
+#include "UniquePtr.h"
+#include "HashFunctions.h"
+#include "SwissGroup.h"
+#include "ReverseIterator.h"
+#include <cstring> // for memcpy() and memset()
+
+namespace nctl {
+
+template <class K, class HashFunc> class SwissHashSetIterator;
+template <class K, class HashFunc> struct SwissHashSetHelperTraits;
+class String;
+
+/// A template based hashset implementation with open addressing and group probing of control bytes
+/*!
+ * Each slot has a control byte storing seven bits of the key hash. Lookups compare a whole
+ * group of control bytes at a time and only compare the keys of the matching slots.
+ * \note Removed elements leave a tombstone if their group is full, call `rehash()` to purge them.
+ */
+template <class K, class HashFunc = FNV1aHashFunc<K>>
+class SwissHashSet
+{
+  public:
+	/// Iterator type
+	/*! Elements in the hashset can never be changed */
+	using Iterator = SwissHashSetIterator<K, HashFunc>;
+	/// Constant iterator type
+	using ConstIterator = SwissHashSetIterator<K, HashFunc>;
+	/// Reverse iterator type
+	using ReverseIterator = nctl::ReverseIterator<Iterator>;
+	/// Reverse constant iterator type
+	using ConstReverseIterator = nctl::ReverseIterator<ConstIterator>;
+
+	explicit SwissHashSet(unsigned int capacity);
+
+	/// Copy constructor
+	SwissHashSet(const SwissHashSet &other);
+	/// Move constructor
+	SwissHashSet(SwissHashSet &&other);
+	/// Copy-and-swap assignment operator
+	SwissHashSet &operator=(SwissHashSet other);
+
+	/// Swaps two hashsets without copying their data
+	inline void swap(SwissHashSet &first, SwissHashSet &second)
+	{
+		nctl::swap(first.size_, second.size_);
+		nctl::swap(first.capacity_, second.capacity_);
+		nctl::swap(first.numGroups_, second.numGroups_);
+		nctl::swap(first.ctrl_, second.ctrl_);
+		nctl::swap(first.keys_, second.keys_);
+	}
+
+	/// Returns a constant iterator to the first element
+	ConstIterator begin();
+	/// Returns a reverse constant iterator to the last element
+	ConstReverseIterator rBegin();
+	/// Returns a constant iterator to past the last element
+	ConstIterator end();
+	/// Returns a reverse constant iterator to prior the first element
+	ConstReverseIterator rEnd();
+
+	/// Returns a constant iterator to the first element
+	ConstIterator begin() const;
+	/// Returns a constant reverse iterator to the last element
+	ConstReverseIterator rBegin() const;
+	/// Returns a constant iterator to past the last lement
+	ConstIterator end() const;
+	/// Returns a constant reverse iterator to prior the first element
+	ConstReverseIterator rEnd() const;
+
+	/// Returns a constant iterator to the first element
+	inline ConstIterator cBegin() const { return begin(); }
+	/// Returns a constant reverse iterator to the last element
+	inline ConstReverseIterator crBegin() const { return rBegin(); }
+	/// Returns a constant iterator to past the last lement
+	inline ConstIterator cEnd() const { return end(); }
+	/// Returns a constant reverse iterator to prior the first element
+	inline ConstReverseIterator crEnd() const { return rEnd(); }
+
+	/// Inserts an element if not already in
+	bool insert(const K &key);
+	/// Moves an element if not already in
+	bool insert(K &&key);
+
+	/// Returns the capacity of the hashset
+	inline unsigned int capacity() const { return capacity_; }
+	/// Returns the number of slots, always greater than the capacity to keep some of them empty
+	inline unsigned int numSlots() const { return numGroups_ * SwissGroup::Size; }
+	/// Returns true if the hashset is empty
+	inline bool isEmpty() const { return size_ == 0; }
+	/// Returns the number of elements in the hashset
+	inline unsigned int size() const { return size_; }
+	/// Returns the ratio between used and total buckets
+	inline float loadFactor() const { return size_ / static_cast<float>(capacity_); }
+	/// Returns the hash of a given key
+	inline hash_t hash(const K &key) const { return hashFunc_(key); }
+
+	/// Clears the hashset
+	void clear();
+	/// Checks whether an element is in the hashset or not
+	bool contains(const K &key) const;
+	/// Checks whether an element is in the hashset or not
+	K *find(const K &key);
+	/// Checks whether an element is in the hashset or not (read-only)
+	const K *find(const K &key) const;
+	/// Removes a key from the hashset, if it exists
+	bool remove(const K &key);
+
+	/// Sets the number of buckets to the new specified size and rehashes the container
+	void rehash(unsigned int count);
+
+  private:
+	unsigned int size_;
+	unsigned int capacity_;
+	/// Number of groups of slots, always a power of two
+	unsigned int numGroups_;
+	UniquePtr<int8_t[]> ctrl_;
+	UniquePtr<K[]> keys_;
+	HashFunc hashFunc_;
+
+	static unsigned int calcNumGroups(unsigned int capacity);
+	/// Returns the hash bits stored in the control byte of a full slot
+	inline static int8_t hashBits(hash_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+	/// Returns the group where the probing sequence for a hash starts
+	inline unsigned int firstGroup(hash_t hash) const { return (hash >> 7) & (numGroups_ - 1); }
+
+	bool findSlotIndex(const K &key, unsigned int &foundIndex) const;
+	/// Returns true if the key is found, otherwise `index` is the slot where it should be inserted
+	bool findOrPrepareInsert(const K &key, hash_t hash, unsigned int &index) const;
+	void insertKey(unsigned int index, hash_t hash, const K &key);
+	void insertKey(unsigned int index, hash_t hash, K &&key);
+
+	friend class SwissHashSetIterator<K, HashFunc>;
+	friend struct SwissHashSetHelperTraits<K, HashFunc>;
+};
+
+template <class K, class HashFunc>
+inline typename SwissHashSet<K, HashFunc>::ConstIterator SwissHashSet<K, HashFunc>::begin()
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::BEGINNING);
+	return ++iterator;
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstReverseIterator SwissHashSet<K, HashFunc>::rBegin()
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::END);
+	return ConstReverseIterator(--iterator);
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstIterator SwissHashSet<K, HashFunc>::end()
+{
+	return ConstIterator(this, ConstIterator::SentinelTagInit::END);
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstReverseIterator SwissHashSet<K, HashFunc>::rEnd()
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::BEGINNING);
+	return ConstReverseIterator(iterator);
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstIterator SwissHashSet<K, HashFunc>::begin() const
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::BEGINNING);
+	return ++iterator;
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstReverseIterator SwissHashSet<K, HashFunc>::rBegin() const
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::END);
+	return ConstReverseIterator(--iterator);
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstIterator SwissHashSet<K, HashFunc>::end() const
+{
+	return ConstIterator(this, ConstIterator::SentinelTagInit::END);
+}
+
+template <class K, class HashFunc>
+typename SwissHashSet<K, HashFunc>::ConstReverseIterator SwissHashSet<K, HashFunc>::rEnd() const
+{
+	ConstIterator iterator(this, ConstIterator::SentinelTagInit::BEGINNING);
+	return ConstReverseIterator(iterator);
+}
+
+template <class K, class HashFunc>
+SwissHashSet<K, HashFunc>::SwissHashSet(unsigned int capacity)
+    : size_(0), capacity_(capacity), numGroups_(calcNumGroups(capacity))
+{
+	FATAL_ASSERT_MSG(capacity > 0, "Zero is not a valid capacity");
+
+	ctrl_ = makeUnique<int8_t[]>(numSlots());
+	keys_ = makeUnique<K[]>(numSlots());
+
+	clear();
+}
+
+template <class K, class HashFunc>
+SwissHashSet<K, HashFunc>::SwissHashSet(const SwissHashSet<K, HashFunc> &other)
+    : size_(other.size_), capacity_(other.capacity_), numGroups_(other.numGroups_)
+{
+	const unsigned int slots = numSlots();
+	ctrl_ = makeUnique<int8_t[]>(slots);
+	memcpy(ctrl_.get(), other.ctrl_.get(), slots);
+
+	keys_ = makeUnique<K[]>(slots);
+	for (unsigned int i = 0; i < slots; i++)
+	{
+		if (ctrl_[i] >= 0)
+			keys_[i] = other.keys_[i];
+	}
+}
+
+template <class K, class HashFunc>
+SwissHashSet<K, HashFunc>::SwissHashSet(SwissHashSet<K, HashFunc> &&other)
+    : size_(other.size_), capacity_(other.capacity_), numGroups_(other.numGroups_),
+      ctrl_(nctl::move(other.ctrl_)), keys_(nctl::move(other.keys_))
+{
+	other.size_ = 0;
+	other.capacity_ = 0;
+	other.numGroups_ = 0;
+}
+
+/*! \note The parameter should be passed by value for the idiom to work. */
+template <class K, class HashFunc>
+SwissHashSet<K, HashFunc> &SwissHashSet<K, HashFunc>::operator=(SwissHashSet<K, HashFunc> other)
+{
+	swap(*this, other);
+	return *this;
+}
+
+/*! \return True if the element has been inserted */
+template <class K, class HashFunc>
+bool SwissHashSet<K, HashFunc>::insert(const K &key)
+{
+	const hash_t hash = hashFunc_(key);
+	unsigned int slotIndex = 0;
+
+	if (findOrPrepareInsert(key, hash, slotIndex))
+		return false;
+
+	insertKey(slotIndex, hash, key);
+	return true;
+}
+
+/*! \return True if the element has been inserted */
+template <class K, class HashFunc>
+bool SwissHashSet<K, HashFunc>::insert(K &&key)
+{
+	const hash_t hash = hashFunc_(key);
+	unsigned int slotIndex = 0;
+
+	if (findOrPrepareInsert(key, hash, slotIndex))
+		return false;
+
+	insertKey(slotIndex, hash, nctl::move(key));
+	return true;
+}
+
+template <class K, class HashFunc>
+void SwissHashSet<K, HashFunc>::clear()
+{
+	memset(ctrl_.get(), static_cast<unsigned char>(SwissCtrl::Empty), numSlots());
+	size_ = 0;
+}
+
+template <class K, class HashFunc>
+bool SwissHashSet<K, HashFunc>::contains(const K &key) const
+{
+	unsigned int slotIndex = 0;
+	return findSlotIndex(key, slotIndex);
+}
+
+/*! \note Prefer this method if copying `K` is expensive, but always check the validity of returned pointer. */
+template <class K, class HashFunc>
+K *SwissHashSet<K, HashFunc>::find(const K &key)
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	K *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &keys_[slotIndex];
+
+	return returnedPtr;
+}
+
+/*! \note Prefer this method if copying `K` is expensive, but always check the validity of returned pointer. */
+template <class K, class HashFunc>
+const K *SwissHashSet<K, HashFunc>::find(const K &key) const
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	const K *returnedPtr = nullptr;
+	if (found)
+		returnedPtr = &keys_[slotIndex];
+
+	return returnedPtr;
+}
+
+/*! \return True if the element has been found and removed */
+template <class K, class HashFunc>
+bool SwissHashSet<K, HashFunc>::remove(const K &key)
+{
+	unsigned int slotIndex = 0;
+	const bool found = findSlotIndex(key, slotIndex);
+
+	if (found)
+	{
+		// If the group has an empty slot no probing sequence has ever continued past it
+		const unsigned int groupStart = slotIndex - (slotIndex % SwissGroup::Size);
+		const SwissGroup group(ctrl_.get() + groupStart);
+		ctrl_[slotIndex] = group.matchEmpty().any() ? SwissCtrl::Empty : SwissCtrl::Deleted;
+		size_--;
+	}
+
+	return found;
+}
+
+template <class K, class HashFunc>
+void SwissHashSet<K, HashFunc>::rehash(unsigned int count)
+{
+	if (size_ == 0 || count < size_)
+		return;
+
+	SwissHashSet<K, HashFunc> hashSet(count);
+
+	unsigned int rehashedKeys = 0;
+	for (unsigned int i = 0; i < numSlots(); i++)
+	{
+		if (ctrl_[i] >= 0)
+		{
+			hashSet.insert(nctl::move(keys_[i]));
+
+			rehashedKeys++;
+			if (rehashedKeys == size_)
+				break;
+		}
+	}
+
+	*this = nctl::move(hashSet);
+}
+
+template <class K, class HashFunc>
+unsigned int SwissHashSet<K, HashFunc>::calcNumGroups(unsigned int capacity)
+{
+	// The maximum load factor is 7/8, so that lookups for missing keys can always stop at an empty slot
+	const unsigned int minSlots = capacity + capacity / 7 + 1;
+	const unsigned int minGroups = (minSlots + SwissGroup::Size - 1) / SwissGroup::Size;
+
+	unsigned int numGroups = 1;
+	while (numGroups < minGroups)
+		numGroups <<= 1;
+	return numGroups;
+}
+
+template <class K, class HashFunc>
+bool SwissHashSet<K, HashFunc>::findSlotIndex(const K &key, unsigned int &foundIndex) const
+{
+	if (size_ == 0)
+		return false;
+
+	const hash_t hash = hashFunc_(key);
+	const int8_t bits = hashBits(hash);
+	unsigned int groupIndex = firstGroup(hash);
+
+	for (unsigned int probe = 0; probe < numGroups_; probe++)
+	{
+		const unsigned int groupStart = groupIndex * SwissGroup::Size;
+		const SwissGroup group(ctrl_.get() + groupStart);
+
+		SwissGroupMask mask = group.match(bits);
+		while (mask.any())
+		{
+			const unsigned int slotIndex = groupStart + mask.lowest();
+			if (keys_[slotIndex] == key)
+			{
+				foundIndex = slotIndex;
+				return true;
+			}
+			mask.clearLowest();
+		}
+
+		if (group.matchEmpty().any())
+			break;
+
+		// Triangular probing visits every group once when their number is a power of two
+		groupIndex = (groupIndex + probe + 1) & (numGroups_ - 1);
+	}
+
+	return false;
+}
+
+template <class K, class HashFunc>
+bool SwissHashSet<K, HashFunc>::findOrPrepareInsert(const K &key, hash_t hash, unsigned int &index) const
+{
+	const int8_t bits = hashBits(hash);
+	unsigned int groupIndex = firstGroup(hash);
+	bool insertIndexFound = false;
+
+	for (unsigned int probe = 0; probe < numGroups_; probe++)
+	{
+		const unsigned int groupStart = groupIndex * SwissGroup::Size;
+		const SwissGroup group(ctrl_.get() + groupStart);
+
+		SwissGroupMask mask = group.match(bits);
+		while (mask.any())
+		{
+			const unsigned int slotIndex = groupStart + mask.lowest();
+			if (keys_[slotIndex] == key)
+			{
+				index = slotIndex;
+				return true;
+			}
+			mask.clearLowest();
+		}
+
+		// The first free slot along the sequence is reused, but the search goes on until an empty one
+		if (insertIndexFound == false)
+		{
+			const SwissGroupMask freeMask = group.matchEmptyOrDeleted();
+			if (freeMask.any())
+			{
+				index = groupStart + freeMask.lowest();
+				insertIndexFound = true;
+			}
+		}
+
+		if (group.matchEmpty().any())
+			break;
+
+		groupIndex = (groupIndex + probe + 1) & (numGroups_ - 1);
+	}
+
+	return false;
+}
+
+template <class K, class HashFunc>
+void SwissHashSet<K, HashFunc>::insertKey(unsigned int index, hash_t hash, const K &key)
+{
+	FATAL_ASSERT(size_ < capacity_);
+	FATAL_ASSERT(ctrl_[index] < 0);
+
+	size_++;
+	ctrl_[index] = hashBits(hash);
+	keys_[index] = key;
+}
+
+template <class K, class HashFunc>
+void SwissHashSet<K, HashFunc>::insertKey(unsigned int index, hash_t hash, K &&key)
+{
+	FATAL_ASSERT(size_ < capacity_);
+	FATAL_ASSERT(ctrl_[index] < 0);
+
+	size_++;
+	ctrl_[index] = hashBits(hash);
+	keys_[index] = nctl::move(key);
+}
+
+using StringSwissHashSet = SwissHashSet<String, MemberHashFunc<String>>;
+
+}
+
+#endif
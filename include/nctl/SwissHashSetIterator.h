@@ -0,0 +1,231 @@
+#ifndef CLASS_NCTL_SWISSHASHSETITERATOR
+#define CLASS_NCTL_SWISSHASHSETITERATOR
+
+#include "SwissHashSet.h"
+#include "iterator.h"
+
+namespace nctl {
+
+/// Base helper structure for type traits used in the Swiss hashset iterator
+template <class K, class HashFunc>
+struct SwissHashSetHelperTraits
+{
+	using SwissHashSetPtr = const SwissHashSet<K, HashFunc> *;
+};
+
+/// A Swiss hashset iterator
+template <class K, class HashFunc>
+class SwissHashSetIterator
+{
+  public:
+	/// Reference type which respects iterator constness
+	using Reference = typename IteratorTraits<SwissHashSetIterator>::Reference;
+
+	/// Sentinel tags to initialize the iterator at the beginning and end
+	enum class SentinelTagInit
+	{
+		/// Iterator at the beginning, next element is the first one
+		BEGINNING,
+		/// Iterator at the end, previous element is the last one
+		END
+	};
+
+	SwissHashSetIterator(typename SwissHashSetHelperTraits<K, HashFunc>::SwissHashSetPtr hashSet, unsigned int slotIndex)
+	    : hashSet_(hashSet), slotIndex_(slotIndex), tag_(SentinelTag::REGULAR) {}
+
+	SwissHashSetIterator(typename SwissHashSetHelperTraits<K, HashFunc>::SwissHashSetPtr hashSet, SentinelTagInit tag);
+
+	/// Deferencing operator
+	Reference operator*() const;
+
+	/// Iterates to the next element (prefix)
+	SwissHashSetIterator &operator++();
+	/// Iterates to the next element (postfix)
+	SwissHashSetIterator operator++(int);
+
+	/// Iterates to the previous element (prefix)
+	SwissHashSetIterator &operator--();
+	/// Iterates to the previous element (postfix)
+	SwissHashSetIterator operator--(int);
+
+	/// Equality operator
+	friend inline bool operator==(const SwissHashSetIterator &lhs, const SwissHashSetIterator &rhs)
+	{
+		if (lhs.tag_ == SentinelTag::REGULAR && rhs.tag_ == SentinelTag::REGULAR)
+			return (lhs.hashSet_ == rhs.hashSet_ && lhs.slotIndex_ == rhs.slotIndex_);
+		else
+			return (lhs.tag_ == rhs.tag_);
+	}
+
+	/// Inequality operator
+	friend inline bool operator!=(const SwissHashSetIterator &lhs, const SwissHashSetIterator &rhs)
+	{
+		if (lhs.tag_ == SentinelTag::REGULAR && rhs.tag_ == SentinelTag::REGULAR)
+			return (lhs.hashSet_ != rhs.hashSet_ || lhs.slotIndex_ != rhs.slotIndex_);
+		else
+			return (lhs.tag_ != rhs.tag_);
+	}
+
+	/// Returns the key associated to the currently pointed element
+	const K &key() const;
+	/// Returns the hash associated to the currently pointed element
+	hash_t hash() const;
+
+  private:
+	/// Sentinel tags to detect begin and end conditions
+	enum SentinelTag
+	{
+		/// Iterator poiting to a real element
+		REGULAR,
+		/// Iterator at the beginning, next element is the first one
+		BEGINNING,
+		/// Iterator at the end, previous element is the last one
+		END
+	};
+
+	typename SwissHashSetHelperTraits<K, HashFunc>::SwissHashSetPtr hashSet_;
+	unsigned int slotIndex_;
+	SentinelTag tag_;
+
+	/// Makes the iterator point to the next element in the hashSet
+	void next();
+	/// Makes the iterator point to the previous element in the hashset
+	void previous();
+};
+
+/// Iterator traits structure specialization for `SwissHashSetIterator` class
+template <class K, class HashFunc>
+struct IteratorTraits<SwissHashSetIterator<K, HashFunc>>
+{
+	/// Type of the values deferenced by the iterator (never const)
+	using ValueType = K;
+	/// Pointer to the type of the values deferenced by the iterator
+	using Pointer = const K *;
+	/// Reference to the type of the values deferenced by the iterator
+	using Reference = const K &;
+	/// Type trait for iterator category
+	static inline BidirectionalIteratorTag IteratorCategory() { return BidirectionalIteratorTag(); }
+};
+
+template <class K, class HashFunc>
+SwissHashSetIterator<K, HashFunc>::SwissHashSetIterator(typename SwissHashSetHelperTraits<K, HashFunc>::SwissHashSetPtr hashSet, SentinelTagInit tag)
+    : hashSet_(hashSet), slotIndex_(0)
+{
+	switch (tag)
+	{
+		case SentinelTagInit::BEGINNING: tag_ = SentinelTag::BEGINNING; break;
+		case SentinelTagInit::END: tag_ = SentinelTag::END; break;
+	}
+}
+
+template <class K, class HashFunc>
+typename SwissHashSetIterator<K, HashFunc>::Reference SwissHashSetIterator<K, HashFunc>::operator*() const
+{
+	return hashSet_->keys_[slotIndex_];
+}
+
+template <class K, class HashFunc>
+SwissHashSetIterator<K, HashFunc> &SwissHashSetIterator<K, HashFunc>::operator++()
+{
+	next();
+	return *this;
+}
+
+template <class K, class HashFunc>
+SwissHashSetIterator<K, HashFunc> SwissHashSetIterator<K, HashFunc>::operator++(int)
+{
+	// Create an unmodified copy to return
+	SwissHashSetIterator<K, HashFunc> iterator = *this;
+	next();
+	return iterator;
+}
+
+template <class K, class HashFunc>
+SwissHashSetIterator<K, HashFunc> &SwissHashSetIterator<K, HashFunc>::operator--()
+{
+	previous();
+	return *this;
+}
+
+template <class K, class HashFunc>
+SwissHashSetIterator<K, HashFunc> SwissHashSetIterator<K, HashFunc>::operator--(int)
+{
+	// Create an unmodified copy to return
+	SwissHashSetIterator<K, HashFunc> iterator = *this;
+	previous();
+	return iterator;
+}
+
+template <class K, class HashFunc>
+const K &SwissHashSetIterator<K, HashFunc>::key() const
+{
+	return hashSet_->keys_[slotIndex_];
+}
+
+template <class K, class HashFunc>
+hash_t SwissHashSetIterator<K, HashFunc>::hash() const
+{
+	return hashSet_->hashFunc_(hashSet_->keys_[slotIndex_]);
+}
+
+template <class K, class HashFunc>
+void SwissHashSetIterator<K, HashFunc>::next()
+{
+	if (tag_ == SentinelTag::REGULAR)
+	{
+		if (slotIndex_ >= hashSet_->numSlots() - 1)
+		{
+			tag_ = SentinelTag::END;
+			return;
+		}
+		else
+			slotIndex_++;
+	}
+	else if (tag_ == SentinelTag::BEGINNING)
+	{
+		tag_ = SentinelTag::REGULAR;
+		slotIndex_ = 0;
+	}
+	else if (tag_ == SentinelTag::END)
+		return;
+
+	// Search the first non empty index starting from the current one
+	while (slotIndex_ < hashSet_->numSlots() - 1 && hashSet_->ctrl_[slotIndex_] < 0)
+		slotIndex_++;
+
+	if (hashSet_->ctrl_[slotIndex_] < 0)
+		tag_ = SentinelTag::END;
+}
+
+template <class K, class HashFunc>
+void SwissHashSetIterator<K, HashFunc>::previous()
+{
+	if (tag_ == SentinelTag::REGULAR)
+	{
+		if (slotIndex_ == 0)
+		{
+			tag_ = SentinelTag::BEGINNING;
+			return;
+		}
+		else
+			slotIndex_--;
+	}
+	else if (tag_ == SentinelTag::END)
+	{
+		tag_ = SentinelTag::REGULAR;
+		slotIndex_ = hashSet_->numSlots() - 1;
+	}
+	else if (tag_ == SentinelTag::BEGINNING)
+		return;
+
+	// Search the first non empty index starting from the current one
+	while (slotIndex_ > 0 && hashSet_->ctrl_[slotIndex_] < 0)
+		slotIndex_--;
+
+	if (hashSet_->ctrl_[slotIndex_] < 0)
+		tag_ = SentinelTag::BEGINNING;
+}
+
+}
+
+#endif
@@ -19,6 +19,7 @@ AppConfiguration::AppConfiguration()
       resolution(1280, 720),
       inFullscreen(false),
       isResizable(false),
+      isHeadless(false),
       frameLimit(0),
       windowTitle(128),
       windowIconFilename(128),
@@ -32,12 +33,14 @@ AppConfiguration::AppConfiguration()
       iboSize(8 * 1024),
 #endif
       vaoPoolSize(16),
+      frameArenaSize(256 * 1024),
       withDebugOverlay(false),
       withAudio(true),
       withThreads(false),
       withScenegraph(true),
       withVSync(true),
       withGlDebugContext(false),
+      withObjectNameIndex(false),
 
       // Compile-time variables
       glCoreProfile_(true),
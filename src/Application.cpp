@@ -3,12 +3,14 @@
 #include "IAppEventHandler.h"
 #include "IFile.h"
 #include "ArrayIndexer.h"
+#include "AsyncFileReader.h"
 #include "GfxCapabilities.h"
 #include "RenderResources.h"
 #include "RenderQueue.h"
 #include "GLDebug.h"
-#include "Timer.h" // for `sleep()`
 #include "FrameTimer.h"
+#include "FramePacer.h"
+#include "FrameArena.h"
 #include "SceneNode.h"
 #include <nctl/String.h>
 #include "IInputManager.h"
@@ -24,6 +26,7 @@
 
 #ifdef WITH_LUA
 	#include "LuaStatistics.h"
+	#include "LuaStateManager.h"
 #endif
 
 #ifdef WITH_IMGUI
@@ -46,7 +49,7 @@ namespace ncine {
 ///////////////////////////////////////////////////////////
 
 Application::Application()
-    : isSuspended_(false), autoSuspension_(true), hasFocus_(true), shouldQuit_(false)
+    : isSuspended_(false), autoSuspension_(true), hasFocus_(true), shouldQuit_(false), timings_()
 {
 }
 
@@ -66,12 +69,18 @@ float Application::interval() const
 	return frameTimer_->lastFrameInterval();
 }
 
+FrameTimeStatistics &Application::frameTimeStatistics()
+{
+	return frameTimer_->statistics();
+}
+
 void Application::setSuspended(bool suspended)
 {
 	isSuspended_ = suspended;
 	if (isSuspended_ == false)
 	{
 		frameTimer_->start();
+		framePacer_->reset();
 		profileStartTime_ = TimeStamp::now();
 	}
 }
@@ -93,7 +102,7 @@ void Application::initCommon()
 	LOGI_X("nCine compiled on %s at %s", VersionStrings::CompilationDate, VersionStrings::CompilationTime);
 #endif
 
-	theServiceLocator().registerIndexer(nctl::makeUnique<ArrayIndexer>());
+	theServiceLocator().registerIndexer(nctl::makeUnique<ArrayIndexer>(appCfg_.withObjectNameIndex));
 #ifdef WITH_AUDIO
 	if (appCfg_.withAudio)
 		theServiceLocator().registerAudioDevice(nctl::makeUnique<ALAudioDevice>());
@@ -102,6 +111,7 @@ void Application::initCommon()
 	if (appCfg_.withThreads)
 		theServiceLocator().registerThreadPool(nctl::makeUnique<ThreadPool>());
 #endif
+	theServiceLocator().registerAsyncFileReader(nctl::makeUnique<AsyncFileReader>());
 	theServiceLocator().registerGfxCapabilities(nctl::makeUnique<GfxCapabilities>());
 	GLDebug::init(theServiceLocator().gfxCapabilities());
 
@@ -118,6 +128,10 @@ void Application::initCommon()
 	TracyGpuCollect;
 
 	frameTimer_ = nctl::makeUnique<FrameTimer>(appCfg_.frameTimerLogInterval, appCfg_.profileTextUpdateTime());
+	frameArena_ = nctl::makeUnique<FrameArena>(appCfg_.frameArenaSize);
+	framePacer_ = nctl::makeUnique<FramePacer>(appCfg_.profileTextUpdateTime());
+	if (appCfg_.frameLimit > 0)
+		framePacer_->setTargetFrameTime(1.0f / static_cast<float>(appCfg_.frameLimit));
 
 #ifdef WITH_IMGUI
 	imguiDrawing_ = nctl::makeUnique<ImGuiDrawing>(appCfg_.withScenegraph);
@@ -163,7 +177,7 @@ void Application::initCommon()
 void Application::step()
 {
 	ZoneScoped;
-	frameTimer_->addFrame();
+	frameTimer_->addFrame(timings_);
 	if (appCfg_.withScenegraph)
 	{
 #ifdef __EMSCRIPTEN__
@@ -187,6 +201,12 @@ void Application::step()
 	LuaStatistics::update();
 #endif
 
+	{
+		// Completed asynchronous reads are delivered before the application logic can use them
+		ZoneScopedN("AsyncFileReader update");
+		theServiceLocator().asyncFileReader().update();
+	}
+
 	{
 		ZoneScopedN("onFrameStart");
 		profileStartTime_ = TimeStamp::now();
@@ -224,7 +244,9 @@ void Application::step()
 
 	{
 		ZoneScopedN("Audio");
+		profileStartTime_ = TimeStamp::now();
 		theServiceLocator().audioDevice().updatePlayers();
+		timings_[Timings::AUDIO] = profileStartTime_.secondsSince();
 	}
 
 #ifdef WITH_IMGUI
@@ -253,12 +275,15 @@ void Application::step()
 	if (debugOverlay_)
 		debugOverlay_->updateFrameTimings();
 
-	if (appCfg_.frameLimit > 0)
-	{
-		const float frameTimeDuration = 1.0f / static_cast<float>(appCfg_.frameLimit);
-		while (frameTimer_->frameInterval() < frameTimeDuration)
-			Timer::sleep(0.0f);
-	}
+#ifdef WITH_LUA
+	// Frame budgeted collectors use the time that would otherwise be spent waiting for the deadline
+	LuaStateManager::stepGarbageCollectors(framePacer_->timeLeft());
+#endif
+
+	// Reclaiming the memory of the previous frame, the one of this frame is still valid during the next
+	frameArena_->swap();
+
+	framePacer_->wait();
 }
 
 void Application::shutdownCommon()
@@ -284,8 +309,13 @@ void Application::shutdownCommon()
 	renderQueue_.reset(nullptr);
 	RenderResources::dispose();
 	frameTimer_.reset(nullptr);
+	frameArena_.reset(nullptr);
+	framePacer_.reset(nullptr);
 	inputManager_.reset(nullptr);
 	gfxDevice_.reset(nullptr);
+	// The reader thread could still be accessing the pack archives
+	theServiceLocator().unregisterAsyncFileReader();
+	IFile::unmountPacks();
 
 	if (theServiceLocator().indexer().isEmpty() == false)
 	{
@@ -312,6 +342,7 @@ void Application::setFocus(bool hasFocus)
 		if (hasFocus == true)
 		{
 			frameTimer_->start();
+			framePacer_->reset();
 			profileStartTime_ = TimeStamp::now();
 		}
 	}
@@ -6,18 +6,18 @@ namespace ncine {
 // CONSTRUCTORS and DESTRUCTOR
 ///////////////////////////////////////////////////////////
 
-ArrayIndexer::ArrayIndexer()
-    : numObjects_(0), nextId_(0), pointers_(16)
+ArrayIndexer::ArrayIndexer(bool withNameIndex)
+    : slots_(16), liveSlots_(16), firstFree_(0), lastFree_(0), withNameIndex_(withNameIndex), nameHeads_(16)
 {
-	// First element reserved
-	pointers_.pushBack(nullptr);
-	nextId_++;
+	// First slot reserved
+	slots_.pushBack(Slot());
 }
 
 ArrayIndexer::~ArrayIndexer()
 {
-	for (Object *obj : pointers_)
-		delete obj;
+	// Deleting an object removes it from the live slots
+	while (liveSlots_.isEmpty() == false)
+		delete slots_[liveSlots_.back()].object;
 }
 
 ///////////////////////////////////////////////////////////
@@ -29,65 +29,211 @@ unsigned int ArrayIndexer::addObject(Object *object)
 	if (object == nullptr)
 		return 0;
 
-	numObjects_++;
+	unsigned int index = firstFree_;
+	if (index != 0)
+	{
+		firstFree_ = slots_[index].nextFree;
+		if (firstFree_ == 0)
+			lastFree_ = 0;
+	}
+	else
+	{
+		index = slots_.size();
+		if (index > IndexMask)
+		{
+			LOGE_X("Cannot index more than %u objects", IndexMask);
+			return 0;
+		}
+		slots_.pushBack(Slot());
+	}
 
-	pointers_[nextId_] = object;
-	nextId_++;
+	Slot &slot = slots_[index];
+	slot.object = object;
+	slot.nextFree = 0;
+	slot.liveIndex = liveSlots_.size();
+	liveSlots_.pushBack(index);
+	addName(index);
 
-	return nextId_ - 1;
+	return makeId(index, slot.generation);
 }
 
 void ArrayIndexer::removeObject(unsigned int id)
 {
-	// setting to `nullptr` instead of physically removing
-	if (id < pointers_.size() && pointers_[id] != nullptr)
+	const unsigned int index = slotIndex(id);
+	if (index == 0)
+		return;
+
+	removeName(index);
+
+	// Swapping the last live slot into the position of the removed one
+	Slot &slot = slots_[index];
+	const unsigned int lastLiveSlot = liveSlots_.back();
+	liveSlots_[slot.liveIndex] = lastLiveSlot;
+	slots_[lastLiveSlot].liveIndex = slot.liveIndex;
+	liveSlots_.popBack();
+
+	slot.object = nullptr;
+	// A stale id can only become valid again after its slot has been reused `MaxGeneration + 1` times
+	slot.generation = (slot.generation + 1) & MaxGeneration;
+
+	if (lastFree_ != 0)
+		slots_[lastFree_].nextFree = index;
+	else
+		firstFree_ = index;
+	lastFree_ = index;
+}
+
+Object *ArrayIndexer::object(unsigned int id) const
+{
+	const unsigned int index = slotIndex(id);
+	return (index != 0) ? slots_[index].object : nullptr;
+}
+
+void ArrayIndexer::updateObjectName(unsigned int id)
+{
+	const unsigned int index = slotIndex(id);
+	if (index != 0)
 	{
-		pointers_[id] = nullptr;
-		numObjects_--;
+		removeName(index);
+		addName(index);
 	}
 }
 
-Object *ArrayIndexer::object(unsigned int id) const
+Object *ArrayIndexer::firstWithName(const nctl::StringView &name, nctl::hash_t hash) const
 {
-	Object *objPtr = nullptr;
+	if (withNameIndex_ == false)
+	{
+		LOGW("The object name index is disabled in the application configuration");
+		return nullptr;
+	}
+
+	const unsigned int *headIndex = nameHeads_.find(hash);
+	return headIndex ? findInChain(*headIndex, name) : nullptr;
+}
 
-	if (id < pointers_.size())
-		objPtr = pointers_[id];
+Object *ArrayIndexer::nextWithName(const Object *object) const
+{
+	const unsigned int index = (object != nullptr) ? slotIndex(object->id()) : 0;
+	if (index == 0 || slots_[index].nameIndexed == false)
+		return nullptr;
 
-	return objPtr;
+	return findInChain(slots_[index].nextNamed, object->name());
 }
 
 void ArrayIndexer::logReport() const
 {
-	for (unsigned int i = 0; i < pointers_.size(); i++)
+	for (unsigned int i = 0; i < liveSlots_.size(); i++)
+	{
+		const Object *objPtr = slots_[liveSlots_[i]].object;
+
+		nctl::String typeName(Object::MaxNameLength);
+		// clang-format off
+		switch (objPtr->type())
+		{
+			case Object::ObjectType::BASE:					typeName = "Base"; break;
+			case Object::ObjectType::TEXTURE:				typeName = "Texture"; break;
+			case Object::ObjectType::SCENENODE:				typeName = "SceneNode"; break;
+			case Object::ObjectType::SPRITE:				typeName = "Sprite"; break;
+			case Object::ObjectType::MESH_SPRITE:			typeName = "MeshSprite"; break;
+			case Object::ObjectType::ANIMATED_SPRITE:		typeName = "AnimatedSprite"; break;
+			case Object::ObjectType::PARTICLE_SYSTEM:		typeName = "ParticleSystem"; break;
+			case Object::ObjectType::FONT:					typeName = "Font"; break;
+			case Object::ObjectType::TEXTNODE:				typeName = "TextNode"; break;
+			case Object::ObjectType::AUDIOBUFFER:			typeName = "AudioBuffer"; break;
+			case Object::ObjectType::AUDIOBUFFER_PLAYER:	typeName = "AudioBufferPlayer"; break;
+			case Object::ObjectType::AUDIOSTREAM_PLAYER:	typeName = "AudioStreamPlayer"; break;
+			default:										typeName = "Unknown"; break;
+		}
+		// clang-format on
+
+		LOGI_X("Object %u - type: %s - name: \"%s\"", objPtr->id(), typeName.data(), objPtr->name().data());
+	}
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+unsigned int ArrayIndexer::slotIndex(unsigned int id) const
+{
+	const unsigned int index = id & IndexMask;
+	if (index == 0 || index >= slots_.size())
+		return 0;
+
+	const Slot &slot = slots_[index];
+	if (slot.object == nullptr || slot.generation != (id >> IndexBits))
+		return 0;
+
+	return index;
+}
+
+void ArrayIndexer::addName(unsigned int slotIndex)
+{
+	Slot &slot = slots_[slotIndex];
+	const nctl::String &name = slot.object->name();
+	if (withNameIndex_ == false || name.isEmpty())
+		return;
+
+	slot.nameHash = nctl::StringView(name).hash();
+
+	unsigned int *headIndex = nameHeads_.find(slot.nameHash);
+	if (headIndex)
 	{
-		if (pointers_[i])
+		// The new object becomes the head of the existing chain
+		slot.nextNamed = *headIndex;
+		*headIndex = slotIndex;
+	}
+	else
+	{
+		if (nameHeads_.size() == nameHeads_.capacity())
+			nameHeads_.rehash(nameHeads_.capacity() * 2);
+		slot.nextNamed = 0;
+		nameHeads_.insert(slot.nameHash, slotIndex);
+	}
+	slot.nameIndexed = true;
+}
+
+void ArrayIndexer::removeName(unsigned int slotIndex)
+{
+	Slot &slot = slots_[slotIndex];
+	if (slot.nameIndexed == false)
+		return;
+
+	unsigned int *headIndex = nameHeads_.find(slot.nameHash);
+	FATAL_ASSERT(headIndex != nullptr);
+
+	if (*headIndex == slotIndex)
+	{
+		if (slot.nextNamed != 0)
+			*headIndex = slot.nextNamed;
+		else
+			nameHeads_.remove(slot.nameHash);
+	}
+	else
+	{
+		unsigned int prevIndex = *headIndex;
+		while (slots_[prevIndex].nextNamed != slotIndex)
 		{
-			Object *objPtr = object(i);
-
-			nctl::String typeName(Object::MaxNameLength);
-			// clang-format off
-			switch (objPtr->type())
-			{
-				case Object::ObjectType::BASE:					typeName = "Base"; break;
-				case Object::ObjectType::TEXTURE:				typeName = "Texture"; break;
-				case Object::ObjectType::SCENENODE:				typeName = "SceneNode"; break;
-				case Object::ObjectType::SPRITE:				typeName = "Sprite"; break;
-				case Object::ObjectType::MESH_SPRITE:			typeName = "MeshSprite"; break;
-				case Object::ObjectType::ANIMATED_SPRITE:		typeName = "AnimatedSprite"; break;
-				case Object::ObjectType::PARTICLE_SYSTEM:		typeName = "ParticleSystem"; break;
-				case Object::ObjectType::FONT:					typeName = "Font"; break;
-				case Object::ObjectType::TEXTNODE:				typeName = "TextNode"; break;
-				case Object::ObjectType::AUDIOBUFFER:			typeName = "AudioBuffer"; break;
-				case Object::ObjectType::AUDIOBUFFER_PLAYER:	typeName = "AudioBufferPlayer"; break;
-				case Object::ObjectType::AUDIOSTREAM_PLAYER:	typeName = "AudioStreamPlayer"; break;
-				default:										typeName = "Unknown"; break;
-			}
-			// clang-format on
-
-			LOGI_X("Object %u - type: %s - name: \"%s\"", objPtr->id(), typeName.data(), objPtr->name().data());
+			prevIndex = slots_[prevIndex].nextNamed;
+			FATAL_ASSERT(prevIndex != 0);
 		}
+		slots_[prevIndex].nextNamed = slot.nextNamed;
 	}
+
+	slot.nextNamed = 0;
+	slot.nameIndexed = false;
+}
+
+Object *ArrayIndexer::findInChain(unsigned int slotIndex, const nctl::StringView &name) const
+{
+	while (slotIndex != 0)
+	{
+		if (slots_[slotIndex].object->name() == name)
+			return slots_[slotIndex].object;
+		slotIndex = slots_[slotIndex].nextNamed;
+	}
+
+	return nullptr;
 }
 
 }
@@ -0,0 +1,340 @@
+#include "common_macros.h"
+#include "AsyncFileReader.h"
+#include "IFile.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+AsyncFileReader::AsyncFileReader()
+    : inFlightRequest_(nullptr), nextRequestId_(1)
+{
+#ifdef WITH_THREADS
+	shouldQuit_ = false;
+	thread_.run(workerFunction, this);
+	#if !defined(__EMSCRIPTEN__) && !defined(__APPLE__)
+	thread_.setName("AsyncFileReader");
+	#endif
+#endif
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+#ifdef WITH_THREADS
+	queueMutex_.lock();
+	shouldQuit_ = true;
+	queueCV_.broadcast();
+	queueMutex_.unlock();
+
+	thread_.join();
+#endif
+
+	const unsigned int numDiscarded = pendingRequests_.size() + completedRequests_.size() + deliveringRequests_.size();
+	if (numDiscarded > 0)
+	{
+		LOGW_X("Discarding %u requests that have not been completed", numDiscarded);
+		for (nctl::UniquePtr<Request> &request : pendingRequests_)
+			releaseRequest(*request);
+		for (nctl::UniquePtr<Request> &request : completedRequests_)
+			releaseRequest(*request);
+		for (nctl::UniquePtr<Request> &request : deliveringRequests_)
+			releaseRequest(*request);
+	}
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+unsigned int AsyncFileReader::submitRead(const char *filename, unsigned char *buffer, unsigned long int offset,
+                                         unsigned long int bytes, CompletionCallback callback, void *userData)
+{
+	ASSERT(filename);
+	ASSERT(buffer);
+	if (filename == nullptr || buffer == nullptr)
+		return 0;
+
+	nctl::UniquePtr<Request> request = nctl::makeUnique<Request>(filename);
+	request->offset = offset;
+	request->bytes = bytes;
+	request->callback = callback;
+	request->result.data = buffer;
+	request->result.userData = userData;
+
+	return submitRequest(nctl::move(request));
+}
+
+unsigned int AsyncFileReader::submitFileRead(const char *filename, CompletionCallback callback, void *userData)
+{
+	return submitFileRead(filename, callback, nullptr, userData);
+}
+
+unsigned int AsyncFileReader::submitFileRead(const char *filename, CompletionCallback callback, ReleaseCallback releaseCallback, void *userData)
+{
+	ASSERT(filename);
+	if (filename == nullptr)
+		return 0;
+
+	// A null data pointer marks a whole file request
+	nctl::UniquePtr<Request> request = nctl::makeUnique<Request>(filename);
+	request->callback = callback;
+	request->releaseCallback = releaseCallback;
+	request->result.userData = userData;
+
+	return submitRequest(nctl::move(request));
+}
+
+bool AsyncFileReader::cancel(unsigned int requestId)
+{
+	if (requestId == 0)
+		return false;
+
+#ifdef WITH_THREADS
+	queueMutex_.lock();
+#endif
+	// Requests taken by `update()` are searched too, a callback can cancel the ones that follow it
+	nctl::UniquePtr<Request> request = takeRequest(pendingRequests_, requestId);
+	if (request == nullptr)
+		request = takeRequest(completedRequests_, requestId);
+	if (request == nullptr)
+		request = takeRequest(deliveringRequests_, requestId);
+#ifdef WITH_THREADS
+	Request *inFlightRequest = nullptr;
+	if (request == nullptr && inFlightRequest_ != nullptr && inFlightRequest_->result.requestId == requestId)
+	{
+		inFlightRequest_->isCanceled = true;
+		inFlightRequest = inFlightRequest_;
+	}
+	queueMutex_.unlock();
+
+	if (inFlightRequest != nullptr)
+	{
+		// Waiting for the worker to finish writing into the user buffer, it will then drop the request
+		ReleaseCallback releaseCallback = inFlightRequest->releaseCallback;
+		void *userData = inFlightRequest->result.userData;
+		readMutex_.lock();
+		readMutex_.unlock();
+
+		if (releaseCallback)
+			releaseCallback(userData);
+		statistics_.numCanceled++;
+		return true;
+	}
+#endif
+
+	if (request == nullptr)
+		return false;
+
+	releaseRequest(*request);
+	statistics_.numCanceled++;
+	return true;
+}
+
+void AsyncFileReader::update()
+{
+#ifndef WITH_THREADS
+	// Without a worker thread the pending requests are read now
+	while (pendingRequests_.isEmpty() == false)
+	{
+		processRequest(*pendingRequests_.front());
+		completedRequests_.pushBack(nctl::move(pendingRequests_.front()));
+		pendingRequests_.popFront();
+	}
+#endif
+
+#ifdef WITH_THREADS
+	queueMutex_.lock();
+#endif
+	deliveringRequests_.splice(deliveringRequests_.end(), completedRequests_);
+#ifdef WITH_THREADS
+	queueMutex_.unlock();
+#endif
+
+	// Callbacks are invoked without holding the lock, so that they can submit or cancel requests
+	while (true)
+	{
+#ifdef WITH_THREADS
+		queueMutex_.lock();
+#endif
+		nctl::UniquePtr<Request> request;
+		if (deliveringRequests_.isEmpty() == false)
+		{
+			request = nctl::move(deliveringRequests_.front());
+			deliveringRequests_.popFront();
+		}
+#ifdef WITH_THREADS
+		queueMutex_.unlock();
+#endif
+		if (request == nullptr)
+			break;
+
+		Result &result = request->result;
+
+		statistics_.numCompleted++;
+		if (result.succeeded == false)
+			statistics_.numFailed++;
+		statistics_.bytesRead += result.bytesRead;
+		statistics_.lastLatency = result.latency;
+		statistics_.averageLatency += (result.latency - statistics_.averageLatency) / statistics_.numCompleted;
+		if (result.latency > statistics_.maxLatency)
+			statistics_.maxLatency = result.latency;
+		statistics_.lastReadTime = result.readTime;
+		statistics_.averageReadTime += (result.readTime - statistics_.averageReadTime) / statistics_.numCompleted;
+
+		if (result.succeeded == false)
+			LOGW_X("Asynchronous read of \"%s\" failed after %lu bytes", result.filename, result.bytesRead);
+
+		if (request->callback)
+			request->callback(result);
+	}
+}
+
+unsigned int AsyncFileReader::numPendingRequests() const
+{
+#ifdef WITH_THREADS
+	queueMutex_.lock();
+#endif
+	const unsigned int numRequests = pendingRequests_.size() + completedRequests_.size() + deliveringRequests_.size() + (inFlightRequest_ ? 1 : 0);
+#ifdef WITH_THREADS
+	queueMutex_.unlock();
+#endif
+
+	return numRequests;
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+#ifdef WITH_THREADS
+void AsyncFileReader::workerFunction(void *arg)
+{
+	AsyncFileReader *reader = static_cast<AsyncFileReader *>(arg);
+
+	LOGD_X("Asynchronous file reader thread %u is starting", Thread::self());
+
+	while (true)
+	{
+		reader->queueMutex_.lock();
+		while (reader->pendingRequests_.isEmpty() && reader->shouldQuit_ == false)
+			reader->queueCV_.wait(reader->queueMutex_);
+
+		if (reader->shouldQuit_)
+		{
+			reader->queueMutex_.unlock();
+			break;
+		}
+
+		nctl::UniquePtr<Request> request = nctl::move(reader->pendingRequests_.front());
+		reader->pendingRequests_.popFront();
+		reader->inFlightRequest_ = request.get();
+		// The read lock is acquired before releasing the queue one, so that `cancel()` cannot miss it
+		reader->readMutex_.lock();
+		reader->queueMutex_.unlock();
+
+		processRequest(*request);
+		reader->readMutex_.unlock();
+
+		reader->queueMutex_.lock();
+		reader->inFlightRequest_ = nullptr;
+		if (request->isCanceled == false)
+			reader->completedRequests_.pushBack(nctl::move(request));
+		reader->queueMutex_.unlock();
+	}
+
+	LOGD_X("Asynchronous file reader thread %u is exiting", Thread::self());
+}
+#endif
+
+unsigned int AsyncFileReader::submitRequest(nctl::UniquePtr<Request> request)
+{
+	const unsigned int requestId = nextRequestId_++;
+	// Zero is reserved for failed submissions
+	if (nextRequestId_ == 0)
+		nextRequestId_ = 1;
+
+	request->result.requestId = requestId;
+	request->result.filename = request->filename.data();
+	request->submitTime = TimeStamp::now();
+	statistics_.numSubmitted++;
+
+#ifdef WITH_THREADS
+	queueMutex_.lock();
+	pendingRequests_.pushBack(nctl::move(request));
+	queueCV_.signal();
+	queueMutex_.unlock();
+#else
+	pendingRequests_.pushBack(nctl::move(request));
+#endif
+
+	return requestId;
+}
+
+nctl::UniquePtr<AsyncFileReader::Request> AsyncFileReader::takeRequest(nctl::List<nctl::UniquePtr<Request>> &requests, unsigned int requestId)
+{
+	nctl::UniquePtr<Request> request;
+	for (nctl::List<nctl::UniquePtr<Request>>::Iterator i = requests.begin(); i != requests.end(); ++i)
+	{
+		if ((*i)->result.requestId == requestId)
+		{
+			request = nctl::move(*i);
+			requests.erase(i);
+			break;
+		}
+	}
+
+	return request;
+}
+
+void AsyncFileReader::releaseRequest(Request &request)
+{
+	if (request.releaseCallback)
+		request.releaseCallback(request.result.userData);
+}
+
+void AsyncFileReader::processRequest(Request &request)
+{
+	const TimeStamp startTime = TimeStamp::now();
+	Result &result = request.result;
+
+	nctl::UniquePtr<IFile> fileHandle = IFile::createFileHandle(request.filename.data());
+	fileHandle->setExitOnFailToOpen(false);
+	fileHandle->open(IFile::OpenMode::READ | IFile::OpenMode::BINARY);
+
+	if (fileHandle->isOpened())
+	{
+		const bool isWholeFile = (result.data == nullptr);
+		const unsigned long int fileSize = static_cast<unsigned long int>(fileHandle->size());
+
+		unsigned long int bytesToRead = 0;
+		if (request.offset <= fileSize)
+		{
+			bytesToRead = fileSize - request.offset;
+			if (isWholeFile == false && request.bytes < bytesToRead)
+				bytesToRead = request.bytes;
+		}
+
+		if (isWholeFile)
+		{
+			result.buffer = nctl::makeUnique<unsigned char[]>(bytesToRead);
+			result.data = result.buffer.get();
+		}
+
+		if (bytesToRead > 0)
+		{
+			if (request.offset > 0)
+				fileHandle->seek(static_cast<long int>(request.offset), SEEK_SET);
+			result.bytesRead = fileHandle->read(result.data, bytesToRead);
+		}
+
+		const unsigned long int expectedBytes = isWholeFile ? fileSize : request.bytes;
+		result.succeeded = (result.bytesRead == expectedBytes);
+	}
+
+	result.readTime = startTime.secondsSince();
+	result.latency = request.submitTime.secondsSince();
+}
+
+}
@@ -19,40 +19,52 @@ FntParser::FntParser(const char *fntFilename)
 	nctl::UniquePtr<char[]> fileBuffer = nctl::makeUnique<char[]>(size);
 	fileHandle->read(fileBuffer.get(), size);
 
-	parseFntBuffer(fileBuffer.get(), size);
+	parseFntBuffer(nctl::StringView(fileBuffer.get(), static_cast<unsigned int>(size)));
 }
 
 FntParser::FntParser(const char *buffer, long int size)
+    : FntParser(nctl::StringView(buffer, static_cast<unsigned int>(size)))
+{
+}
+
+FntParser::FntParser(const nctl::StringView &buffer)
     : numPageTags_(0), numCharTags_(0), numKerningTags_(0)
 {
-	parseFntBuffer(buffer, size);
+	parseFntBuffer(buffer);
 }
 
 ///////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-void FntParser::parseFntBuffer(const char *buffer, long int size)
+void FntParser::parseFntBuffer(const nctl::StringView &buffer)
 {
-	char const *const bufferStart = buffer;
-
-	do
-	{
-		if (strncmp(buffer, "info", 4) == 0)
-			parseInfoTag(buffer);
-		else if (strncmp(buffer, "common", 6) == 0)
-			parseCommonTag(buffer);
-		else if (strncmp(buffer, "page", 4) == 0 && numPageTags_ < MaxPageTags)
-			parsePageTag(buffer, numPageTags_++);
-		else if (strncmp(buffer, "chars", 5) == 0)
-			parseCharsTag(buffer);
-		else if (strncmp(buffer, "char", 4) == 0 && numCharTags_ < MaxCharTags)
-			parseCharTag(buffer, numCharTags_++);
-		else if (strncmp(buffer, "kernings", 8) == 0)
-			parseKerningsTag(buffer);
-		else if (strncmp(buffer, "kerning", 7) == 0 && numKerningTags_ < MaxKerningTags)
-			parseKerningTag(buffer, numKerningTags_++);
-	} while (strchr(buffer, '\n') && (buffer = strchr(buffer, '\n') + 1) < bufferStart + size);
+	nctl::StringView remaining = buffer;
+
+	while (remaining.isEmpty() == false)
+	{
+		const char *line = remaining.data();
+		if (remaining.startsWith("info"))
+			parseInfoTag(line);
+		else if (remaining.startsWith("common"))
+			parseCommonTag(line);
+		else if (remaining.startsWith("page") && numPageTags_ < MaxPageTags)
+			parsePageTag(line, numPageTags_++);
+		else if (remaining.startsWith("chars"))
+			parseCharsTag(line);
+		else if (remaining.startsWith("char") && numCharTags_ < MaxCharTags)
+			parseCharTag(line, numCharTags_++);
+		else if (remaining.startsWith("kernings"))
+			parseKerningsTag(line);
+		else if (remaining.startsWith("kerning") && numKerningTags_ < MaxKerningTags)
+			parseKerningTag(line, numKerningTags_++);
+
+		// Line scanning never goes past the end of the buffer, even if it is not null terminated
+		const int newLine = remaining.findFirstChar('\n');
+		if (newLine < 0)
+			break;
+		remaining = remaining.subView(newLine + 1);
+	}
 
 	LOGI_X("FNT file parsed for \"%s\", size %d, texture %dx%d, : %u pages, %u characters, %u kernings", infoTag_.face.data(), infoTag_.size, commonTag_.scaleW, commonTag_.scaleH, numPageTags_, numCharTags_, numKerningTags_);
 }
@@ -0,0 +1,47 @@
+#include "common_macros.h"
+#include "FrameArena.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+FrameArena::FrameArena(size_t size)
+    : firstAllocator_("FrameArena0", size), secondAllocator_("FrameArena1", size), currentAllocator_(&firstAllocator_),
+      lastFrameUsedMemory_(0), lastFrameOverflows_(0), numOverflowFrames_(0),
+      firstFailedAllocations_(0), secondFailedAllocations_(0)
+{
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void FrameArena::swap()
+{
+	const bool isFirstCurrent = (currentAllocator_ == &firstAllocator_);
+	unsigned int &currentFailedAllocations = isFirstCurrent ? firstFailedAllocations_ : secondFailedAllocations_;
+	unsigned int &nextFailedAllocations = isFirstCurrent ? secondFailedAllocations_ : firstFailedAllocations_;
+
+	lastFrameUsedMemory_ = currentAllocator_->usedMemory();
+	lastFrameOverflows_ = currentAllocator_->numFailedAllocations() - currentFailedAllocations;
+	if (lastFrameOverflows_ > 0)
+	{
+		numOverflowFrames_++;
+		LOGW_X("The frame arena has overflowed %u times, consider increasing its size of %lu bytes", lastFrameOverflows_, static_cast<unsigned long>(size()));
+	}
+
+	currentAllocator_ = isFirstCurrent ? &secondAllocator_ : &firstAllocator_;
+	currentAllocator_->clear();
+	nextFailedAllocations = currentAllocator_->numFailedAllocations();
+}
+
+size_t FrameArena::peakUsedMemory() const
+{
+	const size_t firstPeak = firstAllocator_.peakUsedMemory();
+	const size_t secondPeak = secondAllocator_.peakUsedMemory();
+	return (firstPeak > secondPeak) ? firstPeak : secondPeak;
+}
+
+}
@@ -0,0 +1,152 @@
+#include "FramePacer.h"
+#include "TimeStamp.h"
+#include "Timer.h"
+#include "tracy.h"
+#include <cmath> // for sqrt()
+
+namespace ncine {
+
+namespace {
+
+	/// The spinning tail is never shorter than this, to absorb small scheduling delays
+	const double MinSpinTime = 0.0002;
+	/// The spinning tail is never longer than this, to bound the amount of wasted CPU time
+	const double MaxSpinTime = 0.004;
+	/// How much a wake-up error is enlarged to compute the spinning tail that would have absorbed it
+	const double SpinTimeMargin = 1.25;
+	/// How quickly the spinning tail shrinks back after an unusually late wake-up
+	const double SpinTimeDecay = 0.9;
+
+	inline double nowSeconds() { return TimeStamp::now().secondsDouble(); }
+
+}
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+FramePacer::FramePacer(float statisticsInterval)
+    : targetFrameTime_(0.0f), statisticsInterval_(statisticsInterval),
+      deadline_(0.0), lastFrameEnd_(0.0), spinTime_(0.001)
+{
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void FramePacer::setTargetFrameTime(float seconds)
+{
+	targetFrameTime_ = (seconds > 0.0f) ? seconds : 0.0f;
+	// The next deadline is computed from the end of the current frame
+	deadline_ = 0.0;
+}
+
+void FramePacer::reset()
+{
+	deadline_ = 0.0;
+	lastFrameEnd_ = 0.0;
+}
+
+void FramePacer::wait()
+{
+	if (targetFrameTime_ <= 0.0f)
+	{
+		updateStatistics(nowSeconds());
+		return;
+	}
+
+	ZoneScoped;
+	double now = nowSeconds();
+
+	// Deadlines are spaced by the target frame time, so that the average frame time matches it exactly
+	deadline_ = (deadline_ > 0.0) ? deadline_ + targetFrameTime_ : now + targetFrameTime_;
+	if (now >= deadline_)
+	{
+		// A late frame does not make the following ones shorter to catch up
+		accumulators_.missedDeadlines++;
+		deadline_ = now;
+		updateStatistics(now);
+		return;
+	}
+
+	const double sleepTime = deadline_ - now - spinTime_;
+	if (sleepTime > 0.0)
+	{
+		Timer::sleep(static_cast<float>(sleepTime));
+		const double wakeUpTime = nowSeconds();
+		calibrate(wakeUpTime - (now + sleepTime));
+		now = wakeUpTime;
+	}
+
+	const double spinStart = now;
+	while (now < deadline_)
+		now = nowSeconds();
+	accumulators_.spinTime += now - spinStart;
+
+	updateStatistics(now);
+}
+
+/*! The spinning tail is not counted, as it is needed to wake up in time. */
+float FramePacer::timeLeft() const
+{
+	if (targetFrameTime_ <= 0.0f || deadline_ <= 0.0)
+		return 0.0f;
+
+	const double timeLeft = deadline_ + targetFrameTime_ - nowSeconds() - spinTime_;
+	return (timeLeft > 0.0) ? static_cast<float>(timeLeft) : 0.0f;
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void FramePacer::calibrate(double wakeUpError)
+{
+	if (wakeUpError < 0.0)
+		wakeUpError = 0.0;
+
+	accumulators_.numSleeps++;
+	accumulators_.wakeUpError += wakeUpError;
+	if (wakeUpError > accumulators_.maxWakeUpError)
+		accumulators_.maxWakeUpError = wakeUpError;
+
+	// Grows at once to cover a late wake-up, then slowly shrinks to give back CPU time
+	const double neededSpinTime = wakeUpError * SpinTimeMargin;
+	spinTime_ = (neededSpinTime > spinTime_) ? neededSpinTime : spinTime_ * SpinTimeDecay;
+	if (spinTime_ < MinSpinTime)
+		spinTime_ = MinSpinTime;
+	else if (spinTime_ > MaxSpinTime)
+		spinTime_ = MaxSpinTime;
+}
+
+void FramePacer::updateStatistics(double frameEnd)
+{
+	if (lastFrameEnd_ > 0.0)
+	{
+		const double frameTime = frameEnd - lastFrameEnd_;
+		accumulators_.numFrames++;
+		accumulators_.frameTime += frameTime;
+		accumulators_.frameTimeSquared += frameTime * frameTime;
+		accumulators_.elapsedTime += frameTime;
+	}
+	lastFrameEnd_ = frameEnd;
+
+	if (accumulators_.numFrames == 0 || accumulators_.elapsedTime < statisticsInterval_)
+		return;
+
+	const double numFrames = static_cast<double>(accumulators_.numFrames);
+	const double averageFrameTime = accumulators_.frameTime / numFrames;
+	const double variance = accumulators_.frameTimeSquared / numFrames - averageFrameTime * averageFrameTime;
+
+	statistics_.averageWakeUpError = (accumulators_.numSleeps > 0) ? static_cast<float>(accumulators_.wakeUpError / accumulators_.numSleeps) : 0.0f;
+	statistics_.maxWakeUpError = static_cast<float>(accumulators_.maxWakeUpError);
+	statistics_.averageSpinTime = static_cast<float>(accumulators_.spinTime / numFrames);
+	statistics_.averageFrameTime = static_cast<float>(averageFrameTime);
+	statistics_.frameTimeJitter = (variance > 0.0) ? static_cast<float>(sqrt(variance)) : 0.0f;
+	statistics_.missedDeadlines = accumulators_.missedDeadlines;
+
+	accumulators_ = Accumulators();
+}
+
+}
@@ -0,0 +1,160 @@
+#include <nctl/StaticArray.h>
+#include <nctl/algorithms.h>
+#include "common_macros.h"
+#include "FrameTimeStatistics.h"
+
+namespace ncine {
+
+namespace {
+
+	const char *PhaseNames[FrameTimeStatistics::Phase::COUNT] = { "Frame", "onFrameStart", "Update", "Visit", "Draw", "ImGui", "Audio", "onFrameEnd" };
+
+	/// Returns the index of a percentile in a sorted array, using the nearest-rank method
+	inline unsigned int percentileIndex(unsigned int numValues, unsigned int percentile)
+	{
+		const unsigned int rank = (numValues * percentile + 99) / 100;
+		return (rank > 0) ? rank - 1 : 0;
+	}
+
+}
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+FrameTimeStatistics::FrameTimeStatistics(float updateInterval)
+    : updateInterval_(updateInterval), histogramBinWidth_(0.002f)
+{
+	reset();
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void FrameTimeStatistics::addFrame(const float durations[Phase::COUNT])
+{
+	for (unsigned int i = 0; i < Phase::COUNT; i++)
+		durations_[i][nextIndex_] = durations[i];
+	nextIndex_ = (nextIndex_ + 1) % NumFrames;
+	if (numFrames_ < NumFrames)
+		numFrames_++;
+
+	const float frameTime = durations[Phase::FRAME];
+	unsigned int bin = static_cast<unsigned int>(frameTime / histogramBinWidth_);
+	if (bin >= NumHistogramBins)
+		bin = NumHistogramBins - 1;
+	histogram_[bin]++;
+
+	// The median used by the hitch detection comes from the previous update
+	checkHitch(durations);
+
+	elapsedTime_ += frameTime;
+	if (elapsedTime_ >= updateInterval_)
+	{
+		updatePercentiles();
+		elapsedTime_ = 0.0f;
+	}
+}
+
+void FrameTimeStatistics::reset()
+{
+	elapsedTime_ = 0.0f;
+	nextIndex_ = 0;
+	numFrames_ = 0;
+	numHitches_ = 0;
+
+	for (unsigned int i = 0; i < Phase::COUNT; i++)
+	{
+		percentiles_[i] = Percentiles();
+		lastHitch_[i] = 0.0f;
+	}
+	for (unsigned int i = 0; i < NumHistogramBins; i++)
+		histogram_[i] = 0;
+}
+
+float FrameTimeStatistics::duration(Phase::Enum phase, unsigned int age) const
+{
+	ASSERT(age < numFrames_);
+	if (age >= numFrames_)
+		return 0.0f;
+
+	const unsigned int index = (nextIndex_ + NumFrames - 1 - age) % NumFrames;
+	return durations_[phase][index];
+}
+
+void FrameTimeStatistics::setHistogramBinWidth(float seconds)
+{
+	ASSERT(seconds > 0.0f);
+	if (seconds > 0.0f)
+	{
+		histogramBinWidth_ = seconds;
+		for (unsigned int i = 0; i < NumHistogramBins; i++)
+			histogram_[i] = 0;
+	}
+}
+
+void FrameTimeStatistics::logReport() const
+{
+	for (unsigned int i = 0; i < Phase::COUNT; i++)
+	{
+		const Percentiles &p = percentiles_[i];
+		LOGV_X("%s: p50 %.3fms, p95 %.3fms, p99 %.3fms, max %.3fms", PhaseNames[i],
+		       p.p50 * 1000.0f, p.p95 * 1000.0f, p.p99 * 1000.0f, p.max * 1000.0f);
+	}
+	LOGV_X("%u hitches detected", numHitches_);
+}
+
+const char *FrameTimeStatistics::phaseName(Phase::Enum phase)
+{
+	ASSERT(phase < Phase::COUNT);
+	return PhaseNames[phase];
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void FrameTimeStatistics::updatePercentiles()
+{
+	if (numFrames_ == 0)
+		return;
+
+	nctl::StaticArray<float, NumFrames> sorted;
+	sorted.setSize(numFrames_);
+	for (unsigned int i = 0; i < Phase::COUNT; i++)
+	{
+		for (unsigned int j = 0; j < numFrames_; j++)
+			sorted[j] = durations_[i][j];
+		nctl::quicksort(sorted.begin(), sorted.end());
+
+		Percentiles &p = percentiles_[i];
+		p.p50 = sorted[percentileIndex(numFrames_, 50)];
+		p.p95 = sorted[percentileIndex(numFrames_, 95)];
+		p.p99 = sorted[percentileIndex(numFrames_, 99)];
+		p.max = sorted[numFrames_ - 1];
+	}
+}
+
+void FrameTimeStatistics::checkHitch(const float durations[Phase::COUNT])
+{
+	const float medianThreshold = percentiles_[Phase::FRAME].p50 * hitchSettings_.medianFactor;
+	const float threshold = (medianThreshold > hitchSettings_.minFrameTime) ? medianThreshold : hitchSettings_.minFrameTime;
+	if (durations[Phase::FRAME] <= threshold)
+		return;
+
+	numHitches_++;
+	for (unsigned int i = 0; i < Phase::COUNT; i++)
+		lastHitch_[i] = durations[i];
+
+	if (hitchSettings_.logHitches)
+	{
+		LOGW_X("Hitch of %.3fms (median %.3fms): onFrameStart %.3fms, update %.3fms, visit %.3fms, draw %.3fms, ImGui %.3fms, audio %.3fms, onFrameEnd %.3fms",
+		       durations[Phase::FRAME] * 1000.0f, percentiles_[Phase::FRAME].p50 * 1000.0f,
+		       durations[Phase::FRAME_START] * 1000.0f, durations[Phase::UPDATE] * 1000.0f, durations[Phase::VISIT] * 1000.0f,
+		       durations[Phase::DRAW] * 1000.0f, durations[Phase::IMGUI] * 1000.0f, durations[Phase::AUDIO] * 1000.0f,
+		       durations[Phase::FRAME_END] * 1000.0f);
+	}
+}
+
+}
@@ -1,5 +1,6 @@
 #include "common_macros.h"
 #include "FrameTimer.h"
+#include "Application.h"
 
 namespace ncine {
 
@@ -11,7 +12,7 @@ namespace ncine {
  *  seconds and writes to the log every `logInterval` seconds. */
 FrameTimer::FrameTimer(float logInterval, float avgInterval)
     : logInterval_(logInterval), avgInterval_(avgInterval),
-      totNumFrames_(0L), avgNumFrames_(0L), logNumFrames_(0L), fps_(0.0f)
+      totNumFrames_(0L), avgNumFrames_(0L), logNumFrames_(0L), fps_(0.0f), statistics_(avgInterval)
 {
 }
 
@@ -19,7 +20,7 @@ FrameTimer::FrameTimer(float logInterval, float avgInterval)
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-void FrameTimer::addFrame()
+void FrameTimer::addFrame(const float *timings)
 {
 	frameInterval_ = frameStart_.secondsSince();
 
@@ -30,6 +31,21 @@ void FrameTimer::addFrame()
 	avgNumFrames_++;
 	logNumFrames_++;
 
+	// The first interval is measured from the end of the initialization and not from a previous frame
+	if (totNumFrames_ > 1)
+	{
+		float durations[FrameTimeStatistics::Phase::COUNT];
+		durations[FrameTimeStatistics::Phase::FRAME] = frameInterval_;
+		durations[FrameTimeStatistics::Phase::FRAME_START] = timings[Application::Timings::FRAME_START];
+		durations[FrameTimeStatistics::Phase::UPDATE] = timings[Application::Timings::UPDATE];
+		durations[FrameTimeStatistics::Phase::VISIT] = timings[Application::Timings::VISIT];
+		durations[FrameTimeStatistics::Phase::DRAW] = timings[Application::Timings::DRAW];
+		durations[FrameTimeStatistics::Phase::IMGUI] = timings[Application::Timings::IMGUI];
+		durations[FrameTimeStatistics::Phase::AUDIO] = timings[Application::Timings::AUDIO];
+		durations[FrameTimeStatistics::Phase::FRAME_END] = timings[Application::Timings::FRAME_END];
+		statistics_.addFrame(durations);
+	}
+
 	// Update the FPS average calculation every `avgInterval_` seconds
 	const float secsSinceLastAvgUpdate = (frameStart_ - lastAvgUpdate_).seconds();
 	if (avgInterval_ > 0.0f && secsSinceLastAvgUpdate > avgInterval_)
@@ -47,6 +63,7 @@ void FrameTimer::addFrame()
 		fps_ = static_cast<float>(logNumFrames_) / logInterval_;
 		const float msPerFrame = (logInterval_ * 1000.0f) / static_cast<float>(logNumFrames_);
 		LOGV_X("%lu frames in %.0f seconds = %f FPS (%.3fms per frame)", logNumFrames_, logInterval_, fps_, msPerFrame);
+		statistics_.logReport();
 
 		logNumFrames_ = 0L;
 		lastLogUpdate_ = TimeStamp::now();
@@ -1,8 +1,10 @@
 #include <cstdlib> // for getenv()
-#include <cstring> // for strlen()
+#include <cstring> // for strlen() and strncmp()
 #include "common_macros.h"
 #include "IFile.h"
 #include "StandardFile.h"
+#include "PackArchive.h"
+#include "MemoryFile.h"
 
 #ifdef __ANDROID__
 	#include <sys/stat.h> // for mkdir()
@@ -24,6 +26,7 @@ namespace ncine {
 
 nctl::String IFile::dataPath_(MaxFilenameLength);
 nctl::String IFile::savePath_(MaxFilenameLength);
+nctl::Array<nctl::UniquePtr<PackArchive>> IFile::mountedPacks_;
 
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS and DESTRUCTOR
@@ -32,7 +35,7 @@ nctl::String IFile::savePath_(MaxFilenameLength);
 IFile::IFile(const char *filename)
     : type_(FileType::BASE), filename_(filename), extension_(MaxExtensionLength),
       fileDescriptor_(-1), filePointer_(nullptr), shouldCloseOnDestruction_(true),
-      shouldExitOnFailToOpen_(true), fileSize_(0)
+      shouldExitOnFailToOpen_(true), fileSize_(0), mappedMemory_(nullptr)
 {
 	ASSERT(filename);
 
@@ -54,6 +57,38 @@ bool IFile::isOpened() const
 		return false;
 }
 
+const unsigned char *IFile::mapToMemory()
+{
+	if (mappedMemory_ != nullptr)
+		return mappedMemory_;
+
+	if (isOpened() == false || fileSize_ <= 0)
+		return nullptr;
+
+	// Reading the whole file without changing its seek position
+	const long int seekPosition = tell();
+	seek(0L, SEEK_SET);
+	mappedBuffer_ = nctl::makeUnique<unsigned char[]>(fileSize_);
+	const unsigned long int bytesRead = read(mappedBuffer_.get(), fileSize_);
+	seek(seekPosition, SEEK_SET);
+
+	if (bytesRead != static_cast<unsigned long int>(fileSize_))
+	{
+		LOGW_X("Cannot read the whole file \"%s\" to memory", filename_.data());
+		mappedBuffer_.reset(nullptr);
+		return nullptr;
+	}
+
+	mappedMemory_ = mappedBuffer_.get();
+	return mappedMemory_;
+}
+
+void IFile::unmapFromMemory()
+{
+	mappedBuffer_.reset(nullptr);
+	mappedMemory_ = nullptr;
+}
+
 bool IFile::hasExtension(const char *extension) const
 {
 	ASSERT(extension);
@@ -63,6 +98,13 @@ bool IFile::hasExtension(const char *extension) const
 nctl::UniquePtr<IFile> IFile::createFileHandle(const char *filename)
 {
 	ASSERT(filename);
+	if (mountedPacks_.isEmpty() == false)
+	{
+		nctl::UniquePtr<IFile> packFileHandle = createPackFileHandle(filename);
+		if (packFileHandle != nullptr)
+			return packFileHandle;
+	}
+
 #ifdef __ANDROID__
 	if (strncmp(filename, static_cast<const char *>("asset::"), 7) == 0)
 		return nctl::makeUnique<AssetFile>(filename + 7);
@@ -71,9 +113,23 @@ nctl::UniquePtr<IFile> IFile::createFileHandle(const char *filename)
 		return nctl::makeUnique<StandardFile>(filename);
 }
 
+nctl::UniquePtr<IFile> IFile::createFromMemory(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize)
+{
+	ASSERT(bufferName);
+	ASSERT(bufferPtr);
+	return nctl::makeUnique<MemoryFile>(bufferName, bufferPtr, bufferSize);
+}
+
 bool IFile::access(const char *filename, unsigned char mode)
 {
 	ASSERT(filename);
+	// Pack archive entries can only be read
+	if (mountedPacks_.isEmpty() == false && (mode & AccessMode::WRITABLE) == 0)
+	{
+		if (createPackFileHandle(filename) != nullptr)
+			return true;
+	}
+
 #ifdef __ANDROID__
 	if (strncmp(filename, static_cast<const char *>("asset::"), 7) == 0)
 		return AssetFile::access(filename + 7, mode);
@@ -82,6 +138,26 @@ bool IFile::access(const char *filename, unsigned char mode)
 		return StandardFile::access(filename, mode);
 }
 
+bool IFile::mountPack(const char *filename)
+{
+	ASSERT(filename);
+
+	nctl::UniquePtr<PackArchive> packArchive = nctl::makeUnique<PackArchive>(filename);
+	if (packArchive->isValid() == false)
+	{
+		LOGE_X("Cannot mount the pack archive \"%s\"", filename);
+		return false;
+	}
+
+	mountedPacks_.pushBack(nctl::move(packArchive));
+	return true;
+}
+
+void IFile::unmountPacks()
+{
+	mountedPacks_.clear();
+}
+
 const nctl::String &IFile::savePath()
 {
 	if (savePath_.isEmpty())
@@ -94,6 +170,24 @@ const nctl::String &IFile::savePath()
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
+nctl::UniquePtr<IFile> IFile::createPackFileHandle(const char *filename)
+{
+	// Entries are stored with a path relative to the data directory
+	const char *entryPath = filename;
+	if (dataPath_.isEmpty() == false && strncmp(filename, dataPath_.data(), dataPath_.length()) == 0)
+		entryPath += dataPath_.length();
+
+	for (int i = int(mountedPacks_.size()) - 1; i >= 0; i--)
+	{
+		const PackArchive &packArchive = *mountedPacks_[i];
+		const PackArchive::Entry *entry = packArchive.findEntry(entryPath);
+		if (entry != nullptr)
+			return nctl::makeUnique<MemoryFile>(filename, packArchive.entryData(*entry), PackArchive::entrySize(*entry));
+	}
+
+	return nctl::UniquePtr<IFile>();
+}
+
 void IFile::initSavePath()
 {
 #ifdef __ANDROID__
@@ -0,0 +1,120 @@
+#include <cstdlib> // for exit()
+#include <cstring> // for memcpy()
+#include "common_macros.h"
+#include "MemoryFile.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+MemoryFile::MemoryFile(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize)
+    : IFile(bufferName), bufferPtr_(bufferPtr), bufferSize_(bufferSize), seekPosition_(0L), isOpened_(false)
+{
+	ASSERT(bufferPtr);
+	type_ = FileType::MEMORY;
+}
+
+MemoryFile::~MemoryFile()
+{
+	if (shouldCloseOnDestruction_)
+		close();
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void MemoryFile::open(unsigned char mode)
+{
+	// Checking if the file is already opened
+	if (isOpened_)
+		LOGW_X("File \"%s\" is already opened", filename_.data());
+	// A memory file can only be read
+	else if (mode == OpenMode::READ || mode == (OpenMode::READ | OpenMode::BINARY))
+	{
+		isOpened_ = true;
+		seekPosition_ = 0L;
+		fileSize_ = static_cast<long int>(bufferSize_);
+		LOGI_X("File \"%s\" opened from memory", filename_.data());
+	}
+	else if (shouldExitOnFailToOpen_)
+	{
+		LOGF_X("Cannot open the file \"%s\", memory files can only be opened for reading", filename_.data());
+		exit(EXIT_FAILURE);
+	}
+	else
+		LOGE_X("Cannot open the file \"%s\", memory files can only be opened for reading", filename_.data());
+}
+
+void MemoryFile::close()
+{
+	if (isOpened_)
+	{
+		mappedMemory_ = nullptr;
+		isOpened_ = false;
+		LOGI_X("File \"%s\" closed", filename_.data());
+	}
+}
+
+/*! Like `fseek()`, it returns zero on success and -1 on failure */
+long int MemoryFile::seek(long int offset, int whence) const
+{
+	if (isOpened_ == false)
+		return -1;
+
+	long int seekValue = -1;
+	switch (whence)
+	{
+		case SEEK_SET:
+			seekValue = offset;
+			break;
+		case SEEK_CUR:
+			seekValue = seekPosition_ + offset;
+			break;
+		case SEEK_END:
+			seekValue = fileSize_ + offset;
+			break;
+	}
+
+	if (seekValue < 0 || seekValue > fileSize_)
+		return -1;
+
+	seekPosition_ = seekValue;
+	return 0;
+}
+
+long int MemoryFile::tell() const
+{
+	return isOpened_ ? seekPosition_ : -1;
+}
+
+unsigned long int MemoryFile::read(void *buffer, unsigned long int bytes) const
+{
+	ASSERT(buffer);
+
+	unsigned long int bytesRead = 0;
+
+	if (isOpened_ && seekPosition_ < fileSize_)
+	{
+		bytesRead = static_cast<unsigned long int>(fileSize_ - seekPosition_);
+		if (bytes < bytesRead)
+			bytesRead = bytes;
+
+		memcpy(buffer, bufferPtr_ + seekPosition_, bytesRead);
+		seekPosition_ += bytesRead;
+	}
+
+	return bytesRead;
+}
+
+const unsigned char *MemoryFile::mapToMemory()
+{
+	if (isOpened_)
+		mappedMemory_ = bufferPtr_;
+
+	return mappedMemory_;
+}
+
+}
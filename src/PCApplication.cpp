@@ -9,6 +9,10 @@
 	#include "GlfwGfxDevice.h"
 	#include "GlfwInputManager.h"
 #endif
+#ifdef WITH_HEADLESS
+	#include "HeadlessGfxDevice.h"
+	#include "HeadlessInputManager.h"
+#endif
 
 #ifdef __EMSCRIPTEN__
 	#include "emscripten.h"
@@ -67,13 +71,34 @@ void PCApplication::init(IAppEventHandler *(*createAppEventHandler)())
 	DisplayMode displayMode(8, 8, 8, 8, 24, 8, DisplayMode::DoubleBuffering::ENABLED, vSyncMode);
 
 	const IGfxDevice::WindowMode windowMode(appCfg_.resolution.x, appCfg_.resolution.y, appCfg_.inFullscreen, appCfg_.isResizable);
+#if defined(WITH_HEADLESS) && !defined(WITH_SDL) && !defined(WITH_GLFW)
+	// The headless device is the only one that has been compiled in
+	if (appCfg_.isHeadless == false)
+	{
+		LOGW("Neither SDL2 nor GLFW are available, the application will run headless");
+		modifiableAppCfg.isHeadless = true;
+	}
+#endif
+#ifdef WITH_HEADLESS
+	if (appCfg_.isHeadless)
+	{
+		gfxDevice_ = nctl::makeUnique<HeadlessGfxDevice>(windowMode, glContextInfo, displayMode);
+		inputManager_ = nctl::makeUnique<HeadlessInputManager>();
+	}
+	else
+#else
+	if (appCfg_.isHeadless)
+		LOGW("The headless device is not available, a window will be created");
+#endif
+	{
 #if defined(WITH_SDL)
-	gfxDevice_ = nctl::makeUnique<SdlGfxDevice>(windowMode, glContextInfo, displayMode);
-	inputManager_ = nctl::makeUnique<SdlInputManager>();
+		gfxDevice_ = nctl::makeUnique<SdlGfxDevice>(windowMode, glContextInfo, displayMode);
+		inputManager_ = nctl::makeUnique<SdlInputManager>();
 #elif defined(WITH_GLFW)
-	gfxDevice_ = nctl::makeUnique<GlfwGfxDevice>(windowMode, glContextInfo, displayMode);
-	inputManager_ = nctl::makeUnique<GlfwInputManager>();
+		gfxDevice_ = nctl::makeUnique<GlfwGfxDevice>(windowMode, glContextInfo, displayMode);
+		inputManager_ = nctl::makeUnique<GlfwInputManager>();
 #endif
+	}
 	gfxDevice_->setWindowTitle(appCfg_.windowTitle.data());
 	nctl::String windowIconFilePath = IFile::dataPath() + appCfg_.windowIconFilename;
 	if (IFile::access(windowIconFilePath.data(), IFile::AccessMode::EXISTS))
@@ -102,6 +127,12 @@ void PCApplication::run()
 void PCApplication::processEvents()
 {
 	ZoneScopedN("Poll events");
+#ifdef WITH_HEADLESS
+	// There are no window or input events, the application quits by calling `Application::quit()`
+	if (appCfg_.isHeadless)
+		return;
+#endif
+
 #if defined(WITH_SDL)
 	SDL_Event event;
 
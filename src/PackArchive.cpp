@@ -0,0 +1,160 @@
+#include <cstring> // for strcmp() and memchr()
+#include "common_macros.h"
+#include "PackArchive.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+PackArchive::PackArchive(const char *filename)
+    : fileHandle_(IFile::createFileHandle(filename)), memory_(nullptr), header_(nullptr),
+      entries_(nullptr), names_(nullptr), numEntries_(0), namesSize_(0)
+{
+	fileHandle_->setExitOnFailToOpen(false);
+	fileHandle_->open(IFile::OpenMode::READ | IFile::OpenMode::BINARY);
+	if (fileHandle_->isOpened() == false)
+		return;
+
+	const unsigned long int fileSize = static_cast<unsigned long int>(fileHandle_->size());
+	if (fileSize < sizeof(Header))
+	{
+		LOGE_X("File \"%s\" is too small to be a pack archive", filename);
+		return;
+	}
+
+	memory_ = fileHandle_->mapToMemory();
+	if (memory_ == nullptr)
+	{
+		LOGE_X("Cannot map the pack archive \"%s\" to memory", filename);
+		return;
+	}
+
+	const Header *header = reinterpret_cast<const Header *>(memory_);
+	if (IFile::int32FromLE(header->magic) != Magic)
+	{
+		LOGE_X("File \"%s\" is not a pack archive", filename);
+		return;
+	}
+	if (IFile::int32FromLE(header->version) != Version)
+	{
+		LOGE_X("Pack archive \"%s\" has an unsupported version: %u", filename, IFile::int32FromLE(header->version));
+		return;
+	}
+
+	numEntries_ = IFile::int32FromLE(header->numEntries);
+	namesSize_ = IFile::int32FromLE(header->namesSize);
+	const uint64_t directorySize = sizeof(Header) + uint64_t(numEntries_) * sizeof(Entry) + namesSize_;
+	if (directorySize > fileSize)
+	{
+		LOGE_X("Pack archive \"%s\" has a truncated directory", filename);
+		numEntries_ = 0;
+		return;
+	}
+
+	entries_ = reinterpret_cast<const Entry *>(memory_ + sizeof(Header));
+	names_ = reinterpret_cast<const char *>(memory_ + sizeof(Header) + numEntries_ * sizeof(Entry));
+	if (validateEntries(fileSize) == false)
+	{
+		LOGE_X("Pack archive \"%s\" has a corrupted directory", filename);
+		entries_ = nullptr;
+		names_ = nullptr;
+		numEntries_ = 0;
+		return;
+	}
+	header_ = header;
+
+	LOGI_X("Pack archive \"%s\" opened with %u entries", filename, numEntries_);
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+const PackArchive::Entry *PackArchive::findEntry(const char *path) const
+{
+	ASSERT(path);
+	if (numEntries_ == 0)
+		return nullptr;
+
+	const uint32_t hash = hashPath(path);
+
+	// Binary search of the first entry with a matching hash
+	unsigned int first = 0;
+	unsigned int count = numEntries_;
+	while (count > 0)
+	{
+		const unsigned int step = count / 2;
+		if (IFile::int32FromLE(entries_[first + step].hash) < hash)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+			count = step;
+	}
+
+	// Entries with a colliding hash are stored one after the other
+	for (unsigned int i = first; i < numEntries_ && IFile::int32FromLE(entries_[i].hash) == hash; i++)
+	{
+		const Entry &entry = entries_[i];
+		if (strcmp(entryName(entry), path) != 0)
+			continue;
+
+		if (IFile::int32FromLE(entry.compression) != static_cast<uint32_t>(Compression::NONE))
+		{
+			LOGE_X("Entry \"%s\" in pack archive \"%s\" uses an unsupported compression method", path, filename());
+			return nullptr;
+		}
+		return &entry;
+	}
+
+	return nullptr;
+}
+
+const char *PackArchive::entryName(const Entry &entry) const
+{
+	// Name offsets have been validated when the archive was opened
+	return names_ + IFile::int32FromLE(entry.nameOffset);
+}
+
+const unsigned char *PackArchive::entryData(const Entry &entry) const
+{
+	return memory_ + IFile::int64FromLE(entry.offset);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+/*! Every entry is checked once, so that lookups can trust names, offsets and sizes */
+bool PackArchive::validateEntries(unsigned long int fileSize) const
+{
+	uint32_t prevHash = 0;
+	for (unsigned int i = 0; i < numEntries_; i++)
+	{
+		const Entry &entry = entries_[i];
+
+		// The binary search in `findEntry()` relies on entries sorted by hash
+		const uint32_t hash = IFile::int32FromLE(entry.hash);
+		if (hash < prevHash)
+			return false;
+		prevHash = hash;
+
+		// The name has to be null terminated inside the block of names
+		const uint32_t nameOffset = IFile::int32FromLE(entry.nameOffset);
+		if (nameOffset >= namesSize_ || memchr(names_ + nameOffset, '\0', namesSize_ - nameOffset) == nullptr)
+			return false;
+
+		// The data blob has to be inside the archive, checked without overflowing
+		const uint64_t offset = IFile::int64FromLE(entry.offset);
+		const uint64_t size = IFile::int64FromLE(entry.size);
+		if (offset > fileSize || size > fileSize - offset)
+			return false;
+	}
+
+	return true;
+}
+
+}
@@ -0,0 +1,99 @@
+#include "common_macros.h"
+#include "ParallelAlgorithms.h"
+#include <nctl/SharedPtr.h>
+#include <nctl/Atomic.h>
+
+#ifdef WITH_THREADS
+	#include "Thread.h"
+#endif
+
+namespace ncine {
+
+namespace {
+
+	/// The state shared by the calling thread and the commands executed by the workers
+	/*! \note It is reference counted, a command could start after the calling thread has already returned. */
+	struct RangeState
+	{
+		RangeState(unsigned int sz, unsigned int grain, unsigned int chunks, ParallelRange::RangeFunction func, void *data)
+		    : size(sz), grainSize(grain), numChunks(chunks), function(func), userData(data), nextChunk(0), completedChunks(0) {}
+
+		const unsigned int size;
+		const unsigned int grainSize;
+		const unsigned int numChunks;
+		const ParallelRange::RangeFunction function;
+		void *const userData;
+
+		nctl::Atomic32 nextChunk;
+		nctl::Atomic32 completedChunks;
+	};
+
+	/// Processes chunks until there are no more left to claim
+	void processChunks(RangeState &state)
+	{
+		while (true)
+		{
+			const unsigned int chunk = static_cast<unsigned int>(state.nextChunk.fetchAdd(1, nctl::Atomic32::MemoryModel::RELAXED));
+			// The function and its data are not accessed anymore once all chunks have been claimed
+			if (chunk >= state.numChunks)
+				break;
+
+			const unsigned int begin = chunk * state.grainSize;
+			const unsigned int end = (state.size - begin > state.grainSize) ? begin + state.grainSize : state.size;
+			state.function(state.userData, begin, end);
+			state.completedChunks.fetchAdd(1, nctl::Atomic32::MemoryModel::RELEASE);
+		}
+	}
+
+	/// A thread pool command that helps processing the chunks of a range
+	class RangeCommand : public IThreadCommand
+	{
+	  public:
+		explicit RangeCommand(const nctl::SharedPtr<RangeState> &state)
+		    : state_(state) {}
+
+		void execute() override { processChunks(*state_); }
+
+	  private:
+		nctl::SharedPtr<RangeState> state_;
+	};
+
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void ParallelRange::run(IThreadPool &threadPool, unsigned int size, unsigned int grainSize, RangeFunction function, void *userData)
+{
+	ASSERT(function);
+	if (size == 0)
+		return;
+	if (grainSize == 0)
+		grainSize = 1;
+
+	const unsigned int numChunks = size / grainSize + ((size % grainSize) ? 1 : 0);
+	const unsigned int numThreads = threadPool.numThreads();
+	if (numChunks == 1 || numThreads == 0)
+	{
+		for (unsigned int begin = 0; begin < size; begin += grainSize)
+			function(userData, begin, (size - begin > grainSize) ? begin + grainSize : size);
+		return;
+	}
+
+	nctl::SharedPtr<RangeState> state = nctl::makeShared<RangeState>(size, grainSize, numChunks, function, userData);
+	// The calling thread processes chunks as well
+	const unsigned int numCommands = (numChunks - 1 < numThreads) ? numChunks - 1 : numThreads;
+	for (unsigned int i = 0; i < numCommands; i++)
+		threadPool.enqueueCommand(nctl::makeUnique<RangeCommand>(state));
+
+	processChunks(*state);
+	while (static_cast<unsigned int>(state->completedChunks.load(nctl::Atomic32::MemoryModel::ACQUIRE)) < numChunks)
+	{
+#ifdef WITH_THREADS
+		Thread::yieldExecution();
+#endif
+	}
+}
+
+}
@@ -15,7 +15,7 @@ ServiceLocator &theServiceLocator()
 ServiceLocator::ServiceLocator()
     : indexerService_(&nullIndexer_), loggerService_(&nullLogger_),
       audioDevice_(&nullAudioDevice_), threadPool_(&nullThreadPool_),
-      gfxCapabilities_(&nullGfxCapabilities_)
+      asyncFileReader_(&nullAsyncFileReader_), gfxCapabilities_(&nullGfxCapabilities_)
 {
 }
 
@@ -71,6 +71,18 @@ void ServiceLocator::unregisterThreadPool()
 	threadPool_ = &nullThreadPool_;
 }
 
+void ServiceLocator::registerAsyncFileReader(nctl::UniquePtr<IAsyncFileReader> service)
+{
+	registeredAsyncFileReader_ = nctl::move(service);
+	asyncFileReader_ = registeredAsyncFileReader_.get();
+}
+
+void ServiceLocator::unregisterAsyncFileReader()
+{
+	registeredAsyncFileReader_.reset(nullptr);
+	asyncFileReader_ = &nullAsyncFileReader_;
+}
+
 void ServiceLocator::registerGfxCapabilities(nctl::UniquePtr<ncine::IGfxCapabilities> service)
 {
 	registeredGfxCapabilities_ = nctl::move(service);
@@ -96,6 +108,9 @@ void ServiceLocator::unregisterAll()
 	registeredThreadPool_.reset(nullptr);
 	threadPool_ = &nullThreadPool_;
 
+	registeredAsyncFileReader_.reset(nullptr);
+	asyncFileReader_ = &nullAsyncFileReader_;
+
 	registeredGfxCapabilities_.reset(nullptr);
 	gfxCapabilities_ = &nullGfxCapabilities_;
 
@@ -9,6 +9,10 @@
 	#include <io.h> // for _access()
 #endif
 
+#ifndef _WIN32
+	#include <sys/mman.h> // for mmap()
+#endif
+
 #include "common_macros.h"
 #include "StandardFile.h"
 
@@ -20,6 +24,7 @@ namespace ncine {
 
 StandardFile::~StandardFile()
 {
+	unmapFromMemory();
 	if (shouldCloseOnDestruction_)
 		close();
 }
@@ -49,6 +54,8 @@ void StandardFile::open(unsigned char mode)
 /*! This method will close a file both normally opened or fopened */
 void StandardFile::close()
 {
+	unmapFromMemory();
+
 	if (fileDescriptor_ >= 0)
 	{
 #if !(defined(_WIN32) && !defined(__MINGW32__))
@@ -143,6 +150,49 @@ unsigned long int StandardFile::write(void *buffer, unsigned long int bytes)
 	return bytesWritten;
 }
 
+const unsigned char *StandardFile::mapToMemory()
+{
+#ifndef _WIN32
+	if (mappedMemory_ == nullptr && fileSize_ > 0)
+	{
+		int fileDescriptor = fileDescriptor_;
+		if (fileDescriptor < 0 && filePointer_)
+			fileDescriptor = fileno(filePointer_);
+
+		if (fileDescriptor >= 0)
+		{
+			void *memory = mmap(nullptr, fileSize_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (memory != MAP_FAILED)
+			{
+				mappedMemory_ = static_cast<const unsigned char *>(memory);
+				return mappedMemory_;
+			}
+			else
+				LOGW_X("Cannot map the file \"%s\" to memory, falling back to a buffered read", filename_.data());
+		}
+	}
+#endif
+
+	return IFile::mapToMemory();
+}
+
+void StandardFile::unmapFromMemory()
+{
+#ifndef _WIN32
+	// The memory has been mapped by the operating system if there is no buffer
+	if (mappedMemory_ != nullptr && mappedBuffer_ == nullptr)
+	{
+		const int retValue = munmap(const_cast<unsigned char *>(mappedMemory_), fileSize_);
+		if (retValue < 0)
+			LOGW_X("Cannot unmap the file \"%s\" from memory", filename_.data());
+		mappedMemory_ = nullptr;
+		return;
+	}
+#endif
+
+	IFile::unmapFromMemory();
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
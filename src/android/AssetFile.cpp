@@ -58,6 +58,8 @@ void AssetFile::open(unsigned char mode)
 /*! This method will close a file both normally opened or fopened */
 void AssetFile::close()
 {
+	unmapFromMemory();
+
 	if (fileDescriptor_ >= 0)
 	{
 		const int retValue = ::close(fileDescriptor_);
@@ -148,6 +150,19 @@ bool AssetFile::isOpened() const
 		return false;
 }
 
+const unsigned char *AssetFile::mapToMemory()
+{
+	if (mappedMemory_ == nullptr && asset_)
+	{
+		// The buffer is owned by the asset and released when it is closed
+		mappedMemory_ = static_cast<const unsigned char *>(AAsset_getBuffer(asset_));
+		if (mappedMemory_ != nullptr)
+			return mappedMemory_;
+	}
+
+	return IFile::mapToMemory();
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -3,10 +3,34 @@
 #include "common_macros.h"
 #include "AudioBuffer.h"
 #include "IAudioLoader.h"
+#include "ServiceLocator.h"
 #include "tracy.h"
 
 namespace ncine {
 
+namespace {
+	struct AsyncLoadContext
+	{
+		AudioBuffer::AsyncLoadCallback callback;
+		void *userData;
+	};
+
+	void onAudioFileRead(IAsyncFileReader::Result &result)
+	{
+		nctl::UniquePtr<AsyncLoadContext> context(static_cast<AsyncLoadContext *>(result.userData));
+
+		nctl::UniquePtr<AudioBuffer> audioBuffer;
+		if (result.succeeded)
+			audioBuffer = nctl::makeUnique<AudioBuffer>(result.filename, result.data, result.bytesRead);
+		context->callback(nctl::move(audioBuffer), context->userData);
+	}
+
+	void releaseAsyncLoadContext(void *userData)
+	{
+		delete static_cast<AsyncLoadContext *>(userData);
+	}
+}
+
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS and DESTRUCTOR
 ///////////////////////////////////////////////////////////
@@ -37,16 +61,49 @@ AudioBuffer::AudioBuffer(const char *filename)
 	load(audioLoader.get());
 }
 
+AudioBuffer::AudioBuffer(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize)
+    : Object(ObjectType::AUDIOBUFFER, bufferName),
+      numChannels_(0), frequency_(0), bufferSize_(0)
+{
+	ZoneScoped;
+	ZoneText(bufferName, strnlen(bufferName, nctl::String::MaxCStringLength));
+
+	alGetError();
+	alGenBuffers(1, &bufferId_);
+	const ALenum error = alGetError();
+	ASSERT_MSG_X(error == AL_NO_ERROR, "alGenBuffers failed: %x", error);
+
+	nctl::UniquePtr<IAudioLoader> audioLoader = IAudioLoader::createFromMemory(bufferName, bufferPtr, bufferSize);
+	load(audioLoader.get());
+}
+
 AudioBuffer::~AudioBuffer()
 {
 	alDeleteBuffers(1, &bufferId_);
 }
 
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+unsigned int AudioBuffer::loadAsync(const char *filename, AsyncLoadCallback callback, void *userData)
+{
+	ASSERT(filename);
+	ASSERT(callback);
+
+	AsyncLoadContext *context = new AsyncLoadContext{ callback, userData };
+	const unsigned int requestId = theServiceLocator().asyncFileReader().submitFileRead(filename, onAudioFileRead, releaseAsyncLoadContext, context);
+	if (requestId == 0)
+		delete context;
+
+	return requestId;
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-void AudioBuffer::load(const IAudioLoader *audioLoader)
+void AudioBuffer::load(IAudioLoader *audioLoader)
 {
 	ASSERT(audioLoader);
 
@@ -58,11 +115,19 @@ void AudioBuffer::load(const IAudioLoader *audioLoader)
 
 	// Buffer size calculated as samples * channels * 16bit
 	bufferSize_ = audioLoader->bufferSize();
-	nctl::UniquePtr<char[]> buffer = nctl::makeUnique<char[]>(bufferSize_);
 
-	audioLoader->read(buffer.get(), bufferSize_);
-	// On iOS `alBufferDataStatic()` could be used instead
-	alBufferData(bufferId_, format, buffer.get(), bufferSize_, frequency_);
+	// Uploading samples directly from the file mapped to memory, if possible
+	const char *mappedSamples = audioLoader->mapSamples();
+	if (mappedSamples)
+		alBufferData(bufferId_, format, mappedSamples, bufferSize_, frequency_);
+	else
+	{
+		nctl::UniquePtr<char[]> buffer = nctl::makeUnique<char[]>(bufferSize_);
+
+		audioLoader->read(buffer.get(), bufferSize_);
+		// On iOS `alBufferDataStatic()` could be used instead
+		alBufferData(bufferId_, format, buffer.get(), bufferSize_, frequency_);
+	}
 }
 
 }
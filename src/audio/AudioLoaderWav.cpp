@@ -64,8 +64,26 @@ unsigned long int AudioLoaderWav::read(char *buffer, unsigned long int bufferSiz
 
 void AudioLoaderWav::rewind() const
 {
-	clearerr(fileHandle_->ptr());
+	if (fileHandle_->ptr())
+		clearerr(fileHandle_->ptr());
 	fileHandle_->seek(sizeof(WavHeader), SEEK_SET);
 }
 
+const char *AudioLoaderWav::mapSamples()
+{
+	const unsigned char *fileMemory = fileHandle_->mapToMemory();
+	if (fileMemory == nullptr)
+		return nullptr;
+
+	// Samples are stored uncompressed right after the header
+	if (static_cast<unsigned long int>(fileHandle_->size()) < sizeof(WavHeader) + bufferSize())
+	{
+		LOGW_X("\"%s\" is shorter than its header declares", fileHandle_->filename());
+		fileHandle_->unmapFromMemory();
+		return nullptr;
+	}
+
+	return reinterpret_cast<const char *>(fileMemory + sizeof(WavHeader));
+}
+
 }
@@ -0,0 +1,154 @@
+#include <cstdlib> // for malloc()
+#include "common_macros.h"
+#include <nctl/FreeListAllocator.h>
+
+namespace nctl {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+FreeListAllocator::FreeListAllocator(const char *name, size_t size)
+    : IAllocator(name, size), base_(static_cast<uint8_t *>(malloc(size))), freeList_(nullptr), ownsMemory_(true)
+{
+	FATAL_ASSERT(base_ != nullptr);
+	init();
+}
+
+FreeListAllocator::FreeListAllocator(const char *name, void *base, size_t size)
+    : IAllocator(name, size), base_(static_cast<uint8_t *>(base)), freeList_(nullptr), ownsMemory_(false)
+{
+	FATAL_ASSERT(base != nullptr);
+	init();
+}
+
+FreeListAllocator::~FreeListAllocator()
+{
+	if (numAllocations_ > 0)
+		LOGW_X("Allocator \"%s\" destroyed with %u block(s) still allocated", name_, numAllocations_);
+
+	if (ownsMemory_)
+		free(base_);
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+unsigned int FreeListAllocator::numFreeBlocks() const
+{
+	unsigned int count = 0;
+	for (const FreeBlock *block = freeList_; block != nullptr; block = block->next)
+		count++;
+	return count;
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void FreeListAllocator::init()
+{
+	// The region is shrunk so that every free block starts at an address suitable for a `FreeBlock`
+	const uintptr_t baseAddress = reinterpret_cast<uintptr_t>(base_);
+	const uintptr_t alignedBase = alignAddress(baseAddress, alignof(FreeBlock));
+	FATAL_ASSERT_MSG(size_ >= alignedBase - baseAddress + sizeof(FreeBlock), "The memory region is too small");
+	size_ -= alignedBase - baseAddress;
+	size_ -= size_ % alignof(FreeBlock);
+	base_ = reinterpret_cast<uint8_t *>(alignedBase);
+
+	freeList_ = reinterpret_cast<FreeBlock *>(base_);
+	freeList_->size = size_;
+	freeList_->next = nullptr;
+}
+
+void *FreeListAllocator::allocateImpl(size_t bytes, uint8_t alignment)
+{
+	if (alignment < alignof(Header))
+		alignment = alignof(Header);
+
+	FreeBlock *prevBlock = nullptr;
+	FreeBlock *block = freeList_;
+	while (block != nullptr)
+	{
+		const uintptr_t blockAddress = reinterpret_cast<uintptr_t>(block);
+		const uintptr_t alignedAddress = alignAddress(blockAddress + sizeof(Header), alignment);
+		const size_t adjustment = alignedAddress - blockAddress;
+		// The block size is rounded so that the remaining free block stays aligned
+		size_t totalSize = alignAddress(adjustment + bytes, alignof(FreeBlock));
+
+		if (block->size < totalSize)
+		{
+			prevBlock = block;
+			block = block->next;
+			continue;
+		}
+
+		FreeBlock *nextBlock = block->next;
+		// The remaining memory is too small to hold a free block and is given away with the allocation
+		if (block->size - totalSize < sizeof(FreeBlock))
+			totalSize = block->size;
+		else
+		{
+			FreeBlock *splitBlock = reinterpret_cast<FreeBlock *>(blockAddress + totalSize);
+			splitBlock->size = block->size - totalSize;
+			splitBlock->next = nextBlock;
+			nextBlock = splitBlock;
+		}
+
+		if (prevBlock)
+			prevBlock->next = nextBlock;
+		else
+			freeList_ = nextBlock;
+
+		Header *header = reinterpret_cast<Header *>(alignedAddress - sizeof(Header));
+		header->size = totalSize;
+		header->adjustment = adjustment;
+
+		usedMemory_ += totalSize;
+		return reinterpret_cast<void *>(alignedAddress);
+	}
+
+	LOGW_X("Allocator \"%s\" has no free block big enough for %lu bytes", name_, static_cast<unsigned long>(bytes));
+	return nullptr;
+}
+
+void FreeListAllocator::deallocateImpl(void *ptr)
+{
+	const Header *header = reinterpret_cast<const Header *>(static_cast<uint8_t *>(ptr) - sizeof(Header));
+	const size_t blockSize = header->size;
+	uint8_t *blockPtr = static_cast<uint8_t *>(ptr) - header->adjustment;
+	ASSERT(blockPtr >= base_ && blockPtr + blockSize <= base_ + size_);
+	usedMemory_ -= blockSize;
+
+	// Looking for the free blocks surrounding the released one
+	FreeBlock *prevBlock = nullptr;
+	FreeBlock *nextBlock = freeList_;
+	while (nextBlock != nullptr && reinterpret_cast<uint8_t *>(nextBlock) < blockPtr)
+	{
+		prevBlock = nextBlock;
+		nextBlock = nextBlock->next;
+	}
+
+	FreeBlock *block = reinterpret_cast<FreeBlock *>(blockPtr);
+	block->size = blockSize;
+	block->next = nextBlock;
+	if (prevBlock)
+		prevBlock->next = block;
+	else
+		freeList_ = block;
+
+	// Merging with the adjacent free blocks
+	if (nextBlock != nullptr && blockPtr + block->size == reinterpret_cast<uint8_t *>(nextBlock))
+	{
+		block->size += nextBlock->size;
+		block->next = nextBlock->next;
+	}
+	if (prevBlock != nullptr && reinterpret_cast<uint8_t *>(prevBlock) + prevBlock->size == blockPtr)
+	{
+		prevBlock->size += block->size;
+		prevBlock->next = block->next;
+	}
+}
+
+}
@@ -12,18 +12,15 @@ int32_t Atomic32::load(MemoryModel memModel)
 	switch (memModel)
 	{
 		case MemoryModel::RELAXED:
-			__atomic_load_n(&value_, __ATOMIC_RELAXED);
-			return value_;
+			return __atomic_load_n(&value_, __ATOMIC_RELAXED);
 		case MemoryModel::ACQUIRE:
-			__atomic_load_n(&value_, __ATOMIC_ACQUIRE);
-			return value_;
+			return __atomic_load_n(&value_, __ATOMIC_ACQUIRE);
 		case MemoryModel::RELEASE:
 			FATAL_MSG("Incompatible memory model");
 			return 0;
 		case MemoryModel::SEQ_CST:
 		default:
-			__atomic_load_n(&value_, __ATOMIC_SEQ_CST);
-			return value_;
+			return __atomic_load_n(&value_, __ATOMIC_SEQ_CST);
 	}
 }
 
@@ -104,18 +101,15 @@ int64_t Atomic64::load(MemoryModel memModel)
 	switch (memModel)
 	{
 		case MemoryModel::RELAXED:
-			__atomic_load_n(&value_, __ATOMIC_RELAXED);
-			return value_;
+			return __atomic_load_n(&value_, __ATOMIC_RELAXED);
 		case MemoryModel::ACQUIRE:
-			__atomic_load_n(&value_, __ATOMIC_ACQUIRE);
-			return value_;
+			return __atomic_load_n(&value_, __ATOMIC_ACQUIRE);
 		case MemoryModel::RELEASE:
 			FATAL_MSG("Incompatible memory model");
 			return 0;
 		case MemoryModel::SEQ_CST:
 		default:
-			__atomic_load_n(&value_, __ATOMIC_SEQ_CST);
-			return value_;
+			return __atomic_load_n(&value_, __ATOMIC_SEQ_CST);
 	}
 }
 
@@ -185,4 +179,77 @@ bool Atomic64::cmpExchange(int64_t newValue, int64_t cmpValue, MemoryModel memMo
 	}
 }
 
+///////////////////////////////////////////////////////////
+// AtomicPtr
+///////////////////////////////////////////////////////////
+
+void *AtomicPtr::load(MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return __atomic_load_n(&value_, __ATOMIC_RELAXED);
+		case MemoryModel::ACQUIRE:
+			return __atomic_load_n(&value_, __ATOMIC_ACQUIRE);
+		case MemoryModel::RELEASE:
+			FATAL_MSG("Incompatible memory model");
+			return nullptr;
+		case MemoryModel::SEQ_CST:
+		default:
+			return __atomic_load_n(&value_, __ATOMIC_SEQ_CST);
+	}
+}
+
+void AtomicPtr::store(void *value, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			__atomic_store_n(&value_, value, __ATOMIC_RELAXED);
+			break;
+		case MemoryModel::ACQUIRE:
+			FATAL_MSG("Incompatible memory model");
+			break;
+		case MemoryModel::RELEASE:
+			__atomic_store_n(&value_, value, __ATOMIC_RELEASE);
+			break;
+		case MemoryModel::SEQ_CST:
+		default:
+			__atomic_store_n(&value_, value, __ATOMIC_SEQ_CST);
+			break;
+	}
+}
+
+void *AtomicPtr::exchange(void *value, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return __atomic_exchange_n(&value_, value, __ATOMIC_RELAXED);
+		case MemoryModel::ACQUIRE:
+			return __atomic_exchange_n(&value_, value, __ATOMIC_ACQUIRE);
+		case MemoryModel::RELEASE:
+			return __atomic_exchange_n(&value_, value, __ATOMIC_RELEASE);
+		case MemoryModel::SEQ_CST:
+		default:
+			return __atomic_exchange_n(&value_, value, __ATOMIC_SEQ_CST);
+	}
+}
+
+bool AtomicPtr::cmpExchange(void *newValue, void *cmpValue, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return __atomic_compare_exchange_n(&value_, &cmpValue, newValue, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+		case MemoryModel::ACQUIRE:
+			return __atomic_compare_exchange_n(&value_, &cmpValue, newValue, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+		case MemoryModel::RELEASE:
+			return __atomic_compare_exchange_n(&value_, &cmpValue, newValue, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+		case MemoryModel::SEQ_CST:
+		default:
+			return __atomic_compare_exchange_n(&value_, &cmpValue, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+	}
+}
+
 }
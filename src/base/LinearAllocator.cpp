@@ -0,0 +1,62 @@
+#include <cstdlib> // for malloc()
+#include "common_macros.h"
+#include <nctl/LinearAllocator.h>
+
+namespace nctl {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+LinearAllocator::LinearAllocator(const char *name, size_t size)
+    : IAllocator(name, size), base_(static_cast<uint8_t *>(malloc(size))), offset_(0), ownsMemory_(true)
+{
+	FATAL_ASSERT_MSG(size > 0, "Zero is not a valid size");
+	FATAL_ASSERT(base_ != nullptr);
+}
+
+LinearAllocator::LinearAllocator(const char *name, void *base, size_t size)
+    : IAllocator(name, size), base_(static_cast<uint8_t *>(base)), offset_(0), ownsMemory_(false)
+{
+	FATAL_ASSERT(base != nullptr);
+	FATAL_ASSERT_MSG(size > 0, "Zero is not a valid size");
+}
+
+LinearAllocator::~LinearAllocator()
+{
+	if (ownsMemory_)
+		free(base_);
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void LinearAllocator::clear()
+{
+	offset_ = 0;
+	usedMemory_ = 0;
+	numAllocations_ = 0;
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void *LinearAllocator::allocateImpl(size_t bytes, uint8_t alignment)
+{
+	const uintptr_t baseAddress = reinterpret_cast<uintptr_t>(base_);
+	const uintptr_t alignedAddress = alignAddress(baseAddress + offset_, alignment);
+	const size_t newOffset = alignedAddress + bytes - baseAddress;
+	if (newOffset > size_)
+	{
+		LOGW_X("Allocator \"%s\" is out of memory, cannot allocate %lu bytes", name_, static_cast<unsigned long>(bytes));
+		return nullptr;
+	}
+
+	offset_ = newOffset;
+	usedMemory_ = offset_;
+	return reinterpret_cast<void *>(alignedAddress);
+}
+
+}
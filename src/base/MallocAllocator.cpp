@@ -0,0 +1,52 @@
+#include <cstdlib> // for malloc()
+#include "common_macros.h"
+#include <nctl/MallocAllocator.h>
+
+namespace nctl {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+MallocAllocator::MallocAllocator(const char *name)
+    : IAllocator(name, 0)
+{
+}
+
+MallocAllocator::~MallocAllocator()
+{
+	if (numAllocations_ > 0)
+		LOGW_X("Allocator \"%s\" destroyed with %u block(s) still allocated", name_, numAllocations_);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void *MallocAllocator::allocateImpl(size_t bytes, uint8_t alignment)
+{
+	if (alignment < alignof(Header))
+		alignment = alignof(Header);
+
+	const size_t totalBytes = bytes + sizeof(Header) + alignment - 1;
+	uint8_t *blockPtr = static_cast<uint8_t *>(malloc(totalBytes));
+	if (blockPtr == nullptr)
+		return nullptr;
+
+	const uintptr_t alignedAddress = alignAddress(reinterpret_cast<uintptr_t>(blockPtr) + sizeof(Header), alignment);
+	Header *header = reinterpret_cast<Header *>(alignedAddress - sizeof(Header));
+	header->size = totalBytes;
+	header->adjustment = alignedAddress - reinterpret_cast<uintptr_t>(blockPtr);
+
+	usedMemory_ += totalBytes;
+	return reinterpret_cast<void *>(alignedAddress);
+}
+
+void MallocAllocator::deallocateImpl(void *ptr)
+{
+	const Header *header = reinterpret_cast<const Header *>(static_cast<uint8_t *>(ptr) - sizeof(Header));
+	usedMemory_ -= header->size;
+	free(static_cast<uint8_t *>(ptr) - header->adjustment);
+}
+
+}
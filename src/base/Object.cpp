@@ -28,18 +28,27 @@ Object::~Object()
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-template <class T>
-T *Object::fromId(unsigned int id)
+void Object::setName(const nctl::String &name)
 {
-	const Object *object = theServiceLocator().indexer().object(id);
+	name_ = name;
+	theServiceLocator().indexer().updateObjectName(id_);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+Object *Object::objectFromId(unsigned int id, ObjectType type)
+{
+	Object *object = theServiceLocator().indexer().object(id);
 
 	if (object)
 	{
-		if (object->type_ == T::sType())
-			return static_cast<T *>(object);
+		if (object->type_ == type)
+			return object;
 		else // Cannot cast
 		{
-			LOGF_X("Object \"%s\" (%u) is of type %u instead of %u", object->name_, id, object->type_, T::sType());
+			LOGF_X("Object \"%s\" (%u) is of type %u instead of %u", object->name_.data(), id, static_cast<unsigned int>(object->type_), static_cast<unsigned int>(type));
 			return nullptr;
 		}
 	}
@@ -50,4 +59,23 @@ T *Object::fromId(unsigned int id)
 	}
 }
 
+/*! Objects of a different type with the same name are skipped, unless the requested type is `ObjectType::BASE`. */
+Object *Object::objectFromName(const nctl::StringView &name, nctl::hash_t hash, ObjectType type)
+{
+	Object *object = theServiceLocator().indexer().firstWithName(name, hash);
+	while (object && type != ObjectType::BASE && object->type_ != type)
+		object = theServiceLocator().indexer().nextWithName(object);
+
+	return object;
+}
+
+Object *Object::nextObjectWithName(const Object *object, ObjectType type)
+{
+	Object *nextObject = theServiceLocator().indexer().nextWithName(object);
+	while (nextObject && type != ObjectType::BASE && nextObject->type_ != type)
+		nextObject = theServiceLocator().indexer().nextWithName(nextObject);
+
+	return nextObject;
+}
+
 }
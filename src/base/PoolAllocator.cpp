@@ -0,0 +1,86 @@
+#include <cstdlib> // for malloc()
+#include "common_macros.h"
+#include <nctl/PoolAllocator.h>
+
+namespace nctl {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+PoolAllocator::PoolAllocator(const char *name, size_t blockSize, unsigned int numBlocks)
+    : PoolAllocator(name, blockSize, numBlocks, DefaultAlignment)
+{
+}
+
+PoolAllocator::PoolAllocator(const char *name, size_t blockSize, unsigned int numBlocks, uint8_t alignment)
+    : IAllocator(name, 0), memory_(nullptr), base_(nullptr), blockSize_(0),
+      numBlocks_(numBlocks), alignment_(alignment), freeList_(nullptr)
+{
+	FATAL_ASSERT_MSG(blockSize > 0, "Zero is not a valid block size");
+	FATAL_ASSERT_MSG(numBlocks > 0, "Zero is not a valid number of blocks");
+
+	if (alignment_ < alignof(FreeBlock))
+		alignment_ = alignof(FreeBlock);
+	if (blockSize < sizeof(FreeBlock))
+		blockSize = sizeof(FreeBlock);
+	// Every block starts at an aligned address
+	blockSize_ = alignAddress(blockSize, alignment_);
+	size_ = blockSize_ * numBlocks_;
+
+	memory_ = static_cast<uint8_t *>(malloc(size_ + alignment_ - 1));
+	FATAL_ASSERT(memory_ != nullptr);
+	base_ = reinterpret_cast<uint8_t *>(alignAddress(reinterpret_cast<uintptr_t>(memory_), alignment_));
+
+	for (unsigned int i = 0; i < numBlocks_; i++)
+	{
+		FreeBlock *block = reinterpret_cast<FreeBlock *>(base_ + i * blockSize_);
+		block->next = (i < numBlocks_ - 1) ? reinterpret_cast<FreeBlock *>(base_ + (i + 1) * blockSize_) : nullptr;
+	}
+	freeList_ = reinterpret_cast<FreeBlock *>(base_);
+}
+
+PoolAllocator::~PoolAllocator()
+{
+	if (numAllocations_ > 0)
+		LOGW_X("Allocator \"%s\" destroyed with %u block(s) still allocated", name_, numAllocations_);
+
+	free(memory_);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void *PoolAllocator::allocateImpl(size_t bytes, uint8_t alignment)
+{
+	FATAL_ASSERT_MSG_X(bytes <= blockSize_, "Allocator \"%s\" has blocks of %lu bytes, cannot allocate %lu bytes",
+	                   name_, static_cast<unsigned long>(blockSize_), static_cast<unsigned long>(bytes));
+	FATAL_ASSERT_MSG_X(alignment <= alignment_, "Allocator \"%s\" has blocks aligned to %u bytes, cannot align to %u bytes",
+	                   name_, alignment_, alignment);
+
+	if (freeList_ == nullptr)
+	{
+		LOGW_X("Allocator \"%s\" is out of blocks", name_);
+		return nullptr;
+	}
+
+	FreeBlock *block = freeList_;
+	freeList_ = block->next;
+	usedMemory_ += blockSize_;
+
+	return block;
+}
+
+void PoolAllocator::deallocateImpl(void *ptr)
+{
+	ASSERT(static_cast<uint8_t *>(ptr) >= base_ && static_cast<uint8_t *>(ptr) < base_ + size_);
+	ASSERT((static_cast<uint8_t *>(ptr) - base_) % blockSize_ == 0);
+
+	FreeBlock *block = static_cast<FreeBlock *>(ptr);
+	block->next = freeList_;
+	freeList_ = block;
+	usedMemory_ -= blockSize_;
+}
+
+}
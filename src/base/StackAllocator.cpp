@@ -0,0 +1,84 @@
+#include <cstdlib> // for malloc()
+#include "common_macros.h"
+#include <nctl/StackAllocator.h>
+
+namespace nctl {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+StackAllocator::StackAllocator(const char *name, size_t size)
+    : IAllocator(name, size), base_(static_cast<uint8_t *>(malloc(size))), offset_(0), lastBlock_(nullptr), ownsMemory_(true)
+{
+	FATAL_ASSERT_MSG(size > 0, "Zero is not a valid size");
+	FATAL_ASSERT(base_ != nullptr);
+}
+
+StackAllocator::StackAllocator(const char *name, void *base, size_t size)
+    : IAllocator(name, size), base_(static_cast<uint8_t *>(base)), offset_(0), lastBlock_(nullptr), ownsMemory_(false)
+{
+	FATAL_ASSERT(base != nullptr);
+	FATAL_ASSERT_MSG(size > 0, "Zero is not a valid size");
+}
+
+StackAllocator::~StackAllocator()
+{
+	if (numAllocations_ > 0)
+		LOGW_X("Allocator \"%s\" destroyed with %u block(s) still allocated", name_, numAllocations_);
+
+	if (ownsMemory_)
+		free(base_);
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void StackAllocator::clear()
+{
+	offset_ = 0;
+	lastBlock_ = nullptr;
+	usedMemory_ = 0;
+	numAllocations_ = 0;
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void *StackAllocator::allocateImpl(size_t bytes, uint8_t alignment)
+{
+	if (alignment < alignof(Header))
+		alignment = alignof(Header);
+
+	const uintptr_t baseAddress = reinterpret_cast<uintptr_t>(base_);
+	const uintptr_t alignedAddress = alignAddress(baseAddress + offset_ + sizeof(Header), alignment);
+	const size_t newOffset = alignedAddress + bytes - baseAddress;
+	if (newOffset > size_)
+	{
+		LOGW_X("Allocator \"%s\" is out of memory, cannot allocate %lu bytes", name_, static_cast<unsigned long>(bytes));
+		return nullptr;
+	}
+
+	Header *header = reinterpret_cast<Header *>(alignedAddress - sizeof(Header));
+	header->previousOffset = offset_;
+	header->previousBlock = lastBlock_;
+
+	offset_ = newOffset;
+	lastBlock_ = reinterpret_cast<uint8_t *>(alignedAddress);
+	usedMemory_ = offset_;
+	return reinterpret_cast<void *>(alignedAddress);
+}
+
+void StackAllocator::deallocateImpl(void *ptr)
+{
+	const Header *header = reinterpret_cast<const Header *>(static_cast<uint8_t *>(ptr) - sizeof(Header));
+	FATAL_ASSERT_MSG_X(ptr == lastBlock_, "Allocator \"%s\" can only release the last allocated block", name_);
+
+	offset_ = header->previousOffset;
+	lastBlock_ = header->previousBlock;
+	usedMemory_ = offset_;
+}
+
+}
@@ -179,4 +179,77 @@ bool Atomic64::cmpExchange(int64_t newValue, int64_t cmpValue, MemoryModel memMo
 	}
 }
 
+///////////////////////////////////////////////////////////
+// AtomicPtr
+///////////////////////////////////////////////////////////
+
+void *AtomicPtr::load(MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return std::atomic_load_explicit(&value_, std::memory_order_relaxed);
+		case MemoryModel::RELEASE:
+			FATAL_MSG("Incompatible memory model");
+			return nullptr;
+		case MemoryModel::ACQUIRE:
+			return std::atomic_load_explicit(&value_, std::memory_order_acquire);
+		case MemoryModel::SEQ_CST:
+		default:
+			return std::atomic_load_explicit(&value_, std::memory_order_seq_cst);
+	}
+}
+
+void AtomicPtr::store(void *value, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			std::atomic_store_explicit(&value_, value, std::memory_order_relaxed);
+			break;
+		case MemoryModel::ACQUIRE:
+			FATAL_MSG("Incompatible memory model");
+			break;
+		case MemoryModel::RELEASE:
+			std::atomic_store_explicit(&value_, value, std::memory_order_release);
+			break;
+		case MemoryModel::SEQ_CST:
+		default:
+			std::atomic_store_explicit(&value_, value, std::memory_order_seq_cst);
+			break;
+	}
+}
+
+void *AtomicPtr::exchange(void *value, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return std::atomic_exchange_explicit(&value_, value, std::memory_order_relaxed);
+		case MemoryModel::ACQUIRE:
+			return std::atomic_exchange_explicit(&value_, value, std::memory_order_acquire);
+		case MemoryModel::RELEASE:
+			return std::atomic_exchange_explicit(&value_, value, std::memory_order_release);
+		case MemoryModel::SEQ_CST:
+		default:
+			return std::atomic_exchange_explicit(&value_, value, std::memory_order_seq_cst);
+	}
+}
+
+bool AtomicPtr::cmpExchange(void *newValue, void *cmpValue, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return std::atomic_compare_exchange_strong_explicit(&value_, &cmpValue, newValue, std::memory_order_relaxed, std::memory_order_relaxed);
+		case MemoryModel::ACQUIRE:
+			return std::atomic_compare_exchange_strong_explicit(&value_, &cmpValue, newValue, std::memory_order_acquire, std::memory_order_relaxed);
+		case MemoryModel::RELEASE:
+			return std::atomic_compare_exchange_strong_explicit(&value_, &cmpValue, newValue, std::memory_order_release, std::memory_order_relaxed);
+		case MemoryModel::SEQ_CST:
+		default:
+			return std::atomic_compare_exchange_strong_explicit(&value_, &cmpValue, newValue, std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+}
+
 }
@@ -43,13 +43,65 @@ namespace {
 ///////////////////////////////////////////////////////////
 
 String::String()
-    : length_(0), capacity_(SmallBufferSize)
+    : length_(0), capacity_(SmallBufferSize), allocator_(nullptr), hash_(static_cast<int32_t>(NullHash))
 {
 	array_.local_[0] = '\0';
 }
 
 String::String(unsigned int capacity)
-    : length_(0), capacity_(capacity)
+    : String(capacity, static_cast<IAllocator *>(nullptr))
+{
+}
+
+String::String(unsigned int capacity, IAllocator &alloc)
+    : String(capacity, &alloc)
+{
+}
+
+String::String(const char *cString)
+    : String(cString, static_cast<IAllocator *>(nullptr))
+{
+}
+
+String::String(const char *cString, IAllocator &alloc)
+    : String(cString, &alloc)
+{
+}
+
+String::String(const StringView &view)
+    : String(view, static_cast<IAllocator *>(nullptr))
+{
+}
+
+String::String(const StringView &view, IAllocator &alloc)
+    : String(view, &alloc)
+{
+}
+
+String::~String()
+{
+	if (capacity_ > SmallBufferSize)
+		nctl::deleteArray(allocator_, array_.begin_);
+}
+
+String::String(const String &other)
+    : String(other, static_cast<IAllocator *>(nullptr))
+{
+}
+
+String::String(const String &other, IAllocator &alloc)
+    : String(other, &alloc)
+{
+}
+
+String::String(String &&other)
+    : length_(0), capacity_(0), allocator_(nullptr), hash_(static_cast<int32_t>(NullHash))
+{
+	swap(*this, other);
+}
+
+String::String(unsigned int capacity, IAllocator *alloc)
+    : length_(0), capacity_(capacity), allocator_(alloc), hash_(static_cast<int32_t>(NullHash))
 {
 	FATAL_ASSERT_MSG(capacity > 0, "Zero is not a valid capacity");
 
@@ -58,13 +110,13 @@ String::String(unsigned int capacity)
 		capacity_ = SmallBufferSize;
 	else
 	{
-		array_.begin_ = new char[capacity_];
+		array_.begin_ = nctl::newArray<char>(allocator_, capacity_);
 		array_.begin_[0] = '\0';
 	}
 }
 
-String::String(const char *cString)
-    : length_(0), capacity_(0)
+String::String(const char *cString, IAllocator *alloc)
+    : length_(0), capacity_(0), allocator_(alloc), hash_(static_cast<int32_t>(NullHash))
 {
 	ASSERT(cString);
 
@@ -76,7 +128,7 @@ String::String(const char *cString)
 		capacity_ = SmallBufferSize;
 	else
 	{
-		array_.begin_ = new char[capacity_];
+		array_.begin_ = nctl::newArray<char>(allocator_, capacity_);
 		dest = array_.begin_;
 	}
 
@@ -84,20 +136,31 @@ String::String(const char *cString)
 	dest[length_] = '\0';
 }
 
-String::~String()
+String::String(const StringView &view, IAllocator *alloc)
+    : length_(view.length()), capacity_(view.length() + 1), allocator_(alloc), hash_(static_cast<int32_t>(NullHash))
 {
-	if (capacity_ > SmallBufferSize)
-		delete[] array_.begin_;
+	char *dest = array_.local_;
+	if (capacity_ <= SmallBufferSize)
+		capacity_ = SmallBufferSize;
+	else
+	{
+		array_.begin_ = nctl::newArray<char>(allocator_, capacity_);
+		dest = array_.begin_;
+	}
+
+	if (length_ > 0)
+		memcpy(dest, view.data(), length_);
+	dest[length_] = '\0';
 }
 
-String::String(const String &other)
-    : length_(other.length_), capacity_(other.capacity_)
+String::String(const String &other, IAllocator *alloc)
+    : length_(other.length_), capacity_(other.capacity_), allocator_(alloc), hash_(other.hash_.load(Atomic32::MemoryModel::RELAXED))
 {
 	const char *src = other.array_.local_;
 	char *dest = array_.local_;
 	if (capacity_ > SmallBufferSize)
 	{
-		array_.begin_ = new char[capacity_];
+		array_.begin_ = nctl::newArray<char>(allocator_, capacity_);
 		src = other.array_.begin_;
 		dest = array_.begin_;
 	}
@@ -106,12 +169,6 @@ String::String(const String &other)
 	dest[length_] = '\0';
 }
 
-String::String(String &&other)
-    : length_(0), capacity_(0)
-{
-	swap(*this, other);
-}
-
 ///////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -147,10 +204,23 @@ String &String::operator=(const char *cString)
 	return *this;
 }
 
+/*! \note The view characters are truncated to the string capacity. */
+String &String::operator=(const StringView &view)
+{
+	length_ = min(view.length(), capacity_ - 1);
+	// The view might be pointing to the characters of this string
+	if (length_ > 0)
+		memmove(data(), view.data(), length_);
+
+	data()[length_] = '\0';
+	return *this;
+}
+
 /*! The method is useful to update the string length after writing into it through the `data()` pointer. */
 unsigned int String::setLength(unsigned int length)
 {
 	length_ = (length > capacity_ - 1) ? capacity_ - 1 : length;
+	invalidateHash();
 	return length_;
 }
 
@@ -329,7 +399,8 @@ String &String::format(const char *fmt, ...)
 
 	if (formattedLength > 0)
 	{
-		length_ = nctl::min(capacity_, static_cast<unsigned int>(formattedLength));
+		// A truncated string still needs room for the termination character
+		length_ = nctl::min(capacity_ - 1, static_cast<unsigned int>(formattedLength));
 		data()[length_] = '\0';
 	}
 
@@ -347,7 +418,7 @@ String &String::formatAppend(const char *fmt, ...)
 
 	if (formattedLength > 0)
 	{
-		length_ += min(capacity_ - length_, static_cast<unsigned int>(formattedLength));
+		length_ += min(capacity_ - length_ - 1, static_cast<unsigned int>(formattedLength));
 		data()[length_] = '\0';
 	}
 
@@ -379,6 +450,19 @@ String &String::operator+=(const char *cString)
 	return *this;
 }
 
+String &String::operator+=(const StringView &view)
+{
+	const unsigned int availCapacity = capacity_ - length_ - 1;
+	const unsigned int minLength = min(view.length(), availCapacity);
+
+	if (minLength > 0)
+		memmove(data() + length_, view.data(), minLength);
+	length_ += minLength;
+
+	data()[length_] = '\0';
+	return *this;
+}
+
 String String::operator+(const String &other) const
 {
 	const unsigned int sumLength = length_ + other.length_ + 1;
@@ -0,0 +1,229 @@
+#include <cstring>
+#include "common_macros.h"
+#include <nctl/StringId.h>
+#include <nctl/Array.h>
+#include <nctl/UniquePtr.h>
+
+namespace nctl {
+
+/// The global open addressing table of interned strings
+class InternTable
+{
+  public:
+	using Entry = StringId::Entry;
+
+	InternTable();
+	~InternTable();
+
+	static InternTable &instance();
+
+	inline const Entry *emptyEntry() const { return &emptyEntry_; }
+	inline unsigned int size() const { return size_; }
+	inline unsigned long int allocatedBytes() const { return allocatedBytes_; }
+
+	const Entry *find(const StringView &view, hash_t hash) const;
+	const Entry *intern(const StringView &view, hash_t hash);
+
+  private:
+	static const unsigned int InitialNumSlots = 256;
+	static const unsigned int ChunkSize = 16 * 1024;
+
+	Entry emptyEntry_;
+	unsigned int size_;
+	unsigned int numSlots_;
+	UniquePtr<const Entry *[]> slots_;
+
+	/// Memory chunks storing entries and characters
+	Array<uint8_t *> chunks_;
+	/// The chunk where new entries are allocated from
+	uint8_t *currentChunk_;
+	unsigned int chunkOffset_;
+	unsigned long int allocatedBytes_;
+
+	unsigned int findSlot(const StringView &view, hash_t hash) const;
+	void *allocate(unsigned int bytes);
+	void grow();
+
+	/// Deleted copy constructor
+	InternTable(const InternTable &) = delete;
+	/// Deleted assignment operator
+	InternTable &operator=(const InternTable &) = delete;
+};
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+InternTable::InternTable()
+    : size_(0), numSlots_(InitialNumSlots), slots_(makeUnique<const Entry *[]>(InitialNumSlots)),
+      chunks_(4), currentChunk_(nullptr), chunkOffset_(0), allocatedBytes_(0)
+{
+	emptyEntry_.hash = stringHash("", 0);
+	emptyEntry_.length = 0;
+	emptyEntry_.chars = "";
+}
+
+InternTable::~InternTable()
+{
+	for (uint8_t *chunk : chunks_)
+		delete[] chunk;
+}
+
+StringId::StringId()
+    : entry_(InternTable::instance().emptyEntry())
+{
+}
+
+StringId::StringId(const char *cString)
+    : StringId(StringView(cString))
+{
+}
+
+StringId::StringId(const StringView &view)
+    : StringId(view, view.hash())
+{
+}
+
+StringId::StringId(const StringView &view, hash_t hash)
+    : entry_(InternTable::instance().intern(view, hash))
+{
+	ASSERT(hash == view.hash());
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+/*! The table is created on first use, so that identifiers can be safely defined as static objects. */
+InternTable &InternTable::instance()
+{
+	static InternTable table;
+	return table;
+}
+
+const InternTable::Entry *InternTable::find(const StringView &view, hash_t hash) const
+{
+	if (view.isEmpty())
+		return &emptyEntry_;
+
+	return slots_[findSlot(view, hash)];
+}
+
+const InternTable::Entry *InternTable::intern(const StringView &view, hash_t hash)
+{
+	if (view.isEmpty())
+		return &emptyEntry_;
+
+	unsigned int slotIndex = findSlot(view, hash);
+	if (slots_[slotIndex] != nullptr)
+		return slots_[slotIndex];
+
+	// Keeping the load factor under one half to have short probing sequences
+	if ((size_ + 1) * 2 > numSlots_)
+	{
+		grow();
+		slotIndex = findSlot(view, hash);
+	}
+
+	Entry *entry = static_cast<Entry *>(allocate(sizeof(Entry)));
+	char *chars = static_cast<char *>(allocate(view.length() + 1));
+	memcpy(chars, view.data(), view.length());
+	chars[view.length()] = '\0';
+
+	entry->hash = hash;
+	entry->length = view.length();
+	entry->chars = chars;
+
+	slots_[slotIndex] = entry;
+	size_++;
+	return entry;
+}
+
+bool StringId::find(const StringView &view, StringId &stringId)
+{
+	const InternTable::Entry *entry = InternTable::instance().find(view, view.hash());
+	if (entry)
+		stringId = StringId(entry);
+
+	return (entry != nullptr);
+}
+
+unsigned int StringId::numInterned()
+{
+	return InternTable::instance().size();
+}
+
+unsigned long int StringId::internedBytes()
+{
+	return InternTable::instance().allocatedBytes();
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+/*! \return The index of the slot holding the entry or of the empty slot where it should be inserted */
+unsigned int InternTable::findSlot(const StringView &view, hash_t hash) const
+{
+	unsigned int index = hash & (numSlots_ - 1);
+	while (slots_[index] != nullptr)
+	{
+		const Entry *entry = slots_[index];
+		if (entry->hash == hash && StringView(entry->chars, entry->length) == view)
+			break;
+		index = (index + 1) & (numSlots_ - 1);
+	}
+
+	return index;
+}
+
+void *InternTable::allocate(unsigned int bytes)
+{
+	// Keeping every allocation aligned for the next entry
+	const unsigned int alignment = alignof(Entry);
+	bytes = (bytes + alignment - 1) & ~(alignment - 1);
+
+	if (bytes > ChunkSize)
+	{
+		// Strings bigger than a chunk have a dedicated one and the current chunk is not abandoned
+		uint8_t *bigChunk = new uint8_t[bytes];
+		chunks_.pushBack(bigChunk);
+		allocatedBytes_ += bytes;
+		return bigChunk;
+	}
+
+	if (currentChunk_ == nullptr || chunkOffset_ + bytes > ChunkSize)
+	{
+		currentChunk_ = new uint8_t[ChunkSize];
+		chunks_.pushBack(currentChunk_);
+		chunkOffset_ = 0;
+		allocatedBytes_ += ChunkSize;
+	}
+
+	void *ptr = currentChunk_ + chunkOffset_;
+	chunkOffset_ += bytes;
+	return ptr;
+}
+
+void InternTable::grow()
+{
+	const unsigned int newNumSlots = numSlots_ * 2;
+	UniquePtr<const Entry *[]> newSlots = makeUnique<const Entry *[]>(newNumSlots);
+
+	for (unsigned int i = 0; i < numSlots_; i++)
+	{
+		const Entry *entry = slots_[i];
+		if (entry == nullptr)
+			continue;
+
+		unsigned int index = entry->hash & (newNumSlots - 1);
+		while (newSlots[index] != nullptr)
+			index = (index + 1) & (newNumSlots - 1);
+		newSlots[index] = entry;
+	}
+
+	slots_ = nctl::move(newSlots);
+	numSlots_ = newNumSlots;
+}
+
+}
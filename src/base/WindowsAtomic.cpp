@@ -183,4 +183,76 @@ bool Atomic64::cmpExchange(int64_t newValue, int64_t cmpValue, MemoryModel memMo
 	}
 }
 
+///////////////////////////////////////////////////////////
+// AtomicPtr
+///////////////////////////////////////////////////////////
+
+void *AtomicPtr::load(MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return ReadPointerNoFence(reinterpret_cast<PVOID volatile *>(&value_));
+		case MemoryModel::ACQUIRE:
+			return ReadPointerAcquire(reinterpret_cast<PVOID volatile *>(&value_));
+		case MemoryModel::RELEASE:
+			FATAL_MSG("Incompatible memory model");
+			return nullptr;
+		case MemoryModel::SEQ_CST:
+		default:
+			return ReadPointerAcquire(reinterpret_cast<PVOID volatile *>(&value_));
+	}
+}
+
+void AtomicPtr::store(void *value, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			WritePointerNoFence(reinterpret_cast<PVOID volatile *>(&value_), value);
+			break;
+		case MemoryModel::ACQUIRE:
+			FATAL_MSG("Incompatible memory model");
+			break;
+		case MemoryModel::RELEASE:
+			WritePointerRelease(reinterpret_cast<PVOID volatile *>(&value_), value);
+			break;
+		case MemoryModel::SEQ_CST:
+		default:
+			InterlockedExchangePointer(reinterpret_cast<PVOID volatile *>(&value_), value);
+			break;
+	}
+}
+
+void *AtomicPtr::exchange(void *value, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return InterlockedExchangePointerNoFence(reinterpret_cast<PVOID volatile *>(&value_), value);
+		case MemoryModel::ACQUIRE:
+			return InterlockedExchangePointerAcquire(reinterpret_cast<PVOID volatile *>(&value_), value);
+		case MemoryModel::RELEASE:
+		case MemoryModel::SEQ_CST:
+		default:
+			return InterlockedExchangePointer(reinterpret_cast<PVOID volatile *>(&value_), value);
+	}
+}
+
+bool AtomicPtr::cmpExchange(void *newValue, void *cmpValue, MemoryModel memModel)
+{
+	switch (memModel)
+	{
+		case MemoryModel::RELAXED:
+			return InterlockedCompareExchangePointerNoFence(reinterpret_cast<PVOID volatile *>(&value_), newValue, cmpValue) == cmpValue;
+		case MemoryModel::ACQUIRE:
+			return InterlockedCompareExchangePointerAcquire(reinterpret_cast<PVOID volatile *>(&value_), newValue, cmpValue) == cmpValue;
+		case MemoryModel::RELEASE:
+			return InterlockedCompareExchangePointerRelease(reinterpret_cast<PVOID volatile *>(&value_), newValue, cmpValue) == cmpValue;
+		case MemoryModel::SEQ_CST:
+		default:
+			return InterlockedCompareExchangePointer(reinterpret_cast<PVOID volatile *>(&value_), newValue, cmpValue) == cmpValue;
+	}
+}
+
 }
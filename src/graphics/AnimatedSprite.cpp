@@ -17,7 +17,7 @@ AnimatedSprite::AnimatedSprite(Texture *texture)
 }
 
 AnimatedSprite::AnimatedSprite(SceneNode *parent, Texture *texture, float xx, float yy)
-    : Sprite(parent, texture, xx, yy), anims_(4), currentAnimIndex_(0)
+    : Sprite(parent, texture, xx, yy), currentAnimIndex_(0)
 {
 }
 
@@ -1,5 +1,6 @@
 #include "BaseSprite.h"
 #include "RenderCommand.h"
+#include "UniformNames.h"
 
 namespace ncine {
 
@@ -63,7 +64,7 @@ void BaseSprite::updateRenderCommand()
 	renderCommand_->transformation() = worldMatrix_;
 	renderCommand_->material().setTexture(*texture_);
 
-	spriteBlock_->uniform("color")->setFloatVector(Colorf(absColor()).data());
+	spriteBlock_->uniform(UniformNames::Color)->setFloatVector(Colorf(absColor()).data());
 	const bool isTransparent = absColor().a() < 255 || texture()->numChannels() == 1 ||
 	                           (texture()->numChannels() == 4 && opaqueTexture_ == false);
 	renderCommand_->material().setTransparent(isTransparent);
@@ -74,8 +75,8 @@ void BaseSprite::updateRenderCommand()
 	const float texScaleY = texRect_.h / float(texSize.y);
 	const float texBiasY = texRect_.y / float(texSize.y);
 
-	spriteBlock_->uniform("texRect")->setFloatValue(texScaleX, texBiasX, texScaleY, texBiasY);
-	spriteBlock_->uniform("spriteSize")->setFloatValue(width_, height_);
+	spriteBlock_->uniform(UniformNames::TexRect)->setFloatValue(texScaleX, texBiasX, texScaleY, texBiasY);
+	spriteBlock_->uniform(UniformNames::SpriteSize)->setFloatValue(width_, height_);
 }
 
 }
@@ -52,6 +52,25 @@ void Geometry::createCustomVbo(unsigned int numFloats, GLenum usage)
 	RenderStatistics::addCustomVbo(vbo_->size());
 }
 
+/*! The buffer grows to at least twice its size, otherwise it is orphaned before being written. */
+void Geometry::updateCustomVbo(const GLfloat *vertices, unsigned int numFloats)
+{
+	ASSERT(vbo_ != nullptr);
+
+	const GLsizeiptr size = static_cast<GLsizeiptr>(numFloats * sizeof(GLfloat));
+	if (size > vbo_->size())
+	{
+		const unsigned int capacity = static_cast<unsigned int>(vbo_->size() * 2 / sizeof(GLfloat));
+		RenderStatistics::removeCustomVbo(vbo_->size());
+		createCustomVbo(numFloats > capacity ? numFloats : capacity, vboUsageFlags_);
+	}
+	else
+		vbo_->bufferData(vbo_->size(), nullptr, vboUsageFlags_);
+
+	if (size > 0)
+		vbo_->bufferSubData(0, size, vertices);
+}
+
 GLfloat *Geometry::acquireVertexPointer(unsigned int numFloats, unsigned int numFloatsAlignment)
 {
 	ASSERT(vbo_ == nullptr);
@@ -119,6 +138,25 @@ void Geometry::createCustomIbo(unsigned int numIndices, GLenum usage)
 	RenderStatistics::addCustomIbo(ibo_->size());
 }
 
+/*! The buffer grows to at least twice its size, otherwise it is orphaned before being written. */
+void Geometry::updateCustomIbo(const GLushort *indices, unsigned int numIndices)
+{
+	ASSERT(ibo_ != nullptr);
+
+	const GLsizeiptr size = static_cast<GLsizeiptr>(numIndices * sizeof(GLushort));
+	if (size > ibo_->size())
+	{
+		const unsigned int capacity = static_cast<unsigned int>(ibo_->size() * 2 / sizeof(GLushort));
+		RenderStatistics::removeCustomIbo(ibo_->size());
+		createCustomIbo(numIndices > capacity ? numIndices : capacity, iboUsageFlags_);
+	}
+	else
+		ibo_->bufferData(ibo_->size(), nullptr, iboUsageFlags_);
+
+	if (size > 0)
+		ibo_->bufferSubData(0, size, indices);
+}
+
 GLushort *Geometry::acquireIndexPointer(unsigned int numIndices)
 {
 	ASSERT(ibo_ == nullptr);
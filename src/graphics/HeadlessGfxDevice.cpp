@@ -0,0 +1,190 @@
+#ifdef WITH_GLEW
+	#define GLEW_NO_GLU
+	#include <GL/glew.h>
+#endif
+
+#include <cstring>
+#include "common_macros.h"
+#include "HeadlessGfxDevice.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+HeadlessGfxDevice::HeadlessGfxDevice(const WindowMode &windowMode, const GLContextInfo &glContextInfo, const DisplayMode &displayMode)
+    : IGfxDevice(WindowMode(windowMode.width, windowMode.height, false, false), glContextInfo, displayMode),
+      display_(EGL_NO_DISPLAY), surface_(EGL_NO_SURFACE), context_(EGL_NO_CONTEXT), config_(nullptr)
+{
+	initGraphics();
+	initDevice();
+}
+
+HeadlessGfxDevice::~HeadlessGfxDevice()
+{
+	if (display_ != EGL_NO_DISPLAY)
+	{
+		eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+		if (context_ != EGL_NO_CONTEXT)
+			eglDestroyContext(display_, context_);
+
+		if (surface_ != EGL_NO_SURFACE)
+			eglDestroySurface(display_, surface_);
+
+		eglTerminate(display_);
+	}
+
+	display_ = EGL_NO_DISPLAY;
+	context_ = EGL_NO_CONTEXT;
+	surface_ = EGL_NO_SURFACE;
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void HeadlessGfxDevice::setResolution(int width, int height)
+{
+	if (width == 0 || height == 0)
+	{
+		width = DefaultWidth;
+		height = DefaultHeight;
+	}
+
+	// change resolution only in the case it really changes
+	if (width == width_ && height == height_)
+		return;
+
+	width_ = width;
+	height_ = height;
+	currentVideoMode_.width = static_cast<unsigned int>(width_);
+	currentVideoMode_.height = static_cast<unsigned int>(height_);
+	videoModes_[0] = currentVideoMode_;
+
+	// A pixel buffer surface cannot be resized, a new one is created
+	eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	eglDestroySurface(display_, surface_);
+	createSurface();
+	setViewport(width_, height_);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void HeadlessGfxDevice::initGraphics()
+{
+	// The surfaceless platform does not need a running display server
+	const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	if (clientExtensions != nullptr && strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != nullptr)
+	{
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+		    reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+		if (getPlatformDisplay != nullptr)
+			display_ = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+	}
+
+	if (display_ == EGL_NO_DISPLAY)
+		display_ = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	FATAL_ASSERT_MSG(display_ != EGL_NO_DISPLAY, "eglGetDisplay() returned EGL_NO_DISPLAY");
+
+	EGLint majorVersion, minorVersion;
+	const EGLBoolean ret = eglInitialize(display_, &majorVersion, &minorVersion);
+	FATAL_ASSERT_MSG_X(ret != EGL_FALSE, "eglInitialize() failed with error 0x%x", eglGetError());
+	LOGI_X("Headless EGL %d.%d display initialized", majorVersion, minorVersion);
+}
+
+void HeadlessGfxDevice::initDevice()
+{
+	// asking for a video mode that does not change current screen resolution
+	if (width_ == 0 || height_ == 0)
+	{
+		width_ = DefaultWidth;
+		height_ = DefaultHeight;
+		currentVideoMode_.width = static_cast<unsigned int>(width_);
+		currentVideoMode_.height = static_cast<unsigned int>(height_);
+		videoModes_[0] = currentVideoMode_;
+	}
+
+	const EGLint attribs[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_BLUE_SIZE, static_cast<int>(displayMode_.blueBits()),
+		EGL_GREEN_SIZE, static_cast<int>(displayMode_.greenBits()),
+		EGL_RED_SIZE, static_cast<int>(displayMode_.redBits()),
+		EGL_ALPHA_SIZE, static_cast<int>(displayMode_.alphaBits()),
+		EGL_DEPTH_SIZE, static_cast<int>(displayMode_.depthBits()),
+		EGL_STENCIL_SIZE, static_cast<int>(displayMode_.stencilBits()),
+		EGL_NONE
+	};
+
+	EGLint contextFlagsMask = 0;
+	contextFlagsMask |= (glContextInfo_.forwardCompatible) ? EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR : 0;
+	contextFlagsMask |= (glContextInfo_.debugContext) ? EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR : 0;
+	const EGLint glProfileMaskBit = glContextInfo_.coreProfile ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR
+	                                                           : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR;
+
+	const EGLint attribList[] = {
+		EGL_CONTEXT_MAJOR_VERSION_KHR, static_cast<EGLint>(glContextInfo_.majorVersion),
+		EGL_CONTEXT_MINOR_VERSION_KHR, static_cast<EGLint>(glContextInfo_.minorVersion),
+		EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, glProfileMaskBit,
+		EGL_CONTEXT_FLAGS_KHR, contextFlagsMask,
+		EGL_NONE
+	};
+
+	const EGLBoolean ret = eglBindAPI(EGL_OPENGL_API);
+	FATAL_ASSERT_MSG(ret != EGL_FALSE, "eglBindAPI(EGL_OPENGL_API) returned EGL_FALSE");
+
+	EGLint numConfigs = 0;
+	eglChooseConfig(display_, attribs, &config_, 1, &numConfigs);
+	FATAL_ASSERT_MSG(numConfigs > 0, "eglChooseConfig() found no pixel buffer configuration");
+
+	context_ = eglCreateContext(display_, config_, EGL_NO_CONTEXT, attribList);
+	FATAL_ASSERT_MSG_X(context_ != EGL_NO_CONTEXT, "eglCreateContext() failed with error 0x%x", eglGetError());
+
+	createSurface();
+
+	// There is no display to synchronize with
+	eglSwapInterval(display_, 0);
+
+#ifdef WITH_GLEW
+	const GLenum err = glewInit();
+	#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+	// OpenGL functions are loaded even if GLEW has been built for GLX and there is no X11 display
+	FATAL_ASSERT_MSG_X(err == GLEW_OK || err == GLEW_ERROR_NO_GLX_DISPLAY, "GLEW error: %s", glewGetErrorString(err));
+	#else
+	FATAL_ASSERT_MSG_X(err == GLEW_OK, "GLEW error: %s", glewGetErrorString(err));
+	#endif
+
+	glContextInfo_.debugContext = glContextInfo_.debugContext && glewIsSupported("GL_ARB_debug_output");
+#endif
+
+	EGLint red, blue, green, alpha, depth, stencil;
+	eglGetConfigAttrib(display_, config_, EGL_RED_SIZE, &red);
+	eglGetConfigAttrib(display_, config_, EGL_GREEN_SIZE, &green);
+	eglGetConfigAttrib(display_, config_, EGL_BLUE_SIZE, &blue);
+	eglGetConfigAttrib(display_, config_, EGL_ALPHA_SIZE, &alpha);
+	eglGetConfigAttrib(display_, config_, EGL_DEPTH_SIZE, &depth);
+	eglGetConfigAttrib(display_, config_, EGL_STENCIL_SIZE, &stencil);
+
+	LOGI_X("Headless surface configuration is size:%dx%d, RGBA:%d%d%d%d, depth:%d, stencil:%d", width_, height_, red, green, blue, alpha, depth, stencil);
+}
+
+void HeadlessGfxDevice::createSurface()
+{
+	const EGLint surfaceAttribs[] = {
+		EGL_WIDTH, width_,
+		EGL_HEIGHT, height_,
+		EGL_NONE
+	};
+
+	surface_ = eglCreatePbufferSurface(display_, config_, surfaceAttribs);
+	FATAL_ASSERT_MSG_X(surface_ != EGL_NO_SURFACE, "eglCreatePbufferSurface() failed with error 0x%x", eglGetError());
+
+	const EGLBoolean ret = eglMakeCurrent(display_, surface_, surface_, context_);
+	FATAL_ASSERT_MSG(ret != EGL_FALSE, "eglMakeCurrent() returned EGL_FALSE");
+}
+
+}
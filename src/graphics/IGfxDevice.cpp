@@ -6,6 +6,7 @@
 #include "RenderResources.h"
 #include "GLDepthTest.h"
 #include "GLBlending.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -45,6 +46,7 @@ void IGfxDevice::setClearColor(const Colorf &color)
 void IGfxDevice::setViewport(int width, int height)
 {
 	glViewport(0, 0, width, height);
+	GLCallCounters::addIssued(GLCallCounters::Categories::VIEWPORT);
 	RenderResources::projectionMatrix_ = Matrix4x4f::ortho(0.0f, static_cast<float>(width), 0.0f, static_cast<float>(height), -1.0f, 1.0f);
 }
 
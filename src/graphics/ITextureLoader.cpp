@@ -26,7 +26,7 @@ ITextureLoader::ITextureLoader(const char *filename)
 
 ITextureLoader::ITextureLoader(nctl::UniquePtr<IFile> fileHandle)
     : fileHandle_(nctl::move(fileHandle)), width_(0), height_(0),
-      bpp_(0), headerSize_(0), dataSize_(0), mipMapCount_(1)
+      bpp_(0), headerSize_(0), dataSize_(0), mipMapCount_(1), mappedPixels_(nullptr)
 {
 }
 
@@ -51,9 +51,9 @@ const GLubyte *ITextureLoader::pixels(unsigned int mipMapLevel) const
 	const GLubyte *pixels = nullptr;
 
 	if (mipMapCount_ > 1 && int(mipMapLevel) < mipMapCount_)
-		pixels = pixels_.get() + mipDataOffsets_[mipMapLevel];
+		pixels = this->pixels() + mipDataOffsets_[mipMapLevel];
 	else if (mipMapLevel == 0)
-		pixels = pixels_.get();
+		pixels = this->pixels();
 
 	return pixels;
 }
@@ -64,6 +64,23 @@ nctl::UniquePtr<ITextureLoader> ITextureLoader::createFromFile(const char *filen
 	nctl::UniquePtr<IFile> fileHandle = IFile::createFileHandle(filename);
 	LOGI_X("Loading file: \"%s\"", fileHandle->filename());
 
+	return createLoader(nctl::move(fileHandle));
+}
+
+nctl::UniquePtr<ITextureLoader> ITextureLoader::createFromMemory(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize)
+{
+	nctl::UniquePtr<IFile> fileHandle = IFile::createFromMemory(bufferName, bufferPtr, bufferSize);
+	LOGI_X("Loading memory buffer: \"%s\"", bufferName);
+
+	return createLoader(nctl::move(fileHandle));
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+nctl::UniquePtr<ITextureLoader> ITextureLoader::createLoader(nctl::UniquePtr<IFile> fileHandle)
+{
 	if (fileHandle->hasExtension("dds"))
 		return nctl::makeUnique<TextureLoaderDds>(nctl::move(fileHandle));
 	else if (fileHandle->hasExtension("pvr"))
@@ -112,10 +129,17 @@ void ITextureLoader::loadPixels(GLenum internalFormat, GLenum type)
 		fileHandle_->open(IFile::OpenMode::READ | IFile::OpenMode::BINARY);
 
 	dataSize_ = fileHandle_->size() - headerSize_;
-	fileHandle_->seek(headerSize_, SEEK_SET);
 
-	pixels_ = nctl::makeUnique<unsigned char[]>(dataSize_);
-	fileHandle_->read(pixels_.get(), dataSize_);
+	// The mapping stays valid as long as the loader keeps the file handle
+	const unsigned char *fileMemory = fileHandle_->mapToMemory();
+	if (fileMemory != nullptr)
+		mappedPixels_ = fileMemory + headerSize_;
+	else
+	{
+		fileHandle_->seek(headerSize_, SEEK_SET);
+		pixels_ = nctl::makeUnique<unsigned char[]>(dataSize_);
+		fileHandle_->read(pixels_.get(), dataSize_);
+	}
 }
 
 }
@@ -1,6 +1,9 @@
 #include "imgui.h"
 #include "ImGuiDebugOverlay.h"
 #include "Application.h"
+#include "FrameArena.h"
+#include "FramePacer.h"
+#include "FrameTimeStatistics.h"
 #include "IInputManager.h"
 #include "InputEvents.h"
 
@@ -245,6 +248,8 @@ void ImGuiDebugOverlay::guiWindow()
 		if (appCfg.withScenegraph)
 			guiRenderingSettings();
 		guiWindowSettings();
+		guiFramePacer();
+		guiFrameTimeStatistics();
 		guiAudioPlayers();
 		guiInputState();
 		guiRenderDoc();
@@ -422,6 +427,9 @@ void ImGuiDebugOverlay::guiPreprocessorDefines()
 #ifdef WITH_SDL
 			ImGui::Text("WITH_SDL");
 #endif
+#ifdef WITH_HEADLESS
+			ImGui::Text("WITH_HEADLESS");
+#endif
 #ifdef WITH_AUDIO
 			ImGui::Text("WITH_AUDIO");
 #endif
@@ -559,6 +567,7 @@ void ImGuiDebugOverlay::guiApplicationConfiguration()
 		ImGui::Text("Resolution: %u x %u", appCfg.resolution.x, appCfg.resolution.y);
 		ImGui::Text("Full Screen: %s", appCfg.inFullscreen ? "true" : "false");
 		ImGui::Text("Resizable: %s", appCfg.isResizable ? "true" : "false");
+		ImGui::Text("Headless: %s", appCfg.isHeadless ? "true" : "false");
 		ImGui::Text("Frame Limit: %u", appCfg.frameLimit);
 
 		ImGui::Separator();
@@ -571,6 +580,7 @@ void ImGuiDebugOverlay::guiApplicationConfiguration()
 		ImGui::Text("VBO size: %lu", appCfg.vboSize);
 		ImGui::Text("IBO size: %lu", appCfg.iboSize);
 		ImGui::Text("Vao pool size: %u", appCfg.vaoPoolSize);
+		ImGui::Text("Frame arena size: %lu", appCfg.frameArenaSize);
 
 		ImGui::Separator();
 		ImGui::Text("Debug Overlay: %s", appCfg.withDebugOverlay ? "true" : "false");
@@ -599,6 +609,23 @@ void ImGuiDebugOverlay::guiRenderingSettings()
 
 		settings.minBatchSize = minBatchSize;
 		settings.maxBatchSize = maxBatchSize;
+
+		if (ImGui::TreeNode("OpenGL State Calls"))
+		{
+			unsigned int totalIssued = 0;
+			unsigned int totalFiltered = 0;
+			for (unsigned int i = 0; i < GLCallCounters::Categories::COUNT; i++)
+			{
+				const GLCallCounters::Categories::Enum category = static_cast<GLCallCounters::Categories::Enum>(i);
+				const GLCallCounters::Counters &glCalls = RenderStatistics::glCalls(category);
+				ImGui::Text("%s: %u issued, %u filtered", GLCallCounters::categoryName(category), glCalls.issued, glCalls.filtered);
+				totalIssued += glCalls.issued;
+				totalFiltered += glCalls.filtered;
+			}
+			ImGui::Separator();
+			ImGui::Text("Total: %u issued, %u filtered", totalIssued, totalFiltered);
+			ImGui::TreePop();
+		}
 	}
 }
 
@@ -676,6 +703,64 @@ void ImGuiDebugOverlay::guiWindowSettings()
 #endif
 }
 
+void ImGuiDebugOverlay::guiFramePacer()
+{
+	if (ImGui::CollapsingHeader("Frame Pacer"))
+	{
+		FramePacer &framePacer = theApplication().framePacer();
+		const FramePacer::Statistics &stats = framePacer.statistics();
+
+		int frameLimit = (framePacer.targetFrameTime() > 0.0f) ? static_cast<int>(1.0f / framePacer.targetFrameTime() + 0.5f) : 0;
+		if (ImGui::SliderInt("Frame limit", &frameLimit, 0, 240, frameLimit > 0 ? "%d FPS" : "Disabled"))
+			framePacer.setTargetFrameTime(frameLimit > 0 ? 1.0f / static_cast<float>(frameLimit) : 0.0f);
+
+		ImGui::Text("Frame time: %.3f ms average, %.3f ms jitter", stats.averageFrameTime * 1000.0f, stats.frameTimeJitter * 1000.0f);
+		ImGui::Text("Wake-up error: %.3f ms average, %.3f ms max", stats.averageWakeUpError * 1000.0f, stats.maxWakeUpError * 1000.0f);
+		ImGui::Text("Spin time: %.3f ms average, %.3f ms tail", stats.averageSpinTime * 1000.0f, framePacer.spinTime() * 1000.0f);
+		ImGui::Text("Missed deadlines: %u", stats.missedDeadlines);
+	}
+}
+
+void ImGuiDebugOverlay::guiFrameTimeStatistics()
+{
+	if (ImGui::CollapsingHeader("Frame Time Statistics"))
+	{
+		FrameTimeStatistics &statistics = theApplication().frameTimeStatistics();
+		FrameTimeStatistics::HitchSettings &hitchSettings = statistics.hitchSettings();
+
+		ImGui::Text("Last %u frames", statistics.numFrames());
+		for (unsigned int i = 0; i < FrameTimeStatistics::Phase::COUNT; i++)
+		{
+			const FrameTimeStatistics::Phase::Enum phase = static_cast<FrameTimeStatistics::Phase::Enum>(i);
+			const FrameTimeStatistics::Percentiles &percentiles = statistics.percentiles(phase);
+			ImGui::Text("%s: p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms", FrameTimeStatistics::phaseName(phase),
+			            percentiles.p50 * 1000.0f, percentiles.p95 * 1000.0f, percentiles.p99 * 1000.0f, percentiles.max * 1000.0f);
+		}
+
+		float histogram[FrameTimeStatistics::NumHistogramBins];
+		for (unsigned int i = 0; i < FrameTimeStatistics::NumHistogramBins; i++)
+			histogram[i] = static_cast<float>(statistics.histogram()[i]);
+		nctl::String overlayText;
+		overlayText.format("Bins of %.1f ms", statistics.histogramBinWidth() * 1000.0f);
+		ImGui::PlotHistogram("Frame Times", histogram, FrameTimeStatistics::NumHistogramBins, 0, overlayText.data(), 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+
+		float binWidth = statistics.histogramBinWidth() * 1000.0f;
+		if (ImGui::SliderFloat("Bin width", &binWidth, 0.5f, 10.0f, "%.1f ms"))
+			statistics.setHistogramBinWidth(binWidth / 1000.0f);
+
+		float minFrameTime = hitchSettings.minFrameTime * 1000.0f;
+		if (ImGui::SliderFloat("Hitch min frame time", &minFrameTime, 1.0f, 100.0f, "%.1f ms"))
+			hitchSettings.minFrameTime = minFrameTime / 1000.0f;
+		ImGui::SliderFloat("Hitch median factor", &hitchSettings.medianFactor, 1.0f, 10.0f, "%.1fx");
+		ImGui::Checkbox("Log hitches", &hitchSettings.logHitches);
+
+		const float *lastHitch = statistics.lastHitch();
+		ImGui::Text("Hitches: %u, last one %.3f ms", statistics.numHitches(), lastHitch[FrameTimeStatistics::Phase::FRAME] * 1000.0f);
+		if (ImGui::Button("Reset"))
+			statistics.reset();
+	}
+}
+
 void ImGuiDebugOverlay::guiAudioPlayers()
 {
 #ifdef WITH_AUDIO
@@ -942,6 +1027,8 @@ void ImGuiDebugOverlay::guiRenderDoc()
 void ImGuiDebugOverlay::guiTopLeft()
 {
 	const RenderStatistics::VaoPool &vaoPool = RenderStatistics::vaoPool();
+	const RenderStatistics::StateSwitches &stateSwitches = RenderStatistics::stateSwitches();
+	const RenderStatistics::SharedUniformBlocks &sharedUniformBlocks = RenderStatistics::sharedUniformBlocks();
 	const RenderStatistics::Textures &textures = RenderStatistics::textures();
 	const RenderStatistics::CustomBuffers &customVbos = RenderStatistics::customVBOs();
 	const RenderStatistics::CustomBuffers &customIbos = RenderStatistics::customIBOs();
@@ -966,6 +1053,8 @@ void ImGuiDebugOverlay::guiTopLeft()
 		}
 
 		ImGui::Text("%u/%u VAOs (%u reuses, %u bindings)", vaoPool.size, vaoPool.capacity, vaoPool.reuses, vaoPool.bindings);
+		ImGui::Text("Switches: %u shaders, %u textures, %u VAOs", stateSwitches.shaders, stateSwitches.textures, stateSwitches.vaos);
+		ImGui::Text("%.2f Kb saved by %u shared uniform block(s)", sharedUniformBlocks.dataSize / 1024.0f, sharedUniformBlocks.count);
 		ImGui::Text("%.2f Kb in %u Texture(s)", textures.dataSize / 1024.0f, textures.count);
 		ImGui::Text("%.2f Kb in %u custom VBO(s)", customVbos.dataSize / 1024.0f, customVbos.count);
 		ImGui::Text("%.2f Kb in %u custom IBO(s)", customIbos.dataSize / 1024.0f, customIbos.count);
@@ -989,6 +1078,12 @@ void ImGuiDebugOverlay::guiTopLeft()
 			ImGui::SameLine();
 			ImGui::PlotLines("", plotValues_[ValuesType::UBO_USED].get(), numValues_, 0, nullptr, 0.0f, uboBuffers.size / 1024.0f);
 		}
+
+		const FrameArena &frameArena = theApplication().frameArena();
+		ImGui::Text("%.2f/%lu Kb in frame arena (%.2f Kb peak)", frameArena.lastFrameUsedMemory() / 1024.0f,
+		            static_cast<unsigned long>(frameArena.size() / 1024), frameArena.peakUsedMemory() / 1024.0f);
+		if (frameArena.numOverflowFrames() > 0)
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Frame arena overflowed in %u frame(s)", frameArena.numOverflowFrames());
 		ImGui::End();
 	}
 }
@@ -1114,6 +1209,9 @@ void ImGuiDebugOverlay::guiBottomRight()
 			ImGui::PlotLines("", plotValues_[ValuesType::LUA_OPERATIONS].get(), numValues_, 0, nullptr, 0.0f, FLT_MAX);
 		}
 
+		ImGui::Text("GC memory: %zu Kb, budgeted GC: %.3f ms (max %.3f ms), %u cycles", LuaStatistics::gcMemory(),
+		            LuaStatistics::gcFrameTime() * 1000.0f, LuaStatistics::maxGcFrameTime() * 1000.0f, LuaStatistics::numGcCycles());
+
 		ImGui::Text("Textures: %u, Sprites: %u, Mesh sprites: %u",
 		            LuaStatistics::numTypedUserDatas(LuaTypes::UserDataType::TEXTURE),
 		            LuaStatistics::numTypedUserDatas(LuaTypes::UserDataType::SPRITE),
@@ -1,6 +1,7 @@
 #include "imgui.h"
 
 #include "ImGuiDrawing.h"
+#include "UniformNames.h"
 #include "GLTexture.h"
 #include "GLShaderProgram.h"
 #include "GLScissorTest.h"
@@ -18,6 +19,9 @@
 #elif __ANDROID__
 	#include "ImGuiAndroidInput.h"
 #endif
+#ifdef WITH_HEADLESS
+	#include "ImGuiHeadlessInput.h"
+#endif
 
 #ifdef WITH_EMBEDDED_SHADERS
 	#include "shader_strings.h"
@@ -27,13 +31,76 @@
 
 namespace ncine {
 
+namespace {
+
+	/// Hashes the content of an ImGui vector, the size is part of the hash
+	template <class T>
+	nctl::hash_t hashVector(const ImVector<T> &vector)
+	{
+		return nctl::wordHash(reinterpret_cast<const char *>(vector.Data), static_cast<unsigned int>(vector.Size * sizeof(T)));
+	}
+
+	/// The fields of an `ImDrawCmd` that affect rendering, without the uninitialized padding of the original structure
+	struct DrawCommandKey
+	{
+		float clipRect[4];
+		uint64_t textureId;
+		unsigned int elemCount;
+		unsigned int vtxOffset;
+		unsigned int idxOffset;
+		unsigned int padding;
+	};
+
+	/// Hashes the draw commands of a list together with the framebuffer rectangle used to clip them
+	nctl::hash_t hashDrawCommands(const ImDrawData &drawData, const ImDrawList &imCmdList)
+	{
+		const float displayRect[4] = { drawData.DisplayPos.x, drawData.DisplayPos.y,
+		                               drawData.DisplaySize.x * drawData.FramebufferScale.x, drawData.DisplaySize.y * drawData.FramebufferScale.y };
+		nctl::hash_t hash = nctl::wordHash(reinterpret_cast<const char *>(displayRect), sizeof(displayRect));
+
+		DrawCommandKey key;
+		key.padding = 0;
+		for (int cmdIdx = 0; cmdIdx < imCmdList.CmdBuffer.Size; cmdIdx++)
+		{
+			const ImDrawCmd &imCmd = imCmdList.CmdBuffer[cmdIdx];
+			key.clipRect[0] = imCmd.ClipRect.x;
+			key.clipRect[1] = imCmd.ClipRect.y;
+			key.clipRect[2] = imCmd.ClipRect.z;
+			key.clipRect[3] = imCmd.ClipRect.w;
+			key.textureId = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(imCmd.TextureId));
+			key.elemCount = imCmd.ElemCount;
+			key.vtxOffset = imCmd.VtxOffset;
+			key.idxOffset = imCmd.IdxOffset;
+			hash = hash * 31 + nctl::wordHash(reinterpret_cast<const char *>(&key), sizeof(DrawCommandKey));
+		}
+
+		return hash;
+	}
+
+	/// Copies data at the beginning of a buffer object, growing it to at least twice its size if it is too small
+	void uploadBufferData(GLBufferObject &buffer, const GLvoid *data, GLsizeiptr size)
+	{
+		if (size > buffer.size())
+			buffer.bufferData((size > buffer.size() * 2) ? size : buffer.size() * 2, nullptr, GL_DYNAMIC_DRAW);
+		else
+		{
+			// Orphaning the buffer avoids waiting for the draw calls still using the old data
+			buffer.bufferData(buffer.size(), nullptr, GL_DYNAMIC_DRAW);
+		}
+
+		if (size > 0)
+			buffer.bufferSubData(0, size, data);
+	}
+
+}
+
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS and DESTRUCTOR
 ///////////////////////////////////////////////////////////
 
 ImGuiDrawing::ImGuiDrawing(bool withSceneGraph)
     : withSceneGraph_(withSceneGraph),
-      freeCommandsPool_(16), usedCommandsPool_(16),
+      drawListCaches_(4), numFramesWithUnusedCaches_(0),
       lastFrameWidth_(0), lastFrameHeight_(0)
 {
 	ImGuiIO &io = ImGui::GetIO();
@@ -87,13 +154,20 @@ ImGuiDrawing::~ImGuiDrawing()
 
 void ImGuiDrawing::newFrame()
 {
+#ifdef WITH_HEADLESS
+	if (theApplication().appConfiguration().isHeadless)
+		ImGuiHeadlessInput::newFrame();
+	else
+#endif
+	{
 #ifdef WITH_GLFW
-	ImGuiGlfwInput::newFrame();
+		ImGuiGlfwInput::newFrame();
 #elif WITH_SDL
-	ImGuiSdlInput::newFrame();
+		ImGuiSdlInput::newFrame();
 #elif __ANDROID__
-	ImGuiAndroidInput::newFrame();
+		ImGuiAndroidInput::newFrame();
 #endif
+	}
 
 	ImGuiIO &io = ImGui::GetIO();
 
@@ -103,7 +177,7 @@ void ImGuiDrawing::newFrame()
 
 		if (withSceneGraph_ == false)
 		{
-			imguiShaderUniforms_->uniform("projection")->setFloatVector(projectionMatrix_.data());
+			imguiShaderUniforms_->uniform(UniformNames::Projection)->setFloatVector(projectionMatrix_.data());
 			imguiShaderUniforms_->commitUniforms();
 		}
 	}
@@ -131,40 +205,48 @@ void ImGuiDrawing::endFrame()
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-RenderCommand *ImGuiDrawing::retrieveCommandFromPool()
+ImGuiDrawing::DrawListCache &ImGuiDrawing::retrieveDrawListCache(unsigned int index)
 {
-	RenderCommand *retrievedCommand = nullptr;
-
-	for (unsigned int i = 0; i < freeCommandsPool_.size(); i++)
+	while (drawListCaches_.size() <= index)
 	{
-		const unsigned int poolSize = freeCommandsPool_.size();
-		nctl::UniquePtr<RenderCommand> &command = freeCommandsPool_[i];
-		if (command && command->material().shaderProgram() == imguiShaderProgram_.get())
+		nctl::UniquePtr<DrawListCache> cache = nctl::makeUnique<DrawListCache>();
+		if (withSceneGraph_)
 		{
-			retrievedCommand = command.get();
-			usedCommandsPool_.pushBack(nctl::move(command));
-			command = nctl::move(freeCommandsPool_[poolSize - 1]);
-			freeCommandsPool_.setSize(poolSize - 1);
-			break;
+			nctl::UniquePtr<RenderCommand> firstCmd = nctl::makeUnique<RenderCommand>();
+			setupRenderCmd(*firstCmd);
+			firstCmd->geometry().createCustomVbo(0, GL_DYNAMIC_DRAW);
+			firstCmd->geometry().createCustomIbo(0, GL_DYNAMIC_DRAW);
+			cache->commands.pushBack(nctl::move(firstCmd));
 		}
+		else
+		{
+			cache->vbo = nctl::makeUnique<GLBufferObject>(GL_ARRAY_BUFFER);
+			cache->ibo = nctl::makeUnique<GLBufferObject>(GL_ELEMENT_ARRAY_BUFFER);
+		}
+		drawListCaches_.pushBack(nctl::move(cache));
 	}
 
-	if (retrievedCommand == nullptr)
-	{
-		nctl::UniquePtr<RenderCommand> newCommand = nctl::makeUnique<RenderCommand>();
-		setupRenderCmd(*newCommand);
-		retrievedCommand = newCommand.get();
-		usedCommandsPool_.pushBack(nctl::move(newCommand));
-	}
-
-	return retrievedCommand;
+	return *drawListCaches_[index];
 }
 
-void ImGuiDrawing::resetCommandPool()
+void ImGuiDrawing::releaseUnusedCaches(unsigned int numDrawLists)
 {
-	for (nctl::UniquePtr<RenderCommand> &command : usedCommandsPool_)
-		freeCommandsPool_.pushBack(nctl::move(command));
-	usedCommandsPool_.clear();
+	if (numDrawLists >= drawListCaches_.size())
+	{
+		numFramesWithUnusedCaches_ = 0;
+		return;
+	}
+
+	// Caches are kept for a while, as the number of lists changes whenever a window is shown or hidden
+	numFramesWithUnusedCaches_++;
+	if (numFramesWithUnusedCaches_ >= MaxFramesWithUnusedCaches)
+	{
+		for (unsigned int i = numDrawLists; i < drawListCaches_.size(); i++)
+			drawListCaches_[i].reset(nullptr);
+		drawListCaches_.setSize(numDrawLists);
+		drawListCaches_.shrinkToFit();
+		numFramesWithUnusedCaches_ = 0;
+	}
 }
 
 void ImGuiDrawing::setupRenderCmd(RenderCommand &cmd)
@@ -174,7 +256,7 @@ void ImGuiDrawing::setupRenderCmd(RenderCommand &cmd)
 	Material &material = cmd.material();
 	material.setShaderProgram(imguiShaderProgram_.get());
 	material.setUniformsDataPointer(nullptr);
-	material.uniform("uTexture")->setIntValue(0); // GL_TEXTURE0
+	material.uniform(UniformNames::Texture)->setIntValue(0); // GL_TEXTURE0
 	material.attribute("aPosition")->setVboParameters(sizeof(ImDrawVert), reinterpret_cast<void *>(offsetof(ImDrawVert, pos)));
 	material.attribute("aTexCoords")->setVboParameters(sizeof(ImDrawVert), reinterpret_cast<void *>(offsetof(ImDrawVert, uv)));
 	material.attribute("aColor")->setVboParameters(sizeof(ImDrawVert), reinterpret_cast<void *>(offsetof(ImDrawVert, col)));
@@ -199,71 +281,98 @@ void ImGuiDrawing::draw(RenderQueue &renderQueue)
 		return;
 	drawData->ScaleClipRects(drawData->FramebufferScale);
 
-	resetCommandPool();
-
 	unsigned int numCmd = 0;
-	const ImVec2 pos = drawData->DisplayPos;
 	for (int n = 0; n < drawData->CmdListsCount; n++)
 	{
 		const ImDrawList *imCmdList = drawData->CmdLists[n];
+		DrawListCache &cache = retrieveDrawListCache(n);
 
-		RenderCommand &firstCmd = *retrieveCommandFromPool();
+		RenderCommand &firstCmd = *cache.commands[0];
 		if (lastFrameWidth_ != static_cast<int>(io.DisplaySize.x) ||
 		    lastFrameHeight_ != static_cast<int>(io.DisplaySize.y))
 		{
-			firstCmd.material().uniform("projection")->setFloatVector(projectionMatrix_.data());
+			firstCmd.material().uniform(UniformNames::Projection)->setFloatVector(projectionMatrix_.data());
 			lastFrameWidth_ = static_cast<int>(io.DisplaySize.x);
 			lastFrameHeight_ = static_cast<int>(io.DisplaySize.y);
 		}
 
-		firstCmd.geometry().shareVbo(nullptr);
-		GLfloat *vertices = firstCmd.geometry().acquireVertexPointer(imCmdList->VtxBuffer.Size * numElements, numElements);
-		memcpy(vertices, imCmdList->VtxBuffer.Data, imCmdList->VtxBuffer.Size * numElements * sizeof(GLfloat));
-		firstCmd.geometry().releaseVertexPointer();
+		// The buffers of a list that has not changed since the previous frame are not uploaded again
+		const nctl::hash_t vertexHash = hashVector(imCmdList->VtxBuffer);
+		if (vertexHash != cache.vertexHash || imCmdList->VtxBuffer.Size != cache.numVertices)
+		{
+			firstCmd.geometry().updateCustomVbo(reinterpret_cast<const GLfloat *>(imCmdList->VtxBuffer.Data), imCmdList->VtxBuffer.Size * numElements);
+			cache.vertexHash = vertexHash;
+			cache.numVertices = imCmdList->VtxBuffer.Size;
+		}
+		const nctl::hash_t indexHash = hashVector(imCmdList->IdxBuffer);
+		if (indexHash != cache.indexHash || imCmdList->IdxBuffer.Size != cache.numIndices)
+		{
+			firstCmd.geometry().updateCustomIbo(imCmdList->IdxBuffer.Data, imCmdList->IdxBuffer.Size);
+			cache.indexHash = indexHash;
+			cache.numIndices = imCmdList->IdxBuffer.Size;
+		}
+
+		const nctl::hash_t commandsHash = hashDrawCommands(*drawData, *imCmdList);
+		if (commandsHash != cache.commandsHash || imCmdList->CmdBuffer.Size != cache.numCommands || numCmd != cache.firstCommandIndex)
+		{
+			setupDrawListCommands(cache, *drawData, *imCmdList, numCmd);
+			cache.commandsHash = commandsHash;
+			cache.numCommands = imCmdList->CmdBuffer.Size;
+			cache.firstCommandIndex = numCmd;
+		}
+
+		for (RenderCommand *command : cache.queuedCommands)
+			renderQueue.addCommand(command);
+		numCmd += imCmdList->CmdBuffer.Size;
+	}
 
-		firstCmd.geometry().shareIbo(nullptr);
-		GLushort *indices = firstCmd.geometry().acquireIndexPointer(imCmdList->IdxBuffer.Size);
-		memcpy(indices, imCmdList->IdxBuffer.Data, imCmdList->IdxBuffer.Size * sizeof(GLushort));
-		firstCmd.geometry().releaseIndexPointer();
+	releaseUnusedCaches(drawData->CmdListsCount);
+}
 
-		for (int cmdIdx = 0; cmdIdx < imCmdList->CmdBuffer.Size; cmdIdx++)
+void ImGuiDrawing::setupDrawListCommands(DrawListCache &cache, const ImDrawData &drawData, const ImDrawList &imCmdList, unsigned int firstCommandIndex)
+{
+	const int fbWidth = static_cast<int>(drawData.DisplaySize.x * drawData.FramebufferScale.x);
+	const int fbHeight = static_cast<int>(drawData.DisplaySize.y * drawData.FramebufferScale.y);
+	const ImVec2 pos = drawData.DisplayPos;
+
+	const RenderCommand &firstCmd = *cache.commands[0];
+	while (cache.commands.size() < static_cast<unsigned int>(imCmdList.CmdBuffer.Size))
+	{
+		nctl::UniquePtr<RenderCommand> newCommand = nctl::makeUnique<RenderCommand>();
+		setupRenderCmd(*newCommand);
+		newCommand->geometry().shareVbo(&firstCmd.geometry());
+		newCommand->geometry().shareIbo(&firstCmd.geometry());
+		cache.commands.pushBack(nctl::move(newCommand));
+	}
+
+	cache.queuedCommands.clear();
+	for (int cmdIdx = 0; cmdIdx < imCmdList.CmdBuffer.Size; cmdIdx++)
+	{
+		const ImDrawCmd *imCmd = &imCmdList.CmdBuffer[cmdIdx];
+		RenderCommand &currCmd = *cache.commands[cmdIdx];
+
+		const ImVec4 clipRect = ImVec4(imCmd->ClipRect.x - pos.x, imCmd->ClipRect.y - pos.y, imCmd->ClipRect.z - pos.x, imCmd->ClipRect.w - pos.y);
+		if (clipRect.x < fbWidth && clipRect.y < fbHeight && clipRect.z >= 0.0f && clipRect.w >= 0.0f)
 		{
-			const ImDrawCmd *imCmd = &imCmdList->CmdBuffer[cmdIdx];
-			RenderCommand &currCmd = (cmdIdx == 0) ? firstCmd : *retrieveCommandFromPool();
+			currCmd.setScissor(static_cast<GLint>(clipRect.x), static_cast<GLint>(fbHeight - clipRect.w),
+			                   static_cast<GLsizei>(clipRect.z - clipRect.x), static_cast<GLsizei>(clipRect.w - clipRect.y));
 
-			const ImVec4 clipRect = ImVec4(imCmd->ClipRect.x - pos.x, imCmd->ClipRect.y - pos.y, imCmd->ClipRect.z - pos.x, imCmd->ClipRect.w - pos.y);
-			if (clipRect.x < fbWidth && clipRect.y < fbHeight && clipRect.z >= 0.0f && clipRect.w >= 0.0f)
-			{
-				currCmd.setScissor(static_cast<GLint>(clipRect.x), static_cast<GLint>(fbHeight - clipRect.w),
-				                   static_cast<GLsizei>(clipRect.z - clipRect.x), static_cast<GLsizei>(clipRect.w - clipRect.y));
-
-				if (cmdIdx > 0)
-				{
-					currCmd.geometry().shareVbo(&firstCmd.geometry());
-					currCmd.geometry().shareIbo(&firstCmd.geometry());
-				}
-
-				currCmd.geometry().setNumIndices(imCmd->ElemCount);
-				currCmd.geometry().setFirstIndex(imCmd->IdxOffset);
-				currCmd.geometry().setFirstVertex(imCmd->VtxOffset);
-				currCmd.setLayer(DrawableNode::LayerBase::HUD + numCmd);
-				currCmd.material().setTexture(reinterpret_cast<GLTexture *>(imCmd->TextureId));
-
-				renderQueue.addCommand(&currCmd);
-			}
-			numCmd++;
+			currCmd.geometry().setNumIndices(imCmd->ElemCount);
+			currCmd.geometry().setFirstIndex(imCmd->IdxOffset);
+			currCmd.geometry().setFirstVertex(imCmd->VtxOffset);
+			currCmd.setLayer(DrawableNode::LayerBase::HUD + firstCommandIndex + cmdIdx);
+			currCmd.material().setTexture(reinterpret_cast<GLTexture *>(imCmd->TextureId));
+
+			cache.queuedCommands.pushBack(&currCmd);
 		}
 	}
 }
 
 void ImGuiDrawing::setupBuffersAndShader()
 {
-	vbo_ = nctl::makeUnique<GLBufferObject>(GL_ARRAY_BUFFER);
-	ibo_ = nctl::makeUnique<GLBufferObject>(GL_ELEMENT_ARRAY_BUFFER);
-
 	imguiShaderUniforms_ = nctl::makeUnique<GLShaderUniforms>(imguiShaderProgram_.get());
 	imguiShaderUniforms_->setUniformsDataPointer(uniformsBuffer_);
-	imguiShaderUniforms_->uniform("uTexture")->setIntValue(0); // GL_TEXTURE0
+	imguiShaderUniforms_->uniform(UniformNames::Texture)->setIntValue(0); // GL_TEXTURE0
 
 	imguiShaderAttributes_ = nctl::makeUnique<GLShaderAttributes>(imguiShaderProgram_.get());
 	imguiShaderAttributes_->attribute("aPosition")->setVboParameters(sizeof(ImDrawVert), reinterpret_cast<void *>(offsetof(ImDrawVert, pos)));
@@ -295,12 +404,27 @@ void ImGuiDrawing::draw()
 	for (int n = 0; n < drawData->CmdListsCount; n++)
 	{
 		const ImDrawList *imCmdList = drawData->CmdLists[n];
+		DrawListCache &cache = retrieveDrawListCache(n);
 		const ImDrawIdx *firstIndex = nullptr;
 
-		vbo_->bufferData(static_cast<GLsizeiptr>(imCmdList->VtxBuffer.Size) * sizeof(ImDrawVert), static_cast<const GLvoid *>(imCmdList->VtxBuffer.Data), GL_STREAM_DRAW);
-		ibo_->bufferData(static_cast<GLsizeiptr>(imCmdList->IdxBuffer.Size) * sizeof(ImDrawIdx), static_cast<const GLvoid *>(imCmdList->IdxBuffer.Data), GL_STREAM_DRAW);
+		// The buffers of a list that has not changed since the previous frame are not uploaded again
+		const nctl::hash_t vertexHash = hashVector(imCmdList->VtxBuffer);
+		if (vertexHash != cache.vertexHash || imCmdList->VtxBuffer.Size != cache.numVertices)
+		{
+			uploadBufferData(*cache.vbo, imCmdList->VtxBuffer.Data, static_cast<GLsizeiptr>(imCmdList->VtxBuffer.Size) * sizeof(ImDrawVert));
+			cache.vertexHash = vertexHash;
+			cache.numVertices = imCmdList->VtxBuffer.Size;
+		}
+		const nctl::hash_t indexHash = hashVector(imCmdList->IdxBuffer);
+		if (indexHash != cache.indexHash || imCmdList->IdxBuffer.Size != cache.numIndices)
+		{
+			uploadBufferData(*cache.ibo, imCmdList->IdxBuffer.Data, static_cast<GLsizeiptr>(imCmdList->IdxBuffer.Size) * sizeof(ImDrawIdx));
+			cache.indexHash = indexHash;
+			cache.numIndices = imCmdList->IdxBuffer.Size;
+		}
+
 		imguiShaderProgram_->use();
-		imguiShaderAttributes_->defineVertexFormat(vbo_.get(), ibo_.get());
+		imguiShaderAttributes_->defineVertexFormat(cache.vbo.get(), cache.ibo.get());
 
 		for (int cmdIdx = 0; cmdIdx < imCmdList->CmdBuffer.Size; cmdIdx++)
 		{
@@ -327,6 +451,8 @@ void ImGuiDrawing::draw()
 	GLDepthTest::popState();
 	GLCullFace::popState();
 	GLBlending::popState();
+
+	releaseUnusedCaches(drawData->CmdListsCount);
 }
 
 }
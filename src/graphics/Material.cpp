@@ -1,10 +1,12 @@
 #include <cstddef> // for offsetof()
 #include "Material.h"
+#include "UniformNames.h"
 #include "RenderResources.h"
 #include "GLShaderProgram.h"
 #include "GLUniform.h"
 #include "GLTexture.h"
 #include "Texture.h"
+#include "RenderStatistics.h"
 
 namespace ncine {
 
@@ -78,19 +80,19 @@ void Material::setShaderProgramType(ShaderProgramType shaderProgramType)
 		case ShaderProgramType::SPRITE:
 		case ShaderProgramType::SPRITE_GRAY:
 			setUniformsDataPointer(nullptr);
-			uniform("uTexture")->setIntValue(0); // GL_TEXTURE0
+			uniform(UniformNames::Texture)->setIntValue(0); // GL_TEXTURE0
 			break;
 		case ShaderProgramType::MESH_SPRITE:
 		case ShaderProgramType::MESH_SPRITE_GRAY:
 			setUniformsDataPointer(nullptr);
-			uniform("uTexture")->setIntValue(0); // GL_TEXTURE0
+			uniform(UniformNames::Texture)->setIntValue(0); // GL_TEXTURE0
 			attribute("aPosition")->setVboParameters(sizeof(RenderResources::VertexFormatPos2Tex2), reinterpret_cast<void *>(offsetof(RenderResources::VertexFormatPos2Tex2, position)));
 			attribute("aTexCoords")->setVboParameters(sizeof(RenderResources::VertexFormatPos2Tex2), reinterpret_cast<void *>(offsetof(RenderResources::VertexFormatPos2Tex2, texcoords)));
 			break;
 		case ShaderProgramType::TEXTNODE_ALPHA:
 		case ShaderProgramType::TEXTNODE_RED:
 			setUniformsDataPointer(nullptr);
-			uniform("uTexture")->setIntValue(0); // GL_TEXTURE0
+			uniform(UniformNames::Texture)->setIntValue(0); // GL_TEXTURE0
 			attribute("aPosition")->setVboParameters(sizeof(RenderResources::VertexFormatPos2Tex2), reinterpret_cast<void *>(offsetof(RenderResources::VertexFormatPos2Tex2, position)));
 			attribute("aTexCoords")->setVboParameters(sizeof(RenderResources::VertexFormatPos2Tex2), reinterpret_cast<void *>(offsetof(RenderResources::VertexFormatPos2Tex2, texcoords)));
 			break;
@@ -119,8 +121,8 @@ void Material::setShaderProgramType(ShaderProgramType shaderProgramType)
 	// Should be assigned after calling `setShaderProgram()`
 	shaderProgramType_ = shaderProgramType;
 
-	if (uniform("projection")->dataPointer() != nullptr && shaderProgramType_ != ShaderProgramType::CUSTOM)
-		uniform("projection")->setFloatVector(RenderResources::projectionMatrix().data());
+	if (uniform(UniformNames::Projection)->dataPointer() != nullptr && shaderProgramType_ != ShaderProgramType::CUSTOM)
+		uniform(UniformNames::Projection)->setFloatVector(RenderResources::projectionMatrix().data());
 }
 
 void Material::setShaderProgram(GLShaderProgram *program)
@@ -160,12 +162,13 @@ void Material::setTexture(const Texture &texture)
 
 void Material::bind()
 {
-	if (texture_)
-		texture_->bind();
+	if (texture_ && texture_->bind())
+		RenderStatistics::addTextureSwitch();
 
 	if (shaderProgram_)
 	{
-		shaderProgram_->use();
+		if (shaderProgram_->use())
+			RenderStatistics::addShaderSwitch();
 		shaderUniformBlocks_.bind();
 	}
 }
@@ -175,18 +178,4 @@ void Material::defineVertexFormat(const GLBufferObject *vbo, const GLBufferObjec
 	shaderAttributes_.defineVertexFormat(vbo, ibo, vboOffset);
 }
 
-unsigned int Material::sortKey()
-{
-	unsigned char lower = 0;
-	unsigned int upper = 0;
-
-	if (texture_)
-		lower = static_cast<unsigned char>(texture_->glHandle());
-
-	if (shaderProgram_)
-		upper = shaderProgram_->glHandle() << 8;
-
-	return upper + lower;
-}
-
 }
@@ -0,0 +1,49 @@
+#include "NodeComponents.h"
+#include "DrawableNode.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+unsigned int NodeComponents::applyTransforms(TransformPool &transforms, SceneNodePool &nodes)
+{
+	unsigned int numUpdated = 0;
+	nctl::forEachEntity([&numUpdated](unsigned int, TransformComponent &transform, SceneNode *node) {
+		node->setPosition(transform.position);
+		node->setRotation(transform.rotation);
+		node->setScale(transform.scale);
+		numUpdated++;
+	}, transforms, nodes);
+
+	return numUpdated;
+}
+
+unsigned int NodeComponents::storeTransforms(SceneNodePool &nodes, TransformPool &transforms)
+{
+	unsigned int numUpdated = 0;
+	nctl::forEachEntity([&numUpdated](unsigned int, SceneNode *node, TransformComponent &transform) {
+		transform.position = node->position();
+		transform.rotation = node->rotation();
+		transform.scale = node->scale();
+		numUpdated++;
+	}, nodes, transforms);
+
+	return numUpdated;
+}
+
+unsigned int NodeComponents::applyDrawState(DrawPool &drawStates, DrawableNodePool &nodes)
+{
+	unsigned int numUpdated = 0;
+	nctl::forEachEntity([&numUpdated](unsigned int, DrawComponent &drawState, DrawableNode *node) {
+		node->setColor(drawState.color);
+		node->setLayer(drawState.layer);
+		node->setDrawEnabled(drawState.drawEnabled);
+		numUpdated++;
+	}, drawStates, nodes);
+
+	return numUpdated;
+}
+
+}
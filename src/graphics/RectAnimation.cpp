@@ -7,7 +7,7 @@ namespace ncine {
 ///////////////////////////////////////////////////////////
 
 RectAnimation::RectAnimation(float frameTime, LoopMode loopMode, RewindMode rewindMode)
-    : frameTime_(frameTime), loopMode_(loopMode), rewindMode_(rewindMode), rects_(4),
+    : frameTime_(frameTime), loopMode_(loopMode), rewindMode_(rewindMode),
       currentFrame_(0), elapsedFrameTime_(0.0f), goingForward_(true), isPaused_(true)
 {
 }
@@ -1,5 +1,6 @@
 #include <cstring> // for memcpy()
 #include "RenderBatcher.h"
+#include "UniformNames.h"
 #include "RenderResources.h" // TODO: Remove dependency?
 #include "Application.h"
 
@@ -161,38 +162,38 @@ RenderCommand *RenderBatcher::collectCommands(
 	if (refCommand->material().shaderProgramType() == Material::ShaderProgramType::SPRITE)
 	{
 		batchCommand = retrieveCommandFromPool(Material::ShaderProgramType::BATCHED_SPRITES);
-		singleInstanceBlockSize = (*start)->material().uniformBlock("SpriteBlock")->size();
+		singleInstanceBlockSize = (*start)->material().uniformBlock(UniformNames::SpriteBlock)->size();
 	}
 	else if (refCommand->material().shaderProgramType() == Material::ShaderProgramType::SPRITE_GRAY)
 	{
 		batchCommand = retrieveCommandFromPool(Material::ShaderProgramType::BATCHED_SPRITES_GRAY);
-		singleInstanceBlockSize = (*start)->material().uniformBlock("SpriteBlock")->size();
+		singleInstanceBlockSize = (*start)->material().uniformBlock(UniformNames::SpriteBlock)->size();
 	}
 	else if (refCommand->material().shaderProgramType() == Material::ShaderProgramType::MESH_SPRITE)
 	{
 		batchCommand = retrieveCommandFromPool(Material::ShaderProgramType::BATCHED_MESH_SPRITES);
-		singleInstanceBlockSize = (*start)->material().uniformBlock("MeshSpriteBlock")->size();
+		singleInstanceBlockSize = (*start)->material().uniformBlock(UniformNames::MeshSpriteBlock)->size();
 	}
 	else if (refCommand->material().shaderProgramType() == Material::ShaderProgramType::MESH_SPRITE_GRAY)
 	{
 		batchCommand = retrieveCommandFromPool(Material::ShaderProgramType::BATCHED_MESH_SPRITES_GRAY);
-		singleInstanceBlockSize = (*start)->material().uniformBlock("MeshSpriteBlock")->size();
+		singleInstanceBlockSize = (*start)->material().uniformBlock(UniformNames::MeshSpriteBlock)->size();
 	}
 	else if (refCommand->material().shaderProgramType() == Material::ShaderProgramType::TEXTNODE_ALPHA)
 	{
 		batchCommand = retrieveCommandFromPool(Material::ShaderProgramType::BATCHED_TEXTNODES_ALPHA);
-		singleInstanceBlockSize = (*start)->material().uniformBlock("TextnodeBlock")->size();
+		singleInstanceBlockSize = (*start)->material().uniformBlock(UniformNames::TextnodeBlock)->size();
 	}
 	else if (refCommand->material().shaderProgramType() == Material::ShaderProgramType::TEXTNODE_RED)
 	{
 		batchCommand = retrieveCommandFromPool(Material::ShaderProgramType::BATCHED_TEXTNODES_RED);
-		singleInstanceBlockSize = (*start)->material().uniformBlock("TextnodeBlock")->size();
+		singleInstanceBlockSize = (*start)->material().uniformBlock(UniformNames::TextnodeBlock)->size();
 	}
 	else
 		FATAL_MSG("Unsupported shader for batch element");
 
 	batchCommand->setType(refCommand->type());
-	instancesBlock = batchCommand->material().uniformBlock("InstancesBlock");
+	instancesBlock = batchCommand->material().uniformBlock(UniformNames::InstancesBlock);
 	instancesBlockSize += batchCommand->material().shaderProgram()->uniformsSize();
 
 	// Set to true if at least one command in the batch has indices or forced by a rendering settings
@@ -257,8 +258,8 @@ RenderCommand *RenderBatcher::collectCommands(
 		instancesVertexDataSize -= 2 * (refCommand->geometry().numElementsPerVertex() + 1) * sizeof(GLfloat);
 
 	batchCommand->material().setUniformsDataPointer(acquireMemory(instancesBlockSize));
-	batchCommand->material().uniform("uTexture")->setIntValue(0); // GL_TEXTURE0
-	batchCommand->material().uniform("projection")->setFloatVector(RenderResources::projectionMatrix().data());
+	batchCommand->material().uniform(UniformNames::Texture)->setIntValue(0); // GL_TEXTURE0
+	batchCommand->material().uniform(UniformNames::Projection)->setFloatVector(RenderResources::projectionMatrix().data());
 
 	RenderResources::VertexFormatPos2Tex2Index *destVtx = nullptr;
 	GLushort *destIdx = nullptr;
@@ -282,7 +283,7 @@ RenderCommand *RenderBatcher::collectCommands(
 
 		if (isBatchedSprite(batchCommand->material().shaderProgramType()))
 		{
-			const GLUniformBlockCache *singleInstanceBlock = command->material().uniformBlock("SpriteBlock");
+			const GLUniformBlockCache *singleInstanceBlock = command->material().uniformBlock(UniformNames::SpriteBlock);
 			memcpy(instancesBlock->dataPointer() + instancesBlockOffset, singleInstanceBlock->dataPointer(), singleInstanceBlockSize);
 			instancesBlockOffset += singleInstanceBlockSize;
 		}
@@ -290,9 +291,9 @@ RenderCommand *RenderBatcher::collectCommands(
 		{
 			GLUniformBlockCache *singleInstanceBlock = nullptr;
 			if (isBatchedMeshSprite(batchCommand->material().shaderProgramType()))
-				singleInstanceBlock = command->material().uniformBlock("MeshSpriteBlock");
+				singleInstanceBlock = command->material().uniformBlock(UniformNames::MeshSpriteBlock);
 			else if (isBatchedTextnode(batchCommand->material().shaderProgramType()))
-				singleInstanceBlock = command->material().uniformBlock("TextnodeBlock");
+				singleInstanceBlock = command->material().uniformBlock(UniformNames::TextnodeBlock);
 
 			memcpy(instancesBlock->dataPointer() + instancesBlockOffset, singleInstanceBlock->dataPointer(), singleInstanceBlockSize);
 			instancesBlockOffset += singleInstanceBlockSize;
@@ -371,7 +372,7 @@ RenderCommand *RenderBatcher::collectCommands(
 	batchCommand->material().setTexture(refCommand->material().texture());
 	batchCommand->material().setTransparent(refCommand->material().isTransparent());
 	batchCommand->setBatchSize(nextStart - start);
-	batchCommand->material().uniformBlock("InstancesBlock")->setUsedSize(instancesBlockOffset);
+	batchCommand->material().uniformBlock(UniformNames::InstancesBlock)->setUsedSize(instancesBlockOffset);
 
 	if (isBatchedSprite(batchCommand->material().shaderProgramType()))
 		batchCommand->geometry().setDrawParameters(GL_TRIANGLES, 0, 6 * (nextStart - start));
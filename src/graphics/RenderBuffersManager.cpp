@@ -1,3 +1,4 @@
+#include <cstring> // for memcpy()
 #include "RenderBuffersManager.h"
 #include "RenderStatistics.h"
 #include "GLDebug.h"
@@ -10,7 +11,7 @@ namespace ncine {
 ///////////////////////////////////////////////////////////
 
 RenderBuffersManager::RenderBuffersManager(bool useBufferMapping, unsigned long vboMaxSize, unsigned long iboMaxSize)
-    : buffers_(4)
+    : buffers_(4), uniformRanges_(UniformRangesHashSize)
 {
 	BufferSpecifications &vboSpecs = specs_[BufferTypes::ARRAY];
 	vboSpecs.type = BufferTypes::ARRAY;
@@ -112,6 +113,30 @@ RenderBuffersManager::Parameters RenderBuffersManager::acquireMemory(BufferTypes
 	return params;
 }
 
+RenderBuffersManager::Parameters RenderBuffersManager::acquireUniformMemory(const GLubyte *data, unsigned long bytes)
+{
+	ASSERT(data);
+
+	const nctl::hash_t hash = nctl::wordHash(reinterpret_cast<const char *>(data), static_cast<unsigned int>(bytes));
+	// The null hash is reserved by the hashmap to mark empty buckets
+	const UniformRange *range = (hash != nctl::NullHash) ? uniformRanges_.find(hash) : nullptr;
+	if (range && range->params.size == bytes && memcmp(range->data, data, bytes) == 0)
+	{
+		RenderStatistics::addSharedUniformBlock(bytes);
+		return range->params;
+	}
+
+	const Parameters params = acquireMemory(BufferTypes::UNIFORM, bytes);
+	if (params.mapBase)
+		memcpy(params.mapBase + params.offset, data, bytes);
+
+	// A range whose hash collides with a different content is not remembered
+	if (range == nullptr && hash != nctl::NullHash && uniformRanges_.size() < UniformRangesHashSize / 2)
+		uniformRanges_.insert(hash, UniformRange(params, data));
+
+	return params;
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -142,6 +167,9 @@ void RenderBuffersManager::flushUnmap()
 
 		buffer.mapBase = nullptr;
 	}
+
+	// Ranges cannot be shared anymore once their data has been flushed
+	uniformRanges_.clear();
 }
 
 void RenderBuffersManager::remap()
@@ -1,6 +1,9 @@
 #include "RenderCommand.h"
+#include "UniformNames.h"
 #include "GLShaderProgram.h"
+#include "GLTexture.h"
 #include "GLScissorTest.h"
+#include "Application.h"
 
 namespace ncine {
 
@@ -33,11 +36,60 @@ void RenderCommand::commitUniformBlocks()
 	}
 }
 
+namespace {
+
+	/// Returns a compact value for the primitive type and the number of elements per vertex
+	uint64_t vertexFormatValue(const Geometry &geometry)
+	{
+		// Primitive types go from `GL_POINTS` (0) to `GL_TRIANGLE_FAN` (6)
+		const uint64_t primitive = static_cast<uint64_t>(geometry.primitiveType()) & 0x7;
+		return (static_cast<uint64_t>(geometry.numElementsPerVertex()) << 3) | primitive;
+	}
+
+}
+
 void RenderCommand::calculateSortKey()
 {
-	const unsigned long int upper = layer_ << 16;
-	const unsigned int lower = material_.sortKey();
-	sortKey_ = upper + lower;
+	using SortKeyField = Application::RenderingSettings::SortKeyField;
+	const Application::RenderingSettings &settings = theApplication().renderingSettings();
+
+	uint64_t key = static_cast<uint64_t>(layer_) << SortKey::LayerShift;
+	if (material_.isTransparent())
+		key |= uint64_t(1) << SortKey::TranslucencyShift;
+
+	unsigned int shift = SortKey::TranslucencyShift;
+	unsigned int usedFields = 0;
+	for (unsigned int i = 0; i < Application::RenderingSettings::NumSortKeyFields; i++)
+	{
+		// A repeated field would need more bits than the ones reserved for the sorting order
+		const unsigned int fieldBit = 1u << static_cast<unsigned int>(settings.sortKeyFields[i]);
+		if ((usedFields & fieldBit) != 0)
+			continue;
+		usedFields |= fieldBit;
+
+		uint64_t value = 0;
+		unsigned int numBits = 0;
+		switch (settings.sortKeyFields[i])
+		{
+			case SortKeyField::SHADER:
+				value = material_.shaderProgram_ ? material_.shaderProgram_->sortId() : 0;
+				numBits = SortKey::ShaderBits;
+				break;
+			case SortKeyField::TEXTURE:
+				value = material_.texture_ ? material_.texture_->sortId() : 0;
+				numBits = SortKey::TextureBits;
+				break;
+			case SortKeyField::VERTEX_FORMAT:
+				value = vertexFormatValue(geometry_);
+				numBits = SortKey::VertexFormatBits;
+				break;
+		}
+
+		shift -= numBits;
+		key |= (value & ((uint64_t(1) << numBits) - 1)) << shift;
+	}
+
+	sortKey_ = key;
 }
 
 void RenderCommand::issue()
@@ -92,13 +144,13 @@ void RenderCommand::commitTransformation()
 
 		if (shaderProgramType == Material::ShaderProgramType::SPRITE ||
 		    shaderProgramType == Material::ShaderProgramType::SPRITE_GRAY)
-			material_.uniformBlock("SpriteBlock")->uniform("modelView")->setFloatVector(modelView_.data());
+			material_.uniformBlock(UniformNames::SpriteBlock)->uniform(UniformNames::ModelView)->setFloatVector(modelView_.data());
 		else if (shaderProgramType == Material::ShaderProgramType::MESH_SPRITE ||
 		         shaderProgramType == Material::ShaderProgramType::MESH_SPRITE_GRAY)
-			material_.uniformBlock("MeshSpriteBlock")->uniform("modelView")->setFloatVector(modelView_.data());
+			material_.uniformBlock(UniformNames::MeshSpriteBlock)->uniform(UniformNames::ModelView)->setFloatVector(modelView_.data());
 		else if (shaderProgramType == Material::ShaderProgramType::TEXTNODE_ALPHA ||
 		         shaderProgramType == Material::ShaderProgramType::TEXTNODE_RED)
-			material_.uniformBlock("TextnodeBlock")->uniform("modelView")->setFloatVector(modelView_.data());
+			material_.uniformBlock(UniformNames::TextnodeBlock)->uniform(UniformNames::ModelView)->setFloatVector(modelView_.data());
 		else if (shaderProgramType != Material::ShaderProgramType::BATCHED_SPRITES &&
 		         shaderProgramType != Material::ShaderProgramType::BATCHED_SPRITES_GRAY &&
 		         shaderProgramType != Material::ShaderProgramType::BATCHED_MESH_SPRITES &&
@@ -106,7 +158,7 @@ void RenderCommand::commitTransformation()
 		         shaderProgramType != Material::ShaderProgramType::BATCHED_TEXTNODES_ALPHA &&
 		         shaderProgramType != Material::ShaderProgramType::BATCHED_TEXTNODES_RED &&
 		         shaderProgramType != Material::ShaderProgramType::CUSTOM)
-			material_.uniform("modelView")->setFloatVector(modelView_.data());
+			material_.uniform(UniformNames::ModelView)->setFloatVector(modelView_.data());
 	}
 }
 
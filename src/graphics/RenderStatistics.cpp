@@ -17,6 +17,9 @@ RenderStatistics::CustomBuffers RenderStatistics::customIbos_;
 unsigned int RenderStatistics::index_ = 0;
 unsigned int RenderStatistics::culledNodes_[2] = { 0, 0 };
 RenderStatistics::VaoPool RenderStatistics::vaoPool_;
+RenderStatistics::StateSwitches RenderStatistics::stateSwitches_;
+RenderStatistics::SharedUniformBlocks RenderStatistics::sharedUniformBlocks_;
+GLCallCounters::Counters RenderStatistics::glCalls_[GLCallCounters::Categories::COUNT];
 
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
@@ -26,6 +29,9 @@ void RenderStatistics::reset()
 {
 	TracyPlot("Vertices", static_cast<int64_t>(allCommands_.vertices));
 	TracyPlot("Render Commands", static_cast<int64_t>(allCommands_.commands));
+	TracyPlot("Shader Switches", static_cast<int64_t>(stateSwitches_.shaders));
+	TracyPlot("Texture Switches", static_cast<int64_t>(stateSwitches_.textures));
+	TracyPlot("VAO Switches", static_cast<int64_t>(stateSwitches_.vaos));
 
 	for (unsigned int i = 0; i < RenderCommand::CommandTypes::COUNT; i++)
 		typedCommands_[i].reset();
@@ -39,6 +45,18 @@ void RenderStatistics::reset()
 	culledNodes_[index_] = 0;
 
 	vaoPool_.reset();
+	stateSwitches_.reset();
+	sharedUniformBlocks_.reset();
+
+	// The OpenGL calls of a whole frame, including the ones issued outside of the render queue
+	unsigned int issuedGLCalls = 0;
+	for (unsigned int i = 0; i < GLCallCounters::Categories::COUNT; i++)
+	{
+		glCalls_[i] = GLCallCounters::counters(GLCallCounters::Categories::Enum(i));
+		issuedGLCalls += glCalls_[i].issued;
+	}
+	TracyPlot("OpenGL State Calls", static_cast<int64_t>(issuedGLCalls));
+	GLCallCounters::reset();
 }
 
 void RenderStatistics::gatherStatistics(const RenderCommand &command)
@@ -10,7 +10,7 @@ namespace ncine {
 ///////////////////////////////////////////////////////////
 
 RenderVaoPool::RenderVaoPool(unsigned int vaoPoolSize)
-    : vaoPool_(vaoPoolSize, nctl::ArrayMode::FIXED_CAPACITY)
+    : vaoPool_(vaoPoolSize, nctl::ArrayMode::FIXED_CAPACITY), vaoIndices_(vaoPoolSize * 2)
 {
 	// Start with a VAO bound to the OpenGL context
 	GLVertexFormat format;
@@ -24,28 +24,29 @@ RenderVaoPool::RenderVaoPool(unsigned int vaoPoolSize)
 void RenderVaoPool::bindVao(const GLVertexFormat &vertexFormat)
 {
 	bool vaoFound = false;
-	for (VaoBinding &binding : vaoPool_)
+	const nctl::hash_t formatHash = vertexFormat.hash();
+	// The null hash is reserved by the hashmap to mark empty buckets
+	const unsigned int *foundIndex = (formatHash != nctl::NullHash) ? vaoIndices_.find(formatHash) : nullptr;
+	if (foundIndex != nullptr && vaoPool_[*foundIndex].format == vertexFormat)
 	{
-		if (binding.format == vertexFormat)
+		VaoBinding &binding = vaoPool_[*foundIndex];
+		GLDebug::pushGroup("Bind VAO");
+		vaoFound = true;
+		const bool bindChanged = binding.object->bind();
+		const GLuint iboHandle = vertexFormat.ibo() ? vertexFormat.ibo()->glHandle() : 0;
+		if (bindChanged)
 		{
-			GLDebug::pushGroup("Bind VAO");
-			vaoFound = true;
-			const bool bindChanged = binding.object->bind();
-			const GLuint iboHandle = vertexFormat.ibo() ? vertexFormat.ibo()->glHandle() : 0;
-			if (bindChanged)
-			{
-				// Binding a VAO changes the current bound element array buffer
-				GLBufferObject::setBoundHandle(GL_ELEMENT_ARRAY_BUFFER, iboHandle);
-			}
-			else
-			{
-				// The VAO was already bound but it is not known if the bound element array buffer changed in the meantime
-				GLBufferObject::bindHandle(GL_ELEMENT_ARRAY_BUFFER, iboHandle);
-			}
-			binding.lastBindTime = TimeStamp::now();
-			RenderStatistics::addVaoPoolBinding();
-			break;
+			// Binding a VAO changes the current bound element array buffer
+			GLBufferObject::setBoundHandle(GL_ELEMENT_ARRAY_BUFFER, iboHandle);
+			RenderStatistics::addVaoSwitch();
 		}
+		else
+		{
+			// The VAO was already bound but it is not known if the bound element array buffer changed in the meantime
+			GLBufferObject::bindHandle(GL_ELEMENT_ARRAY_BUFFER, iboHandle);
+		}
+		binding.lastBindTime = TimeStamp::now();
+		RenderStatistics::addVaoPoolBinding();
 	}
 
 	if (vaoFound == false)
@@ -56,6 +57,7 @@ void RenderVaoPool::bindVao(const GLVertexFormat &vertexFormat)
 			GLDebug::pushGroup("Create and define VAO");
 			index = vaoPool_.size();
 			vaoPool_[index].object = nctl::makeUnique<GLVertexArrayObject>();
+			vaoPool_[index].formatHash = nctl::NullHash;
 		}
 		else
 		{
@@ -76,10 +78,21 @@ void RenderVaoPool::bindVao(const GLVertexFormat &vertexFormat)
 
 		const bool bindChanged = vaoPool_[index].object->bind();
 		ASSERT(bindChanged == true || vaoPool_.size() == 1);
+		if (bindChanged)
+			RenderStatistics::addVaoSwitch();
 		// Binding a VAO changes the current bound element array buffer
 		const GLuint oldIboHandle = vaoPool_[index].format.ibo() ? vaoPool_[index].format.ibo()->glHandle() : 0;
 		GLBufferObject::setBoundHandle(GL_ELEMENT_ARRAY_BUFFER, oldIboHandle);
+		// A reused VAO is not reachable through the hash of its old format anymore
+		const nctl::hash_t oldFormatHash = vaoPool_[index].formatHash;
+		const unsigned int *oldIndex = (oldFormatHash != nctl::NullHash) ? vaoIndices_.find(oldFormatHash) : nullptr;
+		if (oldIndex != nullptr && *oldIndex == index)
+			vaoIndices_.remove(oldFormatHash);
+		if (formatHash != nctl::NullHash)
+			vaoIndices_[formatHash] = index;
+
 		vaoPool_[index].format = vertexFormat;
+		vaoPool_[index].formatHash = formatHash;
 		vaoPool_[index].format.define();
 		vaoPool_[index].lastBindTime = TimeStamp::now();
 		RenderStatistics::addVaoPoolBinding();
@@ -2,6 +2,7 @@
 #include "FontGlyph.h"
 #include "Texture.h"
 #include "RenderCommand.h"
+#include "UniformNames.h"
 #include "GLDebug.h"
 #include "tracy.h"
 
@@ -34,7 +35,7 @@ TextNode::TextNode(SceneNode *parent, Font *font, unsigned int maxStringLength)
 	                                                          ? Material::ShaderProgramType::TEXTNODE_RED
 	                                                          : Material::ShaderProgramType::TEXTNODE_ALPHA;
 	renderCommand_->material().setShaderProgramType(shaderProgramType);
-	textnodeBlock_ = renderCommand_->material().uniformBlock("TextnodeBlock");
+	textnodeBlock_ = renderCommand_->material().uniformBlock(UniformNames::TextnodeBlock);
 	renderCommand_->material().setTexture(*font_->texture());
 	renderCommand_->geometry().setPrimitiveType(GL_TRIANGLE_STRIP);
 	renderCommand_->geometry().setNumElementsPerVertex(sizeof(Vertex) / sizeof(float));
@@ -272,7 +273,7 @@ void TextNode::processGlyph(const FontGlyph *glyph, Degenerate degen)
 void TextNode::updateRenderCommand()
 {
 	renderCommand_->transformation() = worldMatrix_;
-	textnodeBlock_->uniform("color")->setFloatVector(Colorf(absColor()).data());
+	textnodeBlock_->uniform(UniformNames::Color)->setFloatVector(Colorf(absColor()).data());
 }
 
 }
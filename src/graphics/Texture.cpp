@@ -9,6 +9,29 @@
 
 namespace ncine {
 
+namespace {
+	struct AsyncLoadContext
+	{
+		Texture::AsyncLoadCallback callback;
+		void *userData;
+	};
+
+	void onTextureFileRead(IAsyncFileReader::Result &result)
+	{
+		nctl::UniquePtr<AsyncLoadContext> context(static_cast<AsyncLoadContext *>(result.userData));
+
+		nctl::UniquePtr<Texture> texture;
+		if (result.succeeded)
+			texture = nctl::makeUnique<Texture>(result.filename, result.data, result.bytesRead);
+		context->callback(nctl::move(texture), context->userData);
+	}
+
+	void releaseAsyncLoadContext(void *userData)
+	{
+		delete static_cast<AsyncLoadContext *>(userData);
+	}
+}
+
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS and DESTRUCTOR
 ///////////////////////////////////////////////////////////
@@ -39,6 +62,27 @@ Texture::Texture(const char *filename, Vector2i size)
 {
 }
 
+Texture::Texture(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize)
+    : Texture(bufferName, bufferPtr, bufferSize, 0, 0)
+{
+}
+
+Texture::Texture(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize, int width, int height)
+    : Object(ObjectType::TEXTURE, bufferName), glTexture_(nctl::makeUnique<GLTexture>(GL_TEXTURE_2D)),
+      width_(0), height_(0), mipMapLevels_(1), isCompressed_(false), numChannels_(0), dataSize_(0),
+      minFiltering_(Filtering::NEAREST), magFiltering_(Filtering::NEAREST), wrapMode_(Wrap::CLAMP_TO_EDGE)
+{
+	ZoneScoped;
+	ZoneText(bufferName, strnlen(bufferName, nctl::String::MaxCStringLength));
+	glTexture_->bind();
+	setGLTextureLabel(bufferName);
+
+	nctl::UniquePtr<ITextureLoader> texLoader = ITextureLoader::createFromMemory(bufferName, bufferPtr, bufferSize);
+	load(*texLoader.get(), width, height);
+
+	RenderStatistics::addTexture(dataSize_);
+}
+
 Texture::~Texture()
 {
 	RenderStatistics::removeTexture(dataSize_);
@@ -48,6 +92,19 @@ Texture::~Texture()
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
 
+unsigned int Texture::loadAsync(const char *filename, AsyncLoadCallback callback, void *userData)
+{
+	ASSERT(filename);
+	ASSERT(callback);
+
+	AsyncLoadContext *context = new AsyncLoadContext{ callback, userData };
+	const unsigned int requestId = theServiceLocator().asyncFileReader().submitFileRead(filename, onTextureFileRead, releaseAsyncLoadContext, context);
+	if (requestId == 0)
+		delete context;
+
+	return requestId;
+}
+
 void Texture::setMinFiltering(Filtering filter)
 {
 	GLenum glFilter = GL_NEAREST;
@@ -17,24 +17,24 @@ TextureLoaderWebP::TextureLoaderWebP(nctl::UniquePtr<IFile> fileHandle)
 {
 	LOGI_X("Loading \"%s\"", fileHandle_->filename());
 
-	// Loading the whole file in memory
+	// Mapping the whole file to memory
 	fileHandle_->open(IFile::OpenMode::READ | IFile::OpenMode::BINARY);
 	const long int fileSize = fileHandle_->size();
-	nctl::UniquePtr<unsigned char[]> fileBuffer = nctl::makeUnique<unsigned char[]>(fileSize);
-	fileHandle_->read(fileBuffer.get(), fileSize);
+	const unsigned char *fileBuffer = fileHandle_->mapToMemory();
+	FATAL_ASSERT_MSG(fileBuffer != nullptr, "Cannot map the WebP file to memory");
 
-	if (WebPGetInfo(fileBuffer.get(), fileSize, &width_, &height_) == 0)
+	if (WebPGetInfo(fileBuffer, fileSize, &width_, &height_) == 0)
 	{
-		fileBuffer.reset(nullptr);
+		fileHandle_->unmapFromMemory();
 		FATAL_MSG("Cannot read WebP header");
 	}
 
 	LOGI_X("Header found: w:%d h:%d", width_, height_);
 
 	WebPBitstreamFeatures features;
-	if (WebPGetFeatures(fileBuffer.get(), fileSize, &features) != VP8_STATUS_OK)
+	if (WebPGetFeatures(fileBuffer, fileSize, &features) != VP8_STATUS_OK)
 	{
-		fileBuffer.reset(nullptr);
+		fileHandle_->unmapFromMemory();
 		FATAL_MSG("Cannot retrieve WebP features from headers");
 	}
 
@@ -49,22 +49,25 @@ TextureLoaderWebP::TextureLoaderWebP(nctl::UniquePtr<IFile> fileHandle)
 
 	if (features.has_alpha)
 	{
-		if (WebPDecodeRGBAInto(fileBuffer.get(), fileSize, pixels_.get(), dataSize_, width_ * bpp_) == nullptr)
+		if (WebPDecodeRGBAInto(fileBuffer, fileSize, pixels_.get(), dataSize_, width_ * bpp_) == nullptr)
 		{
-			fileBuffer.reset(nullptr);
+			fileHandle_->unmapFromMemory();
 			pixels_.reset(nullptr);
 			FATAL_MSG("Cannot decode RGBA WebP image");
 		}
 	}
 	else
 	{
-		if (WebPDecodeRGBInto(fileBuffer.get(), fileSize, pixels_.get(), dataSize_, width_ * bpp_) == nullptr)
+		if (WebPDecodeRGBInto(fileBuffer, fileSize, pixels_.get(), dataSize_, width_ * bpp_) == nullptr)
 		{
-			fileBuffer.reset(nullptr);
+			fileHandle_->unmapFromMemory();
 			pixels_.reset(nullptr);
 			FATAL_MSG("Cannot decode RGB WebP image");
 		}
 	}
+
+	// Compressed data is not needed anymore after decoding
+	fileHandle_->unmapFromMemory();
 }
 
 }
@@ -0,0 +1,19 @@
+#include "UniformNames.h"
+
+namespace ncine {
+
+namespace UniformNames {
+	const nctl::StringId Projection("projection");
+	const nctl::StringId ModelView("modelView");
+	const nctl::StringId Texture("uTexture");
+	const nctl::StringId Color("color");
+	const nctl::StringId TexRect("texRect");
+	const nctl::StringId SpriteSize("spriteSize");
+
+	const nctl::StringId SpriteBlock("SpriteBlock");
+	const nctl::StringId MeshSpriteBlock("MeshSpriteBlock");
+	const nctl::StringId TextnodeBlock("TextnodeBlock");
+	const nctl::StringId InstancesBlock("InstancesBlock");
+}
+
+}
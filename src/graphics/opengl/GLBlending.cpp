@@ -1,5 +1,6 @@
 #include "common_macros.h"
 #include "GLBlending.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -25,8 +26,11 @@ void GLBlending::enable()
 	if (enabled_ == false)
 	{
 		glEnable(GL_BLEND);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BLENDING);
 		enabled_ = true;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::BLENDING);
 }
 
 void GLBlending::disable()
@@ -34,8 +38,11 @@ void GLBlending::disable()
 	if (enabled_ == true)
 	{
 		glDisable(GL_BLEND);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BLENDING);
 		enabled_ = false;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::BLENDING);
 }
 
 void GLBlending::blendFunc(GLenum sfactor, GLenum dfactor)
@@ -43,9 +50,12 @@ void GLBlending::blendFunc(GLenum sfactor, GLenum dfactor)
 	if (sfactor != sfactor_ || dfactor != dfactor_)
 	{
 		glBlendFunc(sfactor, dfactor);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BLENDING);
 		sfactor_ = sfactor;
 		dfactor_ = dfactor;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::BLENDING);
 }
 
 void GLBlending::pushState()
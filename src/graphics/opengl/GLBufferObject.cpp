@@ -1,4 +1,5 @@
 #include "GLBufferObject.h"
+#include "GLCallCounters.h"
 #include "tracy_opengl.h"
 
 namespace ncine {
@@ -41,9 +42,11 @@ bool GLBufferObject::bind() const
 	if (boundBuffers_[target_] != glHandle_)
 	{
 		glBindBuffer(target_, glHandle_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
 		boundBuffers_[target_] = glHandle_;
 		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::BUFFER);
 	return false;
 }
 
@@ -52,9 +55,11 @@ bool GLBufferObject::unbind() const
 	if (boundBuffers_[target_] != 0)
 	{
 		glBindBuffer(target_, 0);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
 		boundBuffers_[target_] = 0;
 		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::BUFFER);
 	return false;
 }
 
@@ -89,7 +94,10 @@ void GLBufferObject::bindBufferBase(GLuint index)
 	ASSERT(index < MaxIndexBufferRange);
 
 	if (index >= MaxIndexBufferRange)
+	{
 		glBindBufferBase(target_, index, glHandle_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
+	}
 	else if (boundIndexBase_[index] != glHandle_)
 	{
 		boundBufferRange_[index].glHandle = -1;
@@ -97,7 +105,10 @@ void GLBufferObject::bindBufferBase(GLuint index)
 		boundBufferRange_[index].ptrsize = 0;
 		boundIndexBase_[index] = glHandle_;
 		glBindBufferBase(target_, index, glHandle_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::BUFFER);
 }
 
 void GLBufferObject::bindBufferRange(GLuint index, GLintptr offset, GLsizei ptrsize)
@@ -106,7 +117,10 @@ void GLBufferObject::bindBufferRange(GLuint index, GLintptr offset, GLsizei ptrs
 	ASSERT(index < MaxIndexBufferRange);
 
 	if (index >= MaxIndexBufferRange)
+	{
 		glBindBufferRange(target_, index, glHandle_, offset, ptrsize);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
+	}
 	else if (boundBufferRange_[index].glHandle != glHandle_ ||
 	         boundBufferRange_[index].offset != offset ||
 	         boundBufferRange_[index].ptrsize != ptrsize)
@@ -116,7 +130,10 @@ void GLBufferObject::bindBufferRange(GLuint index, GLintptr offset, GLsizei ptrs
 		boundBufferRange_[index].offset = offset;
 		boundBufferRange_[index].ptrsize = ptrsize;
 		glBindBufferRange(target_, index, glHandle_, offset, ptrsize);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::BUFFER);
 }
 
 void *GLBufferObject::mapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
@@ -159,9 +176,11 @@ bool GLBufferObject::bindHandle(GLenum target, GLuint glHandle)
 	if (boundBuffers_[target] != glHandle)
 	{
 		glBindBuffer(target, glHandle);
+		GLCallCounters::addIssued(GLCallCounters::Categories::BUFFER);
 		boundBuffers_[target] = glHandle;
 		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::BUFFER);
 	return false;
 }
 
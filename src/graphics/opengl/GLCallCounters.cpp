@@ -0,0 +1,40 @@
+#include "GLCallCounters.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// STATIC DEFINITIONS
+///////////////////////////////////////////////////////////
+
+GLCallCounters::Counters GLCallCounters::counters_[Categories::COUNT];
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+const char *GLCallCounters::categoryName(Categories::Enum category)
+{
+	switch (category)
+	{
+		case Categories::PROGRAM: return "Program";
+		case Categories::VERTEX_ARRAY: return "Vertex Array";
+		case Categories::BUFFER: return "Buffer";
+		case Categories::TEXTURE: return "Texture";
+		case Categories::BLENDING: return "Blending";
+		case Categories::DEPTH: return "Depth";
+		case Categories::SCISSOR: return "Scissor";
+		case Categories::CULL_FACE: return "Cull Face";
+		case Categories::VIEWPORT: return "Viewport";
+		case Categories::COUNT: return "";
+	}
+
+	return "";
+}
+
+void GLCallCounters::reset()
+{
+	for (unsigned int i = 0; i < Categories::COUNT; i++)
+		counters_[i] = Counters();
+}
+
+}
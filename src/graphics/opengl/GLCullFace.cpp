@@ -1,5 +1,6 @@
 #include "common_macros.h"
 #include "GLCullFace.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -23,8 +24,11 @@ void GLCullFace::enable()
 	if (enabled_ == false)
 	{
 		glEnable(GL_CULL_FACE);
+		GLCallCounters::addIssued(GLCallCounters::Categories::CULL_FACE);
 		enabled_ = true;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::CULL_FACE);
 }
 
 void GLCullFace::disable()
@@ -32,8 +36,11 @@ void GLCullFace::disable()
 	if (enabled_ == true)
 	{
 		glDisable(GL_CULL_FACE);
+		GLCallCounters::addIssued(GLCallCounters::Categories::CULL_FACE);
 		enabled_ = false;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::CULL_FACE);
 }
 
 void GLCullFace::set(GLenum mode)
@@ -41,8 +48,11 @@ void GLCullFace::set(GLenum mode)
 	if (mode != mode_)
 	{
 		glCullFace(mode);
+		GLCallCounters::addIssued(GLCallCounters::Categories::CULL_FACE);
 		mode_ = mode;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::CULL_FACE);
 }
 
 void GLCullFace::pushState()
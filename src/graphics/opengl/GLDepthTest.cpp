@@ -1,5 +1,6 @@
 #include "common_macros.h"
 #include "GLDepthTest.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -23,8 +24,11 @@ void GLDepthTest::enable()
 	if (enabled_ == false)
 	{
 		glEnable(GL_DEPTH_TEST);
+		GLCallCounters::addIssued(GLCallCounters::Categories::DEPTH);
 		enabled_ = true;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::DEPTH);
 }
 
 void GLDepthTest::disable()
@@ -32,8 +36,11 @@ void GLDepthTest::disable()
 	if (enabled_ == true)
 	{
 		glDisable(GL_DEPTH_TEST);
+		GLCallCounters::addIssued(GLCallCounters::Categories::DEPTH);
 		enabled_ = false;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::DEPTH);
 }
 
 void GLDepthTest::enableDepthMask()
@@ -41,8 +48,11 @@ void GLDepthTest::enableDepthMask()
 	if (depthMaskEnabled_ == false)
 	{
 		glDepthMask(GL_TRUE);
+		GLCallCounters::addIssued(GLCallCounters::Categories::DEPTH);
 		depthMaskEnabled_ = true;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::DEPTH);
 }
 
 void GLDepthTest::disableDepthMask()
@@ -50,8 +60,11 @@ void GLDepthTest::disableDepthMask()
 	if (depthMaskEnabled_ == true)
 	{
 		glDepthMask(GL_FALSE);
+		GLCallCounters::addIssued(GLCallCounters::Categories::DEPTH);
 		depthMaskEnabled_ = false;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::DEPTH);
 }
 
 void GLDepthTest::pushState()
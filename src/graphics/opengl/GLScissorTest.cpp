@@ -1,5 +1,6 @@
 #include "common_macros.h"
 #include "GLScissorTest.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -29,18 +30,24 @@ void GLScissorTest::enable(GLint x, GLint y, GLsizei width, GLsizei height)
 	if (enabled_ == false)
 	{
 		glEnable(GL_SCISSOR_TEST);
+		GLCallCounters::addIssued(GLCallCounters::Categories::SCISSOR);
 		enabled_ = true;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::SCISSOR);
 
 	if (x != x_ || y != y_ || width != width_ || height != height_)
 	{
 		FATAL_ASSERT(width > 0 && height > 0);
 		glScissor(x, y, width, height);
+		GLCallCounters::addIssued(GLCallCounters::Categories::SCISSOR);
 		x_ = x;
 		y_ = y;
 		width_ = width;
 		height_ = height;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::SCISSOR);
 }
 
 void GLScissorTest::enable()
@@ -49,8 +56,11 @@ void GLScissorTest::enable()
 	{
 		FATAL_ASSERT(width_ > 0 && height_ > 0);
 		glEnable(GL_SCISSOR_TEST);
+		GLCallCounters::addIssued(GLCallCounters::Categories::SCISSOR);
 		enabled_ = true;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::SCISSOR);
 }
 
 void GLScissorTest::disable()
@@ -58,8 +68,11 @@ void GLScissorTest::disable()
 	if (enabled_ == true)
 	{
 		glDisable(GL_SCISSOR_TEST);
+		GLCallCounters::addIssued(GLCallCounters::Categories::SCISSOR);
 		enabled_ = false;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::SCISSOR);
 }
 
 void GLScissorTest::pushState()
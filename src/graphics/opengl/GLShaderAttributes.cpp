@@ -45,17 +45,17 @@ GLVertexFormat::Attribute *GLShaderAttributes::attribute(const char *name)
 
 	if (shaderProgram_)
 	{
-		int location = -1;
-		const bool attributeFound = attributeLocations_.contains(name, location);
+		const nctl::StringView nameView(name);
+		const int *location = attributeLocations_.find(nameView, nameView.hash());
 
-		if (attributeFound == false)
+		if (location == nullptr)
 		{
 			// Returning the dummy vertex attribute to prevent the application from crashing
 			vertexAttribute = &attributeNotFound_;
 			LOGW_X("Attribute \"%s\" not found in shader program %u", name, shaderProgram_->glHandle());
 		}
 		else
-			vertexAttribute = &vertexFormat_[location];
+			vertexAttribute = &vertexFormat_[*location];
 	}
 	else
 		LOGE_X("Cannot find attribute \"%s\", no shader program associated", name);
@@ -1,6 +1,7 @@
 #include "GLShaderProgram.h"
 #include "GLShader.h"
 #include "GLDebug.h"
+#include "GLCallCounters.h"
 #include <nctl/String.h>
 #include <cstring> // for strnlen()
 #include "tracy.h"
@@ -12,6 +13,7 @@ namespace ncine {
 ///////////////////////////////////////////////////////////
 
 GLuint GLShaderProgram::boundProgram_ = 0;
+CompactIdPool GLShaderProgram::sortIds_;
 
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS and DESTRUCTOR
@@ -23,7 +25,7 @@ GLShaderProgram::GLShaderProgram()
 }
 
 GLShaderProgram::GLShaderProgram(QueryPhase queryPhase)
-    : glHandle_(0), attachedShaders_(AttachedShadersInitialSize),
+    : glHandle_(0), sortId_(sortIds_.acquire()), attachedShaders_(AttachedShadersInitialSize),
       status_(Status::NOT_LINKED), queryPhase_(queryPhase),
       uniformsSize_(0), uniformBlocksSize_(0), uniforms_(UniformsInitialSize),
       uniformBlocks_(UniformBlocksInitialSize), attributes_(AttributesInitialSize)
@@ -55,6 +57,7 @@ GLShaderProgram::~GLShaderProgram()
 		glUseProgram(0);
 
 	glDeleteProgram(glHandle_);
+	sortIds_.release(sortId_);
 }
 
 ///////////////////////////////////////////////////////////
@@ -112,14 +115,18 @@ void GLShaderProgram::link(Introspection introspection)
 		status_ = GLShaderProgram::Status::LINKED_WITH_DEFERRED_QUERIES;
 }
 
-void GLShaderProgram::use()
+bool GLShaderProgram::use()
 {
 	if (boundProgram_ != glHandle_)
 	{
 		deferredQueries();
 		glUseProgram(glHandle_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::PROGRAM);
 		boundProgram_ = glHandle_;
+		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::PROGRAM);
+	return false;
 }
 
 ///////////////////////////////////////////////////////////
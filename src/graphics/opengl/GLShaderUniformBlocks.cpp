@@ -1,7 +1,6 @@
 #include "GLShaderUniformBlocks.h"
 #include "RenderResources.h"
 #include <nctl/StaticHashMapIterator.h>
-#include <cstring> // for memcpy()
 
 namespace ncine {
 
@@ -28,16 +27,15 @@ GLShaderUniformBlocks::GLShaderUniformBlocks(GLShaderProgram *shaderProgram)
 
 void GLShaderUniformBlocks::bind()
 {
-	if (uboParams_.object)
+	unsigned int index = 0;
+	for (GLUniformBlockCache &uniformBlockCache : uniformBlockCaches_)
 	{
-		uboParams_.object->bind();
-
-		GLintptr moreOffset = 0;
-		for (GLUniformBlockCache &uniformBlockCache : uniformBlockCaches_)
+		const RenderBuffersManager::Parameters &uboParams = uboParams_[index++];
+		if (uboParams.object)
 		{
+			uboParams.object->bind();
 			uniformBlockCache.setBlockBinding(uniformBlockCache.index());
-			uboParams_.object->bindBufferRange(uniformBlockCache.bindingIndex(), uboParams_.offset + moreOffset, uniformBlockCache.usedSize());
-			moreOffset += uniformBlockCache.usedSize();
+			uboParams.object->bindBufferRange(uniformBlockCache.bindingIndex(), uboParams.offset, uniformBlockCache.usedSize());
 		}
 	}
 }
@@ -53,6 +51,8 @@ void GLShaderUniformBlocks::setProgram(GLShaderProgram *shaderProgram)
 	shaderProgram_ = shaderProgram;
 	shaderProgram_->deferredQueries();
 	uniformBlockCaches_.clear();
+	for (RenderBuffersManager::Parameters &uboParams : uboParams_)
+		uboParams = RenderBuffersManager::Parameters();
 
 	if (shaderProgram_->status() == GLShaderProgram::Status::LINKED_WITH_INTROSPECTION)
 		importUniformBlocks();
@@ -77,23 +77,13 @@ void GLShaderUniformBlocks::setUniformsDataPointer(GLubyte *dataPointer)
 GLUniformBlockCache *GLShaderUniformBlocks::uniformBlock(const char *name)
 {
 	ASSERT(name);
-	GLUniformBlockCache *uniformBlockCache = nullptr;
-
-	if (shaderProgram_)
-	{
-		uniformBlockCache = uniformBlockCaches_.find(name);
-
-		if (uniformBlockCache == nullptr)
-		{
-			// Returning the dummy uniform cache to prevent the application from crashing
-			uniformBlockCache = &uniformBlockNotFound_;
-			LOGW_X("Uniform block \"%s\" not found in shader program %u", name, shaderProgram_->glHandle());
-		}
-	}
-	else
-		LOGE_X("Cannot find uniform block \"%s\", no shader program associated", name);
+	const nctl::StringView nameView(name);
+	return uniformBlock(nameView, nameView.hash());
+}
 
-	return uniformBlockCache;
+GLUniformBlockCache *GLShaderUniformBlocks::uniformBlock(const nctl::StringId &name)
+{
+	return uniformBlock(name.view(), name.hash());
 }
 
 void GLShaderUniformBlocks::commitUniformBlocks()
@@ -102,16 +92,14 @@ void GLShaderUniformBlocks::commitUniformBlocks()
 	{
 		if (shaderProgram_->status() == GLShaderProgram::Status::LINKED_WITH_INTROSPECTION)
 		{
-			int totalUsedSize = 0;
+			// Each block has its own aligned range, so that identical blocks of different commands can share it
+			unsigned int index = 0;
 			for (GLUniformBlockCache &uniformBlockCache : uniformBlockCaches_)
-				totalUsedSize += uniformBlockCache.usedSize();
-
-			if (totalUsedSize > 0)
 			{
-				const RenderBuffersManager::BufferTypes::Enum bufferType = RenderBuffersManager::BufferTypes::UNIFORM;
-				uboParams_ = RenderResources::buffersManager().acquireMemory(bufferType, totalUsedSize);
-				if (uboParams_.mapBase)
-					memcpy(uboParams_.mapBase + uboParams_.offset, dataPointer_, totalUsedSize);
+				RenderBuffersManager::Parameters &uboParams = uboParams_[index++];
+				uboParams = RenderBuffersManager::Parameters();
+				if (uniformBlockCache.usedSize() > 0)
+					uboParams = RenderResources::buffersManager().acquireUniformMemory(uniformBlockCache.dataPointer(), uniformBlockCache.usedSize());
 			}
 		}
 	}
@@ -123,6 +111,27 @@ void GLShaderUniformBlocks::commitUniformBlocks()
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
+GLUniformBlockCache *GLShaderUniformBlocks::uniformBlock(const nctl::StringView &name, nctl::hash_t hash)
+{
+	GLUniformBlockCache *uniformBlockCache = nullptr;
+
+	if (shaderProgram_)
+	{
+		uniformBlockCache = uniformBlockCaches_.find(name, hash);
+
+		if (uniformBlockCache == nullptr)
+		{
+			// Returning the dummy uniform cache to prevent the application from crashing
+			uniformBlockCache = &uniformBlockNotFound_;
+			LOGW_X("Uniform block \"%.*s\" not found in shader program %u", static_cast<int>(name.length()), name.data(), shaderProgram_->glHandle());
+		}
+	}
+	else
+		LOGE_X("Cannot find uniform block \"%.*s\", no shader program associated", static_cast<int>(name.length()), name.data());
+
+	return uniformBlockCache;
+}
+
 void GLShaderUniformBlocks::importUniformBlocks()
 {
 	const unsigned int count = shaderProgram_->uniformBlocks_.size();
@@ -62,23 +62,13 @@ void GLShaderUniforms::setUniformsDataPointer(GLubyte *dataPointer)
 GLUniformCache *GLShaderUniforms::uniform(const char *name)
 {
 	ASSERT(name);
-	GLUniformCache *uniformCache = nullptr;
-
-	if (shaderProgram_)
-	{
-		uniformCache = uniformCaches_.find(name);
-
-		if (uniformCache == nullptr)
-		{
-			// Returning the dummy uniform cache to prevent the application from crashing
-			uniformCache = &uniformNotFound_;
-			LOGW_X("Uniform \"%s\" not found in shader program %u", name, shaderProgram_->glHandle());
-		}
-	}
-	else
-		LOGE_X("Cannot find uniform \"%s\", no shader program associated", name);
+	const nctl::StringView nameView(name);
+	return uniform(nameView, nameView.hash());
+}
 
-	return uniformCache;
+GLUniformCache *GLShaderUniforms::uniform(const nctl::StringId &name)
+{
+	return uniform(name.view(), name.hash());
 }
 
 void GLShaderUniforms::commitUniforms()
@@ -99,6 +89,27 @@ void GLShaderUniforms::commitUniforms()
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
+GLUniformCache *GLShaderUniforms::uniform(const nctl::StringView &name, nctl::hash_t hash)
+{
+	GLUniformCache *uniformCache = nullptr;
+
+	if (shaderProgram_)
+	{
+		uniformCache = uniformCaches_.find(name, hash);
+
+		if (uniformCache == nullptr)
+		{
+			// Returning the dummy uniform cache to prevent the application from crashing
+			uniformCache = &uniformNotFound_;
+			LOGW_X("Uniform \"%.*s\" not found in shader program %u", static_cast<int>(name.length()), name.data(), shaderProgram_->glHandle());
+		}
+	}
+	else
+		LOGE_X("Cannot find uniform \"%.*s\", no shader program associated", static_cast<int>(name.length()), name.data());
+
+	return uniformCache;
+}
+
 void GLShaderUniforms::importUniforms()
 {
 	const unsigned int count = shaderProgram_->uniforms_.size();
@@ -1,4 +1,5 @@
 #include "GLTexture.h"
+#include "GLCallCounters.h"
 #include "tracy_opengl.h"
 
 namespace ncine {
@@ -9,13 +10,14 @@ namespace ncine {
 
 GLHashMap<GLTextureMappingFunc::Size, GLTextureMappingFunc> GLTexture::boundTextures_[MaxTextureUnits];
 unsigned int GLTexture::boundUnit_ = 0;
+CompactIdPool GLTexture::sortIds_;
 
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS AND DESTRUCTOR
 ///////////////////////////////////////////////////////////
 
 GLTexture::GLTexture(GLenum target)
-    : glHandle_(0), target_(target), textureUnit_(0), imageFormat_(GL_RGBA)
+    : glHandle_(0), sortId_(sortIds_.acquire()), target_(target), textureUnit_(0), imageFormat_(GL_RGBA)
 {
 	glGenTextures(1, &glHandle_);
 }
@@ -26,19 +28,21 @@ GLTexture::~GLTexture()
 		unbind();
 
 	glDeleteTextures(1, &glHandle_);
+	sortIds_.release(sortId_);
 }
 
 ///////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-void GLTexture::bind(unsigned int textureUnit) const
+bool GLTexture::bind(unsigned int textureUnit) const
 {
 	FATAL_ASSERT(textureUnit < MaxTextureUnits);
 
 	if (boundUnit_ != textureUnit)
 	{
 		glActiveTexture(GL_TEXTURE0 + textureUnit);
+		GLCallCounters::addIssued(GLCallCounters::Categories::TEXTURE);
 		boundUnit_ = textureUnit;
 		textureUnit_ = textureUnit;
 	}
@@ -46,8 +50,12 @@ void GLTexture::bind(unsigned int textureUnit) const
 	if (boundTextures_[textureUnit][target_] != glHandle_)
 	{
 		glBindTexture(target_, glHandle_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::TEXTURE);
 		boundTextures_[textureUnit][target_] = glHandle_;
+		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::TEXTURE);
+	return false;
 }
 
 void GLTexture::unbind() const
@@ -55,14 +63,18 @@ void GLTexture::unbind() const
 	if (boundUnit_ != textureUnit_)
 	{
 		glActiveTexture(GL_TEXTURE0 + textureUnit_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::TEXTURE);
 		boundUnit_ = textureUnit_;
 	}
 
 	if (boundTextures_[textureUnit_][target_] != 0)
 	{
 		glBindTexture(target_, 0);
+		GLCallCounters::addIssued(GLCallCounters::Categories::TEXTURE);
 		boundTextures_[textureUnit_][target_] = 0;
 	}
+	else
+		GLCallCounters::addFiltered(GLCallCounters::Categories::TEXTURE);
 }
 
 void GLTexture::texImage2D(GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data)
@@ -123,15 +135,18 @@ bool GLTexture::bindHandle(GLenum target, GLuint glHandle, unsigned int textureU
 	if (boundUnit_ != textureUnit)
 	{
 		glActiveTexture(GL_TEXTURE0 + textureUnit);
+		GLCallCounters::addIssued(GLCallCounters::Categories::TEXTURE);
 		boundUnit_ = textureUnit;
 	}
 
 	if (boundTextures_[textureUnit][target] != glHandle)
 	{
 		glBindTexture(target, glHandle);
+		GLCallCounters::addIssued(GLCallCounters::Categories::TEXTURE);
 		boundTextures_[textureUnit][target] = glHandle;
 		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::TEXTURE);
 	return false;
 }
 
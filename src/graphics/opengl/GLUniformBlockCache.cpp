@@ -73,7 +73,8 @@ void GLUniformBlockCache::setDataPointer(GLubyte *dataPointer)
 
 GLUniformCache *GLUniformBlockCache::uniform(const char *name)
 {
-	return uniformCaches_.find(name);
+	const nctl::StringView nameView(name);
+	return uniformCaches_.find(nameView, nameView.hash());
 }
 
 void GLUniformBlockCache::setBlockBinding(GLuint blockBinding)
@@ -1,4 +1,5 @@
 #include "GLVertexArrayObject.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -35,9 +36,11 @@ bool GLVertexArrayObject::bind() const
 	if (boundVAO_ != glHandle_)
 	{
 		glBindVertexArray(glHandle_);
+		GLCallCounters::addIssued(GLCallCounters::Categories::VERTEX_ARRAY);
 		boundVAO_ = glHandle_;
 		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::VERTEX_ARRAY);
 	return false;
 }
 
@@ -46,9 +49,11 @@ bool GLVertexArrayObject::unbind() const
 	if (boundVAO_ != 0)
 	{
 		glBindVertexArray(0);
+		GLCallCounters::addIssued(GLCallCounters::Categories::VERTEX_ARRAY);
 		boundVAO_ = 0;
 		return true;
 	}
+	GLCallCounters::addFiltered(GLCallCounters::Categories::VERTEX_ARRAY);
 	return false;
 }
 
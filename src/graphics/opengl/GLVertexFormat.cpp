@@ -121,4 +121,39 @@ bool GLVertexFormat::operator!=(const GLVertexFormat &other) const
 	return !operator==(other);
 }
 
+namespace {
+
+	void hashCombine(nctl::hash_t &hash, uint64_t value)
+	{
+		hash ^= static_cast<nctl::hash_t>(value ^ (value >> 32)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	}
+
+}
+
+nctl::hash_t GLVertexFormat::hash() const
+{
+	nctl::hash_t hash = 0;
+	hashCombine(hash, reinterpret_cast<uintptr_t>(ibo_));
+
+	// Disabled attributes are all equal, whatever the values of their other members
+	for (unsigned int i = 0; i < MaxAttributes; i++)
+	{
+		const Attribute &attribute = attributes_[i];
+		if (attribute.enabled_ == false)
+			continue;
+
+		hashCombine(hash, i);
+		hashCombine(hash, attribute.vbo_ ? attribute.vbo_->glHandle() : 0);
+		hashCombine(hash, attribute.index_);
+		hashCombine(hash, static_cast<uint64_t>(attribute.size_));
+		hashCombine(hash, attribute.type_);
+		hashCombine(hash, attribute.normalized_);
+		hashCombine(hash, static_cast<uint64_t>(attribute.stride_));
+		hashCombine(hash, reinterpret_cast<uintptr_t>(attribute.pointer_));
+		hashCombine(hash, attribute.baseOffset_);
+	}
+
+	return hash;
+}
+
 }
@@ -3,15 +3,22 @@
 
 #include "IIndexer.h"
 #include <nctl/Array.h>
+#include <nctl/SwissHashMap.h>
 #include "Object.h"
 
 namespace ncine {
 
-/// Keeps track of allocated objects in a growing only array
+/// Keeps track of allocated objects in an array of reusable slots
+/*!
+ * Object ids are handles made of a slot index and a generation counter,
+ * so that ids of removed objects are detected as stale when their slot is reused.
+ * When enabled, objects with a name are also indexed by its hash, objects sharing the same hash are chained together.
+ */
 class ArrayIndexer : public IIndexer
 {
   public:
-	ArrayIndexer();
+	/// Creates an indexer, with or without the index of object names
+	explicit ArrayIndexer(bool withNameIndex);
 	~ArrayIndexer() override;
 
 	unsigned int addObject(Object *object) override;
@@ -19,15 +26,65 @@ class ArrayIndexer : public IIndexer
 
 	Object *object(unsigned int id) const override;
 
-	bool isEmpty() const override { return numObjects_ == 0; }
-	unsigned int size() const override { return numObjects_; }
+	void updateObjectName(unsigned int id) override;
+	Object *firstWithName(const nctl::StringView &name, nctl::hash_t hash) const override;
+	Object *nextWithName(const Object *object) const override;
+
+	bool isEmpty() const override { return liveSlots_.isEmpty(); }
+	unsigned int size() const override { return liveSlots_.size(); }
 
 	void logReport() const override;
 
+	/// Returns the number of allocated slots, either live or free
+	inline unsigned int numSlots() const { return slots_.size(); }
+	/// Returns true if objects are also indexed by name
+	inline bool hasNameIndex() const { return withNameIndex_; }
+
   private:
-	unsigned int numObjects_;
-	unsigned int nextId_;
-	nctl::Array<Object *> pointers_;
+	/// Number of bits of an id used for the slot index, the remaining ones are for the generation
+	static const unsigned int IndexBits = 20;
+	static const unsigned int IndexMask = (1U << IndexBits) - 1;
+	static const unsigned int MaxGeneration = (1U << (32 - IndexBits)) - 1;
+
+	struct Slot
+	{
+		Object *object = nullptr;
+		unsigned int generation = 0;
+		/// Position of the slot index in the array of live slots
+		unsigned int liveIndex = 0;
+		/// The next slot in the free list, zero for the last one
+		unsigned int nextFree = 0;
+
+		/// The hash of the indexed name
+		nctl::hash_t nameHash = 0;
+		/// The next slot in the chain with the same name hash, zero for the last one
+		unsigned int nextNamed = 0;
+		/// True if the object name is in the index
+		bool nameIndexed = false;
+	};
+
+	/// Slot zero is reserved, so that zero is never a valid id
+	nctl::Array<Slot> slots_;
+	/// Indices of the slots holding an object, for dense iteration
+	nctl::Array<unsigned int> liveSlots_;
+	/// Free slots are reused in FIFO order to spread generation increments among them
+	unsigned int firstFree_;
+	unsigned int lastFree_;
+
+	/// True if objects are also indexed by name
+	bool withNameIndex_;
+
+	/// Maps a name hash to the index of the first slot in its chain
+	nctl::SwissHashMap<nctl::hash_t, unsigned int, nctl::IdentityHashFunc<nctl::hash_t>> nameHeads_;
+
+	inline static unsigned int makeId(unsigned int slotIndex, unsigned int generation) { return (generation << IndexBits) | slotIndex; }
+	/// Returns the slot index of a valid id, or zero if the id is stale or invalid
+	unsigned int slotIndex(unsigned int id) const;
+
+	void addName(unsigned int slotIndex);
+	void removeName(unsigned int slotIndex);
+	/// Follows a chain of slots with the same name hash until an object with the specified name is found
+	Object *findInChain(unsigned int slotIndex, const nctl::StringView &name) const;
 
 	/// Deleted copy constructor
 	ArrayIndexer(const ArrayIndexer &) = delete;
@@ -0,0 +1,96 @@
+#ifndef CLASS_NCINE_ASYNCFILEREADER
+#define CLASS_NCINE_ASYNCFILEREADER
+
+#include "IAsyncFileReader.h"
+#include <nctl/List.h>
+#include <nctl/String.h>
+#include "TimeStamp.h"
+#ifdef WITH_THREADS
+	#include "ThreadSync.h"
+	#include "Thread.h"
+#endif
+
+namespace ncine {
+
+/// The asynchronous file reader class
+/*!
+ * Requests are read by a dedicated worker thread. When threads are not available they are
+ * read synchronously at the beginning of the next `update()` call, still deferring the callbacks.
+ * \note Files are opened with `IFile::createFileHandle()` from the worker thread,
+ * pack archives should not be mounted or unmounted while requests are pending.
+ */
+class AsyncFileReader : public IAsyncFileReader
+{
+  public:
+	AsyncFileReader();
+	~AsyncFileReader() override;
+
+	unsigned int submitRead(const char *filename, unsigned char *buffer, unsigned long int offset,
+	                        unsigned long int bytes, CompletionCallback callback, void *userData) override;
+	unsigned int submitFileRead(const char *filename, CompletionCallback callback, void *userData) override;
+	unsigned int submitFileRead(const char *filename, CompletionCallback callback, ReleaseCallback releaseCallback, void *userData) override;
+	bool cancel(unsigned int requestId) override;
+
+	void update() override;
+
+	unsigned int numPendingRequests() const override;
+	inline const Statistics &statistics() const override { return statistics_; }
+
+  private:
+	struct Request
+	{
+		explicit Request(const char *name)
+		    : filename(name), offset(0), bytes(0), callback(nullptr), releaseCallback(nullptr), isCanceled(false) {}
+
+		nctl::String filename;
+		unsigned long int offset;
+		/// Number of bytes to read, ignored for whole file requests
+		unsigned long int bytes;
+		CompletionCallback callback;
+		ReleaseCallback releaseCallback;
+		TimeStamp submitTime;
+		/// Set when the request is canceled while the worker is reading it
+		bool isCanceled;
+		Result result;
+	};
+
+	/// Requests waiting to be read
+	nctl::List<nctl::UniquePtr<Request>> pendingRequests_;
+	/// Requests read and waiting for their callback to be invoked
+	nctl::List<nctl::UniquePtr<Request>> completedRequests_;
+	/// Requests taken by `update()` whose callback has not been invoked yet
+	nctl::List<nctl::UniquePtr<Request>> deliveringRequests_;
+	/// The request currently being read by the worker thread
+	Request *inFlightRequest_;
+	unsigned int nextRequestId_;
+	Statistics statistics_;
+
+#ifdef WITH_THREADS
+	Thread thread_;
+	/// Protects the request lists, the in-flight request and the quit flag
+	mutable Mutex queueMutex_;
+	CondVariable queueCV_;
+	/// Held by the worker thread while reading a request
+	Mutex readMutex_;
+	bool shouldQuit_;
+
+	static void workerFunction(void *arg);
+#endif
+
+	unsigned int submitRequest(nctl::UniquePtr<Request> request);
+	/// Removes a request from a list and returns it, or an empty pointer if it is not found
+	static nctl::UniquePtr<Request> takeRequest(nctl::List<nctl::UniquePtr<Request>> &requests, unsigned int requestId);
+	/// Invokes the release callback of a request that is not going to be completed
+	static void releaseRequest(Request &request);
+	/// Opens the file and reads the requested range, filling the request result
+	static void processRequest(Request &request);
+
+	/// Deleted copy constructor
+	AsyncFileReader(const AsyncFileReader &) = delete;
+	/// Deleted assignment operator
+	AsyncFileReader &operator=(const AsyncFileReader &) = delete;
+};
+
+}
+
+#endif
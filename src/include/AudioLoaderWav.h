@@ -14,6 +14,7 @@ class AudioLoaderWav : public IAudioLoader
 
 	unsigned long int read(char *buffer, unsigned long int bufferSize) const override;
 	void rewind() const override;
+	const char *mapSamples() override;
 
   private:
 	/// Header for the RIFF WAVE format
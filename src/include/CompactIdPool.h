@@ -0,0 +1,41 @@
+#ifndef CLASS_NCINE_COMPACTIDPOOL
+#define CLASS_NCINE_COMPACTIDPOOL
+
+#include <nctl/Array.h>
+
+namespace ncine {
+
+/// A class that hands out small integer ids, reusing the released ones first
+/*! Ids start from one, zero is left to represent no object at all. */
+class CompactIdPool
+{
+  public:
+	CompactIdPool()
+	    : nextId_(1), freeIds_(16) {}
+
+	/// Returns an id that is not in use
+	inline unsigned int acquire()
+	{
+		if (freeIds_.isEmpty() == false)
+		{
+			const unsigned int id = freeIds_.back();
+			freeIds_.popBack();
+			return id;
+		}
+		return nextId_++;
+	}
+
+	/// Makes an id available again
+	inline void release(unsigned int id) { freeIds_.pushBack(id); }
+
+	/// Returns the number of ids currently in use
+	inline unsigned int numUsed() const { return nextId_ - 1 - freeIds_.size(); }
+
+  private:
+	unsigned int nextId_;
+	nctl::Array<unsigned int> freeIds_;
+};
+
+}
+
+#endif
@@ -110,6 +110,8 @@ class DLL_PUBLIC FntParser
 	explicit FntParser(const char *fntFilename);
 	/// Parses a FNT file from a memory buffer of the specified size
 	FntParser(const char *buffer, long int size);
+	/// Parses a FNT file from the characters of a string view
+	explicit FntParser(const nctl::StringView &buffer);
 
 	/// Returns the "info" tag structure from a parsed FNT file
 	const InfoTag &infoTag() const { return infoTag_; }
@@ -170,8 +172,8 @@ class DLL_PUBLIC FntParser
 
 	/// Loads a FNT file in a memory buffer then parses it
 	void parseFntFile(IFile *fileHandle);
-	/// Parses a FNT file from a memory buffer of the specified size
-	void parseFntBuffer(const char *buffer, long int size);
+	/// Parses a FNT file from the characters of a string view
+	void parseFntBuffer(const nctl::StringView &buffer);
 
 	void parseInfoTag(const char *buffer);
 	void parseCommonTag(const char *buffer);
@@ -1,7 +1,7 @@
 #ifndef CLASS_NCINE_FONTGLYPH
 #define CLASS_NCINE_FONTGLYPH
 
-#include <nctl/Array.h>
+#include <nctl/SmallArray.h>
 #include "Rect.h"
 
 namespace ncine {
@@ -55,7 +55,8 @@ class FontGlyph
 	int xOffset_;
 	int yOffset_;
 	int xAdvance_;
-	nctl::Array<Kerning> kernings_;
+	/// Most glyphs have only a few kerning pairs, they are stored inline
+	nctl::SmallArray<Kerning, 4> kernings_;
 };
 
 inline void FontGlyph::set(unsigned int x, unsigned int y, unsigned int width, unsigned int height,
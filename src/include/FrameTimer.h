@@ -2,6 +2,7 @@
 #define CLASS_NCINE_FRAMETIMER
 
 #include "TimeStamp.h"
+#include "FrameTimeStatistics.h"
 
 namespace ncine {
 
@@ -13,7 +14,8 @@ class FrameTimer
 	FrameTimer(float logInterval, float avgInterval);
 
 	/// Adds a frame to the counter and calculates the interval since the previous one
-	void addFrame();
+	/*! The `timings` array, indexed by `Application::Timings`, holds the duration of the phases of the previous frame. */
+	void addFrame(const float *timings);
 	/// Resets the time stamp for the beginning of a frame
 	void start() { frameStart_ = TimeStamp::now(); }
 	/// Returns the total number of frames counted
@@ -24,6 +26,8 @@ class FrameTimer
 	inline float frameInterval() const { return frameStart_.secondsSince(); }
 	/// Returns the average FPS during the update interval
 	inline float averageFps() const { return fps_; }
+	/// Returns the statistics about the duration of the last frames and of their phases
+	inline FrameTimeStatistics &statistics() { return statistics_; }
 
   private:
 	/// Number of seconds between two log events (user defined)
@@ -50,6 +54,8 @@ class FrameTimer
 
 	/// Average FPS calulated during the specified interval
 	float fps_;
+
+	FrameTimeStatistics statistics_;
 };
 
 }
@@ -0,0 +1,62 @@
+#ifndef CLASS_NCINE_GLCALLCOUNTERS
+#define CLASS_NCINE_GLCALLCOUNTERS
+
+namespace ncine {
+
+/// A class to count the OpenGL state calls issued by the wrappers and the redundant ones they filtered out
+/*! The counters accumulate until `RenderStatistics` collects them once per frame. */
+class GLCallCounters
+{
+  public:
+	struct Categories
+	{
+		enum Enum
+		{
+			PROGRAM = 0,
+			VERTEX_ARRAY,
+			BUFFER,
+			TEXTURE,
+			BLENDING,
+			DEPTH,
+			SCISSOR,
+			CULL_FACE,
+			VIEWPORT,
+
+			COUNT
+		};
+	};
+
+	struct Counters
+	{
+		Counters()
+		    : issued(0), filtered(0) {}
+
+		/// Number of OpenGL calls that reached the driver
+		unsigned int issued;
+		/// Number of requests that did not change the state and made no OpenGL call
+		unsigned int filtered;
+	};
+
+	/// Returns the name of the specified category
+	static const char *categoryName(Categories::Enum category);
+
+	static inline const Counters &counters(Categories::Enum category) { return counters_[category]; }
+	static inline void addIssued(Categories::Enum category) { counters_[category].issued++; }
+	static inline void addFiltered(Categories::Enum category) { counters_[category].filtered++; }
+	static void reset();
+
+  private:
+	static Counters counters_[Categories::COUNT];
+
+	GLCallCounters() = delete;
+	~GLCallCounters() = delete;
+
+	/// Deleted copy constructor
+	GLCallCounters(const GLCallCounters &) = delete;
+	/// Deleted assignment operator
+	GLCallCounters &operator=(const GLCallCounters &) = delete;
+};
+
+}
+
+#endif
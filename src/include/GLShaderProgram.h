@@ -5,6 +5,7 @@
 #include "GLUniform.h"
 #include "GLUniformBlock.h"
 #include "GLAttribute.h"
+#include "CompactIdPool.h"
 
 namespace ncine {
 
@@ -44,6 +45,8 @@ class GLShaderProgram
 	~GLShaderProgram();
 
 	inline GLuint glHandle() const { return glHandle_; }
+	/// Returns a small id assigned by the engine, used to sort render commands
+	inline unsigned int sortId() const { return sortId_; }
 	inline Status status() const { return status_; }
 	inline Introspection introspection() const { return introspection_; }
 	inline QueryPhase queryPhase() const { return queryPhase_; }
@@ -56,15 +59,18 @@ class GLShaderProgram
 	void attachShader(GLenum type, const char *filename);
 	void attachShaderFromString(GLenum type, const char *string);
 	void link(Introspection introspection);
-	void use();
+	/// Uses the program, returns true if it was not already in use
+	bool use();
 
   private:
 	/// Max number of discoverable uniforms
 	static const int MaxNumUniforms = 32;
 
 	static GLuint boundProgram_;
+	static CompactIdPool sortIds_;
 
 	GLuint glHandle_;
+	unsigned int sortId_;
 	static const int AttachedShadersInitialSize = 4;
 	nctl::Array<nctl::UniquePtr<GLShader>> attachedShaders_;
 	Status status_;
@@ -3,6 +3,7 @@
 
 #include <nctl/StaticHashMap.h>
 #include <nctl/String.h>
+#include <nctl/StringId.h>
 #include "GLUniformBlockCache.h"
 #include "RenderBuffersManager.h"
 
@@ -21,6 +22,8 @@ class GLShaderUniformBlocks
 	void setUniformsDataPointer(GLubyte *dataPointer);
 
 	GLUniformBlockCache *uniformBlock(const char *name);
+	/// Finds a uniform block without hashing its name
+	GLUniformBlockCache *uniformBlock(const nctl::StringId &name);
 	void commitUniformBlocks();
 
 	void bind();
@@ -30,15 +33,16 @@ class GLShaderUniformBlocks
 	/// Pointer to the data of the first uniform block
 	GLubyte *dataPointer_;
 
-	/// Uniform buffer parameters for binding
-	RenderBuffersManager::Parameters uboParams_;
-
 	static const int UniformBlockCachesHashSize = 4;
+	/// Uniform buffer parameters for binding, one range for each uniform block in iteration order
+	RenderBuffersManager::Parameters uboParams_[UniformBlockCachesHashSize];
+
 	nctl::StaticStringHashMap<GLUniformBlockCache, UniformBlockCachesHashSize> uniformBlockCaches_;
 	/// A dummy uniform block cache returned when a uniform block is not found in the hashmap
 	static GLUniformBlockCache uniformBlockNotFound_;
 
 	void importUniformBlocks();
+	GLUniformBlockCache *uniformBlock(const nctl::StringView &name, nctl::hash_t hash);
 };
 
 }
@@ -3,6 +3,7 @@
 
 #include <nctl/StaticHashMap.h>
 #include <nctl/String.h>
+#include <nctl/StringId.h>
 #include "GLUniformCache.h"
 
 namespace ncine {
@@ -19,6 +20,8 @@ class GLShaderUniforms
 	void setUniformsDataPointer(GLubyte *dataPointer);
 
 	GLUniformCache *uniform(const char *name);
+	/// Finds a uniform without hashing its name
+	GLUniformCache *uniform(const nctl::StringId &name);
 	void commitUniforms();
 
   private:
@@ -30,6 +33,7 @@ class GLShaderUniforms
 	static GLUniformCache uniformNotFound_;
 
 	void importUniforms();
+	GLUniformCache *uniform(const nctl::StringView &name, nctl::hash_t hash);
 };
 
 }
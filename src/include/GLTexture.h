@@ -3,6 +3,7 @@
 
 #include "GLHashMap.h"
 #include "GLDebug.h"
+#include "CompactIdPool.h"
 
 namespace ncine {
 
@@ -15,12 +16,15 @@ class GLTexture
 
 	inline GLuint glHandle() const { return glHandle_; }
 	inline GLenum target() const { return target_; }
+	/// Returns a small id assigned by the engine, used to sort render commands
+	inline unsigned int sortId() const { return sortId_; }
 
 	inline void getObjectLabel(int bufSize, int *length, char *label) const { GLDebug::getObjectLabel(GLDebug::LabelTypes::TEXTURE, glHandle_, bufSize, length, label); }
 	inline void setObjectLabel(const char *label) { GLDebug::objectLabel(GLDebug::LabelTypes::TEXTURE, glHandle_, label); }
 
-	void bind(unsigned int textureUnit) const;
-	inline void bind() const { bind(0); }
+	/// Binds the texture to the specified unit, returns true if it was not already bound
+	bool bind(unsigned int textureUnit) const;
+	inline bool bind() const { return bind(0); }
 	void unbind() const;
 
 	void texImage2D(GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *data);
@@ -36,8 +40,10 @@ class GLTexture
 	static const unsigned int MaxTextureUnits = 4;
 	static class GLHashMap<GLTextureMappingFunc::Size, GLTextureMappingFunc> boundTextures_[MaxTextureUnits];
 	static unsigned int boundUnit_;
+	static CompactIdPool sortIds_;
 
 	GLuint glHandle_;
+	unsigned int sortId_;
 	GLenum target_;
 	/// The texture unit is mutable in order for constant texture objects to be bound
 	/*! A texture can be bound to a specific texture unit. */
@@ -30,7 +30,11 @@ class GLUniformBlock
 	inline GLint size() const { return size_; }
 	inline const char *name() const { return name_; }
 
-	inline GLUniform *uniform(const char *name) { return blockUniforms_.find(name); }
+	inline GLUniform *uniform(const char *name)
+	{
+		const nctl::StringView nameView(name);
+		return blockUniforms_.find(nameView, nameView.hash());
+	}
 	void setBlockBinding(GLuint blockBinding);
 
   private:
@@ -6,6 +6,7 @@
 #include "GLUniformCache.h"
 #include <nctl/StaticHashMap.h>
 #include <nctl/String.h>
+#include <nctl/StringId.h>
 
 namespace ncine {
 
@@ -35,6 +36,8 @@ class GLUniformBlockCache
 	inline void setUsedSize(GLint usedSize) { usedSize_ = usedSize; }
 
 	GLUniformCache *uniform(const char *name);
+	/// Finds a uniform without hashing its name
+	inline GLUniformCache *uniform(const nctl::StringId &name) { return uniformCaches_.find(name.view(), name.hash()); }
 	/// Wrapper around `GLUniformBlock::setBlockBinding()`
 	void setBlockBinding(GLuint blockBinding);
 
@@ -5,6 +5,7 @@
 #include "common_headers.h"
 
 #include <nctl/StaticArray.h>
+#include <nctl/HashFunctions.h>
 
 namespace ncine {
 
@@ -69,6 +70,9 @@ class GLVertexFormat
 	bool operator==(const GLVertexFormat &other) const;
 	bool operator!=(const GLVertexFormat &other) const;
 
+	/// Returns a hash of the format that is the same for all formats that compare as equal
+	nctl::hash_t hash() const;
+
   private:
 	nctl::StaticArray<Attribute, MaxAttributes> attributes_;
 	const GLBufferObject *ibo_;
@@ -36,6 +36,8 @@ class Geometry
 	inline void setNumElementsPerVertex(unsigned int numElements) { numElementsPerVertex_ = numElements; }
 	/// Creates a custom VBO that is unique to this `Geometry` object
 	void createCustomVbo(unsigned int numFloats, GLenum usage);
+	/// Copies vertex data at the beginning of the custom VBO, growing it if it is too small
+	void updateCustomVbo(const GLfloat *vertices, unsigned int numFloats);
 	/// Retrieves a pointer that can be used to write vertex data from a custom VBO owned by this object
 	/*! This overloaded version allows a custom alignment specification */
 	GLfloat *acquireVertexPointer(unsigned int numFloats, unsigned int numFloatsAlignment);
@@ -62,6 +64,8 @@ class Geometry
 	inline void setNumIndices(unsigned int numIndices) { numIndices_ = numIndices; }
 	/// Creates a custom IBO that is unique to this `Geometry` object
 	void createCustomIbo(unsigned int numIndices, GLenum usage);
+	/// Copies index data at the beginning of the custom IBO, growing it if it is too small
+	void updateCustomIbo(const GLushort *indices, unsigned int numIndices);
 	/// Retrieves a pointer that can be used to write index data from a custom IBO owned by this object
 	GLushort *acquireIndexPointer(unsigned int numIndices);
 	/// Retrieves a pointer that can be used to write index data from a IBO owned by the buffers manager
@@ -0,0 +1,63 @@
+#ifndef CLASS_NCINE_HEADLESSGFXDEVICE
+#define CLASS_NCINE_HEADLESSGFXDEVICE
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "IGfxDevice.h"
+#include "Vector2.h"
+#include "DisplayMode.h"
+
+namespace ncine {
+
+/// The headless graphics device, with no window and an offscreen EGL context
+/*!
+ * It renders into a pixel buffer surface of the requested resolution, so that the whole
+ * frame, OpenGL calls included, can be run and profiled on machines without a display.
+ */
+class HeadlessGfxDevice : public IGfxDevice
+{
+  public:
+	HeadlessGfxDevice(const WindowMode &windowMode, const GLContextInfo &glContextInfo, const DisplayMode &displayMode);
+	~HeadlessGfxDevice() override;
+
+	void setResolution(int width, int height) override;
+	inline void setResolution(Vector2i size) override { setResolution(size.x, size.y); }
+
+	void setFullScreen(bool fullScreen) override {}
+
+	inline void update() override { eglSwapBuffers(display_, surface_); }
+
+	void setWindowTitle(const char *windowTitle) override {}
+	void setWindowIcon(const char *windowIconFilename) override {}
+
+  private:
+	/// The resolution used when the requested one would match the screen one
+	static const int DefaultWidth = 1280;
+	static const int DefaultHeight = 720;
+
+	/// The EGL display connection
+	EGLDisplay display_;
+	/// The EGL pixel buffer surface
+	EGLSurface surface_;
+	/// The EGL context
+	EGLContext context_;
+	/// The EGL config used to create the surfaces
+	EGLConfig config_;
+
+	/// Deleted copy constructor
+	HeadlessGfxDevice(const HeadlessGfxDevice &) = delete;
+	/// Deleted assignment operator
+	HeadlessGfxDevice &operator=(const HeadlessGfxDevice &) = delete;
+
+	/// Initializes the EGL display connection, preferring the surfaceless platform
+	void initGraphics();
+	/// Initializes the OpenGL graphic context
+	void initDevice();
+	/// Creates a pixel buffer surface of the current size and binds the context to it
+	void createSurface();
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef CLASS_NCINE_HEADLESSINPUTMANAGER
+#define CLASS_NCINE_HEADLESSINPUTMANAGER
+
+#include "IInputManager.h"
+#include "InputEvents.h"
+
+namespace ncine {
+
+/// Information about the mouse state of the headless device, no button is ever pressed
+class HeadlessMouseState : public MouseState
+{
+  public:
+	HeadlessMouseState() { x = 0; y = 0; }
+
+	inline bool isLeftButtonDown() const override { return false; }
+	inline bool isMiddleButtonDown() const override { return false; }
+	inline bool isRightButtonDown() const override { return false; }
+	inline bool isFourthButtonDown() const override { return false; }
+	inline bool isFifthButtonDown() const override { return false; }
+};
+
+/// Information about the keyboard state of the headless device, no key is ever down
+class HeadlessKeyboardState : public KeyboardState
+{
+  public:
+	inline bool isKeyDown(KeySym key) const override { return false; }
+};
+
+/// Information about the state of a joystick that is never connected
+class HeadlessJoystickState : public JoystickState
+{
+  public:
+	inline bool isButtonPressed(int buttonId) const override { return false; }
+	inline unsigned char hatState(int hatId) const override { return HatState::CENTERED; }
+	inline short int axisValue(int axisId) const override { return 0; }
+	inline float axisNormValue(int axisId) const override { return 0.0f; }
+};
+
+/// The input manager of the headless device, it never dispatches any event
+class HeadlessInputManager : public IInputManager
+{
+  public:
+	HeadlessInputManager();
+	~HeadlessInputManager() override;
+
+	inline const MouseState &mouseState() const override { return mouseState_; }
+	inline const KeyboardState &keyboardState() const override { return keyboardState_; }
+
+	inline bool isJoyPresent(int joyId) const override { return false; }
+	inline const char *joyName(int joyId) const override { return nullptr; }
+	inline const char *joyGuid(int joyId) const override { return nullptr; }
+	inline int joyNumButtons(int joyId) const override { return -1; }
+	inline int joyNumHats(int joyId) const override { return -1; }
+	inline int joyNumAxes(int joyId) const override { return -1; }
+	inline const JoystickState &joystickState(int joyId) const override { return nullJoystickState_; }
+
+	inline void setMouseCursorMode(MouseCursorMode mode) override { mouseCursorMode_ = mode; }
+
+  private:
+	static HeadlessMouseState mouseState_;
+	static HeadlessKeyboardState keyboardState_;
+	static HeadlessJoystickState nullJoystickState_;
+
+	/// Deleted copy constructor
+	HeadlessInputManager(const HeadlessInputManager &) = delete;
+	/// Deleted assignment operator
+	HeadlessInputManager &operator=(const HeadlessInputManager &) = delete;
+};
+
+}
+
+#endif
@@ -30,12 +30,14 @@ class ITextureLoader
 	/// Returns the texture format object
 	inline const TextureFormat &texFormat() const { return texFormat_; }
 	/// Returns the pointer to pixel data
-	inline const GLubyte *pixels() const { return pixels_.get(); }
+	inline const GLubyte *pixels() const { return mappedPixels_ ? mappedPixels_ : pixels_.get(); }
 	/// Returns the pointer to pixel data for the specified MIP map level
 	const GLubyte *pixels(unsigned int mipMapLevel) const;
 
 	/// Returns the proper texture loader according to the file extension
 	static nctl::UniquePtr<ITextureLoader> createFromFile(const char *filename);
+	/// Returns the proper texture loader for a memory buffer according to the extension of its name
+	static nctl::UniquePtr<ITextureLoader> createFromMemory(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize);
 
   protected:
 	/// Texture file handle
@@ -51,14 +53,21 @@ class ITextureLoader
 	nctl::UniquePtr<unsigned long[]> mipDataSizes_;
 	TextureFormat texFormat_;
 	nctl::UniquePtr<GLubyte[]> pixels_;
+	/// Pointer to pixel data inside the file mapped to memory, used instead of `pixels_` when not null
+	const GLubyte *mappedPixels_;
 
 	explicit ITextureLoader(const char *filename);
 	explicit ITextureLoader(nctl::UniquePtr<IFile> fileHandle);
 
 	/// Loads pixel data from a texture file holding either compressed or uncompressed data
+	/*! Pixel data is accessed directly from the file mapped to memory when possible, without an intermediate copy. */
 	void loadPixels(GLenum internalFormat);
 	/// Loads pixel data from a texture file holding either compressed or uncompressed data, overriding pixel type
 	void loadPixels(GLenum internalFormat, GLenum type);
+
+  private:
+	/// Returns the proper texture loader for a file handle according to its extension
+	static nctl::UniquePtr<ITextureLoader> createLoader(nctl::UniquePtr<IFile> fileHandle);
 };
 
 }
@@ -90,6 +90,8 @@ class ImGuiDebugOverlay : public IDebugOverlay
 	void guiApplicationConfiguration();
 	void guiRenderingSettings();
 	void guiWindowSettings();
+	void guiFramePacer();
+	void guiFrameTimeStatistics();
 	void guiAudioPlayers();
 	void guiInputState();
 	void guiRenderDoc();
@@ -2,9 +2,13 @@
 #define CLASS_NCINE_IMGUIDRAWING
 
 #include <nctl/UniquePtr.h>
+#include <nctl/HashFunctions.h>
 #include "RenderCommand.h"
 #include "Matrix4x4.h"
 
+struct ImDrawData;
+struct ImDrawList;
+
 namespace ncine {
 
 class GLTexture;
@@ -32,11 +36,40 @@ class ImGuiDrawing
 	nctl::UniquePtr<GLTexture> texture_;
 	nctl::UniquePtr<GLShaderProgram> imguiShaderProgram_;
 
-	nctl::Array<nctl::UniquePtr<RenderCommand>> freeCommandsPool_;
-	nctl::Array<nctl::UniquePtr<RenderCommand>> usedCommandsPool_;
+	/// The data of an ImGui draw list that is kept across frames to skip uploads and setup when the list does not change
+	struct DrawListCache
+	{
+		DrawListCache()
+		    : vertexHash(nctl::NullHash), indexHash(nctl::NullHash), commandsHash(nctl::NullHash),
+		      numVertices(0), numIndices(0), numCommands(0), firstCommandIndex(0), commands(4), queuedCommands(4) {}
+
+		nctl::hash_t vertexHash;
+		nctl::hash_t indexHash;
+		/// Hash of the draw commands and of the framebuffer rectangle used to clip them
+		nctl::hash_t commandsHash;
+		/// The sizes are compared together with the hashes, so that a collision needs the same amount of data
+		int numVertices;
+		int numIndices;
+		int numCommands;
+		/// Index of the first command among the ones of all lists, commands are set up again when their layers change
+		unsigned int firstCommandIndex;
+
+		/// Render commands of the list, the first one owns the buffers shared by the others
+		nctl::Array<nctl::UniquePtr<RenderCommand>> commands;
+		/// Commands that were not clipped out the last time the list has been set up
+		nctl::Array<RenderCommand *> queuedCommands;
+
+		/// Buffers used when drawing directly with OpenGL
+		nctl::UniquePtr<GLBufferObject> vbo;
+		nctl::UniquePtr<GLBufferObject> ibo;
+	};
 
-	nctl::UniquePtr<GLBufferObject> vbo_;
-	nctl::UniquePtr<GLBufferObject> ibo_;
+	/// One cache for each draw list index
+	nctl::Array<nctl::UniquePtr<DrawListCache>> drawListCaches_;
+	/// Caches of the lists that have not been drawn for this many frames in a row are released
+	static const unsigned int MaxFramesWithUnusedCaches = 120;
+	/// Number of consecutive frames with fewer draw lists than caches
+	unsigned int numFramesWithUnusedCaches_;
 
 	static const int UniformsBufferSize = 65;
 	unsigned char uniformsBuffer_[UniformsBufferSize];
@@ -47,9 +80,11 @@ class ImGuiDrawing
 	int lastFrameHeight_;
 	Matrix4x4f projectionMatrix_;
 
-	RenderCommand *retrieveCommandFromPool();
-	void resetCommandPool();
+	DrawListCache &retrieveDrawListCache(unsigned int index);
+	/// Releases the caches exceeding the number of draw lists, if there have been fewer lists for some frames
+	void releaseUnusedCaches(unsigned int numDrawLists);
 	void setupRenderCmd(RenderCommand &cmd);
+	void setupDrawListCommands(DrawListCache &cache, const ImDrawData &drawData, const ImDrawList &imCmdList, unsigned int firstCommandIndex);
 	void draw(RenderQueue &renderQueue);
 
 	void setupBuffersAndShader();
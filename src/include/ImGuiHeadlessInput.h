@@ -0,0 +1,17 @@
+#ifndef CLASS_NCINE_IMGUIHEADLESSINPUT
+#define CLASS_NCINE_IMGUIHEADLESSINPUT
+
+namespace ncine {
+
+/// The class that feeds ImGui with the display size and the frame time when there is no window
+class ImGuiHeadlessInput
+{
+  public:
+	static void init();
+	static void shutdown();
+	static void newFrame();
+};
+
+}
+
+#endif
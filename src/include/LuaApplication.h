@@ -19,7 +19,11 @@ class LuaApplication
 	static int setDebugOverlaySettings(lua_State *L);
 
 	static int rootNode(lua_State *L);
+	static int findNode(lua_State *L);
 	static int interval(lua_State *L);
+	static int frameTimeStatistics(lua_State *L);
+	static int hitchSettings(lua_State *L);
+	static int setHitchSettings(lua_State *L);
 
 	static int width(lua_State *L);
 	static int height(lua_State *L);
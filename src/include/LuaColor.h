@@ -12,6 +12,8 @@ class LuaColor
 {
   public:
 	static void expose(lua_State *L);
+	/// Creates the metatable of the userdata pushed by `LuaColorUtils`, with the multiplication operator
+	static void exposeMetatable(lua_State *L);
 
   private:
 	static int create(lua_State *L);
@@ -5,6 +5,7 @@
 #include "common_headers.h"
 
 #include "LuaRectUtils.h"
+#include "LuaValueType.h"
 
 namespace ncine {
 
@@ -22,6 +23,8 @@ class LuaRect
 {
   public:
 	static void expose(lua_State *L);
+	/// Creates the metatable of the userdata pushed by `LuaRectUtils`
+	static void exposeMetatable(lua_State *L);
 
   private:
 	static int create(lua_State *L);
@@ -43,6 +46,14 @@ void LuaRect<T>::expose(lua_State *L)
 	lua_setfield(L, -2, LuaNames::Rect::Rect);
 }
 
+template <class T>
+void LuaRect<T>::exposeMetatable(lua_State *L)
+{
+	const char *fieldNames[LuaRectUtils<T>::NumFields] = { LuaNames::Rect::x, LuaNames::Rect::y, LuaNames::Rect::w, LuaNames::Rect::h };
+	LuaValueType<T>::newMetatable(L, LuaRectUtils<T>::typeName(), fieldNames, LuaRectUtils<T>::NumFields, nullptr);
+	lua_pop(L, 1);
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -25,6 +25,9 @@ class LuaSceneNode
 	static int removeChildNode(lua_State *L);
 	static int unlinkChildNode(lua_State *L);
 
+	static int name(lua_State *L);
+	static int setName(lua_State *L);
+
 	static int enabled(lua_State *L);
 	static int setEnabled(lua_State *L);
 
@@ -40,6 +43,11 @@ class LuaSceneNode
 	static int alpha(lua_State *L);
 	static int setAlpha(lua_State *L);
 
+	static int positions(lua_State *L);
+	static int setPositions(lua_State *L);
+	static int setRotations(lua_State *L);
+	static int setColors(lua_State *L);
+
 	friend class LuaDrawableNode;
 	friend class LuaParticleSystem;
 };
@@ -27,6 +27,15 @@ class LuaStatistics
 	static inline size_t usedMemory() { return usedMemory_; }
 	static inline int operations() { return operations_[(index_ + 1) % 2]; }
 
+	/// Returns the number of seconds spent by frame budgeted collectors during the last frame
+	static inline float gcFrameTime() { return gcFrameTime_; }
+	/// Returns the longest number of seconds spent by frame budgeted collectors in a single frame
+	static inline float maxGcFrameTime() { return maxGcFrameTime_; }
+	/// Returns the number of collection cycles completed by frame budgeted collectors
+	static inline unsigned int numGcCycles() { return numGcCycles_; }
+	/// Returns the memory in use according to Lua in all the states, in Kbytes
+	static inline size_t gcMemory() { return gcMemory_; }
+
   private:
 	static const int OperationsCount = 1000;
 
@@ -38,12 +47,20 @@ class LuaStatistics
 	static unsigned int index_;
 	static int operations_[2];
 
+	static float gcFrameTime_;
+	static float maxGcFrameTime_;
+	/// Collection time accumulated during the current frame
+	static float gcAccumulatedTime_;
+	static unsigned int numGcCycles_;
+	static size_t gcMemory_;
+
 	static void registerState(LuaStateManager *manager);
 	static void unregisterState(LuaStateManager *manager);
 
 	static inline void allocMemory(size_t bytes) { usedMemory_ += bytes; }
 	static inline void freeMemory(size_t bytes) { usedMemory_ -= (usedMemory_ >= bytes) ? bytes : usedMemory_; }
 	static void countOperations();
+	static void addGcStep(float seconds, bool cycleCompleted);
 
 	friend class LuaStateManager;
 };
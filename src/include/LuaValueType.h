@@ -0,0 +1,183 @@
+#ifndef CLASS_NCINE_LUAVALUETYPE
+#define CLASS_NCINE_LUAVALUETYPE
+
+#define NCINE_INCLUDE_LUA
+#include "common_headers.h"
+
+#include <nctl/String.h>
+#include "LuaUtils.h"
+#include "LuaDebug.h"
+
+namespace ncine {
+
+namespace LuaNames {
+namespace ValueType {
+	static const char *index = "__index";
+	static const char *newIndex = "__newindex";
+	static const char *equal = "__eq";
+	static const char *toString = "__tostring";
+	static const char *name = "__name";
+}}
+
+/// Metatables that make a full userdata behave like a small value type made of numeric fields
+/*!
+ * A value type userdata holds an array of `T` elements that can be read and written by name or by
+ * one-based index, like the tables used by the math types, but it only needs one allocation and no hash part.
+ * \note Scripts that relied on the returned values being tables need to change: `type(v)` is `"userdata"`,
+ * `pairs(v)` raises an error, and fields other than the ones of the type cannot be set, not even with `rawset()`.
+ */
+template <class T>
+class LuaValueType
+{
+  public:
+	/// Creates the metatable of a value type in the registry and leaves it on top of the stack
+	/*! Field names and methods share a lookup table, the list of methods is terminated by a null entry and can be null itself. */
+	static void newMetatable(lua_State *L, const char *typeName, const char *const *fieldNames, unsigned int numFields, const luaL_Reg *methods);
+
+  private:
+	static int index(lua_State *L);
+	static int newIndex(lua_State *L);
+	static int equal(lua_State *L);
+	static int toString(lua_State *L);
+
+	/// Returns the one-based index of the field named by the key at the specified stack index, or zero
+	static lua_Integer fieldIndex(lua_State *L, int keyIndex, unsigned int numFields);
+};
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+template <class T>
+void LuaValueType<T>::newMetatable(lua_State *L, const char *typeName, const char *const *fieldNames, unsigned int numFields, const luaL_Reg *methods)
+{
+	if (luaL_newmetatable(L, typeName) == 0)
+		return;
+
+	lua_createtable(L, 0, numFields);
+	for (unsigned int i = 0; i < numFields; i++)
+	{
+		lua_pushinteger(L, i + 1);
+		lua_setfield(L, -2, fieldNames[i]);
+	}
+	for (const luaL_Reg *method = methods; method != nullptr && method->name != nullptr; method++)
+		LuaUtils::addFunction(L, method->name, method->func);
+
+	// Both closures share the lookup table as their upvalue
+	lua_pushvalue(L, -1);
+	lua_pushcclosure(L, index, 1);
+	lua_setfield(L, -3, LuaNames::ValueType::index);
+	lua_pushcclosure(L, newIndex, 1);
+	lua_setfield(L, -2, LuaNames::ValueType::newIndex);
+
+	LuaUtils::addFunction(L, LuaNames::ValueType::equal, equal);
+	LuaUtils::addFunction(L, LuaNames::ValueType::toString, toString);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+template <class T>
+int LuaValueType<T>::index(lua_State *L)
+{
+	const T *fields = static_cast<const T *>(lua_touserdata(L, 1));
+	const unsigned int numFields = static_cast<unsigned int>(lua_rawlen(L, 1) / sizeof(T));
+
+	if (lua_type(L, 2) == LUA_TSTRING)
+	{
+		lua_pushvalue(L, 2);
+		// Methods are returned as they are
+		if (lua_rawget(L, lua_upvalueindex(1)) != LUA_TNUMBER)
+			return 1;
+	}
+
+	const lua_Integer field = fieldIndex(L, 2, numFields);
+	if (field > 0)
+		LuaUtils::push(L, fields[field - 1]);
+	else
+		LuaUtils::push(L);
+
+	return 1;
+}
+
+template <class T>
+int LuaValueType<T>::newIndex(lua_State *L)
+{
+	T *fields = static_cast<T *>(lua_touserdata(L, 1));
+	const unsigned int numFields = static_cast<unsigned int>(lua_rawlen(L, 1) / sizeof(T));
+
+	if (lua_type(L, 2) == LUA_TSTRING)
+	{
+		lua_pushvalue(L, 2);
+		lua_rawget(L, lua_upvalueindex(1));
+	}
+
+	const lua_Integer field = fieldIndex(L, 2, numFields);
+	if (field > 0)
+		fields[field - 1] = LuaUtils::retrieve<T>(L, 3);
+	else
+		LuaDebug::traceError(L, "Cannot assign a field that does not exist");
+
+	return 0;
+}
+
+template <class T>
+int LuaValueType<T>::equal(lua_State *L)
+{
+	bool areEqual = false;
+	if (lua_getmetatable(L, 1) && lua_getmetatable(L, 2))
+		areEqual = lua_rawequal(L, -1, -2);
+
+	if (areEqual)
+	{
+		const T *first = static_cast<const T *>(lua_touserdata(L, 1));
+		const T *second = static_cast<const T *>(lua_touserdata(L, 2));
+		const unsigned int numFields = static_cast<unsigned int>(lua_rawlen(L, 1) / sizeof(T));
+		for (unsigned int i = 0; i < numFields; i++)
+		{
+			if (first[i] != second[i])
+			{
+				areEqual = false;
+				break;
+			}
+		}
+	}
+
+	LuaUtils::push(L, areEqual);
+	return 1;
+}
+
+template <class T>
+int LuaValueType<T>::toString(lua_State *L)
+{
+	const T *fields = static_cast<const T *>(lua_touserdata(L, 1));
+	const unsigned int numFields = static_cast<unsigned int>(lua_rawlen(L, 1) / sizeof(T));
+
+	lua_getmetatable(L, 1);
+	lua_getfield(L, -1, LuaNames::ValueType::name);
+	nctl::String string(64);
+	string.format("%s(", lua_tostring(L, -1));
+	for (unsigned int i = 0; i < numFields; i++)
+		string.formatAppend(i > 0 ? ", %g" : "%g", static_cast<double>(fields[i]));
+	string.formatAppend(")");
+
+	LuaUtils::push(L, string.data());
+	return 1;
+}
+
+template <class T>
+lua_Integer LuaValueType<T>::fieldIndex(lua_State *L, int keyIndex, unsigned int numFields)
+{
+	// A string key has already been replaced by the result of the lookup on top of the stack
+	const int index = (lua_type(L, keyIndex) == LUA_TSTRING) ? -1 : keyIndex;
+	if (lua_type(L, index) != LUA_TNUMBER)
+		return 0;
+
+	const lua_Integer field = lua_tointeger(L, index);
+	return (field >= 1 && field <= static_cast<lua_Integer>(numFields)) ? field : 0;
+}
+
+}
+
+#endif
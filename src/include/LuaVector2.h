@@ -6,6 +6,7 @@
 
 #include "LuaVector2Utils.h"
 #include "LuaDebug.h"
+#include "LuaValueType.h"
 
 namespace ncine {
 
@@ -23,6 +24,11 @@ namespace Vector2 {
 	static const char *sqrLength = "sqrlength";
 	static const char *normalized = "normalized";
 	static const char *dot = "dot";
+
+	static const char *addOperator = "__add";
+	static const char *subtractOperator = "__sub";
+	static const char *multiplyOperator = "__mul";
+	static const char *divideOperator = "__div";
 }}
 
 /// Lua bindings around the `Vector2` template class
@@ -31,6 +37,8 @@ class LuaVector2
 {
   public:
 	static void expose(lua_State *L);
+	/// Creates the metatable of the userdata pushed by `LuaVector2Utils`, with arithmetic operators and methods
+	static void exposeMetatable(lua_State *L);
 
   private:
 	static int create(lua_State *L);
@@ -70,6 +78,27 @@ void LuaVector2<T>::expose(lua_State *L)
 	lua_setfield(L, -2, LuaNames::Vector2::Vector2);
 }
 
+template <class T>
+void LuaVector2<T>::exposeMetatable(lua_State *L)
+{
+	const char *fieldNames[LuaVector2Utils<T>::NumFields] = { LuaNames::Vector2::x, LuaNames::Vector2::y };
+	const luaL_Reg methods[] = {
+		{ LuaNames::Vector2::length, length },
+		{ LuaNames::Vector2::sqrLength, sqrLength },
+		{ LuaNames::Vector2::normalized, normalized },
+		{ LuaNames::Vector2::dot, dot },
+		{ nullptr, nullptr }
+	};
+	LuaValueType<T>::newMetatable(L, LuaVector2Utils<T>::typeName(), fieldNames, LuaVector2Utils<T>::NumFields, methods);
+
+	LuaUtils::addFunction(L, LuaNames::Vector2::addOperator, add);
+	LuaUtils::addFunction(L, LuaNames::Vector2::subtractOperator, subtract);
+	LuaUtils::addFunction(L, LuaNames::Vector2::multiplyOperator, multiply);
+	LuaUtils::addFunction(L, LuaNames::Vector2::divideOperator, divide);
+
+	lua_pop(L, 1);
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -95,18 +124,18 @@ namespace {
 
 		if (lua_isnumber(L, -2) && lua_isnumber(L, -1))
 			LuaDebug::traceError(L, "Expecting two vec2 tables or a vec2 table and a number");
-		else if (lua_isnumber(L, -2) && lua_istable(L, -1))
+		else if (lua_isnumber(L, -2) && LuaUtils::isTableOrUserData(L, -1))
 		{
 			scalar = LuaUtils::retrieve<T>(L, -2);
 			first = LuaVector2Utils<T>::retrieveTable(L, -1);
 		}
-		else if (lua_istable(L, -2) && lua_isnumber(L, -1))
+		else if (LuaUtils::isTableOrUserData(L, -2) && lua_isnumber(L, -1))
 		{
 			scalar = LuaUtils::retrieve<T>(L, -1);
 			lua_pop(L, 1);
 			first = LuaVector2Utils<T>::retrieveTable(L, -1);
 		}
-		else if (lua_istable(L, -2) && lua_istable(L, -1))
+		else if (LuaUtils::isTableOrUserData(L, -2) && LuaUtils::isTableOrUserData(L, -1))
 		{
 			second = LuaVector2Utils<T>::retrieveTable(L, -1);
 			lua_pop(L, 1);
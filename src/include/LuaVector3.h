@@ -6,6 +6,7 @@
 
 #include "LuaVector3Utils.h"
 #include "LuaDebug.h"
+#include "LuaValueType.h"
 
 namespace ncine {
 
@@ -23,6 +24,11 @@ namespace Vector3 {
 	static const char *sqrLength = "sqrlength";
 	static const char *normalized = "normalized";
 	static const char *dot = "dot";
+
+	static const char *addOperator = "__add";
+	static const char *subtractOperator = "__sub";
+	static const char *multiplyOperator = "__mul";
+	static const char *divideOperator = "__div";
 }}
 
 /// Lua bindings around the `Vector3` template class
@@ -31,6 +37,8 @@ class LuaVector3
 {
   public:
 	static void expose(lua_State *L);
+	/// Creates the metatable of the userdata pushed by `LuaVector3Utils`, with arithmetic operators and methods
+	static void exposeMetatable(lua_State *L);
 
   private:
 	static int create(lua_State *L);
@@ -70,6 +78,27 @@ void LuaVector3<T>::expose(lua_State *L)
 	lua_setfield(L, -2, LuaNames::Vector3::Vector3);
 }
 
+template <class T>
+void LuaVector3<T>::exposeMetatable(lua_State *L)
+{
+	const char *fieldNames[LuaVector3Utils<T>::NumFields] = { LuaNames::Vector3::x, LuaNames::Vector3::y, LuaNames::Vector3::z };
+	const luaL_Reg methods[] = {
+		{ LuaNames::Vector3::length, length },
+		{ LuaNames::Vector3::sqrLength, sqrLength },
+		{ LuaNames::Vector3::normalized, normalized },
+		{ LuaNames::Vector3::dot, dot },
+		{ nullptr, nullptr }
+	};
+	LuaValueType<T>::newMetatable(L, LuaVector3Utils<T>::typeName(), fieldNames, LuaVector3Utils<T>::NumFields, methods);
+
+	LuaUtils::addFunction(L, LuaNames::Vector3::addOperator, add);
+	LuaUtils::addFunction(L, LuaNames::Vector3::subtractOperator, subtract);
+	LuaUtils::addFunction(L, LuaNames::Vector3::multiplyOperator, multiply);
+	LuaUtils::addFunction(L, LuaNames::Vector3::divideOperator, divide);
+
+	lua_pop(L, 1);
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -96,18 +125,18 @@ namespace {
 
 		if (lua_isnumber(L, -2) && lua_isnumber(L, -1))
 			LuaDebug::traceError(L, "Expecting two vec3 tables or a vec3 table and a number");
-		else if (lua_isnumber(L, -2) && lua_istable(L, -1))
+		else if (lua_isnumber(L, -2) && LuaUtils::isTableOrUserData(L, -1))
 		{
 			scalar = LuaUtils::retrieve<T>(L, -2);
 			first = LuaVector3Utils<T>::retrieveTable(L, -1);
 		}
-		else if (lua_istable(L, -2) && lua_isnumber(L, -1))
+		else if (LuaUtils::isTableOrUserData(L, -2) && lua_isnumber(L, -1))
 		{
 			scalar = LuaUtils::retrieve<T>(L, -1);
 			lua_pop(L, 1);
 			first = LuaVector3Utils<T>::retrieveTable(L, -1);
 		}
-		else if (lua_istable(L, -2) && lua_istable(L, -1))
+		else if (LuaUtils::isTableOrUserData(L, -2) && LuaUtils::isTableOrUserData(L, -1))
 		{
 			second = LuaVector3Utils<T>::retrieveTable(L, -1);
 			lua_pop(L, 1);
@@ -63,8 +63,12 @@ class Material
 	void setUniformsDataPointer(GLubyte *dataPointer);
 	/// Wrapper around `GLShaderUniforms::uniform()`
 	inline GLUniformCache *uniform(const char *name) { return shaderUniforms_.uniform(name); }
+	/// Wrapper around `GLShaderUniforms::uniform()` for an interned name
+	inline GLUniformCache *uniform(const nctl::StringId &name) { return shaderUniforms_.uniform(name); }
 	/// Wrapper around `GLShaderUniformBlocks::uniformBlock()`
 	inline GLUniformBlockCache *uniformBlock(const char *name) { return shaderUniformBlocks_.uniformBlock(name); }
+	/// Wrapper around `GLShaderUniformBlocks::uniformBlock()` for an interned name
+	inline GLUniformBlockCache *uniformBlock(const nctl::StringId &name) { return shaderUniformBlocks_.uniformBlock(name); }
 	/// Wrapper around `GLShaderAttributes::attribute()`
 	inline GLVertexFormat::Attribute *attribute(const char *name) { return shaderAttributes_.attribute(name); }
 	inline const GLTexture *texture() const { return texture_; }
@@ -91,7 +95,6 @@ class Material
 	inline void commitUniformBlocks() { shaderUniformBlocks_.commitUniformBlocks(); }
 	/// Wrapper around `GLShaderAttributes::defineVertexPointers()`
 	void defineVertexFormat(const GLBufferObject *vbo, const GLBufferObject *ibo, unsigned int vboOffset);
-	unsigned int sortKey();
 
 	friend class RenderCommand;
 };
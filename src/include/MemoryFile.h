@@ -0,0 +1,60 @@
+#ifndef CLASS_NCINE_MEMORYFILE
+#define CLASS_NCINE_MEMORYFILE
+
+#include "IFile.h"
+
+namespace ncine {
+
+/// The class dealing with read-only files stored in a memory buffer
+/*!
+ * The buffer is not owned by the object and it should stay valid while the file is in use.
+ * It is used for the entries of a mounted pack archive and for data loaded by the asynchronous file reader.
+ */
+class MemoryFile : public IFile
+{
+  public:
+	/// Constructs a memory file object
+	/*!
+	 * \param bufferName The name of the buffer, its extension is used to choose a loader
+	 * \param bufferPtr Pointer to the beginning of the memory buffer
+	 * \param bufferSize Size in bytes of the memory buffer
+	 */
+	MemoryFile(const char *bufferName, const unsigned char *bufferPtr, unsigned long int bufferSize);
+	~MemoryFile() override;
+
+	/// Static method to return class type
+	inline static FileType sType() { return FileType::MEMORY; }
+
+	/// Tries to open the memory file
+	void open(unsigned char mode) override;
+	/// Closes the memory file
+	void close() override;
+	long int seek(long int offset, int whence) const override;
+	long int tell() const override;
+	unsigned long int read(void *buffer, unsigned long int bytes) const override;
+	unsigned long int write(void *buffer, unsigned long int bytes) override { return 0; }
+
+	bool isOpened() const override { return isOpened_; }
+
+	/// Returns the memory buffer, without any copy
+	const unsigned char *mapToMemory() override;
+	void unmapFromMemory() override { mappedMemory_ = nullptr; }
+
+  private:
+	/// Pointer to the beginning of the memory buffer
+	const unsigned char *bufferPtr_;
+	/// Size in bytes of the memory buffer
+	unsigned long int bufferSize_;
+	/// Current seek position
+	mutable long int seekPosition_;
+	bool isOpened_;
+
+	/// Deleted copy constructor
+	MemoryFile(const MemoryFile &) = delete;
+	/// Deleted assignment operator
+	MemoryFile &operator=(const MemoryFile &) = delete;
+};
+
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef CLASS_NCINE_PACKARCHIVE
+#define CLASS_NCINE_PACKARCHIVE
+
+#include <cstdint>
+#include "IFile.h"
+
+namespace ncine {
+
+/// The class reading the directory of a pack archive and serving its entries from memory
+/*!
+ * A pack archive is made of a header, a directory of entries sorted by path hash,
+ * a block of null terminated paths and the entry data blobs, each one aligned to `Alignment` bytes.
+ * All numbers are stored in little endian order.
+ */
+class PackArchive
+{
+  public:
+	/// The four characters at the beginning of every pack archive ("NCPK")
+	static const uint32_t Magic = 0x4B50434E;
+	/// The version of the pack archive format
+	static const uint32_t Version = 1;
+	/// The alignment in bytes of every entry data blob
+	static const unsigned int Alignment = 16;
+
+	/// Compression methods for entry data
+	enum class Compression : uint32_t
+	{
+		NONE = 0
+	};
+
+	/// The header at the beginning of a pack archive
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t numEntries;
+		/// Size in bytes of the block of paths following the directory
+		uint32_t namesSize;
+	};
+
+	/// A directory entry describing a file stored in the archive
+	struct Entry
+	{
+		/// Hash of the path, calculated with `hashPath()`
+		uint32_t hash;
+		/// Offset of the path inside the block of names
+		uint32_t nameOffset;
+		/// One of the `Compression` methods
+		uint32_t compression;
+		uint32_t reserved;
+		/// Offset of the data blob from the start of the archive
+		uint64_t offset;
+		/// Size in bytes of the data blob
+		uint64_t size;
+	};
+
+	/// Opens the pack archive and maps it to memory
+	explicit PackArchive(const char *filename);
+
+	/// Returns true if the archive has been opened and its header is valid
+	inline bool isValid() const { return header_ != nullptr; }
+	/// Returns the archive file name with path
+	inline const char *filename() const { return fileHandle_->filename(); }
+	/// Returns the number of entries in the archive
+	inline unsigned int numEntries() const { return numEntries_; }
+
+	/// Returns the entry stored with the specified path or `nullptr` if it is not found
+	const Entry *findEntry(const char *path) const;
+	/// Returns the path of the specified entry
+	const char *entryName(const Entry &entry) const;
+	/// Returns the pointer to the data of the specified entry
+	const unsigned char *entryData(const Entry &entry) const;
+	/// Returns the size in bytes of the data of the specified entry
+	inline static unsigned long int entrySize(const Entry &entry) { return static_cast<unsigned long int>(IFile::int64FromLE(entry.size)); }
+
+	/// Hashes a path with the FNV-1a function, the value is stored in the archive directory
+	inline static uint32_t hashPath(const char *path)
+	{
+		const uint32_t Prime = 0x01000193; //   16777619
+		const uint32_t Seed = 0x811C9DC5; // 2166136261
+
+		uint32_t hash = Seed;
+		for (const unsigned char *bytes = reinterpret_cast<const unsigned char *>(path); *bytes != '\0'; bytes++)
+			hash = (*bytes ^ hash) * Prime;
+
+		return hash;
+	}
+
+  private:
+	/// The archive file handle, kept opened while the archive is mapped
+	nctl::UniquePtr<IFile> fileHandle_;
+
+	const unsigned char *memory_;
+	const Header *header_;
+	const Entry *entries_;
+	const char *names_;
+	unsigned int numEntries_;
+	unsigned long int namesSize_;
+
+	/// Checks that every entry has a terminated name and a data blob inside the archive
+	bool validateEntries(unsigned long int fileSize) const;
+
+	/// Deleted copy constructor
+	PackArchive(const PackArchive &) = delete;
+	/// Deleted assignment operator
+	PackArchive &operator=(const PackArchive &) = delete;
+};
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "GLBufferObject.h"
 #include <nctl/Array.h>
+#include <nctl/HashMap.h>
 #include <nctl/UniquePtr.h>
 
 namespace ncine {
@@ -52,6 +53,9 @@ class RenderBuffersManager
 	inline Parameters acquireMemory(BufferTypes::Enum type, unsigned long bytes) { return acquireMemory(type, bytes, specs_[type].alignment); }
 	/// Requests an amount of bytes from the specified buffer type with a custom alignment requirement
 	Parameters acquireMemory(BufferTypes::Enum type, unsigned long bytes, unsigned int alignment);
+	/// Requests a range of the uniform buffer holding a copy of the data
+	/*! If an identical range has been requested since the last flush, the same range is returned and nothing is copied. */
+	Parameters acquireUniformMemory(const GLubyte *data, unsigned long bytes);
 
   private:
 	BufferSpecifications specs_[BufferTypes::COUNT];
@@ -71,6 +75,22 @@ class RenderBuffersManager
 
 	nctl::Array<ManagedBuffer> buffers_;
 
+	struct UniformRange
+	{
+		UniformRange()
+		    : data(nullptr) {}
+		UniformRange(const Parameters &p, const GLubyte *d)
+		    : params(p), data(d) {}
+
+		Parameters params;
+		/// The data that has been copied in the range, to check the content on a hash match
+		const GLubyte *data;
+	};
+
+	static const unsigned int UniformRangesHashSize = 1024;
+	/// The uniform buffer ranges acquired since the last flush, indexed by the hash of their content
+	nctl::HashMap<nctl::hash_t, UniformRange, nctl::IdentityHashFunc<nctl::hash_t>> uniformRanges_;
+
 	void flushUnmap();
 	void remap();
 	void createBuffer(const BufferSpecifications &specs);
@@ -1,6 +1,7 @@
 #ifndef CLASS_NCINE_RENDERCOMMAND
 #define CLASS_NCINE_RENDERCOMMAND
 
+#include <cstdint>
 #include "Matrix4x4.h"
 #include "Material.h"
 #include "Geometry.h"
@@ -39,6 +40,31 @@ class RenderCommand
 	/// Top rendering layer limit
 	static const unsigned int TopLayer = 65535;
 
+	/// The layout of the 64 bits sort key, from the most significant bits
+	/*!
+	 * | Bits  | Field         | Value                                                     |
+	 * |-------|---------------|-----------------------------------------------------------|
+	 * | 63-48 | layer         | The rendering layer                                       |
+	 * | 47    | translucency  | One if the material is transparent                        |
+	 * | 46-11 | sorting order | The shader, texture and vertex format fields, in the order of `RenderingSettings::sortKeyFields` |
+	 * | 10-0  | unused        | Always zero                                               |
+	 *
+	 * Shaders and textures are identified by the compact ids assigned by the engine, not by their OpenGL handles.
+	 * The vertex format is made of the primitive type and of the number of elements per vertex.
+	 * Ids that do not fit in their fields are wrapped, which only affects grouping and never correctness.
+	 */
+	struct SortKey
+	{
+		static const unsigned int LayerBits = 16;
+		static const unsigned int TranslucencyBits = 1;
+		static const unsigned int ShaderBits = 12;
+		static const unsigned int TextureBits = 16;
+		static const unsigned int VertexFormatBits = 8;
+
+		static const unsigned int LayerShift = 64 - LayerBits;
+		static const unsigned int TranslucencyShift = LayerShift - TranslucencyBits;
+	};
+
 	explicit RenderCommand(CommandTypes::Enum profilingType);
 	RenderCommand();
 
@@ -70,7 +96,7 @@ class RenderCommand
 	void commitUniformBlocks();
 
 	/// Returns the queue sort key
-	inline unsigned long int sortKey() const { return sortKey_; }
+	inline uint64_t sortKey() const { return sortKey_; }
 	/// Calculates a sort key for the queue
 	void calculateSortKey();
 	/// Issues the render command
@@ -114,7 +140,7 @@ class RenderCommand
 		GLsizei height;
 	};
 
-	unsigned long int sortKey_;
+	uint64_t sortKey_;
 	unsigned int layer_;
 	int numInstances_;
 	int batchSize_;
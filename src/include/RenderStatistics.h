@@ -3,6 +3,7 @@
 
 #include <nctl/String.h>
 #include "RenderCommand.h"
+#include "GLCallCounters.h"
 
 namespace ncine {
 
@@ -112,6 +113,46 @@ class RenderStatistics
 		friend RenderStatistics;
 	};
 
+	/// The uniform blocks that shared an identical range of the uniform buffer instead of uploading their data
+	class SharedUniformBlocks
+	{
+	  public:
+		unsigned int count;
+		unsigned long dataSize;
+
+		SharedUniformBlocks()
+		    : count(0), dataSize(0) {}
+
+	  private:
+		void reset()
+		{
+			count = 0;
+			dataSize = 0;
+		}
+		friend RenderStatistics;
+	};
+
+	/// The number of OpenGL state changes issued by the render queues in a frame
+	class StateSwitches
+	{
+	  public:
+		unsigned int shaders;
+		unsigned int textures;
+		unsigned int vaos;
+
+		StateSwitches()
+		    : shaders(0), textures(0), vaos(0) {}
+
+	  private:
+		void reset()
+		{
+			shaders = 0;
+			textures = 0;
+			vaos = 0;
+		}
+		friend RenderStatistics;
+	};
+
 	/// Returns the aggregated command statistics for all types
 	static inline const Commands &allCommands() { return allCommands_; }
 	/// Returns the commnad statistics for the specified type
@@ -135,6 +176,15 @@ class RenderStatistics
 	/// Returns statistics about the VAO pool
 	static inline const VaoPool &vaoPool() { return vaoPool_; }
 
+	/// Returns statistics about the uniform blocks that have not been uploaded because identical to another one
+	static inline const SharedUniformBlocks &sharedUniformBlocks() { return sharedUniformBlocks_; }
+
+	/// Returns the number of shader program, texture and VAO switches
+	static inline const StateSwitches &stateSwitches() { return stateSwitches_; }
+
+	/// Returns the number of OpenGL calls issued and filtered in the last frame for the specified category
+	static inline const GLCallCounters::Counters &glCalls(GLCallCounters::Categories::Enum category) { return glCalls_[category]; }
+
   private:
 	/// The string used to output OpenGL debug group information
 	static nctl::String debugString_;
@@ -148,6 +198,9 @@ class RenderStatistics
 	static unsigned int index_;
 	static unsigned int culledNodes_[2];
 	static VaoPool vaoPool_;
+	static StateSwitches stateSwitches_;
+	static SharedUniformBlocks sharedUniformBlocks_;
+	static GLCallCounters::Counters glCalls_[GLCallCounters::Categories::COUNT];
 
 	static void reset();
 	static void gatherStatistics(const RenderCommand &command);
@@ -190,6 +243,14 @@ class RenderStatistics
 	static inline void addCulledNode() { culledNodes_[index_]++; }
 	static inline void addVaoPoolReuse() { vaoPool_.reuses++; }
 	static inline void addVaoPoolBinding() { vaoPool_.bindings++; }
+	static inline void addSharedUniformBlock(unsigned long datasize)
+	{
+		sharedUniformBlocks_.count++;
+		sharedUniformBlocks_.dataSize += datasize;
+	}
+	static inline void addShaderSwitch() { stateSwitches_.shaders++; }
+	static inline void addTextureSwitch() { stateSwitches_.textures++; }
+	static inline void addVaoSwitch() { stateSwitches_.vaos++; }
 
 	friend class RenderQueue;
 	friend class RenderBuffersManager;
@@ -197,6 +258,7 @@ class RenderStatistics
 	friend class Geometry;
 	friend class DrawableNode;
 	friend class RenderVaoPool;
+	friend class Material;
 };
 
 }
@@ -2,6 +2,7 @@
 #define CLASS_NCINE_RENDERVAOPOOL
 
 #include <nctl/Array.h>
+#include <nctl/HashMap.h>
 #include <nctl/UniquePtr.h>
 #include <TimeStamp.h>
 #include "GLVertexArrayObject.h"
@@ -23,10 +24,13 @@ class RenderVaoPool
 	{
 		nctl::UniquePtr<GLVertexArrayObject> object;
 		GLVertexFormat format;
+		nctl::hash_t formatHash;
 		TimeStamp lastBindTime;
 	};
 
 	nctl::Array<VaoBinding> vaoPool_;
+	/// The pool indices of the VAOs, indexed by the hash of their vertex format
+	nctl::HashMap<nctl::hash_t, unsigned int, nctl::IdentityHashFunc<nctl::hash_t>> vaoIndices_;
 };
 
 }
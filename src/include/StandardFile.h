@@ -27,6 +27,10 @@ class StandardFile : public IFile
 	unsigned long int read(void *buffer, unsigned long int bytes) const override;
 	unsigned long int write(void *buffer, unsigned long int bytes) override;
 
+	/// Maps the standard file to memory with `mmap()` when available
+	const unsigned char *mapToMemory() override;
+	void unmapFromMemory() override;
+
   private:
 	/// Deleted copy constructor
 	StandardFile(const StandardFile &) = delete;
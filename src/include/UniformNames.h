@@ -0,0 +1,29 @@
+#ifndef CLASS_NCINE_UNIFORMNAMES
+#define CLASS_NCINE_UNIFORMNAMES
+
+#include <nctl/StringId.h>
+
+namespace ncine {
+
+/// Interned names of the uniforms and uniform blocks that the engine sets every frame
+/*!
+ * Lookups with these identifiers do not need to hash the name again.
+ * They are created before `main()`, so that no name is ever interned by a worker thread.
+ */
+namespace UniformNames {
+	extern const nctl::StringId Projection;
+	extern const nctl::StringId ModelView;
+	extern const nctl::StringId Texture;
+	extern const nctl::StringId Color;
+	extern const nctl::StringId TexRect;
+	extern const nctl::StringId SpriteSize;
+
+	extern const nctl::StringId SpriteBlock;
+	extern const nctl::StringId MeshSpriteBlock;
+	extern const nctl::StringId TextnodeBlock;
+	extern const nctl::StringId InstancesBlock;
+}
+
+}
+
+#endif
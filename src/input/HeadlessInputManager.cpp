@@ -0,0 +1,43 @@
+#include "HeadlessInputManager.h"
+#include "JoyMapping.h"
+
+#ifdef WITH_IMGUI
+	#include "ImGuiHeadlessInput.h"
+#endif
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// STATIC DEFINITIONS
+///////////////////////////////////////////////////////////
+
+#if !defined(WITH_SDL) && !defined(WITH_GLFW)
+// There is no windowing backend to define it
+const int IInputManager::MaxNumJoysticks = 4;
+#endif
+
+HeadlessMouseState HeadlessInputManager::mouseState_;
+HeadlessKeyboardState HeadlessInputManager::keyboardState_;
+HeadlessJoystickState HeadlessInputManager::nullJoystickState_;
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+HeadlessInputManager::HeadlessInputManager()
+{
+	joyMapping_.init(this);
+
+#ifdef WITH_IMGUI
+	ImGuiHeadlessInput::init();
+#endif
+}
+
+HeadlessInputManager::~HeadlessInputManager()
+{
+#ifdef WITH_IMGUI
+	ImGuiHeadlessInput::shutdown();
+#endif
+}
+
+}
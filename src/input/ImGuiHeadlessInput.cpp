@@ -0,0 +1,38 @@
+#include "imgui.h"
+#include "ImGuiHeadlessInput.h"
+#include "Application.h"
+
+namespace ncine {
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void ImGuiHeadlessInput::init()
+{
+	IMGUI_CHECKVERSION();
+	ImGui::CreateContext();
+
+	ImGuiIO &io = ImGui::GetIO();
+	io.BackendPlatformName = "nCine_Headless";
+}
+
+void ImGuiHeadlessInput::shutdown()
+{
+	ImGui::DestroyContext();
+}
+
+void ImGuiHeadlessInput::newFrame()
+{
+	ImGuiIO &io = ImGui::GetIO();
+	IM_ASSERT(io.Fonts->IsBuilt() && "Font atlas not built! It is generally built by the renderer back-end. Missing call to renderer _NewFrame() function? e.g. ImGui_ImplOpenGL3_NewFrame().");
+
+	const IGfxDevice &gfxDevice = theApplication().gfxDevice();
+	io.DisplaySize = ImVec2(static_cast<float>(gfxDevice.width()), static_cast<float>(gfxDevice.height()));
+	io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+
+	const float interval = theApplication().interval();
+	io.DeltaTime = (interval > 0.0f) ? interval : 1.0f / 60.0f;
+}
+
+}
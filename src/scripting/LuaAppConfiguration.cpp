@@ -20,6 +20,7 @@ namespace AppConfiguration {
 	static const char *resolution = "resolution";
 	static const char *inFullscreen = "fullscreen";
 	static const char *isResizable = "resizable";
+	static const char *isHeadless = "headless";
 	static const char *frameLimit = "frame_limit";
 
 	static const char *windowTitle = "window_title";
@@ -30,6 +31,7 @@ namespace AppConfiguration {
 	static const char *vboSize = "vbo_size";
 	static const char *iboSize = "ibo_size";
 	static const char *vaoPoolSize = "vao_pool_size";
+	static const char *frameArenaSize = "frame_arena_size";
 
 	static const char *withDebugOverlay = "debug_overlay";
 	static const char *withAudio = "audio";
@@ -37,6 +39,7 @@ namespace AppConfiguration {
 	static const char *withScenegraph = "scenegraph";
 	static const char *withVSync = "vsync";
 	static const char *withGlDebugContext = "gl_debug_context";
+	static const char *withObjectNameIndex = "object_name_index";
 }}
 
 ///////////////////////////////////////////////////////////
@@ -45,7 +48,7 @@ namespace AppConfiguration {
 
 void LuaAppConfiguration::push(lua_State *L, const AppConfiguration &appCfg)
 {
-	lua_createtable(L, 24, 0);
+	lua_createtable(L, 27, 0);
 
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::dataPath, appCfg.dataPath().data());
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::logFile, appCfg.logFile.data());
@@ -56,6 +59,7 @@ void LuaAppConfiguration::push(lua_State *L, const AppConfiguration &appCfg)
 	LuaVector2iUtils::pushField(L, LuaNames::AppConfiguration::resolution, appCfg.resolution);
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::inFullscreen, appCfg.inFullscreen);
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::isResizable, appCfg.isResizable);
+	LuaUtils::pushField(L, LuaNames::AppConfiguration::isHeadless, appCfg.isHeadless);
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::frameLimit, appCfg.frameLimit);
 
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::windowTitle, appCfg.windowTitle.data());
@@ -66,6 +70,7 @@ void LuaAppConfiguration::push(lua_State *L, const AppConfiguration &appCfg)
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::vboSize, static_cast<int64_t>(appCfg.vboSize));
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::iboSize, static_cast<int64_t>(appCfg.iboSize));
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::vaoPoolSize, appCfg.vaoPoolSize);
+	LuaUtils::pushField(L, LuaNames::AppConfiguration::frameArenaSize, static_cast<int64_t>(appCfg.frameArenaSize));
 
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::withDebugOverlay, appCfg.withDebugOverlay);
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::withAudio, appCfg.withAudio);
@@ -73,6 +78,7 @@ void LuaAppConfiguration::push(lua_State *L, const AppConfiguration &appCfg)
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::withScenegraph, appCfg.withScenegraph);
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::withVSync, appCfg.withVSync);
 	LuaUtils::pushField(L, LuaNames::AppConfiguration::withGlDebugContext, appCfg.withGlDebugContext);
+	LuaUtils::pushField(L, LuaNames::AppConfiguration::withObjectNameIndex, appCfg.withObjectNameIndex);
 }
 
 void LuaAppConfiguration::retrieveAndSet(lua_State *L, AppConfiguration &appCfg)
@@ -97,6 +103,8 @@ void LuaAppConfiguration::retrieveAndSet(lua_State *L, AppConfiguration &appCfg)
 	appCfg.inFullscreen = inFullscreen;
 	const bool isResizable = LuaUtils::retrieveField<bool>(L, -1, LuaNames::AppConfiguration::isResizable);
 	appCfg.isResizable = isResizable;
+	const bool isHeadless = LuaUtils::retrieveField<bool>(L, -1, LuaNames::AppConfiguration::isHeadless);
+	appCfg.isHeadless = isHeadless;
 	const unsigned int frameLimit = LuaUtils::retrieveField<uint32_t>(L, -1, LuaNames::AppConfiguration::frameLimit);
 	appCfg.frameLimit = frameLimit;
 
@@ -115,6 +123,8 @@ void LuaAppConfiguration::retrieveAndSet(lua_State *L, AppConfiguration &appCfg)
 	appCfg.iboSize = iboSize;
 	const unsigned int vaoPoolSize = LuaUtils::retrieveField<uint32_t>(L, -1, LuaNames::AppConfiguration::vaoPoolSize);
 	appCfg.vaoPoolSize = vaoPoolSize;
+	const unsigned long frameArenaSize = LuaUtils::retrieveField<uint64_t>(L, -1, LuaNames::AppConfiguration::frameArenaSize);
+	appCfg.frameArenaSize = frameArenaSize;
 
 	const bool withDebugOverlay = LuaUtils::retrieveField<bool>(L, -1, LuaNames::AppConfiguration::withDebugOverlay);
 	appCfg.withDebugOverlay = withDebugOverlay;
@@ -128,6 +138,8 @@ void LuaAppConfiguration::retrieveAndSet(lua_State *L, AppConfiguration &appCfg)
 	appCfg.withVSync = withVSync;
 	const bool withGlDebugContext = LuaUtils::retrieveField<bool>(L, -1, LuaNames::AppConfiguration::withGlDebugContext);
 	appCfg.withGlDebugContext = withGlDebugContext;
+	const bool withObjectNameIndex = LuaUtils::retrieveField<bool>(L, -1, LuaNames::AppConfiguration::withObjectNameIndex);
+	appCfg.withObjectNameIndex = withObjectNameIndex;
 }
 
 }
@@ -5,7 +5,13 @@
 #include "LuaClassWrapper.h"
 #include "LuaVector2Utils.h"
 #include "Application.h"
+#include "FrameTimeStatistics.h"
 #include "IFile.h"
+#include "Sprite.h"
+#include "MeshSprite.h"
+#include "AnimatedSprite.h"
+#include "TextNode.h"
+#include "ParticleSystem.h"
 
 namespace ncine {
 
@@ -20,7 +26,11 @@ namespace Application {
 	static const char *setDebugOverlaySettings = "set_debugoverlay_settings";
 
 	static const char *rootNode = "rootnode";
+	static const char *findNode = "find_node";
 	static const char *interval = "interval";
+	static const char *frameTimeStatistics = "get_frame_time_statistics";
+	static const char *hitchSettings = "get_hitch_settings";
+	static const char *setHitchSettings = "set_hitch_settings";
 
 	static const char *width = "get_width";
 	static const char *height = "get_height";
@@ -45,6 +55,21 @@ namespace Application {
 		static const char *maxBatchSize = "max_batch_size";
 	}
 
+	namespace FrameTimeStatistics {
+		static const char *hitches = "hitches";
+		static const char *p50 = "p50";
+		static const char *p95 = "p95";
+		static const char *p99 = "p99";
+		static const char *max = "max";
+		static const char *phases[ncine::FrameTimeStatistics::Phase::COUNT] = { "frame", "frame_start", "update", "visit", "draw", "imgui", "audio", "frame_end" };
+	}
+
+	namespace HitchSettings {
+		static const char *minFrameTime = "min_frame_time";
+		static const char *medianFactor = "median_factor";
+		static const char *logHitches = "log_hitches";
+	}
+
 	namespace DebugOverlaySettings {
 		static const char *showProfilerGraphs = "profiler_graphs";
 		static const char *showInfoText = "info_text";
@@ -67,7 +92,11 @@ void LuaApplication::expose(lua_State *L)
 	LuaUtils::addFunction(L, LuaNames::Application::setDebugOverlaySettings, setDebugOverlaySettings);
 
 	LuaUtils::addFunction(L, LuaNames::Application::rootNode, rootNode);
+	LuaUtils::addFunction(L, LuaNames::Application::findNode, findNode);
 	LuaUtils::addFunction(L, LuaNames::Application::interval, interval);
+	LuaUtils::addFunction(L, LuaNames::Application::frameTimeStatistics, frameTimeStatistics);
+	LuaUtils::addFunction(L, LuaNames::Application::hitchSettings, hitchSettings);
+	LuaUtils::addFunction(L, LuaNames::Application::setHitchSettings, setHitchSettings);
 
 	LuaUtils::addFunction(L, LuaNames::Application::width, width);
 	LuaUtils::addFunction(L, LuaNames::Application::height, height);
@@ -154,12 +183,88 @@ int LuaApplication::rootNode(lua_State *L)
 	return 1;
 }
 
+/*! It uses the object name index instead of visiting the scenegraph, the returned node has its most derived type. */
+int LuaApplication::findNode(lua_State *L)
+{
+	const char *name = LuaUtils::retrieve<const char *>(L, -1);
+
+	Object *object = Object::fromName<Object>(name);
+	while (object)
+	{
+		// clang-format off
+		switch (object->type())
+		{
+			case Object::ObjectType::SCENENODE:			LuaClassWrapper<SceneNode>::pushUntrackedUserData(L, static_cast<SceneNode *>(object)); return 1;
+			case Object::ObjectType::SPRITE:			LuaClassWrapper<Sprite>::pushUntrackedUserData(L, static_cast<Sprite *>(object)); return 1;
+			case Object::ObjectType::MESH_SPRITE:		LuaClassWrapper<MeshSprite>::pushUntrackedUserData(L, static_cast<MeshSprite *>(object)); return 1;
+			case Object::ObjectType::ANIMATED_SPRITE:	LuaClassWrapper<AnimatedSprite>::pushUntrackedUserData(L, static_cast<AnimatedSprite *>(object)); return 1;
+			case Object::ObjectType::PARTICLE_SYSTEM:	LuaClassWrapper<ParticleSystem>::pushUntrackedUserData(L, static_cast<ParticleSystem *>(object)); return 1;
+			case Object::ObjectType::TEXTNODE:			LuaClassWrapper<TextNode>::pushUntrackedUserData(L, static_cast<TextNode *>(object)); return 1;
+			default:									break;
+		}
+		// clang-format on
+
+		// Skipping objects with the same name that are not scene nodes
+		object = Object::nextWithName<Object>(object);
+	}
+
+	LuaUtils::push(L);
+	return 1;
+}
+
 int LuaApplication::interval(lua_State *L)
 {
 	LuaUtils::push(L, theApplication().interval());
 	return 1;
 }
 
+/*! Every phase is a table of percentiles in seconds, the frame one included. */
+int LuaApplication::frameTimeStatistics(lua_State *L)
+{
+	const FrameTimeStatistics &statistics = theApplication().frameTimeStatistics();
+
+	lua_createtable(L, 0, FrameTimeStatistics::Phase::COUNT + 1);
+	LuaUtils::pushField(L, LuaNames::Application::FrameTimeStatistics::hitches, statistics.numHitches());
+	for (unsigned int i = 0; i < FrameTimeStatistics::Phase::COUNT; i++)
+	{
+		const FrameTimeStatistics::Percentiles &percentiles = statistics.percentiles(static_cast<FrameTimeStatistics::Phase::Enum>(i));
+		lua_createtable(L, 0, 4);
+		LuaUtils::pushField(L, LuaNames::Application::FrameTimeStatistics::p50, percentiles.p50);
+		LuaUtils::pushField(L, LuaNames::Application::FrameTimeStatistics::p95, percentiles.p95);
+		LuaUtils::pushField(L, LuaNames::Application::FrameTimeStatistics::p99, percentiles.p99);
+		LuaUtils::pushField(L, LuaNames::Application::FrameTimeStatistics::max, percentiles.max);
+		lua_setfield(L, -2, LuaNames::Application::FrameTimeStatistics::phases[i]);
+	}
+
+	return 1;
+}
+
+int LuaApplication::hitchSettings(lua_State *L)
+{
+	const FrameTimeStatistics::HitchSettings &settings = theApplication().frameTimeStatistics().hitchSettings();
+
+	lua_createtable(L, 0, 3);
+	LuaUtils::pushField(L, LuaNames::Application::HitchSettings::minFrameTime, settings.minFrameTime);
+	LuaUtils::pushField(L, LuaNames::Application::HitchSettings::medianFactor, settings.medianFactor);
+	LuaUtils::pushField(L, LuaNames::Application::HitchSettings::logHitches, settings.logHitches);
+
+	return 1;
+}
+
+int LuaApplication::setHitchSettings(lua_State *L)
+{
+	if (lua_istable(L, -1) == false)
+		luaL_argerror(L, -1, "Expecting a table");
+
+	FrameTimeStatistics::HitchSettings &settings = theApplication().frameTimeStatistics().hitchSettings();
+
+	settings.minFrameTime = LuaUtils::retrieveField<float>(L, -1, LuaNames::Application::HitchSettings::minFrameTime);
+	settings.medianFactor = LuaUtils::retrieveField<float>(L, -1, LuaNames::Application::HitchSettings::medianFactor);
+	settings.logHitches = LuaUtils::retrieveField<bool>(L, -1, LuaNames::Application::HitchSettings::logHitches);
+
+	return 0;
+}
+
 int LuaApplication::width(lua_State *L)
 {
 	LuaUtils::push(L, theApplication().width());
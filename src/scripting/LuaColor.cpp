@@ -5,6 +5,7 @@
 #include "LuaColorUtils.h"
 #include "LuaUtils.h"
 #include "LuaDebug.h"
+#include "LuaValueType.h"
 #include "Colorf.h"
 
 namespace ncine {
@@ -15,6 +16,8 @@ namespace Color {
 
 	static const char *create = "create";
 	static const char *multiply = "mul";
+
+	static const char *multiplyOperator = "__mul";
 }}
 
 ///////////////////////////////////////////////////////////
@@ -31,6 +34,14 @@ void LuaColor::expose(lua_State *L)
 	lua_setfield(L, -2, LuaNames::Color::Color);
 }
 
+void LuaColor::exposeMetatable(lua_State *L)
+{
+	const char *fieldNames[LuaColorUtils::NumFields] = { LuaNames::Color::r, LuaNames::Color::g, LuaNames::Color::b, LuaNames::Color::a };
+	LuaValueType<float>::newMetatable(L, LuaColorUtils::typeName(), fieldNames, LuaColorUtils::NumFields, nullptr);
+	LuaUtils::addFunction(L, LuaNames::Color::multiplyOperator, multiply);
+	lua_pop(L, 1);
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -57,18 +68,18 @@ int LuaColor::multiply(lua_State *L)
 
 	if (lua_isnumber(L, -2) && lua_isnumber(L, -1))
 		LuaDebug::traceError(L, "Expecting two color tables or a color table and a number");
-	else if (lua_isnumber(L, -2) && lua_istable(L, -1))
+	else if (lua_isnumber(L, -2) && LuaUtils::isTableOrUserData(L, -1))
 	{
 		scalar = LuaUtils::retrieve<float>(L, -2);
 		first = LuaColorUtils::retrieveTable(L, -1);
 	}
-	else if (lua_istable(L, -2) && lua_isnumber(L, -1))
+	else if (LuaUtils::isTableOrUserData(L, -2) && lua_isnumber(L, -1))
 	{
 		scalar = LuaUtils::retrieve<float>(L, -1);
 		lua_pop(L, 1);
 		first = LuaColorUtils::retrieveTable(L, -1);
 	}
-	else if (lua_istable(L, -2) && lua_istable(L, -1))
+	else if (LuaUtils::isTableOrUserData(L, -2) && LuaUtils::isTableOrUserData(L, -1))
 	{
 		second = LuaColorUtils::retrieveTable(L, -1);
 		lua_pop(L, 1);
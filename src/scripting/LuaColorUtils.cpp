@@ -4,25 +4,17 @@
 
 namespace ncine {
 
-namespace LuaNames {
-namespace Color {
-	static const char *r = "r";
-	static const char *g = "g";
-	static const char *b = "b";
-	static const char *a = "a";
-}}
-
 ///////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
 ///////////////////////////////////////////////////////////
 
 void LuaColorUtils::push(lua_State *L, const Colorf &color)
 {
-	LuaUtils::createTable(L, 4, 0);
-	LuaUtils::pushField(L, LuaNames::Color::r, color.r());
-	LuaUtils::pushField(L, LuaNames::Color::g, color.g());
-	LuaUtils::pushField(L, LuaNames::Color::b, color.b());
-	LuaUtils::pushField(L, LuaNames::Color::a, color.a());
+	float *fields = static_cast<float *>(LuaUtils::newValueType(L, NumFields * sizeof(float), typeName()));
+	fields[0] = color.r();
+	fields[1] = color.g();
+	fields[2] = color.b();
+	fields[3] = color.a();
 }
 
 void LuaColorUtils::pushField(lua_State *L, const char *name, const Colorf &color)
@@ -33,7 +25,13 @@ void LuaColorUtils::pushField(lua_State *L, const char *name, const Colorf &colo
 
 Colorf LuaColorUtils::retrieve(lua_State *L, int index, int &newIndex)
 {
-	if (LuaUtils::isTable(L, index))
+	const float *fields = static_cast<const float *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+	{
+		newIndex = index;
+		return Colorf(fields[0], fields[1], fields[2], fields[3]);
+	}
+	else if (LuaUtils::isTableOrUserData(L, index))
 	{
 		newIndex = index;
 		return retrieveTable(L, index);
@@ -47,6 +45,10 @@ Colorf LuaColorUtils::retrieve(lua_State *L, int index, int &newIndex)
 
 Colorf LuaColorUtils::retrieveTable(lua_State *L, int index)
 {
+	const float *fields = static_cast<const float *>(LuaUtils::retrieveValueType(L, index, typeName()));
+	if (fields != nullptr)
+		return Colorf(fields[0], fields[1], fields[2], fields[3]);
+
 	const float red = LuaUtils::retrieveField<float>(L, index, LuaNames::Color::r);
 	const float green = LuaUtils::retrieveField<float>(L, index, LuaNames::Color::g);
 	const float blue = LuaUtils::retrieveField<float>(L, index, LuaNames::Color::b);
@@ -86,14 +88,11 @@ Colorf LuaColorUtils::retrieveParams(lua_State *L, int index)
 
 Colorf LuaColorUtils::retrieveTableField(lua_State *L, int index, const char *name)
 {
-	LuaUtils::retrieveFieldTable(L, index, name);
-	const float red = LuaUtils::retrieveField<float>(L, -1, LuaNames::Color::r);
-	const float green = LuaUtils::retrieveField<float>(L, -1, LuaNames::Color::g);
-	const float blue = LuaUtils::retrieveField<float>(L, -1, LuaNames::Color::b);
-	const float alpha = LuaUtils::retrieveField<float>(L, -1, LuaNames::Color::a);
+	LuaUtils::getField(L, index, name);
+	const Colorf color = retrieveTable(L, -1);
 	LuaUtils::pop(L);
 
-	return Colorf(red, green, blue, alpha);
+	return color;
 }
 
 Colorf LuaColorUtils::retrieveArrayField(lua_State *L, int index, const char *name)
@@ -117,8 +117,8 @@ namespace {
 		for (unsigned int i = 0; i < length; i++)
 		{
 			const int type = lua_rawgeti(L, index, i + 1);
-			if (type != LUA_TTABLE)
-				luaL_argerror(L, -1, "Expecting a table");
+			if (type != LUA_TTABLE && type != LUA_TUSERDATA)
+				luaL_argerror(L, -1, "Expecting a table or a vector");
 
 			vertices[i] = LuaVector2fUtils::retrieveTable(L, -1);
 			lua_pop(L, 1);
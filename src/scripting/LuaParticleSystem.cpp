@@ -265,7 +265,9 @@ namespace {
 		lua_pop(L, 1);
 
 		lua_getfield(L, index, LuaNames::ParticleInitializer::position);
-		if (lua_istable(L, -1) && lua_rawlen(L, -1) == 0)
+		// A vector returned by the API is a userdata, a plain vector table has no array part
+		if (LuaUtils::retrieveValueType(L, -1, LuaVector2fUtils::typeName()) != nullptr ||
+		    (lua_istable(L, -1) && lua_rawlen(L, -1) == 0))
 		{
 			const Vector2f position = LuaVector2fUtils::retrieveTable(L, -1);
 			init.setPosition(position);
@@ -283,7 +285,8 @@ namespace {
 		lua_pop(L, 1);
 
 		lua_getfield(L, index, LuaNames::ParticleInitializer::velocity);
-		if (lua_istable(L, -1) && lua_rawlen(L, -1) == 0)
+		if (LuaUtils::retrieveValueType(L, -1, LuaVector2fUtils::typeName()) != nullptr ||
+		    (lua_istable(L, -1) && lua_rawlen(L, -1) == 0))
 		{
 			const Vector2f velocity = LuaVector2fUtils::retrieveTable(L, -1);
 			init.setVelocity(velocity);
@@ -0,0 +1,312 @@
+#define NCINE_INCLUDE_LUA
+#include "common_headers.h"
+
+#include <cstdio> // for snprintf()
+#include <nctl/Array.h>
+#include <nctl/algorithms.h>
+#include "LuaProfiler.h"
+#include "LuaStateManager.h"
+#include "LuaUtils.h"
+#include "tracy.h"
+
+namespace ncine {
+
+namespace LuaNames {
+namespace LuaProfiler {
+	static const char *LuaProfiler = "profiler";
+
+	static const char *isEnabled = "is_enabled";
+	static const char *setEnabled = "set_enabled";
+	static const char *reset = "reset";
+	static const char *numSamples = "get_num_samples";
+	static const char *collapsedStacks = "get_collapsed_stacks";
+	static const char *functionTimes = "get_function_times";
+	static const char *forwardsToTracy = "get_tracy_forwarding";
+	static const char *setForwardToTracy = "set_tracy_forwarding";
+}}
+
+namespace {
+
+	/// Initial capacity of the hashmaps of stacks and functions
+	const unsigned int InitialCapacity = 64;
+	/// A longer time between two samples means that Lua was not running, for example between two frames
+	const float MaxSampleWeight = 0.001f;
+
+	/// Doubles the capacity of a hashmap before its load factor makes insertions slow
+	template <class T>
+	void growIfNeeded(nctl::StringHashMap<T> &hashMap)
+	{
+		if (hashMap.size() * 4 >= hashMap.capacity() * 3)
+			hashMap.rehash(hashMap.capacity() * 2);
+	}
+
+	struct FunctionEntry
+	{
+		const nctl::String *name;
+		const LuaProfiler::FunctionTimes *times;
+	};
+
+	bool isSelfTimeGreater(const FunctionEntry &a, const FunctionEntry &b)
+	{
+		return a.times->selfTime > b.times->selfTime;
+	}
+
+}
+
+///////////////////////////////////////////////////////////
+// CONSTRUCTORS and DESTRUCTOR
+///////////////////////////////////////////////////////////
+
+LuaProfiler::LuaProfiler(LuaStateManager &stateManager)
+    : stateManager_(stateManager), enabled_(false), forwardToTracy_(false), numSamples_(0),
+      stacks_(InitialCapacity), functions_(InitialCapacity), stackKey_(MaxStackLength)
+{
+}
+
+///////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void LuaProfiler::setEnabled(bool enabled)
+{
+	if (enabled == enabled_)
+		return;
+
+	enabled_ = enabled;
+	lastSampleTime_ = TimeStamp::now();
+	stateManager_.updateCountHook();
+}
+
+void LuaProfiler::reset()
+{
+	numSamples_ = 0;
+	stacks_.clear();
+	functions_.clear();
+}
+
+nctl::String LuaProfiler::collapsedStacks() const
+{
+	// Enough room for every stack, a space, a ten digits number and a new line
+	unsigned int capacity = 1;
+	for (nctl::StringHashMap<float>::ConstIterator i = stacks_.begin(); i != stacks_.end(); ++i)
+		capacity += i.key().length() + 12;
+
+	nctl::String result(capacity);
+	for (nctl::StringHashMap<float>::ConstIterator i = stacks_.begin(); i != stacks_.end(); ++i)
+		result.formatAppend("%s %u\n", i.key().data(), static_cast<unsigned int>(i.value() * 1000000.0f));
+
+	return result;
+}
+
+nctl::String LuaProfiler::functionTimes() const
+{
+	nctl::Array<FunctionEntry> entries(functions_.size() > 0 ? functions_.size() : 1);
+	unsigned int capacity = 1;
+	for (nctl::StringHashMap<FunctionTimes>::ConstIterator i = functions_.begin(); i != functions_.end(); ++i)
+	{
+		entries.pushBack({ &i.key(), &i.value() });
+		// Room for the name and for the formatted numbers
+		capacity += i.key().length() + 64;
+	}
+	nctl::quicksort(entries.begin(), entries.end(), isSelfTimeGreater);
+
+	nctl::String result(capacity);
+	for (const FunctionEntry &entry : entries)
+	{
+		result.formatAppend("%s: self %.3f ms, total %.3f ms, %u samples\n", entry.name->data(),
+		                    entry.times->selfTime * 1000.0f, entry.times->totalTime * 1000.0f, entry.times->numSamples);
+	}
+
+	return result;
+}
+
+void LuaProfiler::expose(lua_State *L)
+{
+	lua_createtable(L, 0, 8);
+
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::isEnabled, luaIsEnabled);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::setEnabled, luaSetEnabled);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::reset, luaReset);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::numSamples, luaNumSamples);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::collapsedStacks, luaCollapsedStacks);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::functionTimes, luaFunctionTimes);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::forwardsToTracy, luaForwardsToTracy);
+	LuaUtils::addFunction(L, LuaNames::LuaProfiler::setForwardToTracy, luaSetForwardToTracy);
+
+	lua_setfield(L, -2, LuaNames::LuaProfiler::LuaProfiler);
+}
+
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+
+void LuaProfiler::sample(lua_State *L)
+{
+	float weight = lastSampleTime_.secondsSince();
+	lastSampleTime_ = TimeStamp::now();
+	if (weight > MaxSampleWeight)
+		weight = MaxSampleWeight;
+
+	lua_Debug ar;
+	int depth = 0;
+	while (depth < static_cast<int>(MaxStackDepth) && lua_getstack(L, depth, &ar))
+		depth++;
+	if (depth == 0)
+		return;
+
+	// The collapsed format lists functions from the outermost to the innermost one
+	char frame[MaxFrameLength];
+	unsigned int numFrames = 0;
+	stackKey_.clear();
+	for (int level = depth - 1; level >= 0; level--)
+	{
+		lua_getstack(L, level, &ar);
+		lua_getinfo(L, "Sn", &ar);
+
+		// Every level is truncated to the size of the local buffer
+		const char *name = (ar.name != nullptr) ? ar.name : "?";
+		int frameLength = 0;
+		if (ar.what[0] == 'm')
+			frameLength = snprintf(frame, MaxFrameLength, "main@%s", ar.short_src);
+		else if (ar.what[0] == 'C')
+			frameLength = snprintf(frame, MaxFrameLength, "%s@[C]", name);
+		else
+			frameLength = snprintf(frame, MaxFrameLength, "%s@%s:%d", name, ar.short_src, ar.linedefined);
+
+		if (frameLength < 0)
+			frameLength = 0;
+		else if (frameLength >= static_cast<int>(MaxFrameLength))
+			frameLength = MaxFrameLength - 1;
+
+		// The level is only added if it fits together with its separator and the termination character
+		const unsigned int separatorLength = (numFrames > 0) ? 1 : 0;
+		if (stackKey_.length() + separatorLength + frameLength + 1 > stackKey_.capacity())
+			break;
+
+		if (numFrames > 0)
+			stackKey_.formatAppend(";");
+		frameOffsets_[numFrames] = stackKey_.length();
+		stackKey_.formatAppend("%s", frame);
+		numFrames++;
+	}
+	frameOffsets_[numFrames] = stackKey_.length() + 1;
+
+	numSamples_++;
+	addStack(weight);
+	addFunctions(numFrames, weight);
+
+#ifdef WITH_TRACY
+	if (forwardToTracy_)
+		TracyMessage(stackKey_.data(), stackKey_.length());
+#endif
+}
+
+void LuaProfiler::addStack(float weight)
+{
+	float *stackTime = stacks_.find(stackKey_);
+	if (stackTime != nullptr)
+		*stackTime += weight;
+	else
+	{
+		growIfNeeded(stacks_);
+		// The key is copied with a capacity that fits its length
+		stacks_.insert(nctl::String(nctl::StringView(stackKey_.data(), stackKey_.length())), weight);
+	}
+}
+
+/*! A recursive function is counted only once per sample in its total time. */
+void LuaProfiler::addFunctions(unsigned int depth, float weight)
+{
+	for (unsigned int i = 0; i < depth; i++)
+	{
+		const nctl::StringView name = frameName(i);
+
+		bool isRecursive = false;
+		for (unsigned int j = i + 1; j < depth; j++)
+		{
+			if (frameName(j) == name)
+			{
+				isRecursive = true;
+				break;
+			}
+		}
+		if (isRecursive)
+			continue;
+
+		const nctl::hash_t hash = name.hash();
+		FunctionTimes *times = functions_.find(name, hash);
+		if (times == nullptr)
+		{
+			growIfNeeded(functions_);
+			functions_.insert(nctl::String(name), FunctionTimes());
+			times = functions_.find(name, hash);
+		}
+
+		times->totalTime += weight;
+		times->numSamples++;
+		if (i == depth - 1)
+			times->selfTime += weight;
+	}
+}
+
+nctl::StringView LuaProfiler::frameName(unsigned int index) const
+{
+	// Every name is followed by a separator, the last offset is a sentinel past the end
+	const unsigned int start = frameOffsets_[index];
+	const unsigned int end = frameOffsets_[index + 1] - 1;
+	return nctl::StringView(stackKey_.data() + start, (end > start) ? end - start : 0);
+}
+
+int LuaProfiler::luaIsEnabled(lua_State *L)
+{
+	LuaUtils::push(L, LuaStateManager::manager(L)->profiler().isEnabled());
+	return 1;
+}
+
+int LuaProfiler::luaSetEnabled(lua_State *L)
+{
+	const bool enabled = LuaUtils::retrieve<bool>(L, -1);
+	LuaStateManager::manager(L)->profiler().setEnabled(enabled);
+	return 0;
+}
+
+int LuaProfiler::luaReset(lua_State *L)
+{
+	LuaStateManager::manager(L)->profiler().reset();
+	return 0;
+}
+
+int LuaProfiler::luaNumSamples(lua_State *L)
+{
+	LuaUtils::push(L, LuaStateManager::manager(L)->profiler().numSamples());
+	return 1;
+}
+
+int LuaProfiler::luaCollapsedStacks(lua_State *L)
+{
+	const nctl::String stacks = LuaStateManager::manager(L)->profiler().collapsedStacks();
+	LuaUtils::push(L, stacks.data());
+	return 1;
+}
+
+int LuaProfiler::luaFunctionTimes(lua_State *L)
+{
+	const nctl::String times = LuaStateManager::manager(L)->profiler().functionTimes();
+	LuaUtils::push(L, times.data());
+	return 1;
+}
+
+int LuaProfiler::luaForwardsToTracy(lua_State *L)
+{
+	LuaUtils::push(L, LuaStateManager::manager(L)->profiler().forwardsToTracy());
+	return 1;
+}
+
+int LuaProfiler::luaSetForwardToTracy(lua_State *L)
+{
+	const bool forwardToTracy = LuaUtils::retrieve<bool>(L, -1);
+	LuaStateManager::manager(L)->profiler().setForwardToTracy(forwardToTracy);
+	return 0;
+}
+
+}
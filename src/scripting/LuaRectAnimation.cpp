@@ -53,8 +53,8 @@ nctl::UniquePtr<RectAnimation> LuaRectAnimation::retrieveTable(lua_State *L, int
 	for (unsigned int i = 0; i < length; i++)
 	{
 		const int type = lua_rawgeti(L, index, i + 1);
-		if (type != LUA_TTABLE)
-			luaL_argerror(L, -1, "Expecting a table");
+		if (type != LUA_TTABLE && type != LUA_TUSERDATA)
+			luaL_argerror(L, -1, "Expecting a table or a rectangle");
 
 		Recti rect = LuaRectiUtils::retrieveTable(L, -1);
 		animation->addRect(rect);
@@ -1,3 +1,6 @@
+#define NCINE_INCLUDE_LUA
+#include "common_headers.h"
+
 #include "LuaSceneNode.h"
 #include "LuaClassWrapper.h"
 #include "LuaColorUtils.h"
@@ -14,6 +17,9 @@ namespace SceneNode {
 	static const char *removeChildNode = "remove_child";
 	static const char *unlinkChildNode = "unlink_child";
 
+	static const char *name = "get_name";
+	static const char *setName = "set_name";
+
 	static const char *enabled = "is_enabled";
 	static const char *setEnabled = "set_enabled";
 
@@ -28,8 +34,35 @@ namespace SceneNode {
 	static const char *setColor = "set_color";
 	static const char *alpha = "get_alpha";
 	static const char *setAlpha = "set_alpha";
+
+	static const char *positions = "get_positions";
+	static const char *setPositions = "set_positions";
+	static const char *setRotations = "set_rotations";
+	static const char *setColors = "set_colors";
 }}
 
+namespace {
+
+	/// Returns the node at a one-based index of the array of nodes at the specified stack index
+	SceneNode *nodeAt(lua_State *L, int nodesIndex, unsigned int i)
+	{
+		lua_rawgeti(L, nodesIndex, i);
+		SceneNode *node = LuaClassWrapper<SceneNode>::unwrapUserData(L, -1);
+		lua_pop(L, 1);
+		return node;
+	}
+
+	/// Returns the number at a one-based index of the flat array of numbers at the specified stack index
+	float numberAt(lua_State *L, int numbersIndex, unsigned int i)
+	{
+		lua_rawgeti(L, numbersIndex, i);
+		const float number = LuaUtils::retrieve<float>(L, -1);
+		lua_pop(L, 1);
+		return number;
+	}
+
+}
+
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
@@ -42,6 +75,9 @@ void LuaSceneNode::exposeFunctions(lua_State *L)
 	LuaUtils::addFunction(L, LuaNames::SceneNode::removeChildNode, removeChildNode);
 	LuaUtils::addFunction(L, LuaNames::SceneNode::unlinkChildNode, unlinkChildNode);
 
+	LuaUtils::addFunction(L, LuaNames::SceneNode::name, name);
+	LuaUtils::addFunction(L, LuaNames::SceneNode::setName, setName);
+
 	LuaUtils::addFunction(L, LuaNames::SceneNode::enabled, enabled);
 	LuaUtils::addFunction(L, LuaNames::SceneNode::setEnabled, setEnabled);
 
@@ -56,6 +92,11 @@ void LuaSceneNode::exposeFunctions(lua_State *L)
 	LuaUtils::addFunction(L, LuaNames::SceneNode::setColor, setColor);
 	LuaUtils::addFunction(L, LuaNames::SceneNode::alpha, alpha);
 	LuaUtils::addFunction(L, LuaNames::SceneNode::setAlpha, setAlpha);
+
+	LuaUtils::addFunction(L, LuaNames::SceneNode::positions, positions);
+	LuaUtils::addFunction(L, LuaNames::SceneNode::setPositions, setPositions);
+	LuaUtils::addFunction(L, LuaNames::SceneNode::setRotations, setRotations);
+	LuaUtils::addFunction(L, LuaNames::SceneNode::setColors, setColors);
 }
 
 int LuaSceneNode::parent(lua_State *L)
@@ -110,6 +151,25 @@ int LuaSceneNode::unlinkChildNode(lua_State *L)
 	return 1;
 }
 
+int LuaSceneNode::name(lua_State *L)
+{
+	SceneNode *node = LuaClassWrapper<SceneNode>::unwrapUserData(L, -1);
+
+	LuaUtils::push(L, node->name().data());
+
+	return 1;
+}
+
+int LuaSceneNode::setName(lua_State *L)
+{
+	SceneNode *node = LuaClassWrapper<SceneNode>::unwrapUserData(L, -2);
+	const char *name = LuaUtils::retrieve<const char *>(L, -1);
+
+	node->setName(name);
+
+	return 0;
+}
+
 int LuaSceneNode::enabled(lua_State *L)
 {
 	SceneNode *node = LuaClassWrapper<SceneNode>::unwrapUserData(L, -1);
@@ -232,4 +292,94 @@ int LuaSceneNode::setAlpha(lua_State *L)
 	return 0;
 }
 
+/*! Pushes a flat array with the coordinates of an array of nodes, an optional second table is filled and returned instead of creating a new one. */
+int LuaSceneNode::positions(lua_State *L)
+{
+	if (lua_gettop(L) > 1 && lua_isnil(L, -1))
+		lua_pop(L, 1);
+	const bool hasTableToFill = (lua_gettop(L) > 1);
+	if (hasTableToFill && lua_istable(L, -1) == false)
+		luaL_argerror(L, -1, "Expecting a table");
+	const int nodesIndex = hasTableToFill ? -2 : -1;
+	if (lua_istable(L, nodesIndex) == false)
+		luaL_argerror(L, nodesIndex, "Expecting a table");
+
+	const unsigned int numNodes = static_cast<unsigned int>(lua_rawlen(L, nodesIndex));
+	if (hasTableToFill == false)
+		lua_createtable(L, numNodes * 2, 0);
+
+	// The nodes are now at index -2 and the coordinates at index -1
+	for (unsigned int i = 0; i < numNodes; i++)
+	{
+		const Vector2f &pos = nodeAt(L, -2, i + 1)->position();
+		lua_pushnumber(L, pos.x);
+		lua_rawseti(L, -2, i * 2 + 1);
+		lua_pushnumber(L, pos.y);
+		lua_rawseti(L, -2, i * 2 + 2);
+	}
+
+	return 1;
+}
+
+/*! Sets the position of an array of nodes from a flat array of coordinates, with two numbers per node. */
+int LuaSceneNode::setPositions(lua_State *L)
+{
+	if (lua_istable(L, -1) == false)
+		luaL_argerror(L, -1, "Expecting a table");
+	if (lua_istable(L, -2) == false)
+		luaL_argerror(L, -2, "Expecting a table");
+
+	const unsigned int numNodes = static_cast<unsigned int>(lua_rawlen(L, -2));
+	LuaUtils::assertArrayLength(L, -1, numNodes * 2);
+
+	for (unsigned int i = 0; i < numNodes; i++)
+	{
+		SceneNode *node = nodeAt(L, -2, i + 1);
+		node->setPosition(numberAt(L, -1, i * 2 + 1), numberAt(L, -1, i * 2 + 2));
+	}
+
+	return 0;
+}
+
+/*! Sets the rotation of an array of nodes from an array of angles, with one number per node. */
+int LuaSceneNode::setRotations(lua_State *L)
+{
+	if (lua_istable(L, -1) == false)
+		luaL_argerror(L, -1, "Expecting a table");
+	if (lua_istable(L, -2) == false)
+		luaL_argerror(L, -2, "Expecting a table");
+
+	const unsigned int numNodes = static_cast<unsigned int>(lua_rawlen(L, -2));
+	LuaUtils::assertArrayLength(L, -1, numNodes);
+
+	for (unsigned int i = 0; i < numNodes; i++)
+	{
+		SceneNode *node = nodeAt(L, -2, i + 1);
+		node->setRotation(numberAt(L, -1, i + 1));
+	}
+
+	return 0;
+}
+
+/*! Sets the color of an array of nodes from a flat array of components, with four numbers per node. */
+int LuaSceneNode::setColors(lua_State *L)
+{
+	if (lua_istable(L, -1) == false)
+		luaL_argerror(L, -1, "Expecting a table");
+	if (lua_istable(L, -2) == false)
+		luaL_argerror(L, -2, "Expecting a table");
+
+	const unsigned int numNodes = static_cast<unsigned int>(lua_rawlen(L, -2));
+	LuaUtils::assertArrayLength(L, -1, numNodes * 4);
+
+	for (unsigned int i = 0; i < numNodes; i++)
+	{
+		SceneNode *node = nodeAt(L, -2, i + 1);
+		const unsigned int first = i * 4;
+		node->setColorF(numberAt(L, -1, first + 1), numberAt(L, -1, first + 2), numberAt(L, -1, first + 3), numberAt(L, -1, first + 4));
+	}
+
+	return 0;
+}
+
 }
@@ -5,12 +5,14 @@
 #include "LuaStateManager.h"
 #include "LuaDebug.h"
 #include "LuaStatistics.h"
+#include "LuaProfiler.h"
 #include "LuaNames.h"
 
 #include "LuaRect.h"
 #include "LuaVector2.h"
 #include "LuaVector3.h"
 #include "LuaColor.h"
+#include "LuaValueType.h"
 #include "LuaILogger.h"
 
 #include "LuaIInputManager.h"
@@ -41,6 +43,8 @@
 #include "Application.h"
 #include <cstring> // for memchr()
 #include "IFile.h"
+#include "TimeStamp.h"
+#include "tracy.h"
 
 #ifdef WITH_TRACY
 	#include "TracyLua.hpp"
@@ -52,6 +56,34 @@
 
 namespace ncine {
 
+namespace {
+
+	/// Default number of seconds a frame budgeted collector can run in a frame
+	const float DefaultGcBudget = 0.001f;
+	/// Amount of work in Kbytes performed by every incremental collection step
+	const int GcStepSize = 16;
+	/// A new collection cycle starts when the memory in use has grown by this factor since the end of the last one
+	const int GcPauseFactor = 2;
+
+	/// The address is the registry key of the manager of a state that has been created by the host
+	const char ManagerRegistryKey = 0;
+
+}
+
+namespace LuaNames {
+namespace GarbageCollector {
+	static const char *GarbageCollector = "gc";
+
+	static const char *mode = "get_mode";
+	static const char *setMode = "set_mode";
+	static const char *budget = "get_budget";
+	static const char *setBudget = "set_budget";
+
+	static const char *AUTOMATIC = "AUTOMATIC";
+	static const char *FRAME_BUDGETED = "FRAME_BUDGETED";
+	static const char *GarbageCollection = "gc_mode";
+}}
+
 namespace LuaNames {
 #ifdef WITH_GIT_VERSION
 	static const char *Version = "_VERSION";
@@ -87,7 +119,7 @@ namespace LuaNames {
 // STATIC DEFINITIONS
 ///////////////////////////////////////////////////////////
 
-nctl::Array<LuaStateManager::StateToManager> LuaStateManager::managers_(2);
+nctl::Array<LuaStateManager *> LuaStateManager::budgetedManagers_(2);
 
 ///////////////////////////////////////////////////////////
 // CONSTRUCTORS and DESTRUCTOR
@@ -103,17 +135,30 @@ LuaStateManager::LuaStateManager(ApiType apiType, StatisticsTracking statsTracki
 LuaStateManager::LuaStateManager(lua_State *L, ApiType apiType, StatisticsTracking statsTracking, StandardLibraries stdLibraries)
     : L_(L), apiType_(apiType), statsTracking_(statsTracking), stdLibraries_(stdLibraries),
       trackedUserDatas_(apiType == ApiType::FULL ? 16 : 1),
-      untrackedUserDatas_(16), closeOnDestruction_(false)
+      untrackedUserDatas_(16), closeOnDestruction_(false),
+      gcMode_(GarbageCollection::AUTOMATIC), gcBudget_(DefaultGcBudget), gcMemoryAfterCycle_(0), gcCycleInProgress_(false),
+      profiler_(*this)
 {
 	ASSERT(L_);
 	if (stdLibraries == StandardLibraries::LOADED)
 		luaL_openlibs(L_);
-	managers_.pushBack(StateToManager(L_, this));
+	// The extra space of a state created by the host might already be in use
+	if (isEngineState(L_))
+	{
+		// The extra space is shared by all threads created afterwards, coroutines included
+		*static_cast<LuaStateManager **>(lua_getextraspace(L_)) = this;
+	}
+	else
+	{
+		lua_pushlightuserdata(L_, this);
+		lua_rawsetp(L_, LUA_REGISTRYINDEX, &ManagerRegistryKey);
+	}
+	exposeValueTypes();
 
 	if (statsTracking == StatisticsTracking::ENABLED)
 	{
 		LuaStatistics::registerState(this);
-		lua_sethook(L_, luaCountHook, LUA_MASKCOUNT, LuaStatistics::OperationsCount);
+		updateCountHook();
 	}
 
 #ifdef WITH_TRACY
@@ -123,6 +168,7 @@ LuaStateManager::LuaStateManager(lua_State *L, ApiType apiType, StatisticsTracki
 
 LuaStateManager::~LuaStateManager()
 {
+	setGarbageCollection(GarbageCollection::AUTOMATIC);
 	if (statsTracking_ == StatisticsTracking::ENABLED)
 		LuaStatistics::unregisterState(this);
 
@@ -131,6 +177,14 @@ LuaStateManager::~LuaStateManager()
 
 	if (closeOnDestruction_)
 		lua_close(L_);
+	else
+	{
+		// The hook would look for a manager that no longer exists
+		if (lua_gethook(L_) == luaCountHook)
+			lua_sethook(L_, nullptr, 0, 0);
+		lua_pushnil(L_);
+		lua_rawsetp(L_, LUA_REGISTRYINDEX, &ManagerRegistryKey);
+	}
 }
 
 ///////////////////////////////////////////////////////////
@@ -235,55 +289,141 @@ void LuaStateManager::exposeScriptApi()
 
 bool LuaStateManager::run(const char *filename)
 {
-	releaseTrackedMemory();
-	untrackedUserDatas_.clear();
-
 	nctl::UniquePtr<IFile> fileHandle = IFile::createFileHandle(filename);
 	LOGI_X("Loading file: \"%s\"", fileHandle->filename());
 
 	fileHandle->open(IFile::OpenMode::READ | IFile::OpenMode::BINARY);
-	unsigned long fileSize = fileHandle->size();
+	const unsigned long fileSize = fileHandle->size();
 	nctl::UniquePtr<char[]> buffer = nctl::makeUnique<char[]>(fileSize);
 	fileHandle->read(buffer.get(), fileSize);
-	const char *bufferRead = buffer.get();
+
+	return runFromMemory(filename, buffer.get(), fileSize);
+}
+
+bool LuaStateManager::runFromMemory(const char *bufferName, const char *bufferPtr, unsigned long int bufferSize)
+{
+	ASSERT(bufferName);
+	ASSERT(bufferPtr);
+
+	releaseTrackedMemory();
+	untrackedUserDatas_.clear();
 
 	// Skip shebang as `luaL_loadfile` does
-	if (bufferRead[0] == '#')
+	if (bufferSize > 0 && bufferPtr[0] == '#')
 	{
-		bufferRead = static_cast<const char *>(memchr(bufferRead, '\n', fileSize)) + 1;
-		fileSize -= bufferRead - buffer.get();
+		const char *newLine = static_cast<const char *>(memchr(bufferPtr, '\n', bufferSize));
+		const unsigned long int skippedBytes = newLine ? (newLine + 1 - bufferPtr) : bufferSize;
+		bufferPtr += skippedBytes;
+		bufferSize -= skippedBytes;
 	}
 
-	const int loadError = luaL_loadbufferx(L_, bufferRead, fileSize, filename, "bt");
+	const int loadError = luaL_loadbufferx(L_, bufferPtr, bufferSize, bufferName, "bt");
 	if (loadError != LUA_OK)
 	{
-		LOGE_X("Cannot load \"%s\" script: %s", filename, LuaDebug::errorToSting(loadError));
+		LOGE_X("Cannot load \"%s\" script: %s", bufferName, LuaDebug::errorToSting(loadError));
 		return false;
 	}
 
 	const int callError = lua_pcall(L_, 0, LUA_MULTRET, 0);
 	if (callError != LUA_OK)
 	{
-		LOGE_X("Cannot run \"%s\" script: %s", filename, LuaDebug::errorToSting(callError));
+		LOGE_X("Cannot run \"%s\" script: %s", bufferName, LuaDebug::errorToSting(callError));
 		return false;
 	}
 
 	return true;
 }
 
-LuaStateManager *LuaStateManager::manager(lua_State *L)
+void LuaStateManager::setGarbageCollection(GarbageCollection gcMode)
 {
-	LuaStateManager *stateManager = nullptr;
+	if (gcMode == gcMode_)
+		return;
 
-	for (const StateToManager &manager : managers_)
+	gcMode_ = gcMode;
+	if (gcMode == GarbageCollection::FRAME_BUDGETED)
 	{
-		if (manager.luaState == L)
+		lua_gc(L_, LUA_GCSTOP, 0);
+		gcMemoryAfterCycle_ = lua_gc(L_, LUA_GCCOUNT, 0);
+		gcCycleInProgress_ = false;
+		budgetedManagers_.pushBack(this);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < budgetedManagers_.size(); i++)
 		{
-			stateManager = manager.stateManager;
-			break;
+			if (budgetedManagers_[i] == this)
+			{
+				budgetedManagers_.removeAt(i);
+				break;
+			}
 		}
+		lua_gc(L_, LUA_GCRESTART, 0);
+	}
+}
+
+void LuaStateManager::setGcBudget(float seconds)
+{
+	ASSERT(seconds > 0.0f);
+	if (seconds > 0.0f)
+		gcBudget_ = seconds;
+}
+
+/*! Once a cycle has started, at least one step is performed at every call, so that it makes progress even when the frame has no time left. */
+void LuaStateManager::stepGarbageCollector(float budget)
+{
+	// Like the automatic collector, a new cycle only starts when the memory has grown enough since the last one.
+	// A cycle in progress is never paused, as sweeping frees memory and would bring it back under the threshold.
+	if (gcCycleInProgress_ == false)
+	{
+		const int memoryInUse = lua_gc(L_, LUA_GCCOUNT, 0);
+		if (memoryInUse < gcMemoryAfterCycle_ * GcPauseFactor)
+			return;
+		gcCycleInProgress_ = true;
+	}
+
+	const TimeStamp startTime = TimeStamp::now();
+	bool cycleCompleted = false;
+	do
+	{
+		cycleCompleted = (lua_gc(L_, LUA_GCSTEP, GcStepSize) != 0);
+	} while (cycleCompleted == false && startTime.secondsSince() < budget);
+
+	if (cycleCompleted)
+	{
+		gcMemoryAfterCycle_ = lua_gc(L_, LUA_GCCOUNT, 0);
+		gcCycleInProgress_ = false;
+	}
+
+	if (statsTracking_ == StatisticsTracking::ENABLED)
+		LuaStatistics::addGcStep(startTime.secondsSince(), cycleCompleted);
+}
+
+void LuaStateManager::stepGarbageCollectors(float timeLeft)
+{
+	if (budgetedManagers_.isEmpty())
+		return;
+
+	ZoneScoped;
+	const float sharedTimeLeft = timeLeft / budgetedManagers_.size();
+	for (LuaStateManager *manager : budgetedManagers_)
+	{
+		const float budget = (sharedTimeLeft > 0.0f && sharedTimeLeft < manager->gcBudget_) ? sharedTimeLeft : manager->gcBudget_;
+		manager->stepGarbageCollector(budget);
 	}
+}
 
+/*! The manager of a state created by the engine is stored in the extra space, the one of a state created by the host in the registry. */
+LuaStateManager *LuaStateManager::manager(lua_State *L)
+{
+	LuaStateManager *stateManager = nullptr;
+	if (isEngineState(L))
+		stateManager = *static_cast<LuaStateManager **>(lua_getextraspace(L));
+	else
+	{
+		lua_rawgetp(L, LUA_REGISTRYINDEX, &ManagerRegistryKey);
+		stateManager = static_cast<LuaStateManager *>(lua_touserdata(L, -1));
+		lua_pop(L, 1);
+	}
 	FATAL_ASSERT(stateManager != nullptr);
 	return stateManager;
 }
@@ -292,6 +432,13 @@ LuaStateManager *LuaStateManager::manager(lua_State *L)
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
+/*! Only the states created by the engine use one of its allocators. */
+bool LuaStateManager::isEngineState(lua_State *L)
+{
+	const lua_Alloc allocFunc = lua_getallocf(L, nullptr);
+	return (allocFunc == luaAllocator || allocFunc == luaAllocatorWithStatistics);
+}
+
 void *LuaStateManager::luaAllocator(void *ud, void *ptr, size_t osize, size_t nsize)
 {
 	if (nsize == 0)
@@ -320,8 +467,23 @@ void *LuaStateManager::luaAllocatorWithStatistics(void *ud, void *ptr, size_t os
 
 void LuaStateManager::luaCountHook(lua_State *L, lua_Debug *ar)
 {
-	if (ar->event == LUA_HOOKCOUNT)
+	if (ar->event != LUA_HOOKCOUNT)
+		return;
+
+	LuaStateManager *stateManager = manager(L);
+	if (stateManager->statsTracking_ == StatisticsTracking::ENABLED)
 		LuaStatistics::countOperations();
+	if (stateManager->profiler_.isEnabled())
+		stateManager->profiler_.sample(L);
+}
+
+/*! The hook of a thread is inherited by the ones it creates, coroutines created before a change keep the previous hook. */
+void LuaStateManager::updateCountHook()
+{
+	if (statsTracking_ == StatisticsTracking::ENABLED || profiler_.isEnabled())
+		lua_sethook(L_, luaCountHook, LUA_MASKCOUNT, LuaStatistics::OperationsCount);
+	else
+		lua_sethook(L_, nullptr, 0, 0);
 }
 
 void LuaStateManager::exposeApi()
@@ -333,6 +495,8 @@ void LuaStateManager::exposeApi()
 	LuaVector3<float>::expose(L_);
 	LuaColor::expose(L_);
 	LuaILogger::expose(L_);
+	LuaProfiler::expose(L_);
+	exposeGarbageCollector();
 	LuaIInputManager::expose(L_);
 	LuaKeyboardEvents::expose(L_);
 	LuaJoystickEvents::expose(L_);
@@ -371,6 +535,11 @@ void LuaStateManager::exposeConstants()
 	LuaIInputManager::exposeConstants(L_);
 	LuaILogger::exposeConstants(L_);
 
+	lua_createtable(L_, 2, 0);
+	LuaUtils::pushField(L_, LuaNames::GarbageCollector::AUTOMATIC, static_cast<int64_t>(GarbageCollection::AUTOMATIC));
+	LuaUtils::pushField(L_, LuaNames::GarbageCollector::FRAME_BUDGETED, static_cast<int64_t>(GarbageCollection::FRAME_BUDGETED));
+	lua_setfield(L_, -2, LuaNames::GarbageCollector::GarbageCollection);
+
 	if (appCfg.withScenegraph)
 	{
 		LuaTexture::exposeConstants(L_);
@@ -418,4 +587,63 @@ void LuaStateManager::exposeConstants()
 #endif
 }
 
+void LuaStateManager::exposeGarbageCollector()
+{
+	lua_createtable(L_, 0, 4);
+
+	LuaUtils::addFunction(L_, LuaNames::GarbageCollector::mode, luaGcMode);
+	LuaUtils::addFunction(L_, LuaNames::GarbageCollector::setMode, luaSetGcMode);
+	LuaUtils::addFunction(L_, LuaNames::GarbageCollector::budget, luaGcBudget);
+	LuaUtils::addFunction(L_, LuaNames::GarbageCollector::setBudget, luaSetGcBudget);
+
+	lua_setfield(L_, -2, LuaNames::GarbageCollector::GarbageCollector);
+}
+
+int LuaStateManager::luaGcMode(lua_State *L)
+{
+	LuaUtils::push(L, static_cast<int64_t>(manager(L)->garbageCollection()));
+	return 1;
+}
+
+int LuaStateManager::luaSetGcMode(lua_State *L)
+{
+	const int64_t gcMode = LuaUtils::retrieve<int64_t>(L, -1);
+	LuaDebug::assert(L, gcMode == static_cast<int64_t>(GarbageCollection::AUTOMATIC) ||
+	                        gcMode == static_cast<int64_t>(GarbageCollection::FRAME_BUDGETED),
+	                 "Invalid garbage collection mode %ld", static_cast<long>(gcMode));
+	manager(L)->setGarbageCollection(static_cast<GarbageCollection>(gcMode));
+	return 0;
+}
+
+int LuaStateManager::luaGcBudget(lua_State *L)
+{
+	LuaUtils::push(L, manager(L)->gcBudget());
+	return 1;
+}
+
+int LuaStateManager::luaSetGcBudget(lua_State *L)
+{
+	const float seconds = LuaUtils::retrieve<float>(L, -1);
+	LuaDebug::assert(L, seconds > 0.0f, "The garbage collection budget should be positive");
+	manager(L)->setGcBudget(seconds);
+	return 0;
+}
+
+void LuaStateManager::exposeValueTypes()
+{
+	LuaVector2<float>::exposeMetatable(L_);
+	LuaVector3<float>::exposeMetatable(L_);
+	LuaRect<float>::exposeMetatable(L_);
+	LuaRect<int>::exposeMetatable(L_);
+	LuaColor::exposeMetatable(L_);
+
+	// Integer vectors have no operators, an integer division by zero would not raise a Lua error
+	const char *vector2Fields[LuaVector2iUtils::NumFields] = { LuaNames::Vector2::x, LuaNames::Vector2::y };
+	LuaValueType<int>::newMetatable(L_, LuaVector2iUtils::typeName(), vector2Fields, LuaVector2iUtils::NumFields, nullptr);
+	lua_pop(L_, 1);
+	const char *vector3Fields[LuaVector3iUtils::NumFields] = { LuaNames::Vector3::x, LuaNames::Vector3::y, LuaNames::Vector3::z };
+	LuaValueType<int>::newMetatable(L_, LuaVector3iUtils::typeName(), vector3Fields, LuaVector3iUtils::NumFields, nullptr);
+	lua_pop(L_, 1);
+}
+
 }
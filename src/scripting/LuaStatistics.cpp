@@ -1,3 +1,6 @@
+#define NCINE_INCLUDE_LUA
+#include "common_headers.h"
+
 #include <nctl/String.h>
 #include "LuaStatistics.h"
 #include "LuaStateManager.h"
@@ -16,6 +19,11 @@ size_t LuaStatistics::usedMemory_ = 0;
 TimeStamp LuaStatistics::lastOpsUpdateTime_;
 unsigned int LuaStatistics::index_ = 0;
 int LuaStatistics::operations_[2] = { 0, 0 };
+float LuaStatistics::gcFrameTime_ = 0.0f;
+float LuaStatistics::maxGcFrameTime_ = 0.0f;
+float LuaStatistics::gcAccumulatedTime_ = 0.0f;
+unsigned int LuaStatistics::numGcCycles_ = 0;
+size_t LuaStatistics::gcMemory_ = 0;
 
 ///////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
@@ -27,8 +35,17 @@ void LuaStatistics::update()
 	for (unsigned int i = 0; i < LuaTypes::UserDataType::UNKNOWN + 1; i++)
 		numTypedUserDatas_[i] = 0;
 
+	// Collectors are stepped at the end of the previous frame
+	gcFrameTime_ = gcAccumulatedTime_;
+	if (maxGcFrameTime_ < gcFrameTime_)
+		maxGcFrameTime_ = gcFrameTime_;
+	gcAccumulatedTime_ = 0.0f;
+	TracyPlot("Lua GC", gcFrameTime_ * 1000.0f);
+
+	gcMemory_ = 0;
 	for (const LuaStateManager *manager : managers_)
 	{
+		gcMemory_ += static_cast<size_t>(lua_gc(manager->L_, LUA_GCCOUNT, 0));
 		numTrackedUserDatas_ += manager->trackedUserDatas_.size();
 		for (const LuaStateManager::UserDataWrapper &wrapper : manager->trackedUserDatas_)
 			numTypedUserDatas_[wrapper.type]++;
@@ -68,6 +85,13 @@ void LuaStatistics::unregisterState(LuaStateManager *stateManager)
 	}
 }
 
+void LuaStatistics::addGcStep(float seconds, bool cycleCompleted)
+{
+	gcAccumulatedTime_ += seconds;
+	if (cycleCompleted)
+		numGcCycles_++;
+}
+
 void LuaStatistics::countOperations()
 {
 	operations_[index_] += OperationsCount;
@@ -68,6 +68,12 @@ bool LuaUtils::isTable(lua_State *L, int index)
 	return lua_istable(L, index);
 }
 
+bool LuaUtils::isTableOrUserData(lua_State *L, int index)
+{
+	const int type = lua_type(L, index);
+	return (type == LUA_TTABLE || type == LUA_TUSERDATA);
+}
+
 size_t LuaUtils::rawLen(lua_State *L, int index)
 {
 	return lua_rawlen(L, index);
@@ -176,6 +182,20 @@ void *LuaUtils::retrieveUserData(lua_State *L, int index)
 	return lua_touserdata(L, index);
 }
 
+/*! The memory is owned by the full userdata left on top of the stack, its metatable is the one registered with `typeName`. */
+void *LuaUtils::newValueType(lua_State *L, size_t size, const char *typeName)
+{
+	void *userData = lua_newuserdata(L, size);
+	luaL_setmetatable(L, typeName);
+	return userData;
+}
+
+/*! \returns A null pointer if the value is not a full userdata with the metatable registered with `typeName` */
+void *LuaUtils::retrieveValueType(lua_State *L, int index, const char *typeName)
+{
+	return luaL_testudata(L, index, typeName);
+}
+
 void LuaUtils::assertArrayLength(lua_State *L, int index, unsigned int length)
 {
 	LuaDebug::assert(L, lua_rawlen(L, index) >= length, "Expecting an array of a minimum length of %u", length);
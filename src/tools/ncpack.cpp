@@ -0,0 +1,195 @@
+#include <cstdio>
+#include <cstring>
+#include <nctl/Array.h>
+#include <nctl/String.h>
+#include <nctl/algorithms.h>
+#include "PackArchive.h"
+
+namespace nc = ncine;
+
+namespace {
+
+const unsigned int MaxPathLength = 1024;
+
+/// A file to be stored in the pack archive
+struct InputFile
+{
+	nctl::String name;
+	uint32_t hash;
+	uint64_t size;
+	uint64_t offset;
+	uint32_t nameOffset;
+
+	InputFile()
+	    : name(MaxPathLength), hash(0), size(0), offset(0), nameOffset(0) {}
+};
+
+bool isEntryLess(const InputFile &a, const InputFile &b)
+{
+	if (a.hash != b.hash)
+		return a.hash < b.hash;
+	return strcmp(a.name.data(), b.name.data()) < 0;
+}
+
+uint64_t alignOffset(uint64_t offset)
+{
+	return (offset + nc::PackArchive::Alignment - 1) & ~static_cast<uint64_t>(nc::PackArchive::Alignment - 1);
+}
+
+bool addInputFile(nctl::Array<InputFile> &inputFiles, const char *inputDir, const char *name)
+{
+	if (strlen(name) >= MaxPathLength)
+	{
+		fprintf(stderr, "The input file path \"%s\" is too long\n", name);
+		return false;
+	}
+
+	InputFile inputFile;
+	inputFile.name = name;
+	// Paths in the directory always use forward slashes
+	for (char &c : inputFile.name)
+	{
+		if (c == '\\')
+			c = '/';
+	}
+	inputFile.hash = nc::PackArchive::hashPath(inputFile.name.data());
+
+	nctl::String path(MaxPathLength);
+	path.format("%s/%s", inputDir, name);
+	FILE *file = fopen(path.data(), "rb");
+	if (file == nullptr)
+	{
+		fprintf(stderr, "Cannot open the input file \"%s\"\n", path.data());
+		return false;
+	}
+	fseek(file, 0L, SEEK_END);
+	inputFile.size = static_cast<uint64_t>(ftell(file));
+	fclose(file);
+
+	inputFiles.pushBack(nctl::move(inputFile));
+	return true;
+}
+
+bool copyFileData(FILE *packFile, const char *inputDir, const InputFile &inputFile)
+{
+	nctl::String path(MaxPathLength);
+	path.format("%s/%s", inputDir, inputFile.name.data());
+	FILE *file = fopen(path.data(), "rb");
+	if (file == nullptr)
+	{
+		fprintf(stderr, "Cannot open the input file \"%s\"\n", path.data());
+		return false;
+	}
+
+	fseek(packFile, static_cast<long int>(inputFile.offset), SEEK_SET);
+	unsigned char buffer[64 * 1024];
+	size_t bytesRead = 0;
+	while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		fwrite(buffer, 1, bytesRead, packFile);
+	fclose(file);
+
+	return true;
+}
+
+}
+
+/// Creates a pack archive from a list of files relative to an input directory
+/*! The list is read from the standard input, one path per line, if it is not specified as arguments. */
+int main(int argc, char **argv)
+{
+	if (argc < 3)
+	{
+		printf("Usage: %s <output pack> <input directory> [file...]\n", argv[0]);
+		printf("If no files are specified their paths are read from the standard input, one per line.\n");
+		return EXIT_FAILURE;
+	}
+
+	const char *outputFilename = argv[1];
+	const char *inputDir = argv[2];
+
+	nctl::Array<InputFile> inputFiles;
+	if (argc > 3)
+	{
+		for (int i = 3; i < argc; i++)
+		{
+			if (addInputFile(inputFiles, inputDir, argv[i]) == false)
+				return EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		char line[MaxPathLength];
+		while (fgets(line, MaxPathLength, stdin))
+		{
+			line[strcspn(line, "\r\n")] = '\0';
+			if (line[0] != '\0' && addInputFile(inputFiles, inputDir, line) == false)
+				return EXIT_FAILURE;
+		}
+	}
+
+	if (inputFiles.isEmpty())
+	{
+		fprintf(stderr, "No input files\n");
+		return EXIT_FAILURE;
+	}
+
+	// The directory is sorted by hash to allow a binary search
+	nctl::quicksort(inputFiles.begin(), inputFiles.end(), isEntryLess);
+
+	uint32_t namesSize = 0;
+	for (InputFile &inputFile : inputFiles)
+	{
+		inputFile.nameOffset = namesSize;
+		namesSize += inputFile.name.length() + 1;
+	}
+
+	uint64_t offset = sizeof(nc::PackArchive::Header) + inputFiles.size() * sizeof(nc::PackArchive::Entry) + namesSize;
+	for (InputFile &inputFile : inputFiles)
+	{
+		inputFile.offset = alignOffset(offset);
+		offset = inputFile.offset + inputFile.size;
+	}
+
+	FILE *packFile = fopen(outputFilename, "wb");
+	if (packFile == nullptr)
+	{
+		fprintf(stderr, "Cannot open the output file \"%s\"\n", outputFilename);
+		return EXIT_FAILURE;
+	}
+
+	nc::PackArchive::Header header;
+	header.magic = nc::IFile::int32FromLE(nc::PackArchive::Magic);
+	header.version = nc::IFile::int32FromLE(nc::PackArchive::Version);
+	header.numEntries = nc::IFile::int32FromLE(inputFiles.size());
+	header.namesSize = nc::IFile::int32FromLE(namesSize);
+	fwrite(&header, sizeof(header), 1, packFile);
+
+	for (const InputFile &inputFile : inputFiles)
+	{
+		nc::PackArchive::Entry entry;
+		entry.hash = nc::IFile::int32FromLE(inputFile.hash);
+		entry.nameOffset = nc::IFile::int32FromLE(inputFile.nameOffset);
+		entry.compression = nc::IFile::int32FromLE(static_cast<uint32_t>(nc::PackArchive::Compression::NONE));
+		entry.reserved = 0;
+		entry.offset = nc::IFile::int64FromLE(inputFile.offset);
+		entry.size = nc::IFile::int64FromLE(inputFile.size);
+		fwrite(&entry, sizeof(entry), 1, packFile);
+	}
+
+	for (const InputFile &inputFile : inputFiles)
+		fwrite(inputFile.name.data(), 1, inputFile.name.length() + 1, packFile);
+
+	for (const InputFile &inputFile : inputFiles)
+	{
+		if (copyFileData(packFile, inputDir, inputFile) == false)
+		{
+			fclose(packFile);
+			return EXIT_FAILURE;
+		}
+	}
+
+	fclose(packFile);
+	printf("Pack archive \"%s\" created with %u entries (%llu bytes)\n", outputFilename, inputFiles.size(), static_cast<unsigned long long>(offset));
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,205 @@
+#include <nctl/Array.h>
+#include <nctl/List.h>
+#include <nctl/String.h>
+#include <nctl/LinearAllocator.h>
+#include <nctl/PoolAllocator.h>
+#include <nctl/FreeListAllocator.h>
+#include <nctl/MallocAllocator.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const unsigned int Capacity = 10;
+
+TEST(AllocatorContainersTest, ArrayWithLinearAllocator)
+{
+	nctl::LinearAllocator allocator("ArrayLinearAllocator", 1024);
+	nctl::Array<int> array(Capacity, allocator);
+	printf("Filling an array that takes its memory from a linear allocator\n");
+	for (unsigned int i = 0; i < Capacity; i++)
+		array.pushBack(i);
+
+	ASSERT_EQ(array.allocator(), &allocator);
+	ASSERT_EQ(allocator.numAllocations(), 1u);
+	ASSERT_GE(allocator.usedMemory(), Capacity * sizeof(int));
+	for (unsigned int i = 0; i < Capacity; i++)
+		ASSERT_EQ(array[i], static_cast<int>(i));
+}
+
+TEST(AllocatorContainersTest, ArrayGrowWithFreeListAllocator)
+{
+	nctl::FreeListAllocator allocator("ArrayFreeListAllocator", 4096);
+	{
+		nctl::Array<int> array(allocator);
+		printf("Growing an array that takes its memory from a free list allocator\n");
+		for (unsigned int i = 0; i < 100; i++)
+			array.pushBack(i);
+
+		ASSERT_EQ(array.size(), 100u);
+		for (unsigned int i = 0; i < 100; i++)
+			ASSERT_EQ(array[i], static_cast<int>(i));
+		ASSERT_EQ(allocator.numAllocations(), 1u);
+		ASSERT_GT(allocator.totalAllocations(), 1u);
+	}
+	ASSERT_EQ(allocator.numAllocations(), 0u);
+	ASSERT_EQ(allocator.usedMemory(), 0u);
+}
+
+TEST(AllocatorContainersTest, CopyArrayUsesDefaultAllocator)
+{
+	nctl::MallocAllocator allocator("ArrayMallocAllocator");
+	nctl::Array<int> array(Capacity, allocator);
+	for (unsigned int i = 0; i < Capacity; i++)
+		array.pushBack(i);
+
+	printf("Copy constructing and move constructing an array with an allocator\n");
+	nctl::Array<int> copiedArray(array);
+	ASSERT_EQ(copiedArray.allocator(), nullptr);
+	ASSERT_EQ(allocator.numAllocations(), 1u);
+	nctl::Array<int> movedArray(nctl::move(array));
+	ASSERT_EQ(movedArray.allocator(), &allocator);
+	ASSERT_EQ(allocator.numAllocations(), 1u);
+
+	for (unsigned int i = 0; i < Capacity; i++)
+		ASSERT_EQ(movedArray[i], copiedArray[i]);
+}
+
+TEST(AllocatorContainersTest, CopyArrayWithAllocator)
+{
+	nctl::MallocAllocator allocator("ArrayMallocAllocator");
+	nctl::Array<int> array(Capacity);
+	for (unsigned int i = 0; i < Capacity; i++)
+		array.pushBack(i);
+
+	printf("Copy constructing an array with an explicit allocator\n");
+	nctl::Array<int> copiedArray(array, allocator);
+	ASSERT_EQ(copiedArray.allocator(), &allocator);
+	ASSERT_EQ(allocator.numAllocations(), 1u);
+	for (unsigned int i = 0; i < Capacity; i++)
+		ASSERT_EQ(copiedArray[i], array[i]);
+}
+
+TEST(AllocatorContainersTest, AssignArrayKeepsAllocator)
+{
+	nctl::MallocAllocator allocator("ArrayMallocAllocator");
+	nctl::Array<int> array(Capacity);
+	for (unsigned int i = 0; i < Capacity; i++)
+		array.pushBack(i);
+
+	printf("Assigning an array to one with an allocator\n");
+	{
+		nctl::Array<int> assignedArray(allocator);
+		assignedArray = array;
+		ASSERT_EQ(assignedArray.allocator(), &allocator);
+		ASSERT_EQ(allocator.numAllocations(), 1u);
+		for (unsigned int i = 0; i < Capacity; i++)
+			ASSERT_EQ(assignedArray[i], array[i]);
+
+		array = assignedArray;
+		ASSERT_EQ(array.allocator(), nullptr);
+		ASSERT_EQ(allocator.numAllocations(), 1u);
+	}
+	ASSERT_EQ(allocator.numAllocations(), 0u);
+}
+
+TEST(AllocatorContainersTest, ArrayOfStrings)
+{
+	nctl::MallocAllocator allocator("ArrayOfStringsAllocator");
+	{
+		nctl::Array<nctl::String> array(2, allocator);
+		array.pushBack("first string");
+		array.pushBack("a second string longer than the local buffer");
+		array.pushBack("third");
+		ASSERT_STREQ(array[1].data(), "a second string longer than the local buffer");
+		ASSERT_STREQ(array[2].data(), "third");
+	}
+	ASSERT_EQ(allocator.numAllocations(), 0u);
+	ASSERT_EQ(allocator.usedMemory(), 0u);
+}
+
+TEST(AllocatorContainersTest, ListWithPoolAllocator)
+{
+	const unsigned int NumNodes = 16;
+	nctl::PoolAllocator allocator("ListPoolAllocator", sizeof(nctl::ListNode<int>), NumNodes);
+	{
+		nctl::List<int> list(allocator);
+		printf("Filling a list whose nodes are allocated by a pool allocator\n");
+		for (unsigned int i = 0; i < NumNodes; i++)
+			list.pushBack(i);
+
+		ASSERT_EQ(list.allocator(), &allocator);
+		ASSERT_EQ(allocator.numFreeBlocks(), 0u);
+
+		list.popFront();
+		list.popBack();
+		ASSERT_EQ(allocator.numFreeBlocks(), 2u);
+		list.emplaceFront(-1);
+		ASSERT_EQ(list.front(), -1);
+		ASSERT_EQ(list.size(), NumNodes - 1);
+	}
+	ASSERT_EQ(allocator.numFreeBlocks(), NumNodes);
+}
+
+TEST(AllocatorContainersTest, CopyListUsesDefaultAllocator)
+{
+	nctl::MallocAllocator allocator("ListMallocAllocator");
+	nctl::List<int> list(allocator);
+	for (unsigned int i = 0; i < Capacity; i++)
+		list.pushBack(i);
+
+	printf("Copying and assigning a list with an allocator\n");
+	nctl::List<int> copiedList(list);
+	ASSERT_EQ(copiedList.allocator(), nullptr);
+	ASSERT_EQ(allocator.numAllocations(), Capacity);
+
+	nctl::List<int> explicitList(list, allocator);
+	ASSERT_EQ(explicitList.allocator(), &allocator);
+	ASSERT_EQ(allocator.numAllocations(), Capacity * 2);
+
+	nctl::List<int> assignedList(allocator);
+	assignedList = copiedList;
+	ASSERT_EQ(assignedList.allocator(), &allocator);
+	ASSERT_EQ(allocator.numAllocations(), Capacity * 3);
+	ASSERT_EQ(assignedList.size(), Capacity);
+	ASSERT_EQ(assignedList.back(), static_cast<int>(Capacity - 1));
+
+	assignedList.clear();
+	explicitList.clear();
+	list.clear();
+	ASSERT_EQ(allocator.numAllocations(), 0u);
+}
+
+TEST(AllocatorContainersTest, StringWithAllocator)
+{
+	nctl::MallocAllocator allocator("StringMallocAllocator");
+	{
+		nctl::String shortString("short", allocator);
+		printf("A string fitting the local buffer does not allocate\n");
+		ASSERT_EQ(allocator.numAllocations(), 0u);
+
+		nctl::String string(64, allocator);
+		string = "A string that does not fit the local buffer";
+		ASSERT_EQ(string.allocator(), &allocator);
+		ASSERT_EQ(allocator.numAllocations(), 1u);
+
+		nctl::String copiedString(string);
+		ASSERT_EQ(copiedString.allocator(), nullptr);
+		ASSERT_EQ(allocator.numAllocations(), 1u);
+		ASSERT_STREQ(copiedString.data(), string.data());
+
+		nctl::String explicitString(string, allocator);
+		ASSERT_EQ(explicitString.allocator(), &allocator);
+		ASSERT_EQ(allocator.numAllocations(), 2u);
+		ASSERT_STREQ(explicitString.data(), string.data());
+
+		nctl::String cString("Another string that does not fit the local buffer", allocator);
+		ASSERT_EQ(allocator.numAllocations(), 3u);
+		cString = copiedString;
+		ASSERT_EQ(cString.allocator(), &allocator);
+		ASSERT_EQ(allocator.numAllocations(), 3u);
+	}
+	ASSERT_EQ(allocator.numAllocations(), 0u);
+	ASSERT_EQ(allocator.usedMemory(), 0u);
+}
+
+}
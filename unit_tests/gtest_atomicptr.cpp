@@ -0,0 +1,70 @@
+#include "gtest_atomic.h"
+#include "test_thread_functions.h"
+
+namespace {
+
+class AtomicPtrTest : public ::testing::Test
+{
+  public:
+	AtomicPtrTest()
+	    : counter_(0), tr_(this) {}
+
+	nctl::AtomicPtr ptr_;
+	nctl::AtomicFlag flag_;
+	int counter_;
+	ThreadRunner<NumThreads> tr_;
+};
+
+TEST_F(AtomicPtrTest, LoadAndStore)
+{
+	int value = 0;
+	printf("Storing and loading a pointer with explicit memory models\n");
+	ptr_.store(&value, nctl::AtomicPtr::MemoryModel::RELEASE);
+
+	ASSERT_EQ(ptr_.load(nctl::AtomicPtr::MemoryModel::ACQUIRE), &value);
+	ASSERT_EQ(ptr_.loadAs<int>(nctl::AtomicPtr::MemoryModel::RELAXED), &value);
+}
+
+TEST_F(AtomicPtrTest, ExchangeAndCompareExchange)
+{
+	int first = 0;
+	int second = 0;
+	printf("Exchanging pointers\n");
+
+	ASSERT_EQ(ptr_.exchange(&first), nullptr);
+	ASSERT_FALSE(ptr_.cmpExchange(&second, nullptr));
+	ASSERT_EQ(ptr_.load(), &first);
+	ASSERT_TRUE(ptr_.cmpExchange(&second, &first));
+	ASSERT_EQ(ptr_.load(), &second);
+}
+
+TEST_F(AtomicPtrTest, FlagTestAndSet)
+{
+	printf("Setting and clearing a flag\n");
+
+	ASSERT_FALSE(flag_.test());
+	ASSERT_FALSE(flag_.testAndSet());
+	ASSERT_TRUE(flag_.testAndSet());
+	ASSERT_TRUE(flag_.test());
+	flag_.clear();
+	ASSERT_FALSE(flag_.test());
+}
+
+TEST_F(AtomicPtrTest, FlagSpinLock)
+{
+	tr_.runThreads([](void *arg) -> ThreadRunner<NumThreads>::threadFuncRet {
+		AtomicPtrTest *obj = static_cast<AtomicPtrTest *>(arg);
+		for (unsigned int i = 0; i < NumIterations; i++)
+		{
+			while (obj->flag_.testAndSet(nctl::AtomicFlag::MemoryModel::ACQUIRE)) {}
+			obj->counter_++;
+			obj->flag_.clear(nctl::AtomicFlag::MemoryModel::RELEASE);
+		}
+		return obj->tr_.retFunc();
+	});
+
+	printf("Incrementing a counter protected by a flag with %u threads and %u iterations: %d\n", NumThreads, NumIterations, counter_);
+	ASSERT_EQ(counter_, NumThreads * NumIterations);
+}
+
+}
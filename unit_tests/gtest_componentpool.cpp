@@ -0,0 +1,162 @@
+#include <nctl/ComponentPool.h>
+#include <nctl/EntityRegistry.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const unsigned int Capacity = 4;
+const unsigned int MaxEntities = 64;
+const unsigned int NumEntities = 16;
+
+struct Position
+{
+	Position()
+	    : x(0), y(0) {}
+	Position(int xx, int yy)
+	    : x(xx), y(yy) {}
+
+	int x;
+	int y;
+};
+
+using PositionPool = nctl::ComponentPool<Position>;
+using VelocityPool = nctl::ComponentPool<int>;
+
+class ComponentPoolTest : public ::testing::Test
+{
+  public:
+	ComponentPoolTest()
+	    : positions_(Capacity, MaxEntities) {}
+
+  protected:
+	void SetUp() override
+	{
+		for (unsigned int i = 0; i < NumEntities; i++)
+			positions_.emplace(i, i, i * 2);
+	}
+
+	PositionPool positions_;
+};
+
+TEST_F(ComponentPoolTest, GrowWhenFull)
+{
+	printf("Size: %u, capacity: %u\n", positions_.size(), positions_.capacity());
+
+	ASSERT_EQ(positions_.size(), NumEntities);
+	ASSERT_GE(positions_.capacity(), NumEntities);
+	ASSERT_EQ(positions_.maxEntities(), MaxEntities);
+	for (unsigned int i = 0; i < NumEntities; i++)
+	{
+		ASSERT_EQ(positions_.entityAt(i), i);
+		ASSERT_EQ(positions_.componentAt(i).x, static_cast<int>(i));
+	}
+}
+
+TEST_F(ComponentPoolTest, FindComponent)
+{
+	const Position *position = positions_.find(5);
+	printf("Component of entity 5: (%d, %d)\n", position->x, position->y);
+
+	ASSERT_TRUE(positions_.contains(5));
+	ASSERT_EQ(position->x, 5);
+	ASSERT_EQ(position->y, 10);
+	ASSERT_EQ(positions_.find(NumEntities), nullptr);
+}
+
+TEST_F(ComponentPoolTest, ReplaceComponent)
+{
+	printf("Replacing the component of entity 3\n");
+	positions_.add(3, Position(-1, -2));
+
+	ASSERT_EQ(positions_.size(), NumEntities);
+	ASSERT_EQ(positions_.find(3)->x, -1);
+	ASSERT_EQ(positions_.find(3)->y, -2);
+}
+
+TEST_F(ComponentPoolTest, RemoveComponents)
+{
+	printf("Removing the component of entity 0 and 7\n");
+	ASSERT_TRUE(positions_.remove(0));
+	ASSERT_TRUE(positions_.remove(7));
+	ASSERT_FALSE(positions_.remove(7));
+
+	ASSERT_EQ(positions_.size(), NumEntities - 2);
+	ASSERT_FALSE(positions_.contains(0));
+	ASSERT_FALSE(positions_.contains(7));
+	// Entities and components should stay paired after the swaps
+	for (unsigned int i = 0; i < positions_.size(); i++)
+	{
+		const unsigned int entity = positions_.entityAt(i);
+		ASSERT_EQ(positions_.componentAt(i).x, static_cast<int>(entity));
+		ASSERT_EQ(positions_.data()[i].y, static_cast<int>(entity * 2));
+	}
+}
+
+TEST_F(ComponentPoolTest, Clear)
+{
+	printf("Clearing the pool\n");
+	positions_.clear();
+
+	ASSERT_TRUE(positions_.isEmpty());
+	ASSERT_FALSE(positions_.contains(0));
+}
+
+TEST_F(ComponentPoolTest, ForEachEntityIntersection)
+{
+	VelocityPool velocities(Capacity, MaxEntities);
+	for (unsigned int i = 0; i < NumEntities; i += 4)
+		velocities.add(i, 1);
+	velocities.add(NumEntities, 1);
+
+	unsigned int numVisited = 0;
+	nctl::forEachEntity([&numVisited](unsigned int entity, Position &position, int &velocity) {
+		position.x += velocity;
+		numVisited++;
+	}, positions_, velocities);
+	printf("Visited entities: %u\n", numVisited);
+
+	ASSERT_EQ(numVisited, NumEntities / 4);
+	for (unsigned int i = 0; i < NumEntities; i++)
+		ASSERT_EQ(positions_.find(i)->x, static_cast<int>((i % 4 == 0) ? i + 1 : i));
+}
+
+#ifndef __EMSCRIPTEN__
+TEST(ComponentPoolDeathTest, EntityOutOfRange)
+{
+	printf("Adding a component to an entity out of range\n");
+	PositionPool pool(Capacity, MaxEntities);
+	ASSERT_DEATH(pool.add(MaxEntities, Position()), "");
+}
+#endif
+
+TEST(EntityRegistryTest, CreateAndReuse)
+{
+	nctl::EntityRegistry registry(NumEntities);
+	const unsigned int first = registry.create();
+	const unsigned int second = registry.create();
+	printf("Created entities %u and %u\n", first, second);
+
+	ASSERT_EQ(registry.size(), 2u);
+	ASSERT_TRUE(registry.isAlive(second));
+	ASSERT_TRUE(registry.destroy(second));
+	ASSERT_FALSE(registry.isAlive(second));
+	ASSERT_FALSE(registry.destroy(second));
+
+	// The identifier of the destroyed entity is reused, the other one is stable
+	ASSERT_EQ(registry.create(), second);
+	ASSERT_TRUE(registry.isAlive(first));
+}
+
+TEST(EntityRegistryTest, Exhausted)
+{
+	nctl::EntityRegistry registry(NumEntities);
+	for (unsigned int i = 0; i < NumEntities; i++)
+		registry.create();
+	const unsigned int invalidEntity = nctl::EntityRegistry::InvalidEntity;
+	printf("Creating an entity after %u\n", registry.size());
+
+	ASSERT_EQ(registry.create(), invalidEntity);
+	ASSERT_EQ(registry.size(), NumEntities);
+}
+
+}
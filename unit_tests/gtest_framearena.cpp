@@ -0,0 +1,103 @@
+#include <ncine/FrameArena.h>
+#include <nctl/Array.h>
+#include "gtest/gtest.h"
+
+namespace nc = ncine;
+
+namespace {
+
+const size_t Size = 512;
+
+class FrameArenaTest : public ::testing::Test
+{
+  public:
+	FrameArenaTest()
+	    : arena_(Size) {}
+
+  protected:
+	nc::FrameArena arena_;
+};
+
+TEST_F(FrameArenaTest, Construction)
+{
+	printf("Constructing a frame arena with two buffers of %lu bytes\n", static_cast<unsigned long>(Size));
+
+	ASSERT_EQ(arena_.size(), Size);
+	ASSERT_EQ(arena_.usedMemory(), 0u);
+	ASSERT_EQ(arena_.lastFrameUsedMemory(), 0u);
+	ASSERT_EQ(arena_.peakUsedMemory(), 0u);
+	ASSERT_EQ(arena_.numOverflowFrames(), 0u);
+}
+
+TEST_F(FrameArenaTest, MemoryLastsTwoFrames)
+{
+	int *value = arena_.newObject<int>(42);
+	ASSERT_EQ(arena_.numAllocations(), 1u);
+
+	printf("Allocating in a frame and checking the memory in the next one\n");
+	arena_.swap();
+	ASSERT_EQ(*value, 42);
+	ASSERT_GE(arena_.lastFrameUsedMemory(), sizeof(int));
+	ASSERT_EQ(arena_.usedMemory(), 0u);
+
+	int *nextValue = arena_.newObject<int>(0);
+	ASSERT_NE(value, nextValue);
+
+	printf("The memory of the first frame is reused two frames later\n");
+	arena_.swap();
+	int *reusedValue = arena_.newObject<int>(0);
+	ASSERT_EQ(value, reusedValue);
+}
+
+TEST_F(FrameArenaTest, PeakUsedMemory)
+{
+	arena_.allocate(100);
+	arena_.swap();
+	arena_.allocate(300);
+	arena_.swap();
+	arena_.allocate(10);
+	arena_.swap();
+
+	printf("Peak memory used in a single frame: %lu bytes\n", static_cast<unsigned long>(arena_.peakUsedMemory()));
+	ASSERT_GE(arena_.peakUsedMemory(), 300u);
+	ASSERT_LT(arena_.peakUsedMemory(), 400u);
+}
+
+TEST_F(FrameArenaTest, Overflow)
+{
+	ASSERT_NE(arena_.allocate(Size, 1), nullptr);
+	ASSERT_EQ(arena_.allocate(1, 1), nullptr);
+	ASSERT_EQ(arena_.allocate(1, 1), nullptr);
+
+	printf("Overflowing the arena buffer\n");
+	arena_.swap();
+	ASSERT_EQ(arena_.lastFrameOverflows(), 2u);
+	ASSERT_EQ(arena_.numOverflowFrames(), 1u);
+
+	arena_.allocate(1);
+	arena_.swap();
+	ASSERT_EQ(arena_.lastFrameOverflows(), 0u);
+
+	printf("Overflowing the buffer that has already overflowed before\n");
+	ASSERT_NE(arena_.allocate(Size, 1), nullptr);
+	ASSERT_EQ(arena_.allocate(1, 1), nullptr);
+	arena_.swap();
+	ASSERT_EQ(arena_.lastFrameOverflows(), 1u);
+	ASSERT_EQ(arena_.numOverflowFrames(), 2u);
+}
+
+TEST_F(FrameArenaTest, ArrayWithArenaAllocator)
+{
+	const unsigned int Capacity = 16;
+	nctl::Array<float> array(Capacity, arena_.allocator());
+	printf("Filling an array that takes its memory from the frame arena\n");
+	for (unsigned int i = 0; i < Capacity; i++)
+		array.pushBack(static_cast<float>(i));
+
+	ASSERT_EQ(arena_.numAllocations(), 1u);
+	ASSERT_GE(arena_.usedMemory(), Capacity * sizeof(float));
+	for (unsigned int i = 0; i < Capacity; i++)
+		ASSERT_EQ(array[i], static_cast<float>(i));
+}
+
+}
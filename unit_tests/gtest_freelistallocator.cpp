@@ -0,0 +1,117 @@
+#include <nctl/FreeListAllocator.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const size_t Size = 1024;
+
+class FreeListAllocatorTest : public ::testing::Test
+{
+  public:
+	FreeListAllocatorTest()
+	    : allocator_("FreeListAllocatorTest", Size) {}
+
+  protected:
+	nctl::FreeListAllocator allocator_;
+};
+
+TEST_F(FreeListAllocatorTest, Construction)
+{
+	printf("Constructing a free list allocator of %lu bytes\n", static_cast<unsigned long>(Size));
+
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 1u);
+	ASSERT_LE(allocator_.size(), Size);
+}
+
+TEST_F(FreeListAllocatorTest, AllocateAligned)
+{
+	const uint8_t alignments[] = { 1, 2, 4, 8, 16, 32, 64 };
+	void *blocks[7];
+	unsigned int index = 0;
+	for (uint8_t alignment : alignments)
+	{
+		blocks[index] = allocator_.allocate(5, alignment);
+		printf("Allocated 5 bytes aligned to %u at %p\n", alignment, blocks[index]);
+		ASSERT_NE(blocks[index], nullptr);
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(blocks[index]) % alignment, 0u);
+		index++;
+	}
+
+	for (unsigned int i = 0; i < index; i++)
+		allocator_.deallocate(blocks[i]);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 1u);
+}
+
+TEST_F(FreeListAllocatorTest, CoalesceFreeBlocks)
+{
+	void *ptr1 = allocator_.allocate(100);
+	void *ptr2 = allocator_.allocate(100);
+	void *ptr3 = allocator_.allocate(100);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 1u);
+
+	printf("Releasing the middle block\n");
+	allocator_.deallocate(ptr2);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 2u);
+
+	printf("Releasing the first block, it should be merged with the middle one\n");
+	allocator_.deallocate(ptr1);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 2u);
+
+	printf("Releasing the last block, all the memory should be merged\n");
+	allocator_.deallocate(ptr3);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 1u);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+}
+
+TEST_F(FreeListAllocatorTest, ReuseReleasedBlock)
+{
+	void *ptr1 = allocator_.allocate(100);
+	void *ptr2 = allocator_.allocate(100);
+	allocator_.deallocate(ptr1);
+
+	printf("Allocating a block that fits in the released one\n");
+	void *ptr3 = allocator_.allocate(50);
+	ASSERT_EQ(ptr1, ptr3);
+
+	allocator_.deallocate(ptr2);
+	allocator_.deallocate(ptr3);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 1u);
+}
+
+TEST_F(FreeListAllocatorTest, OutOfMemory)
+{
+	printf("Allocating more than the allocator size\n");
+	ASSERT_EQ(allocator_.allocate(Size), nullptr);
+	ASSERT_EQ(allocator_.numFailedAllocations(), 1u);
+
+	void *ptr = allocator_.allocate(Size / 2);
+	ASSERT_NE(ptr, nullptr);
+	ASSERT_EQ(allocator_.allocate(Size / 2), nullptr);
+	allocator_.deallocate(ptr);
+}
+
+TEST_F(FreeListAllocatorTest, RandomOrderDeallocation)
+{
+	const unsigned int NumBlocks = 16;
+	void *blocks[NumBlocks];
+	for (unsigned int i = 0; i < NumBlocks; i++)
+	{
+		blocks[i] = allocator_.allocate(8 + i * 2);
+		ASSERT_NE(blocks[i], nullptr);
+	}
+
+	printf("Releasing the even blocks first, then the odd ones\n");
+	for (unsigned int i = 0; i < NumBlocks; i += 2)
+		allocator_.deallocate(blocks[i]);
+	for (unsigned int i = 1; i < NumBlocks; i += 2)
+		allocator_.deallocate(blocks[i]);
+
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numFreeBlocks(), 1u);
+}
+
+}
@@ -0,0 +1,141 @@
+#include <nctl/HashFunctions.h>
+#include <nctl/Array.h>
+#include <nctl/String.h>
+#include <nctl/algorithms.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const unsigned int NumStrings = 64 * 1024;
+const unsigned int NumBuckets = 1024;
+const unsigned int MaxLength = 40;
+const char Characters[] = "The quick brown fox jumps over the lazy dog";
+
+unsigned int countBits(nctl::hash_t value)
+{
+	unsigned int count = 0;
+	for (; value != 0; value &= value - 1)
+		count++;
+	return count;
+}
+
+/// Fills an array with the hashes of similar asset paths
+template <class HashFunc>
+void hashPaths(nctl::Array<nctl::hash_t> &hashes, HashFunc hashFunc)
+{
+	nctl::String path(64);
+	for (unsigned int i = 0; i < NumStrings; i++)
+	{
+		path.format("textures/sprites/sprite_%05u.png", i);
+		hashes.pushBack(hashFunc(path.data(), path.length()));
+	}
+}
+
+unsigned int countCollisions(nctl::Array<nctl::hash_t> &hashes)
+{
+	nctl::quicksort(hashes.begin(), hashes.end());
+	unsigned int numCollisions = 0;
+	for (unsigned int i = 1; i < hashes.size(); i++)
+	{
+		if (hashes[i] == hashes[i - 1])
+			numCollisions++;
+	}
+	return numCollisions;
+}
+
+void bucketRange(const nctl::Array<nctl::hash_t> &hashes, unsigned int &minCount, unsigned int &maxCount)
+{
+	nctl::Array<unsigned int> buckets(NumBuckets);
+	for (unsigned int i = 0; i < NumBuckets; i++)
+		buckets.pushBack(0);
+	for (unsigned int i = 0; i < hashes.size(); i++)
+		buckets[hashes[i] % NumBuckets]++;
+
+	minCount = *nctl::minElement(buckets.begin(), buckets.end());
+	maxCount = *nctl::maxElement(buckets.begin(), buckets.end());
+}
+
+TEST(HashFunctionsTest, WordHashMatchesConstexpr)
+{
+	printf("Comparing the run time and compile time word hashes up to %u characters\n", MaxLength);
+	for (unsigned int i = 0; i <= MaxLength; i++)
+		ASSERT_EQ(nctl::wordHash(Characters, i), nctl::wordHashConstexpr(Characters, i));
+
+	constexpr nctl::hash_t literalHash = nctl::wordHashConstexpr("Literal with more than eight characters", 39);
+	ASSERT_EQ(literalHash, nctl::wordHash("Literal with more than eight characters", 39));
+}
+
+TEST(HashFunctionsTest, StringHashMatchesLiteral)
+{
+	constexpr nctl::hash_t literalHash = nctl::stringHashLiteral("textures/sprite.png");
+	printf("Hash of the literal: %u\n", literalHash);
+
+	ASSERT_EQ(literalHash, nctl::stringHash("textures/sprite.png", 19));
+}
+
+TEST(HashFunctionsTest, WordHashTrailingZeros)
+{
+	const char zeros[8] = {};
+	printf("Hashing sequences of one to eight zero characters\n");
+
+	for (unsigned int i = 1; i < 8; i++)
+		ASSERT_NE(nctl::wordHash(zeros, i), nctl::wordHash(zeros, i + 1));
+}
+
+TEST(HashFunctionsTest, WordHashAvalanche)
+{
+	char chars[MaxLength];
+	unsigned long int totalFlippedBits = 0;
+	unsigned int numFlips = 0;
+	for (unsigned int i = 0; i < MaxLength; i++)
+		chars[i] = Characters[i];
+
+	for (unsigned int byte = 0; byte < MaxLength; byte++)
+	{
+		const nctl::hash_t hash = nctl::wordHash(chars, MaxLength);
+		for (unsigned int bit = 0; bit < 8; bit++)
+		{
+			chars[byte] ^= static_cast<char>(1 << bit);
+			totalFlippedBits += countBits(hash ^ nctl::wordHash(chars, MaxLength));
+			chars[byte] ^= static_cast<char>(1 << bit);
+			numFlips++;
+		}
+	}
+	const float averageFlippedBits = totalFlippedBits / static_cast<float>(numFlips);
+	printf("Average number of hash bits changed by flipping one input bit: %.2f\n", averageFlippedBits);
+
+	// Half of the bits should change on average
+	ASSERT_GT(averageFlippedBits, 14.0f);
+	ASSERT_LT(averageFlippedBits, 18.0f);
+}
+
+TEST(HashFunctionsTest, WordHashCollisions)
+{
+	nctl::Array<nctl::hash_t> hashes(NumStrings);
+	hashPaths(hashes, nctl::wordHash);
+	unsigned int minCount = 0;
+	unsigned int maxCount = 0;
+	bucketRange(hashes, minCount, maxCount);
+	const unsigned int numCollisions = countCollisions(hashes);
+	printf("Word hash of %u paths: %u collisions, buckets between %u and %u elements\n", NumStrings, numCollisions, minCount, maxCount);
+
+	// Less than one collision is expected from a random 32 bits hash
+	ASSERT_LE(numCollisions, 2u);
+	ASSERT_GT(minCount, NumStrings / NumBuckets / 2);
+	ASSERT_LT(maxCount, NumStrings / NumBuckets * 2);
+}
+
+TEST(HashFunctionsTest, FNV1aHashCollisions)
+{
+	nctl::Array<nctl::hash_t> hashes(NumStrings);
+	hashPaths(hashes, nctl::fnv1aHash);
+	unsigned int minCount = 0;
+	unsigned int maxCount = 0;
+	bucketRange(hashes, minCount, maxCount);
+	const unsigned int numCollisions = countCollisions(hashes);
+	printf("FNV-1a hash of %u paths: %u collisions, buckets between %u and %u elements\n", NumStrings, numCollisions, minCount, maxCount);
+
+	ASSERT_LE(numCollisions, 2u);
+}
+
+}
@@ -27,7 +27,11 @@ TEST_F(HashSetListStringTest, BucketSize)
 	const unsigned int bucketSize = strHashset_.bucketSize(Keys[0]);
 	printf("Bucket size for key %s: %u\n", Keys[0], bucketSize);
 
-	ASSERT_EQ(bucketSize, 3u);
+	ASSERT_EQ(bucketSize, 1u);
+
+	// The string hash function spreads every test key in a different bucket
+	for (unsigned int i = 0; i < Size; i++)
+		ASSERT_EQ(strHashset_.bucketSize(Keys[i]), 1u);
 }
 
 TEST_F(HashSetListStringTest, InsertElements)
@@ -0,0 +1,100 @@
+#include <nctl/LinearAllocator.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const size_t Size = 256;
+
+class LinearAllocatorTest : public ::testing::Test
+{
+  public:
+	LinearAllocatorTest()
+	    : allocator_("LinearAllocatorTest", Size) {}
+
+  protected:
+	nctl::LinearAllocator allocator_;
+};
+
+TEST_F(LinearAllocatorTest, Construction)
+{
+	printf("Constructing a linear allocator of %lu bytes\n", static_cast<unsigned long>(Size));
+
+	ASSERT_STREQ(allocator_.name(), "LinearAllocatorTest");
+	ASSERT_EQ(allocator_.size(), Size);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.freeMemory(), Size);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+}
+
+TEST_F(LinearAllocatorTest, AllocateAligned)
+{
+	const uint8_t alignments[] = { 1, 2, 4, 8, 16, 32 };
+	for (uint8_t alignment : alignments)
+	{
+		void *ptr = allocator_.allocate(3, alignment);
+		printf("Allocated 3 bytes aligned to %u at %p\n", alignment, ptr);
+		ASSERT_NE(ptr, nullptr);
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+	}
+
+	ASSERT_EQ(allocator_.numAllocations(), 6u);
+	ASSERT_EQ(allocator_.totalAllocations(), 6u);
+	ASSERT_GT(allocator_.usedMemory(), 6u * 3);
+}
+
+TEST_F(LinearAllocatorTest, OutOfMemory)
+{
+	void *ptr = allocator_.allocate(Size, 1);
+	ASSERT_NE(ptr, nullptr);
+	ASSERT_EQ(allocator_.freeMemory(), 0u);
+
+	printf("Allocating from an exhausted linear allocator\n");
+	void *ptr2 = allocator_.allocate(1, 1);
+	ASSERT_EQ(ptr2, nullptr);
+	ASSERT_EQ(allocator_.numFailedAllocations(), 1u);
+	ASSERT_EQ(allocator_.numAllocations(), 1u);
+}
+
+TEST_F(LinearAllocatorTest, Clear)
+{
+	void *ptr = allocator_.allocate(64);
+	allocator_.allocate(64);
+	const size_t peakMemory = allocator_.usedMemory();
+
+	printf("Clearing the linear allocator\n");
+	allocator_.clear();
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+	ASSERT_EQ(allocator_.peakUsedMemory(), peakMemory);
+
+	void *ptr2 = allocator_.allocate(64);
+	ASSERT_EQ(ptr, ptr2);
+}
+
+TEST_F(LinearAllocatorTest, NewAndDeleteArray)
+{
+	int *array = allocator_.newArray<int>(8);
+	for (int i = 0; i < 8; i++)
+	{
+		ASSERT_EQ(array[i], 0);
+		array[i] = i;
+	}
+	ASSERT_EQ(reinterpret_cast<uintptr_t>(array) % alignof(int), 0u);
+	ASSERT_EQ(allocator_.numAllocations(), 1u);
+
+	allocator_.deleteArray(array);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+}
+
+TEST_F(LinearAllocatorTest, ExternalMemory)
+{
+	uint8_t buffer[64];
+	nctl::LinearAllocator allocator("ExternalLinearAllocator", buffer, sizeof(buffer));
+	printf("Constructing a linear allocator on an external buffer\n");
+
+	uint8_t *ptr = static_cast<uint8_t *>(allocator.allocate(16, 1));
+	ASSERT_EQ(ptr, buffer);
+	ASSERT_EQ(allocator.allocate(64, 1), nullptr);
+}
+
+}
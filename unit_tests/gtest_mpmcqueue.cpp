@@ -0,0 +1,95 @@
+#include <nctl/MpmcQueue.h>
+#include "gtest/gtest.h"
+#include "test_thread_functions.h"
+
+namespace {
+
+const unsigned int Capacity = 64;
+const unsigned int NumProducers = 4;
+const unsigned int NumConsumers = 4;
+const unsigned int NumElements = 50000;
+
+class MpmcQueueTest : public ::testing::Test
+{
+  public:
+	MpmcQueueTest()
+	    : queue_(Capacity), tr_(this) {}
+
+	nctl::MpmcQueue<unsigned int> queue_;
+	nctl::Atomic32 role_;
+	nctl::Atomic32 numPopped_;
+	nctl::Atomic64 sum_;
+	ThreadRunner<NumProducers + NumConsumers> tr_;
+};
+
+TEST_F(MpmcQueueTest, PushUntilFull)
+{
+	printf("Pushing elements until the queue is full\n");
+	unsigned int numPushed = 0;
+	while (queue_.push(numPushed))
+		numPushed++;
+
+	ASSERT_EQ(numPushed, Capacity);
+	ASSERT_EQ(queue_.size(), Capacity);
+}
+
+TEST_F(MpmcQueueTest, PopInOrder)
+{
+	for (unsigned int i = 0; i < Capacity * 3; i++)
+	{
+		queue_.push(i);
+		if (i % 2 == 0)
+			continue;
+
+		unsigned int first = 0;
+		unsigned int second = 0;
+		ASSERT_TRUE(queue_.pop(first));
+		ASSERT_TRUE(queue_.pop(second));
+		ASSERT_EQ(first, i - 1);
+		ASSERT_EQ(second, i);
+	}
+	printf("Pushing and popping pairs of elements through the queue\n");
+
+	unsigned int value = 0;
+	ASSERT_FALSE(queue_.pop(value));
+	ASSERT_TRUE(queue_.isEmpty());
+}
+
+TEST_F(MpmcQueueTest, ProducersConsumersStress)
+{
+	tr_.runThreads([](void *arg) -> ThreadRunner<NumProducers + NumConsumers>::threadFuncRet {
+		MpmcQueueTest *obj = static_cast<MpmcQueueTest *>(arg);
+		const int32_t role = obj->role_.fetchAdd(1);
+		if (role < static_cast<int32_t>(NumProducers))
+		{
+			for (unsigned int i = 0; i < NumElements; i++)
+			{
+				while (obj->queue_.push(i + 1) == false) {}
+			}
+		}
+		else
+		{
+			const int32_t totalElements = NumProducers * NumElements;
+			unsigned int value = 0;
+			while (obj->numPopped_.load() < totalElements)
+			{
+				if (obj->queue_.pop(value))
+				{
+					obj->sum_.fetchAdd(value);
+					obj->numPopped_.fetchAdd(1);
+				}
+			}
+		}
+		return obj->tr_.retFunc();
+	});
+
+	const int64_t expectedSum = static_cast<int64_t>(NumProducers) * NumElements * (NumElements + 1) / 2;
+	const int32_t numPopped = numPopped_;
+	const int64_t sum = sum_;
+	printf("%u producers and %u consumers passed %d elements, sum: %lld\n", NumProducers, NumConsumers, numPopped, static_cast<long long>(sum));
+	ASSERT_EQ(numPopped, static_cast<int32_t>(NumProducers * NumElements));
+	ASSERT_EQ(sum, expectedSum);
+	ASSERT_TRUE(queue_.isEmpty());
+}
+
+}
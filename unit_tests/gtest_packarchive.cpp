@@ -0,0 +1,266 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <ncine/IFile.h>
+#include <ncine/IAudioLoader.h>
+#include <nctl/Array.h>
+#include <nctl/String.h>
+#include "gtest/gtest.h"
+
+namespace nc = ncine;
+
+namespace {
+
+const char *PackFilename = "gtest_packarchive.ncpk";
+const char *TextEntryName = "texts/entry.txt";
+const char *TextEntryData = "Pack archive entry";
+const unsigned int TextEntrySize = static_cast<unsigned int>(strlen(TextEntryData));
+
+const uint32_t Magic = 0x4B50434E;
+const uint32_t Version = 1;
+const unsigned int Alignment = 16;
+
+struct Header
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t numEntries;
+	uint32_t namesSize;
+};
+
+struct Entry
+{
+	uint32_t hash;
+	uint32_t nameOffset;
+	uint32_t compression;
+	uint32_t reserved;
+	uint64_t offset;
+	uint64_t size;
+};
+
+struct InputEntry
+{
+	InputEntry()
+	    : name(nullptr), data(nullptr), size(0) {}
+	InputEntry(const char *nn, const unsigned char *dd, unsigned long int ss)
+	    : name(nn), data(dd), size(ss) {}
+
+	const char *name;
+	const unsigned char *data;
+	unsigned long int size;
+};
+
+uint32_t hashPath(const char *path)
+{
+	uint32_t hash = 0x811C9DC5;
+	for (const unsigned char *bytes = reinterpret_cast<const unsigned char *>(path); *bytes != '\0'; bytes++)
+		hash = (*bytes ^ hash) * 0x01000193;
+	return hash;
+}
+
+/// Writes a pack archive in the same layout as the `ncpack` tool, on a little endian host
+void writePack(const char *filename, nctl::Array<InputEntry> &inputs, bool terminateNames = true)
+{
+	for (unsigned int i = 0; i < inputs.size(); i++)
+	{
+		for (unsigned int j = i + 1; j < inputs.size(); j++)
+		{
+			if (hashPath(inputs[j].name) < hashPath(inputs[i].name))
+				nctl::swap(inputs[i], inputs[j]);
+		}
+	}
+
+	nctl::String names(256);
+	nctl::Array<Entry> entries(inputs.size());
+	for (unsigned int i = 0; i < inputs.size(); i++)
+	{
+		Entry entry = {};
+		entry.hash = hashPath(inputs[i].name);
+		entry.nameOffset = names.length();
+		entry.size = inputs[i].size;
+		entries.pushBack(entry);
+		names.append(inputs[i].name);
+		if (terminateNames)
+			names.append(" ");
+	}
+	// Spaces are replaced by the terminators of every name
+	const uint32_t namesSize = names.length();
+	for (unsigned int i = 0; i < names.length(); i++)
+	{
+		if (names[i] == ' ')
+			names[i] = '\0';
+	}
+
+	const uint64_t directorySize = sizeof(Header) + entries.size() * sizeof(Entry) + namesSize;
+	uint64_t offset = (directorySize + Alignment - 1) & ~uint64_t(Alignment - 1);
+	for (unsigned int i = 0; i < entries.size(); i++)
+	{
+		entries[i].offset = offset;
+		offset = (offset + entries[i].size + Alignment - 1) & ~uint64_t(Alignment - 1);
+	}
+
+	FILE *file = fopen(filename, "wb");
+	ASSERT_NE(file, nullptr);
+	const Header header = { Magic, Version, entries.size(), namesSize };
+	fwrite(&header, sizeof(Header), 1, file);
+	fwrite(entries.data(), sizeof(Entry), entries.size(), file);
+	fwrite(names.data(), 1, namesSize, file);
+	for (unsigned int i = 0; i < entries.size(); i++)
+	{
+		fseek(file, static_cast<long int>(entries[i].offset), SEEK_SET);
+		fwrite(inputs[i].data, 1, inputs[i].size, file);
+	}
+	fclose(file);
+}
+
+void writeTextPack(const char *filename)
+{
+	nctl::Array<InputEntry> inputs;
+	inputs.pushBack(InputEntry(TextEntryName, reinterpret_cast<const unsigned char *>(TextEntryData), TextEntrySize));
+	writePack(filename, inputs);
+}
+
+class PackArchiveTest : public ::testing::Test
+{
+  protected:
+	void SetUp() override { writeTextPack(PackFilename); }
+	void TearDown() override
+	{
+		nc::IFile::unmountPacks();
+		remove(PackFilename);
+	}
+};
+
+TEST_F(PackArchiveTest, MountAndRead)
+{
+	ASSERT_TRUE(nc::IFile::mountPack(PackFilename));
+	ASSERT_EQ(nc::IFile::numMountedPacks(), 1u);
+	printf("Reading the entry \"%s\" from a mounted pack archive\n", TextEntryName);
+
+	nctl::UniquePtr<nc::IFile> fileHandle = nc::IFile::createFileHandle(TextEntryName);
+	ASSERT_EQ(fileHandle->type(), nc::IFile::FileType::MEMORY);
+	fileHandle->open(nc::IFile::OpenMode::READ | nc::IFile::OpenMode::BINARY);
+	ASSERT_TRUE(fileHandle->isOpened());
+	ASSERT_EQ(fileHandle->size(), long(TextEntrySize));
+
+	char buffer[64] = {};
+	ASSERT_EQ(fileHandle->read(buffer, sizeof(buffer)), TextEntrySize);
+	ASSERT_STREQ(buffer, TextEntryData);
+}
+
+TEST_F(PackArchiveTest, SeekReturnsZeroOnSuccess)
+{
+	ASSERT_TRUE(nc::IFile::mountPack(PackFilename));
+	nctl::UniquePtr<nc::IFile> fileHandle = nc::IFile::createFileHandle(TextEntryName);
+	fileHandle->open(nc::IFile::OpenMode::READ | nc::IFile::OpenMode::BINARY);
+	printf("Seeking inside a pack archive entry of %u bytes\n", TextEntrySize);
+
+	ASSERT_EQ(fileHandle->seek(5, SEEK_SET), 0);
+	ASSERT_EQ(fileHandle->tell(), 5);
+	ASSERT_EQ(fileHandle->seek(2, SEEK_CUR), 0);
+	ASSERT_EQ(fileHandle->tell(), 7);
+	ASSERT_EQ(fileHandle->seek(0, SEEK_END), 0);
+	ASSERT_EQ(fileHandle->tell(), long(TextEntrySize));
+
+	char buffer[8] = {};
+	ASSERT_EQ(fileHandle->seek(-5, SEEK_END), 0);
+	ASSERT_EQ(fileHandle->read(buffer, sizeof(buffer)), 5u);
+	ASSERT_STREQ(buffer, "entry");
+}
+
+TEST_F(PackArchiveTest, SeekOutOfRangeFails)
+{
+	ASSERT_TRUE(nc::IFile::mountPack(PackFilename));
+	nctl::UniquePtr<nc::IFile> fileHandle = nc::IFile::createFileHandle(TextEntryName);
+	fileHandle->open(nc::IFile::OpenMode::READ | nc::IFile::OpenMode::BINARY);
+	printf("Seeking outside of a pack archive entry\n");
+
+	ASSERT_EQ(fileHandle->seek(3, SEEK_SET), 0);
+	ASSERT_EQ(fileHandle->seek(-1, SEEK_SET), -1);
+	ASSERT_EQ(fileHandle->seek(1, SEEK_END), -1);
+	ASSERT_EQ(fileHandle->tell(), 3);
+}
+
+TEST_F(PackArchiveTest, WriteOpenFails)
+{
+	ASSERT_TRUE(nc::IFile::mountPack(PackFilename));
+	nctl::UniquePtr<nc::IFile> fileHandle = nc::IFile::createFileHandle(TextEntryName);
+	printf("Opening a pack archive entry for writing\n");
+
+	fileHandle->setExitOnFailToOpen(false);
+	fileHandle->open(nc::IFile::OpenMode::WRITE | nc::IFile::OpenMode::BINARY);
+	ASSERT_FALSE(fileHandle->isOpened());
+}
+
+TEST_F(PackArchiveTest, RejectUnterminatedName)
+{
+	nctl::Array<InputEntry> inputs;
+	inputs.pushBack(InputEntry(TextEntryName, reinterpret_cast<const unsigned char *>(TextEntryData), TextEntrySize));
+	writePack(PackFilename, inputs, false);
+	printf("Mounting a pack archive with an unterminated entry name\n");
+
+	ASSERT_FALSE(nc::IFile::mountPack(PackFilename));
+	ASSERT_EQ(nc::IFile::numMountedPacks(), 0u);
+}
+
+TEST_F(PackArchiveTest, RejectEntryOutOfArchive)
+{
+	FILE *file = fopen(PackFilename, "r+b");
+	ASSERT_NE(file, nullptr);
+	const uint64_t size = 1024 * 1024;
+	fseek(file, static_cast<long int>(sizeof(Header) + offsetof(Entry, size)), SEEK_SET);
+	fwrite(&size, sizeof(uint64_t), 1, file);
+	fclose(file);
+	printf("Mounting a pack archive with an entry exceeding the archive size\n");
+
+	ASSERT_FALSE(nc::IFile::mountPack(PackFilename));
+	ASSERT_EQ(nc::IFile::numMountedPacks(), 0u);
+}
+
+#if defined(WITH_VORBIS) && defined(NCINE_TESTS_DATA_DIR)
+TEST_F(PackArchiveTest, DecodeOggFromPack)
+{
+	const char *OggEntryName = "sounds/music.ogg";
+	const nctl::String oggFilename = nctl::String(NCINE_TESTS_DATA_DIR) + OggEntryName;
+
+	nctl::UniquePtr<nc::IFile> oggFile = nc::IFile::createFileHandle(oggFilename.data());
+	oggFile->open(nc::IFile::OpenMode::READ | nc::IFile::OpenMode::BINARY);
+	ASSERT_TRUE(oggFile->isOpened());
+	const unsigned long int oggSize = static_cast<unsigned long int>(oggFile->size());
+	nctl::UniquePtr<unsigned char[]> oggData = nctl::makeUnique<unsigned char[]>(oggSize);
+	ASSERT_EQ(oggFile->read(oggData.get(), oggSize), oggSize);
+	oggFile->close();
+
+	nctl::Array<InputEntry> inputs;
+	inputs.pushBack(InputEntry(TextEntryName, reinterpret_cast<const unsigned char *>(TextEntryData), TextEntrySize));
+	inputs.pushBack(InputEntry(OggEntryName, oggData.get(), oggSize));
+	writePack(PackFilename, inputs);
+	ASSERT_TRUE(nc::IFile::mountPack(PackFilename));
+	printf("Decoding \"%s\" from a pack archive and from the file system\n", OggEntryName);
+
+	// The Vorbis library seeks through the file callbacks to find the stream length
+	nctl::UniquePtr<nc::IAudioLoader> packLoader = nc::IAudioLoader::createFromFile(OggEntryName);
+	nctl::UniquePtr<nc::IAudioLoader> fileLoader = nc::IAudioLoader::createFromFile(oggFilename.data());
+	ASSERT_GT(packLoader->numSamples(), 0u);
+	ASSERT_EQ(packLoader->numSamples(), fileLoader->numSamples());
+	ASSERT_EQ(packLoader->numChannels(), fileLoader->numChannels());
+	ASSERT_EQ(packLoader->frequency(), fileLoader->frequency());
+
+	const unsigned long int BufferSize = 16 * 1024;
+	nctl::UniquePtr<char[]> packBuffer = nctl::makeUnique<char[]>(BufferSize);
+	nctl::UniquePtr<char[]> fileBuffer = nctl::makeUnique<char[]>(BufferSize);
+	for (unsigned int i = 0; i < 2; i++)
+	{
+		const unsigned long int bytesRead = packLoader->read(packBuffer.get(), BufferSize);
+		ASSERT_EQ(bytesRead, fileLoader->read(fileBuffer.get(), BufferSize));
+		ASSERT_GT(bytesRead, 0u);
+		ASSERT_EQ(memcmp(packBuffer.get(), fileBuffer.get(), bytesRead), 0);
+
+		packLoader->rewind();
+		fileLoader->rewind();
+	}
+}
+#endif
+
+}
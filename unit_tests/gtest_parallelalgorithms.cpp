@@ -0,0 +1,137 @@
+#include <ncine/ParallelAlgorithms.h>
+#include <nctl/Array.h>
+#include "gtest/gtest.h"
+
+namespace nc = ncine;
+
+namespace {
+
+const unsigned int Size = 10000;
+const unsigned int GrainSize = 256;
+const unsigned int NumThreads = 3;
+// Coprime with the size, to generate a permutation of its indices
+const unsigned int Multiplier = 7919;
+
+/// A fake thread pool which executes a command as soon as it is enqueued
+class ImmediateThreadPool : public nc::IThreadPool
+{
+  public:
+	void enqueueCommand(nctl::UniquePtr<nc::IThreadCommand> threadCommand) override
+	{
+		numCommands++;
+		threadCommand->execute();
+	}
+	unsigned int numThreads() const override { return NumThreads; }
+
+	unsigned int numCommands = 0;
+};
+
+class ParallelAlgorithmsTest : public ::testing::Test
+{
+  public:
+	ParallelAlgorithmsTest()
+	    : array_(Size) {}
+
+  protected:
+	void SetUp() override
+	{
+		for (unsigned int i = 0; i < Size; i++)
+			array_.pushBack(static_cast<int>((i * Multiplier) % Size));
+	}
+
+	ImmediateThreadPool threadPool_;
+	nctl::Array<int> array_;
+};
+
+TEST_F(ParallelAlgorithmsTest, RangeChunks)
+{
+	nctl::Array<int> visits(Size);
+	for (unsigned int i = 0; i < Size; i++)
+		visits.pushBack(0);
+	unsigned int numChunks = 0;
+	auto rangeFunction = [&visits, &numChunks](unsigned int begin, unsigned int end) {
+		numChunks++;
+		for (unsigned int i = begin; i < end; i++)
+			visits[i]++;
+	};
+	nc::ParallelRange::run(threadPool_, Size, GrainSize, rangeFunction);
+	printf("Chunks: %u, commands: %u\n", numChunks, threadPool_.numCommands);
+
+	ASSERT_EQ(numChunks, (Size + GrainSize - 1) / GrainSize);
+	ASSERT_EQ(threadPool_.numCommands, NumThreads);
+	for (unsigned int i = 0; i < Size; i++)
+		ASSERT_EQ(visits[i], 1);
+}
+
+TEST_F(ParallelAlgorithmsTest, ForEach)
+{
+	printf("Doubling every element\n");
+	nc::parallelForEach(threadPool_, array_.begin(), array_.end(), [](int &value) { value *= 2; }, GrainSize);
+
+	for (unsigned int i = 0; i < Size; i++)
+		ASSERT_EQ(array_[i], static_cast<int>(((i * Multiplier) % Size) * 2));
+}
+
+TEST_F(ParallelAlgorithmsTest, Transform)
+{
+	nctl::Array<int> result(Size);
+	for (unsigned int i = 0; i < Size; i++)
+		result.pushBack(0);
+	printf("Negating every element into a new array\n");
+	nctl::Array<int>::Iterator resultEnd = nc::parallelTransform(threadPool_, array_.begin(), array_.end(), result.begin(),
+	                                                             nctl::Negate<int>, GrainSize);
+
+	ASSERT_TRUE(resultEnd == result.end());
+	for (unsigned int i = 0; i < Size; i++)
+		ASSERT_EQ(result[i], -array_[i]);
+}
+
+TEST_F(ParallelAlgorithmsTest, Reduce)
+{
+	const long int sum = nc::parallelReduce(threadPool_, array_.begin(), array_.end(), 10L,
+	                                        [](long int a, long int b) { return a + b; }, GrainSize);
+	printf("Sum of the elements plus ten: %ld\n", sum);
+
+	ASSERT_EQ(sum, 10L + static_cast<long int>(Size) * (Size - 1) / 2);
+}
+
+TEST_F(ParallelAlgorithmsTest, Sort)
+{
+	printf("Sorting the array\n");
+	nc::parallelSort(threadPool_, array_.begin(), array_.end());
+
+	ASSERT_GT(threadPool_.numCommands, 0u);
+	for (unsigned int i = 0; i < Size; i++)
+		ASSERT_EQ(array_[i], static_cast<int>(i));
+}
+
+TEST_F(ParallelAlgorithmsTest, SortDescendingWithSmallRuns)
+{
+	printf("Sorting the array in descending order\n");
+	nc::parallelSort(threadPool_, array_.begin(), array_.end(), nctl::IsGreater<int>, 100);
+
+	for (unsigned int i = 0; i < Size; i++)
+		ASSERT_EQ(array_[i], static_cast<int>(Size - 1 - i));
+}
+
+TEST_F(ParallelAlgorithmsTest, SortWithNullThreadPool)
+{
+	nc::NullThreadPool nullThreadPool;
+	printf("Sorting the array without worker threads\n");
+	nc::parallelSort(nullThreadPool, array_.begin(), array_.end(), nctl::IsLess<int>, GrainSize);
+
+	ASSERT_TRUE(nctl::isSorted(array_.begin(), array_.end()));
+}
+
+TEST_F(ParallelAlgorithmsTest, SerialBelowGrainSize)
+{
+	printf("Sorting and reducing the array with a grain size larger than it\n");
+	nc::parallelSort(threadPool_, array_.begin(), array_.end(), nctl::IsLess<int>, Size);
+	const int maximum = nc::parallelReduce(threadPool_, array_.begin(), array_.end(), 0, [](int a, int b) { return nctl::max(a, b); }, Size);
+
+	ASSERT_EQ(threadPool_.numCommands, 0u);
+	ASSERT_TRUE(nctl::isSorted(array_.begin(), array_.end()));
+	ASSERT_EQ(maximum, static_cast<int>(Size - 1));
+}
+
+}
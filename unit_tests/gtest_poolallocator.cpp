@@ -0,0 +1,79 @@
+#include <nctl/PoolAllocator.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const size_t BlockSize = 24;
+const unsigned int NumBlocks = 8;
+
+class PoolAllocatorTest : public ::testing::Test
+{
+  public:
+	PoolAllocatorTest()
+	    : allocator_("PoolAllocatorTest", BlockSize, NumBlocks) {}
+
+  protected:
+	nctl::PoolAllocator allocator_;
+};
+
+TEST_F(PoolAllocatorTest, Construction)
+{
+	printf("Constructing a pool allocator of %u blocks of %lu bytes\n", NumBlocks, static_cast<unsigned long>(BlockSize));
+
+	ASSERT_EQ(allocator_.numBlocks(), NumBlocks);
+	ASSERT_EQ(allocator_.numFreeBlocks(), NumBlocks);
+	ASSERT_GE(allocator_.blockSize(), BlockSize);
+	ASSERT_EQ(allocator_.blockSize() % nctl::IAllocator::DefaultAlignment, 0u);
+	ASSERT_EQ(allocator_.size(), allocator_.blockSize() * NumBlocks);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+}
+
+TEST_F(PoolAllocatorTest, AllocateAllBlocks)
+{
+	void *blocks[NumBlocks];
+	for (unsigned int i = 0; i < NumBlocks; i++)
+	{
+		blocks[i] = allocator_.allocate(BlockSize);
+		ASSERT_NE(blocks[i], nullptr);
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(blocks[i]) % nctl::IAllocator::DefaultAlignment, 0u);
+		for (unsigned int j = 0; j < i; j++)
+			ASSERT_NE(blocks[i], blocks[j]);
+	}
+	ASSERT_EQ(allocator_.numFreeBlocks(), 0u);
+	ASSERT_EQ(allocator_.usedMemory(), allocator_.size());
+
+	printf("Allocating from an exhausted pool\n");
+	ASSERT_EQ(allocator_.allocate(BlockSize), nullptr);
+	ASSERT_EQ(allocator_.numFailedAllocations(), 1u);
+
+	for (unsigned int i = 0; i < NumBlocks; i++)
+		allocator_.deallocate(blocks[i]);
+	ASSERT_EQ(allocator_.numFreeBlocks(), NumBlocks);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+}
+
+TEST_F(PoolAllocatorTest, ReuseReleasedBlock)
+{
+	void *ptr1 = allocator_.allocate(BlockSize);
+	void *ptr2 = allocator_.allocate(BlockSize);
+
+	printf("Releasing a block and allocating a new one\n");
+	allocator_.deallocate(ptr1);
+	void *ptr3 = allocator_.allocate(BlockSize);
+	ASSERT_EQ(ptr1, ptr3);
+
+	allocator_.deallocate(ptr2);
+	allocator_.deallocate(ptr3);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+	ASSERT_EQ(allocator_.totalAllocations(), 3u);
+}
+
+TEST_F(PoolAllocatorTest, SmallerAllocation)
+{
+	void *ptr = allocator_.allocate(1, 1);
+	ASSERT_NE(ptr, nullptr);
+	ASSERT_EQ(allocator_.usedMemory(), allocator_.blockSize());
+	allocator_.deallocate(ptr);
+}
+
+}
@@ -0,0 +1,166 @@
+#include "gtest_smallarray.h"
+
+namespace {
+
+class SmallArrayTest : public ::testing::Test
+{
+  protected:
+	SmallArrayTestType array_;
+};
+
+TEST_F(SmallArrayTest, InlineCapacity)
+{
+	printf("Inline capacity: %u\n", array_.capacity());
+
+	ASSERT_TRUE(array_.isInline());
+	ASSERT_EQ(array_.capacity(), InlineCapacity);
+	ASSERT_EQ(SmallArrayTestType::inlineCapacity(), InlineCapacity);
+}
+
+TEST_F(SmallArrayTest, FillInline)
+{
+	printf("Filling the inline storage\n");
+	initArray(array_, InlineCapacity);
+	printArray(array_);
+
+	ASSERT_TRUE(array_.isInline());
+	ASSERT_EQ(array_.size(), InlineCapacity);
+	ASSERT_TRUE(isUnmodified(array_, InlineCapacity));
+}
+
+TEST_F(SmallArrayTest, SpillToHeap)
+{
+	printf("Adding more elements than the inline capacity\n");
+	initArray(array_, Capacity);
+	printArray(array_);
+
+	ASSERT_FALSE(array_.isInline());
+	ASSERT_EQ(array_.size(), Capacity);
+	ASSERT_GE(array_.capacity(), Capacity);
+	ASSERT_TRUE(isUnmodified(array_, Capacity));
+}
+
+TEST_F(SmallArrayTest, ConstructWithCapacity)
+{
+	SmallArrayTestType array(Capacity);
+	printf("Constructing with a capacity bigger than the inline one: %u\n", array.capacity());
+
+	ASSERT_FALSE(array.isInline());
+	ASSERT_EQ(array.capacity(), Capacity);
+	ASSERT_EQ(array.size(), 0u);
+}
+
+TEST_F(SmallArrayTest, ShrinkBackInline)
+{
+	initArray(array_, Capacity);
+	array_.setSize(InlineCapacity - 1);
+	printf("Shrinking to fit the inline storage\n");
+	array_.shrinkToFit();
+	printArray(array_);
+
+	ASSERT_TRUE(array_.isInline());
+	ASSERT_EQ(array_.capacity(), InlineCapacity);
+	ASSERT_TRUE(isUnmodified(array_, InlineCapacity - 1));
+}
+
+TEST_F(SmallArrayTest, SetCapacityNotBelowInline)
+{
+	printf("Setting a capacity smaller than the inline one\n");
+	initArray(array_, Capacity);
+	array_.setCapacity(InlineCapacity / 2);
+	printArray(array_);
+
+	ASSERT_TRUE(array_.isInline());
+	ASSERT_EQ(array_.capacity(), InlineCapacity);
+	ASSERT_EQ(array_.size(), InlineCapacity);
+	ASSERT_TRUE(isUnmodified(array_, InlineCapacity));
+}
+
+TEST_F(SmallArrayTest, InsertAndRemove)
+{
+	initArray(array_, InlineCapacity);
+	printf("Inserting an element at the front and removing two from the middle\n");
+	array_.insertAt(0, -1);
+	array_.removeRange(1, 3);
+	printArray(array_);
+
+	ASSERT_FALSE(array_.isInline());
+	ASSERT_EQ(array_.size(), InlineCapacity - 1);
+	ASSERT_EQ(array_[0], -1);
+	ASSERT_EQ(array_[1], 2);
+	ASSERT_EQ(array_[2], 3);
+}
+
+TEST_F(SmallArrayTest, CopyConstruction)
+{
+	initArray(array_, Capacity);
+	printf("Creating a new array with copy construction\n");
+	SmallArrayTestType newArray(array_);
+	printArray(newArray);
+
+	ASSERT_EQ(newArray.size(), array_.size());
+	ASSERT_TRUE(isUnmodified(newArray, Capacity));
+	ASSERT_NE(newArray.data(), array_.data());
+}
+
+TEST_F(SmallArrayTest, AssignmentOperator)
+{
+	initArray(array_, InlineCapacity);
+	printf("Creating a new array with the assignment operator\n");
+	SmallArrayTestType newArray;
+	initArray(newArray, Capacity);
+	newArray = array_;
+	printArray(newArray);
+
+	ASSERT_EQ(newArray.size(), InlineCapacity);
+	ASSERT_TRUE(isUnmodified(newArray, InlineCapacity));
+}
+
+TEST_F(SmallArrayTest, MoveConstructionFromHeap)
+{
+	initArray(array_, Capacity);
+	const int *heapData = array_.data();
+	printf("Creating a new array with move construction from the heap\n");
+	SmallArrayTestType newArray(nctl::move(array_));
+	printArray(newArray);
+
+	ASSERT_EQ(newArray.data(), heapData);
+	ASSERT_TRUE(isUnmodified(newArray, Capacity));
+	ASSERT_EQ(array_.size(), 0u);
+	ASSERT_TRUE(array_.isInline());
+}
+
+TEST_F(SmallArrayTest, MoveAssignmentInline)
+{
+	initArray(array_, InlineCapacity);
+	printf("Creating a new array with the move assignment operator from the inline storage\n");
+	SmallArrayTestType newArray;
+	newArray = nctl::move(array_);
+	printArray(newArray);
+
+	ASSERT_TRUE(newArray.isInline());
+	ASSERT_TRUE(isUnmodified(newArray, InlineCapacity));
+	ASSERT_EQ(array_.size(), 0u);
+}
+
+TEST_F(SmallArrayTest, Iterate)
+{
+	initArray(array_, Capacity);
+	printf("Iterating through the elements\n");
+
+	int value = FirstElement;
+	for (int element : array_)
+		ASSERT_EQ(element, value++);
+	ASSERT_EQ(value, static_cast<int>(Capacity));
+}
+
+#ifndef __EMSCRIPTEN__
+TEST(SmallArrayDeathTest, AccessBeyondSize)
+{
+	printf("Trying to access an element beyond the size\n");
+	SmallArrayTestType array;
+	ASSERT_DEATH(array.at(1), "");
+}
+#endif
+
+}
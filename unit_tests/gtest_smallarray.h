@@ -0,0 +1,48 @@
+#ifndef GTEST_SMALLARRAY_H
+#define GTEST_SMALLARRAY_H
+
+#include <nctl/SmallArray.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const unsigned int InlineCapacity = 4;
+const unsigned int Capacity = 10;
+const int FirstElement = 0;
+
+using SmallArrayTestType = nctl::SmallArray<int, InlineCapacity>;
+
+void printArray(const SmallArrayTestType &array)
+{
+	printf("Size %u (%s): ", array.size(), array.isInline() ? "inline" : "heap");
+	for (unsigned int i = 0; i < array.size(); i++)
+		printf("[%u]=%d ", i, array[i]);
+	printf("\n");
+}
+
+void initArray(SmallArrayTestType &array, unsigned int size)
+{
+	int value = FirstElement;
+
+	for (unsigned int i = 0; i < size; i++)
+		array[i] = value++;
+}
+
+bool isUnmodified(const SmallArrayTestType &array, unsigned int size)
+{
+	int value = FirstElement;
+
+	for (unsigned int i = 0; i < size; i++)
+	{
+		if (array[i] != value)
+			return false;
+
+		value++;
+	}
+
+	return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,172 @@
+#include "gtest_smallarray.h"
+#include "test_movable.h"
+
+namespace {
+
+class SmallArrayMovableTest : public ::testing::Test
+{
+  protected:
+	nctl::SmallArray<Movable, InlineCapacity> array_;
+};
+
+#if !TEST_MOVABLE_ONLY
+TEST_F(SmallArrayMovableTest, PushBackLValue)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Inserting a complex object at the back\n");
+	array_.pushBack(movable);
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), array_[0].size());
+	ASSERT_NE(movable.data(), nullptr);
+}
+#endif
+
+TEST_F(SmallArrayMovableTest, PushBackRValue)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Move inserting a complex object at the back\n");
+	array_.pushBack(nctl::move(movable));
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), 0);
+	ASSERT_EQ(movable.data(), nullptr);
+}
+
+TEST_F(SmallArrayMovableTest, EmplaceBack)
+{
+	printf("Emplacing a complex object at the back\n");
+	array_.emplaceBack(Movable::Construction::INITIALIZED);
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+}
+
+#if !TEST_MOVABLE_ONLY
+TEST_F(SmallArrayMovableTest, InsertLValue)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Inserting a complex object at the back\n");
+	array_.insertAt(0, movable);
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), array_[0].size());
+	ASSERT_NE(movable.data(), nullptr);
+}
+#endif
+
+TEST_F(SmallArrayMovableTest, InsertRValue)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Move inserting a complex object at the back\n");
+	array_.insertAt(0, nctl::move(movable));
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), 0);
+	ASSERT_EQ(movable.data(), nullptr);
+}
+
+TEST_F(SmallArrayMovableTest, EmplaceAt)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Emplacing a complex object at the back\n");
+	array_.emplaceAt(0, Movable::Construction::INITIALIZED);
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), array_[0].size());
+	ASSERT_NE(movable.data(), nullptr);
+}
+
+#if !TEST_MOVABLE_ONLY
+TEST_F(SmallArrayMovableTest, InsertLValueAtBackWithIterator)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Inserting a complex object at the back\n");
+	array_.insert(array_.end(), movable);
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), array_[0].size());
+	ASSERT_NE(movable.data(), nullptr);
+}
+#endif
+
+TEST_F(SmallArrayMovableTest, InsertRValueAtBackWithIterator)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Move inserting a complex object at the back\n");
+	array_.insert(array_.end(), nctl::move(movable));
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), 0);
+	ASSERT_EQ(movable.data(), nullptr);
+}
+
+TEST_F(SmallArrayMovableTest, EmplaceAtBackWithIterator)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	printf("Emplacing a complex object at the back\n");
+	array_.emplace(array_.end(), Movable::Construction::INITIALIZED);
+
+	array_[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 1);
+	ASSERT_EQ(movable.size(), array_[0].size());
+	ASSERT_NE(movable.data(), nullptr);
+}
+
+TEST_F(SmallArrayMovableTest, MoveConstruction)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	array_.pushBack(nctl::move(movable));
+	printf("Creating a new array with move construction\n");
+	nctl::SmallArray<Movable, InlineCapacity> newArray(nctl::move(array_));
+
+	newArray[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 0);
+	ASSERT_EQ(newArray.size(), 1);
+}
+
+TEST_F(SmallArrayMovableTest, MoveAssignmentOperator)
+{
+	Movable movable(Movable::Construction::INITIALIZED);
+	array_.pushBack(nctl::move(movable));
+	printf("Creating a new array with the move assignment operator\n");
+	nctl::SmallArray<Movable, InlineCapacity> newArray;
+	newArray = nctl::move(array_);
+
+	newArray[0].printAndAssert();
+	ASSERT_EQ(array_.size(), 0);
+	ASSERT_EQ(newArray.size(), 1);
+}
+
+TEST_F(SmallArrayMovableTest, SpillToHeap)
+{
+	printf("Move inserting more complex objects than the inline capacity\n");
+	for (unsigned int i = 0; i < Capacity; i++)
+		array_.pushBack(Movable(Movable::Construction::INITIALIZED));
+
+	ASSERT_FALSE(array_.isInline());
+	ASSERT_EQ(array_.size(), Capacity);
+	for (unsigned int i = 0; i < Capacity; i++)
+		array_[i].printAndAssert();
+}
+
+TEST_F(SmallArrayMovableTest, MoveConstructionFromHeap)
+{
+	for (unsigned int i = 0; i < Capacity; i++)
+		array_.pushBack(Movable(Movable::Construction::INITIALIZED));
+	printf("Creating a new array with move construction from the heap\n");
+	nctl::SmallArray<Movable, InlineCapacity> newArray(nctl::move(array_));
+
+	newArray[Capacity - 1].printAndAssert();
+	ASSERT_EQ(array_.size(), 0);
+	ASSERT_EQ(newArray.size(), Capacity);
+}
+
+}
@@ -0,0 +1,99 @@
+#include <nctl/SpscQueue.h>
+#include "gtest/gtest.h"
+#include "test_thread_functions.h"
+
+namespace {
+
+const unsigned int Capacity = 10;
+const unsigned int NumElements = 100000;
+
+class SpscQueueTest : public ::testing::Test
+{
+  public:
+	SpscQueueTest()
+	    : queue_(Capacity), numErrors_(0), tr_(this) {}
+
+	nctl::SpscQueue<unsigned int> queue_;
+	nctl::Atomic32 role_;
+	unsigned int numErrors_;
+	ThreadRunner<2> tr_;
+};
+
+TEST_F(SpscQueueTest, CapacityIsPowerOfTwo)
+{
+	printf("Requested capacity: %u, actual capacity: %u\n", Capacity, queue_.capacity());
+
+	ASSERT_EQ(queue_.capacity(), 16u);
+	ASSERT_TRUE(queue_.isEmpty());
+}
+
+TEST_F(SpscQueueTest, PushUntilFull)
+{
+	printf("Pushing elements until the queue is full\n");
+	unsigned int numPushed = 0;
+	while (queue_.push(numPushed))
+		numPushed++;
+
+	ASSERT_EQ(numPushed, queue_.capacity());
+	ASSERT_EQ(queue_.size(), queue_.capacity());
+}
+
+TEST_F(SpscQueueTest, PopInOrder)
+{
+	for (unsigned int i = 0; i < Capacity; i++)
+		queue_.push(i);
+
+	printf("Popping elements in insertion order\n");
+	unsigned int value = 0;
+	for (unsigned int i = 0; i < Capacity; i++)
+	{
+		ASSERT_TRUE(queue_.pop(value));
+		ASSERT_EQ(value, i);
+	}
+	ASSERT_FALSE(queue_.pop(value));
+	ASSERT_TRUE(queue_.isEmpty());
+}
+
+TEST_F(SpscQueueTest, WrapAround)
+{
+	printf("Pushing and popping more elements than the capacity\n");
+	unsigned int value = 0;
+	for (unsigned int i = 0; i < Capacity * 10; i++)
+	{
+		ASSERT_TRUE(queue_.push(i));
+		ASSERT_TRUE(queue_.pop(value));
+		ASSERT_EQ(value, i);
+	}
+	ASSERT_TRUE(queue_.isEmpty());
+}
+
+TEST_F(SpscQueueTest, ProducerConsumerStress)
+{
+	tr_.runThreads([](void *arg) -> ThreadRunner<2>::threadFuncRet {
+		SpscQueueTest *obj = static_cast<SpscQueueTest *>(arg);
+		if (obj->role_.fetchAdd(1) == 0)
+		{
+			for (unsigned int i = 0; i < NumElements; i++)
+			{
+				while (obj->queue_.push(i) == false) {}
+			}
+		}
+		else
+		{
+			unsigned int value = 0;
+			for (unsigned int i = 0; i < NumElements; i++)
+			{
+				while (obj->queue_.pop(value) == false) {}
+				if (value != i)
+					obj->numErrors_++;
+			}
+		}
+		return obj->tr_.retFunc();
+	});
+
+	printf("Passing %u elements from a producer to a consumer thread, errors: %u\n", NumElements, numErrors_);
+	ASSERT_EQ(numErrors_, 0u);
+	ASSERT_TRUE(queue_.isEmpty());
+}
+
+}
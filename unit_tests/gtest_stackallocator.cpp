@@ -0,0 +1,109 @@
+#include <nctl/StackAllocator.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const size_t Size = 256;
+
+class StackAllocatorTest : public ::testing::Test
+{
+  public:
+	StackAllocatorTest()
+	    : allocator_("StackAllocatorTest", Size) {}
+
+  protected:
+	nctl::StackAllocator allocator_;
+};
+
+TEST_F(StackAllocatorTest, Construction)
+{
+	printf("Constructing a stack allocator of %lu bytes\n", static_cast<unsigned long>(Size));
+
+	ASSERT_STREQ(allocator_.name(), "StackAllocatorTest");
+	ASSERT_EQ(allocator_.size(), Size);
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+}
+
+TEST_F(StackAllocatorTest, AllocateAligned)
+{
+	const uint8_t alignments[] = { 1, 2, 4, 8, 16, 32 };
+	for (uint8_t alignment : alignments)
+	{
+		void *ptr = allocator_.allocate(3, alignment);
+		printf("Allocated 3 bytes aligned to %u at %p\n", alignment, ptr);
+		ASSERT_NE(ptr, nullptr);
+		ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+	}
+	ASSERT_EQ(allocator_.numAllocations(), 6u);
+}
+
+TEST_F(StackAllocatorTest, DeallocateInReverseOrder)
+{
+	void *ptr1 = allocator_.allocate(10);
+	const size_t usedMemory1 = allocator_.usedMemory();
+	void *ptr2 = allocator_.allocate(20);
+	void *ptr3 = allocator_.allocate(30);
+	ASSERT_EQ(allocator_.numAllocations(), 3u);
+
+	printf("Releasing the blocks in reverse order\n");
+	allocator_.deallocate(ptr3);
+	allocator_.deallocate(ptr2);
+	ASSERT_EQ(allocator_.usedMemory(), usedMemory1);
+	allocator_.deallocate(ptr1);
+
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+	ASSERT_GT(allocator_.peakUsedMemory(), 60u);
+}
+
+TEST_F(StackAllocatorTest, ReuseReleasedMemory)
+{
+	void *ptr = allocator_.allocate(32);
+	allocator_.deallocate(ptr);
+
+	void *ptr2 = allocator_.allocate(32);
+	ASSERT_EQ(ptr, ptr2);
+	allocator_.deallocate(ptr2);
+}
+
+TEST_F(StackAllocatorTest, OutOfMemory)
+{
+	printf("Allocating more than the stack size\n");
+	void *ptr = allocator_.allocate(Size);
+	ASSERT_EQ(ptr, nullptr);
+	ASSERT_EQ(allocator_.numFailedAllocations(), 1u);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+}
+
+TEST_F(StackAllocatorTest, NewAndDeleteObject)
+{
+	struct Pair
+	{
+		Pair(int aa, double bb)
+		    : a(aa), b(bb) {}
+		int a;
+		double b;
+	};
+
+	Pair *pair = allocator_.newObject<Pair>(1, 2.0);
+	ASSERT_EQ(pair->a, 1);
+	ASSERT_EQ(pair->b, 2.0);
+	ASSERT_EQ(reinterpret_cast<uintptr_t>(pair) % alignof(Pair), 0u);
+
+	allocator_.deleteObject(pair);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+}
+
+TEST_F(StackAllocatorTest, Clear)
+{
+	allocator_.allocate(32);
+	allocator_.allocate(32);
+
+	printf("Clearing the stack allocator\n");
+	allocator_.clear();
+	ASSERT_EQ(allocator_.usedMemory(), 0u);
+	ASSERT_EQ(allocator_.numAllocations(), 0u);
+}
+
+}
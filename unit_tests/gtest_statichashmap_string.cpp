@@ -163,4 +163,26 @@ TEST_F(StaticHashMapStringTest, DoesNotContain)
 	ASSERT_FALSE(found);
 }
 
+
+TEST_F(StaticHashMapStringTest, FindWithStringView)
+{
+	const char buffer[] = "ABCD";
+	const nctl::StringView key(buffer, 2);
+	const nctl::String *value = strHashmap_.find(key, key.hash());
+	printf("Key %.*s is in the hashmap: %d - Value: %s\n", key.length(), key.data(), value != nullptr, value ? value->data() : "");
+
+	ASSERT_EQ(key.hash(), strHashmap_.hash(nctl::String(key)));
+	ASSERT_NE(value, nullptr);
+	ASSERT_STREQ(value->data(), Values[4]);
+}
+
+TEST_F(StaticHashMapStringTest, DoesNotFindWithStringView)
+{
+	const nctl::StringView key("ABC");
+	const nctl::String *value = strHashmap_.find(key, key.hash());
+	printf("Key %s is in the hashmap: %d\n", key.data(), value != nullptr);
+
+	ASSERT_EQ(value, nullptr);
+}
+
 }
@@ -141,6 +141,45 @@ TEST_F(StringTest, AccessAtLastConstCharacter)
 	ASSERT_EQ(constSting.at(constSting.length() - 1), '1');
 }
 
+TEST_F(StringTest, CachedHash)
+{
+	const nctl::hash_t hash = string_.hash();
+	printf("Hash of the string: %u\n", hash);
+
+	ASSERT_EQ(hash, nctl::stringHash(string_.data(), string_.length()));
+	ASSERT_EQ(string_.hash(), hash);
+	ASSERT_EQ(nctl::String(string_).hash(), hash);
+}
+
+TEST_F(StringTest, CachedHashInvalidatedByAppend)
+{
+	const nctl::hash_t hash = string_.hash();
+	string_ += "Appended";
+	printf("Hash of the string after appending: %u\n", string_.hash());
+
+	ASSERT_NE(string_.hash(), hash);
+	ASSERT_EQ(string_.hash(), nctl::StringView(string_).hash());
+}
+
+TEST_F(StringTest, CachedHashInvalidatedBySubscript)
+{
+	const nctl::hash_t hash = string_.hash();
+	string_[0] = 's';
+	printf("Hash of the string after changing its first character: %u\n", string_.hash());
+
+	ASSERT_NE(string_.hash(), hash);
+	ASSERT_EQ(string_.hash(), nctl::stringHash("string1", 7));
+}
+
+TEST_F(StringTest, CachedHashInvalidatedBySetLength)
+{
+	string_.hash();
+	string_.setLength(3);
+	printf("Hash of the string after setting its length: %u\n", string_.hash());
+
+	ASSERT_EQ(string_.hash(), nctl::stringHashLiteral("Str"));
+}
+
 #ifndef __EMSCRIPTEN__
 	#ifdef NCINE_DEBUG
 TEST(StringDeathTest, SubscriptAccessBeyondLastCharacter)
@@ -176,6 +176,35 @@ TEST_F(StringOperationTest, FormatAppend)
 	ASSERT_STREQ(string_.data(), "String1String2");
 }
 
+TEST_F(StringOperationTest, FormatTruncated)
+{
+	nctl::String string(32);
+	string.format("%s%s", "0123456789012345678901234567890123456789", "0123456789");
+	printString("Resetting the string to a formatted one longer than its capacity: ", string);
+
+	ASSERT_EQ(string.capacity(), 32u);
+	ASSERT_EQ(string.length(), string.capacity() - 1);
+	ASSERT_STREQ(string.data(), "0123456789012345678901234567890");
+}
+
+TEST_F(StringOperationTest, FormatAppendTruncated)
+{
+	nctl::String string(32);
+	string = "String1";
+	string.formatAppend("%s", "0123456789012345678901234567890123456789");
+	printString("Appending a formatted string that exceeds the capacity: ", string);
+
+	ASSERT_EQ(string.capacity(), 32u);
+	ASSERT_EQ(string.length(), string.capacity() - 1);
+	ASSERT_STREQ(string.data(), "String1012345678901234567890123");
+
+	string.formatAppend("%d", 2);
+	printString("Appending a formatted string to a full one: ", string);
+
+	ASSERT_EQ(string.length(), string.capacity() - 1);
+	ASSERT_STREQ(string.data(), "String1012345678901234567890123");
+}
+
 TEST_F(StringOperationTest, SetLengthShrink)
 {
 	const unsigned int length = string_.length();
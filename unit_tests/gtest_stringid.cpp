@@ -0,0 +1,129 @@
+#include <nctl/StringId.h>
+#include <nctl/String.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+TEST(StringIdTest, DefaultIsEmpty)
+{
+	const nctl::StringId id;
+	printf("Default identifier: \"%s\" (length %u)\n", id.data(), id.length());
+
+	ASSERT_TRUE(id.isEmpty());
+	ASSERT_EQ(id, nctl::StringId(""));
+}
+
+TEST(StringIdTest, EqualStringsShareData)
+{
+	const nctl::String string("uniformName");
+	const nctl::StringId first("uniformName");
+	const nctl::StringId second(string);
+	printf("First identifier: %p, second identifier: %p\n", static_cast<const void *>(first.data()), static_cast<const void *>(second.data()));
+
+	ASSERT_EQ(first, second);
+	ASSERT_EQ(first.data(), second.data());
+	ASSERT_STREQ(first.data(), "uniformName");
+}
+
+TEST(StringIdTest, DifferentStringsAreDifferent)
+{
+	const nctl::StringId first("uniformName1");
+	const nctl::StringId second("uniformName2");
+	printf("First identifier: %s, second identifier: %s\n", first.data(), second.data());
+
+	ASSERT_NE(first, second);
+}
+
+TEST(StringIdTest, InternedCharactersAreTerminated)
+{
+	const char *characters = "objectName_suffix";
+	const nctl::StringId id(nctl::StringView(characters, 10));
+	printf("Identifier from a view: \"%s\" (length %u)\n", id.data(), id.length());
+
+	ASSERT_EQ(id.length(), 10u);
+	ASSERT_STREQ(id.data(), "objectName");
+	ASSERT_EQ(id.view(), nctl::StringView("objectName"));
+}
+
+TEST(StringIdTest, HashIsPrecomputed)
+{
+	const nctl::StringId id("luaKey");
+	printf("Identifier hash: %u\n", id.hash());
+
+	ASSERT_EQ(id.hash(), nctl::String("luaKey").hash());
+	ASSERT_EQ(id.hash(), nctl::stringHashLiteral("luaKey"));
+}
+
+TEST(StringIdTest, ConstructWithLiteralHash)
+{
+	const nctl::StringId id(nctl::StringView("literalKey"), nctl::stringHashLiteral("literalKey"));
+	printf("Identifier from a literal with a compile time hash: %s\n", id.data());
+
+	ASSERT_EQ(id, nctl::StringId("literalKey"));
+}
+
+TEST(StringIdTest, FindWithoutInterning)
+{
+	const unsigned int numInterned = nctl::StringId::numInterned();
+	nctl::StringId id;
+	const bool found = nctl::StringId::find("neverInternedBefore", id);
+	printf("Looking for a string that was never interned: %d\n", found);
+
+	ASSERT_FALSE(found);
+	ASSERT_TRUE(id.isEmpty());
+	ASSERT_EQ(nctl::StringId::numInterned(), numInterned);
+}
+
+TEST(StringIdTest, FindInterned)
+{
+	const nctl::StringId interned("internedString");
+	nctl::StringId id;
+	const bool found = nctl::StringId::find("internedString", id);
+	printf("Looking for an interned string: %d\n", found);
+
+	ASSERT_TRUE(found);
+	ASSERT_EQ(id, interned);
+}
+
+TEST(StringIdTest, InternManyStrings)
+{
+	const unsigned int numStrings = 2048;
+	const unsigned int numInterned = nctl::StringId::numInterned();
+	nctl::String string(32);
+
+	for (unsigned int i = 0; i < numStrings; i++)
+	{
+		string.format("manyStrings_%u", i);
+		nctl::StringId id(string);
+	}
+	printf("Interned strings: %u, bytes: %lu\n", nctl::StringId::numInterned(), nctl::StringId::internedBytes());
+	ASSERT_EQ(nctl::StringId::numInterned(), numInterned + numStrings);
+
+	// Interning the same strings again does not add new entries
+	for (unsigned int i = 0; i < numStrings; i++)
+	{
+		string.format("manyStrings_%u", i);
+		nctl::StringId id;
+		ASSERT_TRUE(nctl::StringId::find(string, id));
+		ASSERT_STREQ(id.data(), string.data());
+	}
+	ASSERT_EQ(nctl::StringId::numInterned(), numInterned + numStrings);
+}
+
+TEST(StringIdTest, InternLongString)
+{
+	nctl::String longString(20 * 1024);
+	longString.setLength(longString.capacity() - 1);
+	for (unsigned int i = 0; i < longString.length(); i++)
+		longString[i] = 'a' + (i % 26);
+
+	const nctl::StringId id(longString);
+	const nctl::StringId smallAfterLong("smallAfterLong");
+	printf("Interned a string of length %u\n", id.length());
+
+	ASSERT_EQ(id.length(), longString.length());
+	ASSERT_EQ(id.view(), nctl::StringView(longString));
+	ASSERT_STREQ(smallAfterLong.data(), "smallAfterLong");
+}
+
+}
@@ -0,0 +1,203 @@
+#include <nctl/String.h>
+#include <nctl/StringView.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const char *Characters = "String1String2";
+
+void printView(const char *message, const nctl::StringView &view)
+{
+	printf("%s\"%.*s\" (length %u)\n", message, view.length(), view.data(), view.length());
+}
+
+TEST(StringViewTest, DefaultConstructor)
+{
+	const nctl::StringView view;
+	printView("Creating an empty view: ", view);
+
+	ASSERT_TRUE(view.isEmpty());
+	ASSERT_EQ(view.length(), 0u);
+}
+
+TEST(StringViewTest, ConstructFromCString)
+{
+	const nctl::StringView view(Characters);
+	printView("Creating a view from a C string: ", view);
+
+	ASSERT_EQ(view.length(), strlen(Characters));
+	ASSERT_EQ(view.data(), Characters);
+}
+
+TEST(StringViewTest, ConstructFromPartOfCString)
+{
+	const nctl::StringView view(Characters, 7);
+	printView("Creating a view from the first part of a C string: ", view);
+
+	ASSERT_EQ(view.length(), 7u);
+	ASSERT_EQ(view, nctl::StringView("String1"));
+}
+
+TEST(StringViewTest, ConstructFromString)
+{
+	const nctl::String string(Characters);
+	const nctl::StringView view = string;
+	printView("Creating a view from a string: ", view);
+
+	ASSERT_EQ(view.length(), string.length());
+	ASSERT_EQ(view.data(), string.data());
+}
+
+TEST(StringViewTest, SubView)
+{
+	const nctl::StringView view(Characters);
+	const nctl::StringView subView = view.subView(7, 7);
+	printView("Creating a view over the second part: ", subView);
+
+	ASSERT_EQ(subView.length(), 7u);
+	ASSERT_EQ(subView, nctl::StringView("String2"));
+}
+
+TEST(StringViewTest, SubViewClamped)
+{
+	const nctl::StringView view(Characters);
+	const nctl::StringView subView = view.subView(10, 100);
+	printView("Creating a view that goes past the end: ", subView);
+
+	ASSERT_EQ(subView.length(), 4u);
+	ASSERT_TRUE(view.subView(100).isEmpty());
+}
+
+TEST(StringViewTest, Compare)
+{
+	const nctl::StringView view("String1");
+	printf("Comparing views in lexicographical order\n");
+
+	ASSERT_EQ(view.compare("String1"), 0);
+	ASSERT_LT(view.compare("String2"), 0);
+	ASSERT_GT(view.compare("String"), 0);
+	ASSERT_LT(view.compare("String10"), 0);
+	ASSERT_TRUE(view < nctl::StringView("String2"));
+}
+
+TEST(StringViewTest, EqualityIgnoresTermination)
+{
+	const nctl::StringView view(Characters, 6);
+	printView("Comparing a view that is not null terminated: ", view);
+
+	ASSERT_TRUE(view == nctl::StringView("String"));
+	ASSERT_TRUE(view != nctl::StringView("String1"));
+}
+
+TEST(StringViewTest, FindCharacters)
+{
+	const nctl::StringView view(Characters);
+	printf("First 'S' at %d, last 'S' at %d, first 'z' at %d\n", view.findFirstChar('S'), view.findLastChar('S'), view.findFirstChar('z'));
+
+	ASSERT_EQ(view.findFirstChar('S'), 0);
+	ASSERT_EQ(view.findLastChar('S'), 7);
+	ASSERT_EQ(view.findFirstChar('z'), -1);
+}
+
+TEST(StringViewTest, FindDoesNotGoPastTheEnd)
+{
+	const nctl::StringView view(Characters, 7);
+	printView("Searching in a view over the first part: ", view);
+
+	ASSERT_EQ(view.findFirstChar('2'), -1);
+	ASSERT_EQ(view.find("String2"), -1);
+	ASSERT_EQ(view.find("ing1"), 3);
+}
+
+TEST(StringViewTest, StartsWith)
+{
+	const nctl::StringView view(Characters);
+	printView("Checking the beginning of the view: ", view);
+
+	ASSERT_TRUE(view.startsWith("String1"));
+	ASSERT_FALSE(view.startsWith("String2"));
+	ASSERT_TRUE(view.startsWith(""));
+}
+
+TEST(StringViewTest, HashMatchesStringHash)
+{
+	const nctl::StringView view(Characters, 7);
+	const nctl::String string("String1");
+	printf("View hash: %u, string hash: %u\n", view.hash(), string.hash());
+
+	ASSERT_EQ(view.hash(), string.hash());
+}
+
+TEST(StringViewTest, ConstexprHashOfLiteral)
+{
+	constexpr nctl::hash_t literalHash = nctl::stringHashLiteral("String1");
+	const nctl::StringView view("String1");
+	printf("Literal hash: %u, view hash: %u\n", literalHash, view.hash());
+
+	ASSERT_EQ(literalHash, view.hash());
+}
+
+TEST(StringViewTest, StringFromView)
+{
+	const nctl::StringView view(Characters, 7);
+	const nctl::String string(view);
+	printf("Creating a string from a view: \"%s\"\n", string.data());
+
+	ASSERT_EQ(string.length(), 7u);
+	ASSERT_STREQ(string.data(), "String1");
+	ASSERT_TRUE(string == view);
+}
+
+TEST(StringViewTest, LongStringFromView)
+{
+	nctl::String longString(64);
+	for (unsigned int i = 0; i < 4; i++)
+		longString += Characters;
+	const nctl::String string(nctl::StringView(longString.data(), 40));
+	printf("Creating a string from a view bigger than the local buffer: \"%s\"\n", string.data());
+
+	ASSERT_EQ(string.length(), 40u);
+	ASSERT_EQ(nctl::StringView(string), nctl::StringView(longString.data(), 40));
+}
+
+TEST(StringViewTest, AssignViewToString)
+{
+	nctl::String string(16);
+	string = nctl::StringView(Characters, 7);
+	printf("Assigning a view to a string: \"%s\"\n", string.data());
+
+	ASSERT_EQ(string.length(), 7u);
+	ASSERT_STREQ(string.data(), "String1");
+}
+
+TEST(StringViewTest, AssignViewToStringTruncated)
+{
+	const nctl::StringView view("String1String2String3String4");
+	nctl::String string(8);
+	string = view;
+	printf("Assigning a view to a smaller string: \"%s\"\n", string.data());
+
+	ASSERT_EQ(string.length(), string.capacity() - 1);
+	ASSERT_TRUE(view.startsWith(string));
+}
+
+TEST(StringViewTest, AssignOwnSubView)
+{
+	nctl::String string(Characters);
+	string = nctl::StringView(string).subView(7);
+	printf("Assigning a view over the string itself: \"%s\"\n", string.data());
+
+	ASSERT_STREQ(string.data(), "String2");
+}
+
+TEST(StringViewTest, AppendViewToString)
+{
+	nctl::String string(32);
+	string = "Append";
+	string += nctl::StringView(Characters, 7);
+	printf("Appending a view to a string: \"%s\"\n", string.data());
+
+	ASSERT_STREQ(string.data(), "AppendString1");
+}
+
+}
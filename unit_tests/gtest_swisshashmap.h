@@ -0,0 +1,61 @@
+#ifndef GTEST_SWISSHASHMAP_H
+#define GTEST_SWISSHASHMAP_H
+
+#include <nctl/algorithms.h>
+#include <nctl/SwissHashMap.h>
+#include <nctl/SwissHashMapIterator.h>
+#include "gtest/gtest.h"
+
+namespace {
+
+const unsigned int Capacity = 32;
+const unsigned int Size = 10;
+const int KeyValueDifference = 10;
+using SwissHashMapTestType = nctl::SwissHashMap<int, int, nctl::FixedHashFunc<int>>;
+
+template <class HashFunc>
+void initHashMap(nctl::SwissHashMap<int, int, HashFunc> &hashmap)
+{
+	for (unsigned int i = 0; i < Size; i++)
+		hashmap[i] = i + KeyValueDifference;
+}
+
+template <class HashFunc>
+void printHashMap(const nctl::SwissHashMap<int, int, HashFunc> &hashmap)
+{
+	unsigned int n = 0;
+
+	for (typename nctl::SwissHashMap<int, int, HashFunc>::ConstIterator i = hashmap.begin(); i != hashmap.end(); ++i)
+		printf("[%u] hash: %u, key: %d, value: %d\n", n++, i.hash(), i.key(), i.value());
+	printf("\n");
+}
+
+template <class HashFunc>
+unsigned int calcSize(const nctl::SwissHashMap<int, int, HashFunc> &hashmap)
+{
+	unsigned int length = 0;
+
+	for (typename nctl::SwissHashMap<int, int, HashFunc>::ConstIterator i = hashmap.begin(); i != hashmap.end(); ++i)
+		length++;
+
+	return length;
+}
+
+template <class HashFunc>
+void assertHashMapsAreEqual(const nctl::SwissHashMap<int, int, HashFunc> &hashmap1, const nctl::SwissHashMap<int, int, HashFunc> &hashmap2)
+{
+	typename nctl::SwissHashMap<int, int, HashFunc>::ConstIterator hashmap1It = hashmap1.begin();
+	typename nctl::SwissHashMap<int, int, HashFunc>::ConstIterator hashmap2It = hashmap2.begin();
+	while (hashmap1It != hashmap1.end())
+	{
+		ASSERT_EQ(hashmap1It.key(), hashmap2It.key());
+		ASSERT_EQ(*hashmap1It, *hashmap2It);
+
+		hashmap1It++;
+		hashmap2It++;
+	}
+}
+
+}
+
+#endif